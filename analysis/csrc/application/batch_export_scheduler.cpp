@@ -0,0 +1,409 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#include "analysis/csrc/application/include/batch_export_scheduler.h"
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <csignal>
+#include <iostream>
+#include <map>
+#include <thread>
+#include <tuple>
+
+#include "analysis/csrc/application/database/db_constant.h"
+#include "analysis/csrc/application/include/export_manager.h"
+#include "analysis/csrc/domain/data_process/ai_task/hash_init_processor.h"
+#include "analysis/csrc/infrastructure/db/include/db_runner.h"
+#include "analysis/csrc/infrastructure/dfx/log.h"
+#include "analysis/csrc/infrastructure/utils/admission_controller.h"
+#include "analysis/csrc/infrastructure/utils/common_constant.h"
+#include "analysis/csrc/infrastructure/utils/file.h"
+#include "analysis/csrc/infrastructure/utils/run_control.h"
+#include "analysis/csrc/infrastructure/utils/self_trace.h"
+#include "analysis/csrc/infrastructure/utils/utils.h"
+
+namespace Analysis
+{
+namespace Application
+{
+using namespace Analysis::Infra;
+using namespace Analysis::Utils;
+using Analysis::Domain::HashInitProcessor;
+namespace
+{
+const std::string DATA_DIR = "data";
+const std::string MERGED_DB_NAME = "cluster_communication.db";
+const std::string TABLE_NAME_CLUSTER_COMMUNICATION_OP = "CLUSTER_COMMUNICATION_OP";
+const int JOB_SUCCESS = 0;
+const int JOB_FAILED = 1;
+const uint32_t WAIT_JOB_INTERVAL_MS = 10;
+
+// 通信大算子中的字符串列在各rank的STRING_IDS中编号各不相同，合并前先还原为字符串
+const std::string QUERY_COMMUNICATION_SQL =
+    "SELECT COALESCE(s1.value, ''), c.startNs, c.endNs, c.connectionId, COALESCE(s2.value, ''), c.opId, c.relay, "
+    "c.retry, c.dataType, COALESCE(s3.value, ''), c.count, COALESCE(s4.value, ''), c.deviceId, c.rankSize FROM " +
+    TABLE_NAME_COMMUNICATION_OP + " c LEFT JOIN " + TABLE_NAME_STRING_IDS + " s1 ON c.opName = s1.id LEFT JOIN " +
+    TABLE_NAME_STRING_IDS + " s2 ON c.groupName = s2.id LEFT JOIN " + TABLE_NAME_STRING_IDS +
+    " s3 ON c.algType = s3.id LEFT JOIN " + TABLE_NAME_STRING_IDS + " s4 ON c.opType = s4.id";
+
+const std::vector<TableColumn> CLUSTER_COMMUNICATION_OP = {
+    {"rankIndex", SQL_INTEGER_TYPE}, {"profPath", SQL_TEXT_TYPE},   {"opName", SQL_TEXT_TYPE},
+    {"startNs", SQL_INTEGER_TYPE},   {"endNs", SQL_INTEGER_TYPE},   {"connectionId", SQL_INTEGER_TYPE},
+    {"groupName", SQL_TEXT_TYPE},    {"opId", SQL_INTEGER_TYPE},    {"relay", SQL_INTEGER_TYPE},
+    {"retry", SQL_INTEGER_TYPE},     {"dataType", SQL_INTEGER_TYPE}, {"algType", SQL_TEXT_TYPE},
+    {"count", SQL_NUMERIC_TYPE},     {"opType", SQL_TEXT_TYPE},     {"deviceId", SQL_INTEGER_TYPE},
+    {"rankSize", SQL_INTEGER_TYPE}};
+
+using CommunicationOpFormat = std::vector<std::tuple<std::string, uint64_t, uint64_t, uint64_t, std::string, uint64_t,
+    int32_t, int32_t, uint64_t, std::string, double, std::string, uint32_t, uint32_t>>;
+using ClusterCommunicationOpFormat = std::vector<std::tuple<uint32_t, std::string, std::string, uint64_t, uint64_t,
+    uint64_t, std::string, uint64_t, int32_t, int32_t, uint64_t, std::string, double, std::string, uint32_t,
+    uint32_t>>;
+
+// 目录下非隐藏普通文件的大小之和(不递归)
+uint64_t GetDirSize(const std::string &dir)
+{
+    uint64_t size = 0;
+    DIR *dp = opendir(dir.c_str());
+    if (dp == nullptr)
+    {
+        return size;
+    }
+    const struct dirent *entry = nullptr;
+    while ((entry = readdir(dp)) != nullptr)
+    {
+        if (entry->d_name[0] == '.')
+        {
+            continue;
+        }
+        auto path = File::PathJoin({dir, entry->d_name});
+        struct stat st;
+        if (stat(path.c_str(), &st) == 0 && S_ISREG(st.st_mode))
+        {
+            size += static_cast<uint64_t>(st.st_size);
+        }
+    }
+    closedir(dp);
+    return size;
+}
+}  // namespace
+
+BatchExportScheduler::BatchExportScheduler(const std::vector<std::string>& profPaths,
+                                           const BatchExportOptions& options)
+    : profPaths_(profPaths), options_(options)
+{
+    cpuBudget_ = options_.cpuBudget != 0 ? options_.cpuBudget : std::thread::hardware_concurrency();
+    cpuBudget_ = std::max(cpuBudget_, 1U);
+}
+
+const std::vector<BatchExportJob>& BatchExportScheduler::GetJobs() const
+{
+    return jobs_;
+}
+
+std::string BatchExportScheduler::GetMergedDBPath() const
+{
+    if (options_.mergedOutputPath.empty())
+    {
+        return "";
+    }
+    return File::PathJoin({options_.mergedOutputPath, MERGED_DB_NAME});
+}
+
+uint64_t BatchExportScheduler::GetDataSize(const std::string& profPath)
+{
+    // 原始数据位于host与各device目录的data子目录，已解析的db位于sqlite子目录
+    std::vector<std::string> dataDirs = File::GetFilesWithPrefix(profPath, DEVICE_PREFIX);
+    dataDirs.emplace_back(File::PathJoin({profPath, HOST}));
+    uint64_t size = 0;
+    for (const auto& dir : dataDirs)
+    {
+        size += GetDirSize(dir) + GetDirSize(File::PathJoin({dir, DATA_DIR})) +
+                GetDirSize(File::PathJoin({dir, SQLITE}));
+    }
+    return size;
+}
+
+bool BatchExportScheduler::PlanJobs()
+{
+    jobs_.clear();
+    for (size_t i = 0; i < profPaths_.size(); ++i)
+    {
+        if (!File::CheckDir(profPaths_[i]))
+        {
+            ERROR("The PROF path % is invalid.", profPaths_[i]);
+            PRINT_ERROR("The PROF path % is invalid.", profPaths_[i]);
+            return false;
+        }
+        BatchExportJob job;
+        job.profPath = profPaths_[i];
+        job.rankIndex = i;
+        job.dataSize = GetDataSize(job.profPath);
+        auto deviceNum = static_cast<uint32_t>(File::GetFilesWithPrefix(job.profPath, DEVICE_PREFIX).size());
+        job.weight = std::min(std::max(deviceNum, 1U), cpuBudget_);
+        jobs_.emplace_back(job);
+    }
+    // 数据量大的PROF最先启动，数据量相同时保持输入顺序
+    std::stable_sort(jobs_.begin(), jobs_.end(), [](const BatchExportJob& lhs, const BatchExportJob& rhs) {
+        return lhs.dataSize > rhs.dataSize;
+    });
+    return true;
+}
+
+bool BatchExportScheduler::RunJob(const BatchExportJob& job) const
+{
+    if (options_.parseStage && !options_.parseStage(job.profPath))
+    {
+        ERROR("Parse % failed.", job.profPath);
+        return false;
+    }
+    if (options_.exportStage)
+    {
+        return options_.exportStage(job.profPath);
+    }
+    ExportManager exportManager(job.profPath, options_.reportJsonPath);
+    exportManager.SetThreadLimit(job.weight);
+    return exportManager.Run(options_.exportModes);
+}
+
+pid_t BatchExportScheduler::StartJob(const BatchExportJob& job) const
+{
+    // 避免缓冲区中未输出的内容在子进程中重复输出
+    std::cout.flush();
+    std::cerr.flush();
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        // 子进程内device解析流水线的准入控制按分配给该PROF的CPU预算并发
+        setenv(ADMISSION_CPU_ENV, std::to_string(job.weight).c_str(), 1);
+        bool ret = RunJob(job);
+        // 子进程以_exit退出，不会执行析构，自身trace在此写入
+        SelfTrace::GetInstance().Flush();
+        _exit(ret ? JOB_SUCCESS : JOB_FAILED);
+    }
+    return pid;
+}
+
+pid_t BatchExportScheduler::WaitAnyJob(const std::map<pid_t, size_t>& running, int& status)
+{
+    // 只轮询本调度器fork的子进程，waitpid(-1)会回收宿主进程的其它子进程
+    for (const auto& item : running)
+    {
+        pid_t pid = waitpid(item.first, &status, WNOHANG);
+        if (pid != 0)
+        {
+            return pid;
+        }
+    }
+    return 0;
+}
+
+bool BatchExportScheduler::Schedule()
+{
+    std::map<pid_t, size_t> running;
+    uint32_t usedBudget = 0;
+    size_t next = 0;
+    auto& runControl = RunControl::GetInstance();
+    bool cancelForwarded = false;
+    while (next < jobs_.size() || !running.empty())
+    {
+        // 取消后不再启动新的PROF，并将取消转发给运行中的子进程，由子进程在任务边界退出
+        if (runControl.IsCancelled())
+        {
+            if (!cancelForwarded)
+            {
+                WARN("Batch export is cancelled, % PROF are not started.", jobs_.size() - next);
+                for (const auto& item : running)
+                {
+                    kill(item.first, SIGTERM);
+                }
+                cancelForwarded = true;
+            }
+            next = jobs_.size();
+            if (running.empty())
+            {
+                break;
+            }
+        }
+        // 严格按规划顺序启动，队首PROF的预算不足时等待运行中的PROF结束，避免大PROF被小PROF持续插队
+        while (next < jobs_.size() && (running.empty() || usedBudget + jobs_[next].weight <= cpuBudget_))
+        {
+            auto& job = jobs_[next++];
+            pid_t pid = StartJob(job);
+            if (pid < 0)
+            {
+                ERROR("Fork for % failed, errno is %.", job.profPath, errno);
+                continue;
+            }
+            INFO("Start to export %, data size is %, weight is %.", job.profPath, job.dataSize, job.weight);
+            running[pid] = next - 1;
+            usedBudget += job.weight;
+        }
+        if (running.empty())
+        {
+            continue;
+        }
+        int status = 0;
+        pid_t pid = WaitAnyJob(running, status);
+        if (pid == 0)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(WAIT_JOB_INTERVAL_MS));
+            continue;
+        }
+        if (pid < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            ERROR("Wait for export process failed, errno is %.", errno);
+            return false;
+        }
+        auto it = running.find(pid);
+        auto& job = jobs_[it->second];
+        job.success = WIFEXITED(status) && WEXITSTATUS(status) == JOB_SUCCESS;
+        usedBudget -= job.weight;
+        running.erase(it);
+        if (job.success)
+        {
+            PRINT_INFO("Export % finished.", job.profPath);
+        }
+        else
+        {
+            ERROR("Export % failed, status is %.", job.profPath, status);
+            PRINT_ERROR("Export % failed. Please check msprof_analysis_log in outputPath for more info.",
+                        job.profPath);
+        }
+    }
+    return true;
+}
+
+std::string BatchExportScheduler::GetLatestMsprofDB(const std::string& profPath)
+{
+    std::vector<std::string> files = File::GetOriginData(profPath, {DB_NAME_MSPROF_DB}, {".json", ".csv"});
+    std::string latestName;
+    std::string latestFile;
+    for (const auto& file : files)
+    {
+        // msprof_{时间戳}.db，时间戳定长，文件名最大即最新
+        auto name = File::BaseName(file);
+        if (EndsWith(name, ".db") && name > latestName)
+        {
+            latestName = name;
+            latestFile = file;
+        }
+    }
+    return latestFile;
+}
+
+bool BatchExportScheduler::MergeCommunication()
+{
+    auto mergedPath = GetMergedDBPath();
+    if (File::Exist(mergedPath) && !File::DeleteFile(mergedPath))
+    {
+        ERROR("Delete previous % failed.", mergedPath);
+        return false;
+    }
+    DBRunner mergedRunner(mergedPath);
+    if (!mergedRunner.CreateTable(TABLE_NAME_CLUSTER_COMMUNICATION_OP, CLUSTER_COMMUNICATION_OP))
+    {
+        ERROR("Create % failed.", TABLE_NAME_CLUSTER_COMMUNICATION_OP);
+        return false;
+    }
+    std::vector<const BatchExportJob*> rankJobs;
+    for (const auto& job : jobs_)
+    {
+        rankJobs.emplace_back(&job);
+    }
+    std::sort(rankJobs.begin(), rankJobs.end(), [](const BatchExportJob* lhs, const BatchExportJob* rhs) {
+        return lhs->rankIndex < rhs->rankIndex;
+    });
+    for (const auto* job : rankJobs)
+    {
+        auto dbPath = GetLatestMsprofDB(job->profPath);
+        if (!job->success || dbPath.empty())
+        {
+            WARN("Skip merging communication of %.", job->profPath);
+            continue;
+        }
+        DBRunner runner(dbPath);
+        if (!runner.CheckTableExists(TABLE_NAME_COMMUNICATION_OP))
+        {
+            continue;
+        }
+        CommunicationOpFormat opData;
+        if (!runner.QueryData(QUERY_COMMUNICATION_SQL, opData))
+        {
+            ERROR("Query communication op from % failed.", dbPath);
+            return false;
+        }
+        ClusterCommunicationOpFormat mergedData;
+        if (!Reserve(mergedData, opData.size()))
+        {
+            ERROR("Reserve for cluster communication op failed.");
+            return false;
+        }
+        auto rankIndex = static_cast<uint32_t>(job->rankIndex);
+        for (const auto& op : opData)
+        {
+            mergedData.emplace_back(rankIndex, job->profPath, std::get<0>(op), std::get<1>(op), std::get<2>(op),
+                                    std::get<3>(op), std::get<4>(op), std::get<5>(op), std::get<6>(op),
+                                    std::get<7>(op), std::get<8>(op), std::get<9>(op), std::get<10>(op),
+                                    std::get<11>(op), std::get<12>(op), std::get<13>(op));
+        }
+        if (!mergedRunner.InsertData(TABLE_NAME_CLUSTER_COMMUNICATION_OP, mergedData))
+        {
+            ERROR("Insert communication op of % failed.", job->profPath);
+            return false;
+        }
+    }
+    INFO("Merge cluster communication op into % finished.", mergedPath);
+    return true;
+}
+
+bool BatchExportScheduler::Run()
+{
+    if (!PlanJobs())
+    {
+        return false;
+    }
+    // 在fork前加载，子进程通过写时复制共享同一份hash字典
+    auto sharedNum = HashInitProcessor::ShareHashMaps(profPaths_);
+    INFO("Batch export % PROF, cpu budget is %, % hash dictionaries are preloaded.", jobs_.size(), cpuBudget_,
+         sharedNum);
+    bool ret = Schedule();
+    HashInitProcessor::ClearSharedHashMaps();
+    for (const auto& job : jobs_)
+    {
+        ret = job.success && ret;
+    }
+    if (!options_.mergedOutputPath.empty() && !MergeCommunication())
+    {
+        ERROR("Merge cluster communication op failed.");
+        ret = false;
+    }
+    return ret;
+}
+}  // namespace Application
+}  // namespace Analysis
@@ -21,7 +21,6 @@
 
 #include "analysis/csrc/application/credential/id_pool.h"
 #include "analysis/csrc/application/database/db_constant.h"
-#include "analysis/csrc/domain/data_process/ai_task/overlap_analysis_processor.h"
 #include "analysis/csrc/domain/entities/viewer_data/ai_task/include/api_data.h"
 #include "analysis/csrc/domain/entities/viewer_data/ai_task/include/ascend_task_data.h"
 #include "analysis/csrc/domain/entities/viewer_data/ai_task/include/ccu_mission_data.h"
@@ -53,7 +52,9 @@
 #include "analysis/csrc/domain/entities/viewer_data/system/include/ub_data.h"
 #include "analysis/csrc/domain/services/environment/context.h"
 #include "analysis/csrc/infrastructure/dfx/error_code.h"
+#include "analysis/csrc/infrastructure/dump_tools/include/atomic_output.h"
 #include "analysis/csrc/infrastructure/dump_tools/json_tool/include/json_writer.h"
+#include "analysis/csrc/infrastructure/utils/self_trace.h"
 #include "analysis/csrc/infrastructure/utils/thread_pool.h"
 
 namespace Analysis
@@ -1202,16 +1203,6 @@ bool SaveOSRuntimeApiData(DataInventory& dataInventory, DBInfo& msprofDB, const
 bool SaveOverlapAnalysisData(DataInventory& dataInventory, DBInfo& msprofDB, const std::string& profPath)
 {
     auto overlapData = dataInventory.GetPtr<std::vector<OverlapAnalysisData>>();
-    if (overlapData == nullptr)
-    {
-        OverlapAnalysisProcessor processor(profPath);
-        if (!processor.Run(dataInventory, PROCESSOR_NAME_OVERLAP_ANALYSIS))
-        {
-            ERROR("Process overlap analysis data failed.");
-            return false;
-        }
-        overlapData = dataInventory.GetPtr<std::vector<OverlapAnalysisData>>();
-    }
     if (overlapData == nullptr || overlapData->empty())
     {
         WARN("Overlap analysis data not exist.");
@@ -1613,7 +1604,7 @@ const std::set<std::string> DB_DATA_PROCESS_LIST{
     PROCESSOR_NAME_SOC,          PROCESSOR_NAME_NIC,           PROCESSOR_NAME_ROCE,
     PROCESSOR_NAME_QOS,          PROCESSOR_NAME_CCU_MISSION,   PROCESSOR_MC2_COMM_INFO,
     PROCESSOR_NAME_MEMCPY_INFO,  PROCESSOR_NAME_NPU_OP_MEM,    PROCESSOR_NAME_NPU_MODULE_MEM,
-    PROCESSOR_NAME_UNIFIED_PMU,
+    PROCESSOR_NAME_UNIFIED_PMU,  PROCESSOR_NAME_OVERLAP_ANALYSIS,
 };
 }  // namespace
 
@@ -1622,8 +1613,9 @@ DBAssembler::DBAssembler(const std::string& profPath, const std::string& outputP
 {
     // 当前outputPath_路径依然传递PROF路径，即db落盘路径依然是PROF目录下
     MAKE_SHARED0_NO_OPERATION(msprofDB_.database, MsprofDB);
-    auto msprofDBPath = GetDBPath(outputPath);
-    msprofDB_.ConstructDBRunner(msprofDBPath);
+    // 导出过程中写入隐藏的临时db，全部表落盘后再发布为msprof_*.db，CheckMsprofDb不会看到未完成的db
+    msprofDBPath_ = GetDBPath(outputPath);
+    msprofDB_.ConstructDBRunner(AtomicOutput::GetInstance().Stage(msprofDBPath_));
 }
 
 bool DBAssembler::Run(DataInventory& dataInventory)
@@ -1632,10 +1624,13 @@ bool DBAssembler::Run(DataInventory& dataInventory)
     PRINT_INFO("Start exporting the db!");
     if (CheckMsprofDb(outputPath_))
     {
+        AtomicOutput::GetInstance().Discard(msprofDBPath_);
         PRINT_INFO("Find completed msprof db. End exporting db output_file.");
         return true;
     }
+    AtomicOutput::GetInstance().RemoveStale(outputPath_);
 
+    auto& runControl = Utils::RunControl::GetInstance();
     std::atomic<bool> retFlag(true);
     const uint16_t processorsLimit = 10;  // 最多有10个线程
     Analysis::Utils::ThreadPool pool(processorsLimit);
@@ -1644,9 +1639,14 @@ bool DBAssembler::Run(DataInventory& dataInventory)
     for (const auto& saveFunc : DATA_SAVER)
     {
         pool.AddTask(
-            [saveFunc, &retFlag, &dataInventory, this]()
+            [saveFunc, &retFlag, &dataInventory, &runControl, this]()
             {
+                if (runControl.IsCancelled())
+                {
+                    return;
+                }
                 INFO("Begin to save % data.", saveFunc.first);
+                Utils::TraceSpan span(Utils::TRACE_CAT_SAVE, saveFunc.first, true);
                 auto flag = saveFunc.second(dataInventory, msprofDB_, profPath_);
                 if (!flag)
                 {
@@ -1659,7 +1659,23 @@ bool DBAssembler::Run(DataInventory& dataInventory)
     pool.Stop();
 
     // StringIds为id到name映射表，需要最后落盘
-    retFlag = SaveStringIdsData(dataInventory, msprofDB_, profPath_) && retFlag;
+    {
+        Utils::TraceSpan span(Utils::TRACE_CAT_SAVE, TABLE_NAME_STRING_IDS, true);
+        retFlag = SaveStringIdsData(dataInventory, msprofDB_, profPath_) && retFlag;
+    }
+    // 被取消的导出删除临时db，不留下不完整的msprof db
+    if (runControl.IsCancelled())
+    {
+        AtomicOutput::GetInstance().Discard(msprofDBPath_);
+        WARN("The db export is cancelled, no msprof db is published.");
+        PRINT_WARN("The db export is cancelled.");
+        return false;
+    }
+    if (!AtomicOutput::GetInstance().Publish(msprofDBPath_))
+    {
+        ERROR("Publish msprof db % failed.", msprofDBPath_);
+        return false;
+    }
     PRINT_INFO("End exporting db output_file. The file is stored in the PROF file.");
     return retFlag;
 }
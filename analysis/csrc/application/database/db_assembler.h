@@ -20,6 +20,7 @@
 #include "analysis/csrc/application/database/msprof_db.h"
 #include "analysis/csrc/infrastructure/data_inventory/include/data_inventory.h"
 #include "analysis/csrc/infrastructure/db/include/db_info.h"
+#include "analysis/csrc/infrastructure/utils/run_control.h"
 #include "analysis/csrc/infrastructure/utils/utils.h"
 
 namespace Analysis
@@ -40,6 +41,7 @@ class DBAssembler
    private:
     std::string profPath_;
     std::string outputPath_;
+    std::string msprofDBPath_;
     DBInfo msprofDB_;
 };
 
@@ -62,6 +64,11 @@ bool SaveData(const std::vector<std::tuple<Args...>> &data, const std::string &t
         ERROR("Msprof db runner is nullptr.");
         return false;
     }
+    if (Utils::RunControl::GetInstance().IsCancelled())
+    {
+        WARN("The export is cancelled, skip saving %.", tableName);
+        return false;
+    }
     if (!msprofDB.dbRunner->CreateTable(tableName, msprofDB.database->GetTableCols(tableName)))
     {
         ERROR("Create table: % failed", tableName);
@@ -72,6 +79,7 @@ bool SaveData(const std::vector<std::tuple<Args...>> &data, const std::string &t
         ERROR("Insert data into % failed", tableName);
         return false;
     }
+    Utils::RunControl::GetInstance().AddTableWritten();
     return true;
 }
 
@@ -16,7 +16,9 @@
 
 #include "analysis/csrc/application/include/export_manager.h"
 
+#include <algorithm>
 #include <atomic>
+#include <mutex>
 
 #include "analysis/csrc/application/database/db_assembler.h"
 #include "analysis/csrc/application/database/db_constant.h"
@@ -27,6 +29,9 @@
 #include "analysis/csrc/domain/data_process/include/data_processor_factory.h"
 #include "analysis/csrc/domain/services/environment/context.h"
 #include "analysis/csrc/infrastructure/dfx/error_code.h"
+#include "analysis/csrc/infrastructure/dump_tools/include/compressed_file_writer.h"
+#include "analysis/csrc/infrastructure/utils/run_control.h"
+#include "analysis/csrc/infrastructure/utils/stage_manifest.h"
 #include "analysis/csrc/infrastructure/utils/thread_pool.h"
 
 namespace Analysis
@@ -47,52 +52,198 @@ std::string CreateOutputPath(const std::string& profPath)
     }
     return outputPath;
 }
+
+const std::map<ExportMode, std::string> EXPORT_STAGE_NAME = {
+    {ExportMode::DB, "export_db"},
+    {ExportMode::TIMELINE, "export_timeline"},
+    {ExportMode::SUMMARY, "export_summary"},
+};
+
+// 读取其他processor产物的processor，在其余processor全部完成后再执行
+const std::set<std::string> DERIVED_PROCESS_LIST{
+    PROCESSOR_NAME_OVERLAP_ANALYSIS,
+};
 }  // namespace
 
-bool ExportManager::ProcessData(DataInventory& dataInventory, const std::set<ExportMode>& exportModeSet)
+std::shared_ptr<StageManifest> ExportManager::CreateManifest(ExportMode exportMode)
+{
+    auto it = EXPORT_STAGE_NAME.find(exportMode);
+    if (it == EXPORT_STAGE_NAME.end())
+    {
+        return nullptr;
+    }
+    std::shared_ptr<StageManifest> manifest;
+    MAKE_SHARED_RETURN_VALUE(manifest, StageManifest, nullptr, profPath_, it->second);
+    // 导出阶段的输入为host与各device解析生成的db以及采集参数文件
+    std::vector<std::string> dataDirs = File::GetFilesWithPrefix(profPath_, DEVICE_PREFIX);
+    dataDirs.emplace_back(File::PathJoin({profPath_, HOST}));
+    for (const auto& dir : dataDirs)
+    {
+        manifest->AddInputDir(dir);
+        manifest->AddInputDir(File::PathJoin({dir, SQLITE}));
+    }
+    if (!jsonPath_.empty())
+    {
+        manifest->AddInputFile(jsonPath_);
+    }
+    // 影响产物的参数：info.json/sample.json/start_info等加载到Context的采集参数、导出配置文件以及压缩格式
+    auto contextHash = StageManifest::HashString(Domain::Environment::Context::GetInstance().Dump(profPath_));
+    manifest->AddParam("context", std::to_string(contextHash));
+    manifest->AddParam("report_json", jsonPath_);
+    manifest->AddParam("compress_suffix", CompressedSink::GetInstance().GetFilePath(""));
+    return manifest;
+}
+
+void ExportManager::CommitManifest(ExportMode exportMode, StageManifest& manifest)
+{
+    static const std::map<ExportMode, std::vector<std::string>> outputSuffixes = {
+        {ExportMode::DB, {".db"}},
+        {ExportMode::TIMELINE, {".json", ".json.gz"}},
+        {ExportMode::SUMMARY, {".csv", ".csv.gz"}},
+    };
+    auto it = outputSuffixes.find(exportMode);
+    if (it == outputSuffixes.end())
+    {
+        return;
+    }
+    const std::string outputDir =
+        exportMode == ExportMode::DB ? profPath_ : File::PathJoin({profPath_, Analysis::Common::OUTPUT_PATH});
+    manifest.AddOutputsModifiedSinceBegin(outputDir, it->second);
+    manifest.Commit();
+}
+
+bool ExportManager::GetProcessListByMode(const std::set<ExportMode>& exportModeSet,
+                                         const std::vector<JsonProcess>& jsonProcesses,
+                                         std::map<ExportMode, std::set<std::string>>& modeProcessList)
+{
+    for (auto exportMode : exportModeSet)
+    {
+        switch (exportMode)
+        {
+            case ExportMode::DB:
+                modeProcessList[exportMode] = DBAssembler::GetProcessList();
+                break;
+            case ExportMode::TIMELINE:
+                // timeline只计算所选json进程依赖的processor
+                modeProcessList[exportMode] = TimelineManager::GetProcessList(jsonProcesses);
+                break;
+            case ExportMode::SUMMARY:
+                modeProcessList[exportMode] = SummaryManager::GetProcessList();
+                break;
+            default:
+                ERROR("Unsupported ExportMode: %.", static_cast<int>(exportMode));
+                return false;
+        }
+    }
+    return true;
+}
+
+void ExportManager::SetThreadLimit(uint32_t threadLimit)
+{
+    threadLimit_ = threadLimit;
+}
+
+uint32_t ExportManager::GetPoolSize(uint32_t defaultSize) const
+{
+    if (threadLimit_ == 0)
+    {
+        return defaultSize;
+    }
+    return std::max(std::min(defaultSize, threadLimit_), 1U);
+}
+
+bool ExportManager::ProcessData(DataInventory& dataInventory,
+                                const std::map<ExportMode, std::set<std::string>>& modeProcessList,
+                                const std::function<void(ExportMode, bool)>& onModeReady)
 {
     // hash数据作为其他流程的依赖数据，需要优先加载
     HashInitProcessor hashProcessor(profPath_);
     hashProcessor.Run(dataInventory, PROCESSOR_NAME_HASH);
-    const uint16_t tableProcessors = 10;  // 最多有10个线程
-    Analysis::Utils::ThreadPool pool(tableProcessors);
-    pool.Start();
-    std::atomic<bool> retFlag(true);
-    static const std::unordered_map<ExportMode, const std::set<std::string>& (*)()> processListFactory = {
-        {ExportMode::DB, &DBAssembler::GetProcessList},
-        {ExportMode::TIMELINE, &TimelineManager::GetProcessList},
-        {ExportMode::SUMMARY, &SummaryManager::GetProcessList}};
-
-    std::set<std::string> dataProcessList;
-    for (auto exportMode : exportModeSet)
+    // 统计每个processor被哪些导出模式依赖，以及每个导出模式还未完成的processor个数
+    std::map<std::string, std::vector<ExportMode>> processUsers;
+    std::map<ExportMode, size_t> pendingNum;
+    std::map<ExportMode, bool> modeSuccess;
+    for (const auto& it : modeProcessList)
+    {
+        for (const auto& name : it.second)
+        {
+            processUsers[name].emplace_back(it.first);
+        }
+        pendingNum[it.first] = it.second.size();
+        modeSuccess[it.first] = true;
+    }
+    // 不依赖任何processor的导出模式可以直接开始
+    for (const auto& it : pendingNum)
     {
-        auto it = processListFactory.find(exportMode);
-        if (it == processListFactory.end())
+        if (it.second == 0)
         {
-            ERROR("Unsupported ExportMode: %.", static_cast<int>(exportMode));
-            return false;
+            onModeReady(it.first, true);
         }
-        auto tmpSet = it->second();
-        dataProcessList.insert(tmpSet.begin(), tmpSet.end());
     }
+    INFO("There are % data processors to be executed for % export modes.", processUsers.size(),
+         modeProcessList.size());
 
-    for (const auto& name : dataProcessList)
+    const uint16_t tableProcessors = 10;  // 最多有10个线程
+    Analysis::Utils::ThreadPool pool(GetPoolSize(tableProcessors));
+    pool.Start();
+    std::atomic<bool> retFlag(true);
+    std::mutex pendingMutex;
+    auto& runControl = Utils::RunControl::GetInstance();
+    runControl.SetStage("process_data");
+    auto runProcessor = [this, &retFlag, &dataInventory, &runControl, &pendingMutex, &pendingNum, &modeSuccess,
+                         &onModeReady](const std::pair<const std::string, std::vector<ExportMode>>& users)
     {
-        pool.AddTask(
-            [this, &name, &retFlag, &dataInventory]()
+        bool ret = false;
+        if (!runControl.IsCancelled())
+        {
+            auto processor = DataProcessorFactory::GetDataProcessByName(profPath_, users.first);
+            if (processor == nullptr)
             {
-                auto processor = DataProcessorFactory::GetDataProcessByName(profPath_, name);
-                if (processor == nullptr)
-                {
-                    ERROR("% is not defined", name);
-                    retFlag = false;
-                    return;
-                }
-                retFlag = processor->Run(dataInventory, name) && retFlag;
-            });
+                ERROR("% is not defined", users.first);
+            }
+            else
+            {
+                ret = processor->Run(dataInventory, users.first);
+            }
+        }
+        retFlag = ret && retFlag;
+        // 依赖的processor全部完成后，对应的导出模式即可开始组装，无需等待其他导出模式的processor
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        for (auto exportMode : users.second)
+        {
+            modeSuccess[exportMode] = ret && modeSuccess[exportMode];
+            if (--pendingNum[exportMode] == 0)
+            {
+                onModeReady(exportMode, modeSuccess[exportMode]);
+            }
+        }
+    };
+    for (const auto& users : processUsers)
+    {
+        if (DERIVED_PROCESS_LIST.find(users.first) == DERIVED_PROCESS_LIST.end())
+        {
+            pool.AddTask([&runProcessor, &users]() { runProcessor(users); });
+        }
     }
     pool.WaitAllTasks();
     pool.Stop();
+    // 派生processor读取上一批processor注入的数据，需等上一批全部结束(Stop会join所有线程)后再执行
+    Analysis::Utils::ThreadPool derivedPool(GetPoolSize(static_cast<uint32_t>(DERIVED_PROCESS_LIST.size())));
+    derivedPool.Start();
+    for (const auto& users : processUsers)
+    {
+        if (DERIVED_PROCESS_LIST.find(users.first) != DERIVED_PROCESS_LIST.end())
+        {
+            derivedPool.AddTask([&runProcessor, &users]() { runProcessor(users); });
+        }
+    }
+    derivedPool.WaitAllTasks();
+    derivedPool.Stop();
+    if (runControl.IsCancelled())
+    {
+        WARN("The export of % is cancelled during data process.", profPath_);
+        return false;
+    }
     if (!retFlag)
     {
         ERROR("The % for data process failed to be executed.", profPath_);
@@ -145,9 +296,41 @@ bool ExportManager::Run(const std::set<ExportMode>& exportModeSet)
     {
         return false;
     }
-    DataInventory dataInventory;
-    std::atomic<bool> runFlag(true);
-    runFlag = ProcessData(dataInventory, exportModeSet);
+    // 输入与参数未变化的导出模式直接复用上次的产物
+    std::set<ExportMode> staleModeSet;
+    std::map<ExportMode, std::shared_ptr<StageManifest>> manifests;
+    for (const auto& exportMode : exportModeSet)
+    {
+        auto manifest = CreateManifest(exportMode);
+        if (manifest != nullptr && manifest->IsUpToDate())
+        {
+            INFO("The % inputs are unchanged, skip export.", manifest->GetManifestPath());
+            continue;
+        }
+        if (manifest != nullptr)
+        {
+            manifest->RemovePreviousOutputs();
+            manifest->Begin();
+            manifests[exportMode] = manifest;
+        }
+        staleModeSet.insert(exportMode);
+    }
+    if (staleModeSet.empty())
+    {
+        INFO("All export data are up to date!");
+        PRINT_INFO("All export data are up to date!");
+        return true;
+    }
+    std::vector<JsonProcess> jsonProcesses;
+    if (staleModeSet.find(ExportMode::TIMELINE) != staleModeSet.end())
+    {
+        jsonProcesses = GetProcessEnum();
+    }
+    std::map<ExportMode, std::set<std::string>> modeProcessList;
+    if (!GetProcessListByMode(staleModeSet, jsonProcesses, modeProcessList))
+    {
+        return false;
+    }
     const std::map<ExportMode, std::function<bool(DataInventory&)>> operationMap = {
         {ExportMode::DB,
          [this](DataInventory& dataInventory) -> bool
@@ -156,7 +339,7 @@ bool ExportManager::Run(const std::set<ExportMode>& exportModeSet)
              return dbAssembler.Run(dataInventory);
          }},
         {ExportMode::TIMELINE,
-         [this](DataInventory& dataInventory) -> bool
+         [this, &jsonProcesses](DataInventory& dataInventory) -> bool
          {
              std::string outputPath = CreateOutputPath(profPath_);
              if (outputPath.empty())
@@ -164,7 +347,6 @@ bool ExportManager::Run(const std::set<ExportMode>& exportModeSet)
                  return false;
              }
              TimelineManager timelineManager(profPath_, outputPath);
-             std::vector<JsonProcess> jsonProcesses = GetProcessEnum();
              return timelineManager.Run(dataInventory, jsonProcesses);
          }},
         {ExportMode::SUMMARY,
@@ -180,20 +362,51 @@ bool ExportManager::Run(const std::set<ExportMode>& exportModeSet)
          }},
     };
 
+    DataInventory dataInventory;
+    std::atomic<bool> runFlag(true);
+    auto& runControl = Utils::RunControl::GetInstance();
     const uint16_t processorsLimit = 3;  // 最多有3个线程
-    Analysis::Utils::ThreadPool pool(processorsLimit);
+    Analysis::Utils::ThreadPool pool(GetPoolSize(processorsLimit));
     pool.Start();
-    for (const auto& exportMode : exportModeSet)
+    // 导出模式依赖的processor完成后立即提交组装任务，与其余processor并行执行
+    auto onModeReady = [this, &operationMap, &manifests, &runFlag, &dataInventory, &runControl, &pool](
+                           ExportMode exportMode, bool processSuccess)
     {
         auto iter = operationMap.find(exportMode);
-        if (iter != operationMap.end())
+        if (iter == operationMap.end())
         {
-            pool.AddTask([iter, &runFlag, &dataInventory]() { runFlag = iter->second(dataInventory) && runFlag; });
+            return;
         }
-    }
+        auto manifestIter = manifests.find(exportMode);
+        auto manifest = manifestIter == manifests.end() ? nullptr : manifestIter->second;
+        pool.AddTask(
+            [this, iter, manifest, processSuccess, &runFlag, &dataInventory, &runControl]()
+            {
+                if (runControl.IsCancelled())
+                {
+                    return;
+                }
+                bool ret = iter->second(dataInventory);
+                // 被取消的导出不提交清单，下次导出重新生成产物
+                if (ret && processSuccess && manifest != nullptr && !runControl.IsCancelled())
+                {
+                    CommitManifest(iter->first, *manifest);
+                }
+                runFlag = ret && runFlag;
+            });
+    };
+    bool processFlag = ProcessData(dataInventory, modeProcessList, onModeReady);
+    // processor全部结束后不再注入数据，剩余的组装任务免锁读取
+    dataInventory.Freeze();
+    runControl.SetStage("assemble");
     pool.WaitAllTasks();
     pool.Stop();
-    return runFlag;
+    if (runControl.IsCancelled())
+    {
+        PRINT_WARN("The export of % is cancelled.", profPath_);
+        return false;
+    }
+    return processFlag && runFlag;
 }
 
 std::vector<JsonProcess> ExportManager::GetProcessEnum()
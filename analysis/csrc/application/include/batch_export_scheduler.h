@@ -0,0 +1,83 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#ifndef ANALYSIS_APPLICATION_BATCH_EXPORT_SCHEDULER_H
+#define ANALYSIS_APPLICATION_BATCH_EXPORT_SCHEDULER_H
+
+#include <sys/types.h>
+
+#include <functional>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "analysis/csrc/application/include/export_mode_enum.h"
+
+namespace Analysis {
+namespace Application {
+// 单个PROF目录的处理阶段，返回是否成功
+using BatchStage = std::function<bool(const std::string &profPath)>;
+
+struct BatchExportOptions {
+    std::set<ExportMode> exportModes;
+    std::string reportJsonPath;
+    uint32_t cpuBudget = 0;         // 所有PROF共享的CPU预算，0表示使用全部CPU核，各PROF的线程数不超过其权重
+    BatchStage parseStage;          // 导出前的device解析阶段，为空时跳过
+    BatchStage exportStage;         // 导出阶段，为空时使用ExportManager按exportModes导出
+    std::string mergedOutputPath;   // 跨rank通信视图的输出目录，为空时不合并
+};
+
+struct BatchExportJob {
+    std::string profPath;
+    size_t rankIndex = 0;   // 在输入列表中的序号
+    uint64_t dataSize = 0;
+    uint32_t weight = 1;    // 占用的CPU预算，与device数一致
+    bool success = false;
+};
+
+// 集群场景下多个PROF目录的批量导出
+// 1. 按数据量从大到小调度，每个PROF在独立子进程中依次执行解析与导出(各PROF的单例状态互不影响)，
+//    同时运行的PROF占用的CPU预算之和不超过cpuBudget，数据量最大的PROF最先启动，避免其成为长尾
+// 2. 父进程在启动子进程前预加载各PROF的hash字典，内容相同的字典只加载一次，子进程通过写时复制共享
+// 3. 全部导出结束后可选地将各rank的通信大算子合并为一份跨rank通信视图
+class BatchExportScheduler {
+public:
+    BatchExportScheduler(const std::vector<std::string> &profPaths, const BatchExportOptions &options);
+    bool Run();
+    const std::vector<BatchExportJob> &GetJobs() const;
+    std::string GetMergedDBPath() const;
+
+private:
+    bool PlanJobs();
+    bool Schedule();
+    bool RunJob(const BatchExportJob &job) const;
+    pid_t StartJob(const BatchExportJob &job) const;
+    static pid_t WaitAnyJob(const std::map<pid_t, size_t> &running, int &status);
+    bool MergeCommunication();
+    static uint64_t GetDataSize(const std::string &profPath);
+    static std::string GetLatestMsprofDB(const std::string &profPath);
+
+private:
+    std::vector<std::string> profPaths_;
+    BatchExportOptions options_;
+    uint32_t cpuBudget_ = 1;
+    std::vector<BatchExportJob> jobs_;
+};
+}  // namespace Application
+}  // namespace Analysis
+
+#endif  // ANALYSIS_APPLICATION_BATCH_EXPORT_SCHEDULER_H
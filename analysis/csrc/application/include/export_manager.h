@@ -17,14 +17,20 @@
 #ifndef ANALYSIS_APPLICATION_EXPORT_MANAGER_H
 #define ANALYSIS_APPLICATION_EXPORT_MANAGER_H
 
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
 #include <string>
 #include "analysis/csrc/infrastructure/data_inventory/include/data_inventory.h"
+#include "analysis/csrc/infrastructure/utils/stage_manifest.h"
 #include "analysis/csrc/application/timeline/json_process_enum.h"
 #include "analysis/csrc/application/include/export_mode_enum.h"
 
 namespace Analysis {
 namespace Application {
 using namespace Analysis::Infra;
+using Analysis::Utils::StageManifest;
 class ExportManager {
 public:
     explicit ExportManager(const std::string &profPath) : profPath_(profPath) {}
@@ -32,15 +38,27 @@ public:
         jsonPath_(jsonPath)
     {}
     bool Run(const std::set<ExportMode>& exportModeSet);
+    // 限制导出各阶段线程池的线程数，批量导出时按分配给该PROF的CPU预算设置，0表示不限制
+    void SetThreadLimit(uint32_t threadLimit);
 private:
     bool Init();
     bool CheckProfDirsValid();
-    bool ProcessData(DataInventory &dataInventory, const std::set<ExportMode>& exportModeSet);
+    // 各导出模式依赖的processor，timeline按所选json进程裁剪
+    bool GetProcessListByMode(const std::set<ExportMode>& exportModeSet, const std::vector<JsonProcess>& jsonProcesses,
+                              std::map<ExportMode, std::set<std::string>>& modeProcessList);
+    // 只执行导出模式依赖的processor，某个导出模式依赖的processor全部完成时回调onModeReady
+    bool ProcessData(DataInventory &dataInventory, const std::map<ExportMode, std::set<std::string>>& modeProcessList,
+                     const std::function<void(ExportMode, bool)>& onModeReady);
     std::vector<JsonProcess> GetProcessEnum();
+    // 导出阶段的增量缓存清单，输入为解析生成的db，产物为各导出模式的文件
+    std::shared_ptr<StageManifest> CreateManifest(ExportMode exportMode);
+    void CommitManifest(ExportMode exportMode, StageManifest& manifest);
+    uint32_t GetPoolSize(uint32_t defaultSize) const;
 
 private:
     std::string profPath_;
     std::string jsonPath_;
+    uint32_t threadLimit_ = 0;
 };
 }
 }
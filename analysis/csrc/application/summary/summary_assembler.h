@@ -24,6 +24,7 @@
 #include "analysis/csrc/application/summary/summary_constant.h"
 #include "analysis/csrc/infrastructure/data_inventory/include/data_inventory.h"
 #include "analysis/csrc/infrastructure/dump_tools/csv_tool/include/csv_writer.h"
+#include "analysis/csrc/infrastructure/utils/self_trace.h"
 
 namespace Analysis
 {
@@ -40,6 +41,7 @@ class SummaryAssembler
     bool Run(DataInventory &dataInventory)
     {
         INFO("Begin to Assemble % data", processorName_);
+        Utils::TraceSpan span(Utils::TRACE_CAT_ASSEMBLER, processorName_, true);
         auto res = AssembleData(dataInventory);
         if (res == ASSEMBLE_SUCCESS)
         {
@@ -16,6 +16,7 @@
 
 #include "analysis/csrc/application/summary/summary_manager.h"
 #include <atomic>
+#include "analysis/csrc/infrastructure/utils/run_control.h"
 #include "analysis/csrc/infrastructure/utils/thread_pool.h"
 #include "analysis/csrc/application/summary/summary_factory.h"
 
@@ -36,21 +37,33 @@ const std::vector<std::string> DATA_ASSEMBLE_LIST{
     PROCESSOR_NAME_STEP_TRACE
 };
 
-const std::set<std::string> SUMMARY_DATA_PROCESS_LIST{
-    PROCESSOR_NAME_COMMUNICATION,
-    PROCESSOR_NAME_COMPUTE_TASK_INFO,
-    PROCESSOR_NAME_TASK,
-    PROCESSOR_PMU,
-    PROCESSOR_NAME_COMM_STATISTIC,
-    PROCESSOR_NAME_OP_STATISTIC,
-    PROCESSOR_NAME_NPU_MEM,
-    PROCESSOR_NAME_NPU_MODULE_MEM,
-    PROCESSOR_NAME_API,
-    PROCESSOR_NAME_FUSION_OP,
-    PROCESSOR_NAME_MODEL_NAME,
-    PROCESSOR_NAME_STEP_TRACE,
-    PROCESSOR_HOST_TASK
+// 各summary assembler读取的数据所对应的processor
+const std::unordered_map<std::string, std::set<std::string>> ASSEMBLER_DEPENDENCY_TABLE{
+    {PROCESSOR_OP_SUMMARY,
+     {PROCESSOR_PMU, PROCESSOR_NAME_TASK, PROCESSOR_NAME_COMMUNICATION, PROCESSOR_NAME_COMPUTE_TASK_INFO}},
+    {PROCESSOR_NAME_COMM_STATISTIC, {PROCESSOR_NAME_COMM_STATISTIC}},
+    {PROCESSOR_NAME_OP_STATISTIC, {PROCESSOR_NAME_OP_STATISTIC}},
+    {PROCESSOR_NAME_NPU_MEM, {PROCESSOR_NAME_NPU_MEM}},
+    {PROCESSOR_NAME_NPU_MODULE_MEM, {PROCESSOR_NAME_NPU_MODULE_MEM}},
+    {PROCESSOR_NAME_API, {PROCESSOR_NAME_API}},
+    {PROCESSOR_NAME_FUSION_OP, {PROCESSOR_NAME_FUSION_OP, PROCESSOR_NAME_MODEL_NAME}},
+    {PROCESSOR_TASK_TIME_SUMMARY, {PROCESSOR_NAME_TASK, PROCESSOR_NAME_COMPUTE_TASK_INFO, PROCESSOR_HOST_TASK}},
+    {PROCESSOR_NAME_STEP_TRACE, {PROCESSOR_NAME_STEP_TRACE}},
 };
+
+std::set<std::string> BuildProcessList()
+{
+    std::set<std::string> processList;
+    for (const auto& name : DATA_ASSEMBLE_LIST) {
+        auto it = ASSEMBLER_DEPENDENCY_TABLE.find(name);
+        if (it == ASSEMBLER_DEPENDENCY_TABLE.end()) {
+            WARN("The dependency of summary assembler % is not declared.", name);
+            continue;
+        }
+        processList.insert(it->second.begin(), it->second.end());
+    }
+    return processList;
+}
 }
 
 bool SummaryManager::Run(DataInventory& dataInventory)
@@ -73,8 +86,13 @@ bool SummaryManager::ProcessSummary(Analysis::Infra::DataInventory& dataInventor
     Analysis::Utils::ThreadPool pool(PROCESSOR_POOL_NUM);
     pool.Start();
     std::atomic<bool> retFlag(true);
+    auto& runControl = Utils::RunControl::GetInstance();
+    runControl.AddAssemblersTotal(DATA_ASSEMBLE_LIST.size());
     for (const auto& name : DATA_ASSEMBLE_LIST) {
-        pool.AddTask([this, &name, &retFlag, &dataInventory]() {
+        pool.AddTask([this, &name, &retFlag, &dataInventory, &runControl]() {
+            if (runControl.IsCancelled()) {
+                return;
+            }
             auto assembler = SummaryFactory::GetAssemblerByName(name, profPath_);
             if (assembler == nullptr) {
                 ERROR("% is not defined", name);
@@ -82,10 +100,15 @@ bool SummaryManager::ProcessSummary(Analysis::Infra::DataInventory& dataInventor
                 return;
             }
             retFlag = assembler->Run(dataInventory) && retFlag;
+            runControl.AddAssemblerDone();
         });
     }
     pool.WaitAllTasks();
     pool.Stop();
+    if (runControl.IsCancelled()) {
+        WARN("The summary export of % is cancelled.", profPath_);
+        return false;
+    }
     if (!retFlag) {
         ERROR("The % for summary assemble failed to be executed.", profPath_);
         PRINT_ERROR("The % for summary assemble failed to be executed. "
@@ -97,7 +120,8 @@ bool SummaryManager::ProcessSummary(Analysis::Infra::DataInventory& dataInventor
 
 const std::set<std::string>& SummaryManager::GetProcessList()
 {
-    return SUMMARY_DATA_PROCESS_LIST;
+    static const std::set<std::string> processList = BuildProcessList();
+    return processList;
 }
 }
 }
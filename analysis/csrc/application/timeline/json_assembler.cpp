@@ -17,6 +17,7 @@
 #include "analysis/csrc/application/timeline/json_assembler.h"
 
 #include "analysis/csrc/domain/services/environment/context.h"
+#include "analysis/csrc/infrastructure/utils/self_trace.h"
 
 namespace Analysis
 {
@@ -31,6 +32,7 @@ JsonAssembler::JsonAssembler(const std::string &name, std::unordered_map<std::st
 bool JsonAssembler::Run(DataInventory &dataInventory, const std::string &profPath)
 {
     INFO("Begin to Assemble % data", processorName_);
+    Utils::TraceSpan span(Utils::TRACE_CAT_ASSEMBLER, processorName_, true);
     JsonWriter ostream;
     // 写多个json对象，需要使用数组包起来作为一个完整有效json
     ostream.StartArray();
@@ -21,6 +21,7 @@
 #include "analysis/csrc/application/timeline/timeline_factory.h"
 #include "analysis/csrc/domain/entities/viewer_data/ai_task/include/msprof_tx_host_data.h"
 #include "analysis/csrc/domain/entities/viewer_data/ai_task/include/step_trace_data.h"
+#include "analysis/csrc/infrastructure/utils/run_control.h"
 #include "analysis/csrc/infrastructure/utils/thread_pool.h"
 
 namespace Analysis
@@ -71,48 +72,51 @@ const std::unordered_map<JsonProcess, std::string> JSON_TO_ASSEMBLER_TABLE{
     {JsonProcess::FUSION_TASK, PROCESS_FUSION_TASK},
 };
 
-std::set<std::string> TIMELINE_DATA_PROCESS_LIST{
-    PROCESSOR_NAME_API,
-    PROCESSOR_NAME_DPU,
-    PROCESSOR_NAME_FUSION_TASK,
-    PROCESSOR_NAME_COMMUNICATION,
-    PROCESSOR_NAME_CCU_MISSION,
-    PROCESSOR_NAME_COMPUTE_TASK_INFO,
-    PROCESSOR_NAME_KFC_TASK,
-    PROCESSOR_NAME_KFC_COMM,
-    PROCESSOR_NAME_DEVICE_TX,
-    PROCESSOR_NAME_MSTX,
+// 各timeline assembler读取的数据所对应的processor，导出时只计算所选assembler依赖的processor
+const std::unordered_map<std::string, std::set<std::string>> ASSEMBLER_DEPENDENCY_TABLE{
+    {PROCESS_TASK,
+     {PROCESSOR_NAME_TASK, PROCESSOR_NAME_COMPUTE_TASK_INFO, PROCESSOR_NAME_API, PROCESSOR_NAME_KFC_TASK,
+      PROCESSOR_NAME_MEMCPY_INFO}},
+    {PROCESS_ACC_PMU, {PROCESSOR_NAME_ACC_PMU}},
+    {PROCESS_API, {PROCESSOR_NAME_API, PROCESSOR_NAME_TASK}},
+    {PROCESS_DDR, {PROCESSOR_NAME_DDR}},
+    {PROCESS_STARS_CHIP_TRANS, {PROCESSOR_NAME_CHIP_TRAINS}},
+    {PROCESS_HBM, {PROCESSOR_NAME_HBM}},
+    {PROCESS_HCCL, {PROCESSOR_NAME_COMMUNICATION, PROCESSOR_NAME_KFC_COMM}},
+    {PROCESS_CCU, {PROCESSOR_NAME_CCU_MISSION}},
+    {PROCESS_HCCS, {PROCESSOR_NAME_HCCS}},
+    {PROCESSOR_NAME_OSRT_API, {PROCESSOR_NAME_OSRT_API}},
+    {PROCESS_NETWORK_USAGE, {PROCESSOR_NAME_NETWORK_USAGE}},
+    {PROCESS_DISK_USAGE, {PROCESSOR_NAME_DISK_USAGE}},
+    {PROCESS_MEMORY_USAGE, {PROCESSOR_NAME_MEM_USAGE}},
+    {PROCESS_CPU_USAGE, {PROCESSOR_NAME_CPU_USAGE}},
+    {PROCESS_MSPROFTX, {PROCESSOR_NAME_MSTX}},
+    {PROCESS_NPU_MEM, {PROCESSOR_NAME_NPU_MEM}},
+    // 重叠分析processor读取task与通信processor的产物，在其余processor完成后执行
+    {PROCESS_OVERLAP_ANALYSE,
+     {PROCESSOR_NAME_OVERLAP_ANALYSIS, PROCESSOR_NAME_TASK, PROCESSOR_NAME_COMPUTE_TASK_INFO,
+      PROCESSOR_NAME_COMMUNICATION, PROCESSOR_NAME_KFC_COMM, PROCESSOR_MC2_COMM_INFO}},
+    {PROCESS_PCIE, {PROCESSOR_NAME_PCIE}},
+    {PROCESS_SIO, {PROCESSOR_NAME_SIO}},
+    {PROCESS_STARS_SOC, {PROCESSOR_NAME_SOC}},
+    {PROCESS_STEP_TRACE, {PROCESSOR_NAME_STEP_TRACE}},
+    {PROCESS_LOW_POWER, {PROCESSOR_NAME_AICORE_FREQ, PROCESSOR_NAME_LOW_POWER}},
+    {PROCESS_LLC, {PROCESSOR_NAME_LLC}},
+    {PROCESS_NIC, {PROCESSOR_NAME_NIC_TIMELINE}},
+    {PROCESS_ROCE, {PROCESSOR_NAME_ROCE_TIMELINE}},
+    {PROCESS_QOS, {PROCESSOR_NAME_QOS}},
+    {PROCESS_DEVICE_TX, {PROCESSOR_NAME_DEVICE_TX, PROCESSOR_NAME_MSTX}},
+    {PROCESS_BIU_PERF, {PROCESSOR_NAME_BIU_PERF}},
+    {PROCESS_UB, {PROCESSOR_NAME_UB}},
+    {PROCESS_BLOCK_DETAIL, {PROCESSOR_NAME_BLOCK_DETAIL, PROCESSOR_NAME_TASK, PROCESSOR_NAME_COMPUTE_TASK_INFO}},
+    {PROCESS_DPU, {PROCESSOR_NAME_DPU}},
+    {PROCESS_FUSION_TASK, {PROCESSOR_NAME_FUSION_TASK}},
+};
+
+// PreDumpJson根据step trace与msproftx数据是否存在决定创建哪些json文件，无论选择哪些assembler都需要计算
+const std::set<std::string> PRE_DUMP_PROCESS_LIST{
     PROCESSOR_NAME_STEP_TRACE,
-    PROCESSOR_NAME_TASK,
-    PROCESSOR_NAME_ACC_PMU,
-    PROCESSOR_NAME_AICORE_FREQ,
-    PROCESSOR_NAME_CHIP_TRAINS,
-    PROCESSOR_NAME_DDR,
-    PROCESSOR_NAME_HBM,
-    PROCESSOR_NAME_HCCS,
-    PROCESSOR_NAME_CPU_USAGE,
-    PROCESSOR_NAME_MEM_USAGE,
-    PROCESSOR_NAME_DISK_USAGE,
-    PROCESSOR_NAME_NETWORK_USAGE,
-    PROCESSOR_NAME_OSRT_API,
-    PROCESSOR_NAME_LLC,
-    PROCESSOR_NAME_NPU_MEM,
-    PROCESSOR_NAME_PCIE,
-    PROCESSOR_NAME_SIO,
-    PROCESSOR_NAME_SOC,
-    PROCESSOR_NAME_NIC,
-    PROCESSOR_NAME_ROCE,
-    PROCESSOR_NAME_QOS,
-    PROCESSOR_MC2_COMM_INFO,
-    PROCESSOR_NAME_MEMCPY_INFO,
-    PROCESSOR_NAME_NPU_OP_MEM,
-    PROCESSOR_NAME_NPU_MODULE_MEM,
-    PROCESSOR_NAME_NIC_TIMELINE,
-    PROCESSOR_NAME_ROCE_TIMELINE,
-    PROCESSOR_NAME_LOW_POWER,
-    PROCESSOR_NAME_BIU_PERF,
-    PROCESSOR_NAME_UB,
-    PROCESSOR_NAME_BLOCK_DETAIL,
+    PROCESSOR_NAME_MSTX,
 };
 }  // namespace
 
@@ -123,11 +127,17 @@ bool TimelineManager::ProcessTimeLine(DataInventory& dataInventory, const std::v
     pool.Start();
     std::atomic<bool> retFlag(true);
     std::vector<std::string> assemblerList = GetAssemblerList(jsonProcess);
+    auto& runControl = Utils::RunControl::GetInstance();
+    runControl.AddAssemblersTotal(assemblerList.size());
     for (const auto& name : assemblerList)
     {
         pool.AddTask(
-            [this, &name, &retFlag, &dataInventory]()
+            [this, &name, &retFlag, &dataInventory, &runControl]()
             {
+                if (runControl.IsCancelled())
+                {
+                    return;
+                }
                 auto assembler = TimelineFactory::GetAssemblerByName(name);
                 if (assembler == nullptr)
                 {
@@ -136,6 +146,7 @@ bool TimelineManager::ProcessTimeLine(DataInventory& dataInventory, const std::v
                     return;
                 }
                 retFlag = assembler->Run(dataInventory, profPath_) && retFlag;
+                runControl.AddAssemblerDone();
             });
     }
     pool.WaitAllTasks();
@@ -157,6 +168,8 @@ void TimelineManager::WriteFile(const std::string& filePrefix, FileCategory cate
     auto tempFile = filePrefix;
     tempFile.append("_").append(GetTimeStampStr()).append(JSON_SUFFIX);
     auto filePath = File::PathJoin({outputPath_, tempFile});
+    // 导出完成前写入隐藏的临时文件，PostDumpJson中再发布为正式文件
+    AtomicOutput::GetInstance().Stage(filePath);
     DumpTool::WriteToFile(filePath, PREFIX_CONTEXT.c_str(), PREFIX_CONTEXT.size(), category);
     fileType_.emplace(category, filePath);
 }
@@ -181,11 +194,24 @@ bool TimelineManager::PreDumpJson(DataInventory& dataInventory)
 
 void TimelineManager::PostDumpJson()
 {
+    bool cancelled = Utils::RunControl::GetInstance().IsCancelled();
+    auto suffix = CompressedSink::GetInstance().GetFilePath("");
     for (const auto& it : fileType_)
     {
-        // 此处需要覆盖文件末尾的","，实测必须使用in、out、ate三种模式打开文件，才可以实现覆盖写入
-        FileWriter writer(it.second, std::ios::in | std::ios::out | std::ios::ate);
-        writer.WriteTextBack(SUFFIX_CONTEXT, JSON_FILE_OFFSET);
+        // 此处需要覆盖文件末尾的","
+        if (!DumpTool::WriteBackAndClose(it.second, SUFFIX_CONTEXT, JSON_FILE_OFFSET))
+        {
+            ERROR("Finish json file % failed.", it.second);
+        }
+        // 被取消的导出不发布未完成的json
+        if (cancelled)
+        {
+            AtomicOutput::GetInstance().Discard(it.second, suffix);
+        }
+        else if (!AtomicOutput::GetInstance().Publish(it.second, suffix))
+        {
+            ERROR("Publish json file % failed.", it.second);
+        }
     }
 }
 
@@ -193,6 +219,7 @@ bool TimelineManager::Run(DataInventory& dataInventory, const std::vector<JsonPr
 {
     INFO("Start exporting timeline!");
     PRINT_INFO("Start exporting the timeline!");
+    AtomicOutput::GetInstance().RemoveStale(outputPath_);
     if (!PreDumpJson(dataInventory))
     {
         WARN("Can't Get data from dataInventory after data process");
@@ -201,6 +228,12 @@ bool TimelineManager::Run(DataInventory& dataInventory, const std::vector<JsonPr
     }
     bool runFlag = ProcessTimeLine(dataInventory, jsonProcess);
     PostDumpJson();
+    if (Utils::RunControl::GetInstance().IsCancelled())
+    {
+        WARN("The timeline export is cancelled, no json is published.");
+        PRINT_WARN("The timeline export is cancelled.");
+        return false;
+    }
     if (!runFlag)
     {
         ERROR("The unified timeline process failed to be executed.");
@@ -223,6 +256,20 @@ std::vector<std::string> TimelineManager::GetAssemblerList(const std::vector<Jso
     return assemblerList;
 }
 
-const std::set<std::string>& TimelineManager::GetProcessList() { return TIMELINE_DATA_PROCESS_LIST; }
+std::set<std::string> TimelineManager::GetProcessList(const std::vector<JsonProcess>& jsonProcess)
+{
+    std::set<std::string> processList(PRE_DUMP_PROCESS_LIST);
+    for (const auto& name : GetAssemblerList(jsonProcess))
+    {
+        auto it = ASSEMBLER_DEPENDENCY_TABLE.find(name);
+        if (it == ASSEMBLER_DEPENDENCY_TABLE.end())
+        {
+            WARN("The dependency of timeline assembler % is not declared.", name);
+            continue;
+        }
+        processList.insert(it->second.begin(), it->second.end());
+    }
+    return processList;
+}
 }  // namespace Application
 }  // namespace Analysis
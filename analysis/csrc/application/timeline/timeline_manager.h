@@ -31,13 +31,14 @@ public:
     explicit TimelineManager(const std::string &profPath, const std::string &outputPath)
         : profPath_(profPath), outputPath_(outputPath) {};
     bool Run(DataInventory &dataInventory, const std::vector<JsonProcess>& jsonProcess);
-    const static std::set<std::string>& GetProcessList();
+    // 所选json进程对应的assembler依赖的processor
+    static std::set<std::string> GetProcessList(const std::vector<JsonProcess>& jsonProcess);
 private:
     bool ProcessTimeLine(DataInventory &dataInventory, const std::vector<JsonProcess> &jsonEnum);
     bool PreDumpJson(DataInventory &dataInventory);
     void PostDumpJson();
     void WriteFile(const std::string &filePrefix, FileCategory category);
-    std::vector<std::string> GetAssemblerList(const std::vector<JsonProcess>& jsonProcess);
+    static std::vector<std::string> GetAssemblerList(const std::vector<JsonProcess>& jsonProcess);
 private:
     std::string profPath_;
     std::string outputPath_;
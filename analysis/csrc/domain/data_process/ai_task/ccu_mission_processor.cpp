@@ -21,6 +21,8 @@
 #include <unordered_set>
 
 #include "analysis/csrc/domain/services/environment/context.h"
+#include "analysis/csrc/infrastructure/utils/flat_key_map.h"
+#include "analysis/csrc/infrastructure/utils/radix_sort.h"
 #include "analysis/csrc/infrastructure/utils/time_utils.h"
 #include "analysis/csrc/infrastructure/utils/utils.h"
 
@@ -90,9 +92,10 @@ struct CCUChannelPrefixInfo
 
 using CCUChannelIndex = std::unordered_map<uint16_t, std::vector<CCUChannelPrefixInfo>>;
 
-std::string MakeCCUKey(uint64_t streamId, uint64_t taskId, uint64_t instrId)
+// streamId(16位), taskId(32位), instrId(16位)
+uint64_t MakeCCUKey(uint16_t streamId, uint32_t taskId, uint16_t instrId)
 {
-    return std::to_string(streamId) + "_" + std::to_string(taskId) + "_" + std::to_string(instrId);
+    return PackedKey<16, 32, 16>::Pack(streamId, taskId, instrId);
 }
 
 CCUDelayChannel GetMaxDelayChannel(const std::vector<CCUWaitSignalInfo> &hostData, const CCUMissionInfo &missionData,
@@ -138,30 +141,30 @@ CCUDelayChannel GetMaxDelayChannel(const std::vector<CCUWaitSignalInfo> &hostDat
 
 CCUChannelIndex BuildChannelIndex(const std::vector<CCUChannelInfo> &channelInfo)
 {
-    std::unordered_map<uint16_t, std::vector<CCUChannelInfo>> groupedChannelInfo;
-    groupedChannelInfo.reserve(channelInfo.size());
-    for (const auto &channel : channelInfo)
-    {
-        groupedChannelInfo[channel.channelId].emplace_back(channel);
-    }
+    // 按(channelId, timestamp)排序一次后顺序扫描，同一channel的记录连续且按时间升序
+    std::vector<CCUChannelInfo> records(channelInfo);
+    RadixSort::SortByKeys(
+        records, [](const CCUChannelInfo &record) { return record.channelId; },
+        [](const CCUChannelInfo &record) { return record.timestamp; });
 
     CCUChannelIndex channelIndex;
-    channelIndex.reserve(groupedChannelInfo.size());
-    for (auto &item : groupedChannelInfo)
-    {
-        auto &records = item.second;
-        std::sort(records.begin(), records.end(), [](const CCUChannelInfo &left, const CCUChannelInfo &right)
-                  { return left.timestamp < right.timestamp; });
-        auto &prefixRecords = channelIndex[item.first];
-        if (!Reserve(prefixRecords, records.size()))
+    for (size_t begin = 0, end = 0; begin < records.size(); begin = end)
+    {
+        while (end < records.size() && records[end].channelId == records[begin].channelId)
+        {
+            ++end;
+        }
+        auto &prefixRecords = channelIndex[records[begin].channelId];
+        if (!Reserve(prefixRecords, end - begin))
         {
             ERROR("Reserve ccu channel index failed.");
             continue;
         }
         uint64_t maxDelay = 0;
         uint16_t maxDelayChannel = UINT16_MAX;
-        for (const auto &record : records)
+        for (size_t i = begin; i < end; ++i)
         {
+            const auto &record = records[i];
             if (record.avgDelay > maxDelay)
             {
                 maxDelay = record.avgDelay;
@@ -250,8 +253,13 @@ void FormatLoopTimelineData(const std::vector<CCUMissionInfo> &loopData, const s
     {
         return;
     }
-    std::unordered_map<std::string, CCUMissionInfo> groupedLoopData;
-    std::unordered_map<std::string, std::vector<CCUGroupInfo>> groupedGroupData;
+    FlatKeyMap<CCUMissionInfo> groupedLoopData;
+    FlatKeyMap<std::vector<CCUGroupInfo>> groupedGroupData;
+    if (!groupedLoopData.Reserve(loopData.size()) || !groupedGroupData.Reserve(groupData.size()))
+    {
+        ERROR("Reserve ccu grouped loop data failed.");
+        return;
+    }
     for (const auto &item : loopData)
     {
         auto key = MakeCCUKey(item.streamId, item.taskId, item.lpInstrId);
@@ -275,10 +283,10 @@ void FormatLoopTimelineData(const std::vector<CCUMissionInfo> &loopData, const s
         traceData.timestamp = GetLocalTime(start, record).Uint64();
         traceData.duration =
             data.endTime > data.startTime ? GetDurTimeFromSyscnt(data.endTime - data.startTime, params).Double() : 0.0;
-        auto hostDataIter = groupedGroupData.find(item.first);
-        if (hostDataIter != groupedGroupData.end() && !hostDataIter->second.empty())
+        auto hostDataList = groupedGroupData.Find(item.first);
+        if (hostDataList != nullptr && !hostDataList->empty())
         {
-            const auto &hostData = hostDataIter->second.front();
+            const auto &hostData = hostDataList->front();
             traceData.hasDieId = true;
             traceData.dieId = hostData.dieId;
             traceData.hasDataSize = true;
@@ -313,8 +321,13 @@ void FormatWaitTimelineData(const std::vector<CCUMissionInfo> &waitData,
     {
         return;
     }
-    std::unordered_map<std::string, std::vector<CCUMissionInfo>> groupedWaitData;
-    std::unordered_map<std::string, std::vector<CCUWaitSignalInfo>> groupedWaitSignalData;
+    FlatKeyMap<std::vector<CCUMissionInfo>> groupedWaitData;
+    FlatKeyMap<std::vector<CCUWaitSignalInfo>> groupedWaitSignalData;
+    if (!groupedWaitData.Reserve(waitData.size()) || !groupedWaitSignalData.Reserve(waitSignalData.size()))
+    {
+        ERROR("Reserve ccu grouped wait data failed.");
+        return;
+    }
     auto channelIndex = BuildChannelIndex(channelInfo);
     for (const auto &item : waitData)
     {
@@ -348,15 +361,15 @@ void FormatWaitTimelineData(const std::vector<CCUMissionInfo> &waitData,
         traceData.timestamp = GetLocalTime(start, record).Uint64();
         traceData.duration =
             data.endTime > data.startTime ? GetDurTimeFromSyscnt(data.endTime - data.startTime, params).Double() : 0.0;
-        auto hostDataIter = groupedWaitSignalData.find(item.first);
-        if (hostDataIter != groupedWaitSignalData.end() && !hostDataIter->second.empty())
+        auto hostDataList = groupedWaitSignalData.Find(item.first);
+        if (hostDataList != nullptr && !hostDataList->empty())
         {
-            const auto &hostData = hostDataIter->second.front();
+            const auto &hostData = hostDataList->front();
             traceData.hasDieId = true;
             traceData.dieId = hostData.dieId;
             traceData.hasMask = true;
             traceData.mask = hostData.mask;
-            auto maxDelay = GetMaxDelayChannel(hostDataIter->second, data, channelIndex);
+            auto maxDelay = GetMaxDelayChannel(*hostDataList, data, channelIndex);
             if (maxDelay.channelId != UINT16_MAX && maxDelay.channelDelay != 0)
             {
                 traceData.hasDelayChannel = true;
@@ -18,6 +18,7 @@
 #include <limits>
 
 #include "analysis/csrc/domain/services/environment/context.h"
+#include "analysis/csrc/infrastructure/utils/arena_allocator.h"
 
 namespace Analysis
 {
@@ -30,6 +31,13 @@ namespace
 const size_t OPNAME_INDEX = 1;
 const size_t RELAY_INDEX = 2;
 const size_t RETRY_INDEX = 3;
+const std::vector<std::string> HCCL_TASK_COLUMNS = {
+    "model_id", "op_name", "hccl_name", "group_name", "plane_id", "stream_id", "task_id", "local_rank",
+    "remote_rank", "transport_type", "size", "data_type", "link_type", "context_id", "notify_id", "batch_id",
+    "rdma_type", "timestamp", "duration", "connection_id", "duration_estimated", "bandwidth", "is_master"};
+const std::vector<std::string> HCCL_OP_COLUMNS = {
+    "connection_id", "op_name", "relay", "retry", "data_type", "alg_type", "count", "group_name", "op_type",
+    "model_id", "rank_size"};
 struct CommunicationOpEndpointsTime
 {
     double firstTaskStartTime = std::numeric_limits<double>::max();
@@ -38,13 +46,14 @@ struct CommunicationOpEndpointsTime
 };
 
 // groupName 依据hash进行转换，对于无hash的数据，直接取用hash值（即groupName）进行转换
-std::string GetGroupNameValue(const std::string& groupName, GeHashMap& hashMap)
+std::string GetGroupNameValue(const std::string& groupName, const std::shared_ptr<GeHashMap>& hashMap)
 {
-    if (groupName != NA && Utils::IsNumber(groupName))
+    if (hashMap != nullptr && groupName != NA && Utils::IsNumber(groupName))
     {
-        if (hashMap.find(groupName) != hashMap.end())
+        auto it = hashMap->find(groupName);
+        if (it != hashMap->end())
         {
-            return hashMap[groupName];
+            return it->second;
         }
     }
     return groupName;
@@ -75,7 +84,7 @@ bool CommunicationInfoProcessor::Process(DataInventory& dataInventory)
         ERROR("Can't get hash data.");
         return false;
     }
-    communicationData.hashMap = *hashMap;
+    communicationData.hashMap = hashMap;
     for (const auto& devicePath : deviceList)
     {
         communicationData.deviceId = Utils::GetDeviceIdByDevicePath(devicePath);
@@ -156,8 +165,10 @@ bool CommunicationInfoProcessor::FormatData(std::vector<CommunicationTaskData>&
     }
     CommunicationTaskData taskData;
     HcclTaskSingleDeviceData hcclData;
-    std::unordered_map<std::string, CommunicationOpData> opDataMap;
-    std::unordered_map<std::string, CommunicationOpEndpointsTime> endpoints;
+    // 按算子聚合的临时表节点数与task数同量级，分配在processor的阶段Arena中
+    auto &arena = StageArena();
+    ArenaUnorderedMap<std::string, CommunicationOpData> opDataMap(ArenaAllocator<char>{arena});
+    ArenaUnorderedMap<std::string, CommunicationOpEndpointsTime> endpoints(ArenaAllocator<char>{arena});
     std::unordered_map<uint32_t, size_t> opInfoIdxMap = GenOpInfoIdxMap(communicationData.oriOpData);
     for (auto& row : communicationData.oriTaskData)
     {
@@ -343,27 +354,32 @@ bool CommunicationInfoProcessor::ProcessHcclData(const std::string& devicePath,
     DBInfo opDBInfo("hccl_single_device.db", "HCCLOpSingleDevice");
     std::string taskDBPath = Utils::File::PathJoin({devicePath, SQLITE, taskDBInfo.dbName});
     std::string opDBPath = Utils::File::PathJoin({devicePath, SQLITE, opDBInfo.dbName});
-    if (!taskDBInfo.ConstructDBRunner(taskDBPath) || !opDBInfo.ConstructDBRunner(opDBPath))
+    if (LoadColumnFile(taskDBPath, taskDBInfo.tableName, HCCL_TASK_COLUMNS, communicationData.oriTaskData) !=
+            CHECK_SUCCESS ||
+        LoadColumnFile(opDBPath, opDBInfo.tableName, HCCL_OP_COLUMNS, communicationData.oriOpData) != CHECK_SUCCESS)
     {
-        return false;
-    }
-    auto status = CheckPathAndTable(taskDBPath, taskDBInfo, false);
-    if (status != CHECK_SUCCESS)
-    {
-        return status != CHECK_FAILED;
-    }
-    status = CheckPathAndTable(opDBPath, opDBInfo, false);
-    if (status != CHECK_SUCCESS)
-    {
-        return status != CHECK_FAILED;
+        if (!taskDBInfo.ConstructDBRunner(taskDBPath) || !opDBInfo.ConstructDBRunner(opDBPath))
+        {
+            return false;
+        }
+        auto status = CheckPathAndTable(taskDBPath, taskDBInfo, false);
+        if (status != CHECK_SUCCESS)
+        {
+            return status != CHECK_FAILED;
+        }
+        status = CheckPathAndTable(opDBPath, opDBInfo, false);
+        if (status != CHECK_SUCCESS)
+        {
+            return status != CHECK_FAILED;
+        }
+        communicationData.oriTaskData = LoadTaskData(taskDBInfo);
+        communicationData.oriOpData = LoadOpData(opDBInfo);
     }
-    communicationData.oriTaskData = LoadTaskData(taskDBInfo);
     if (communicationData.oriTaskData.empty())
     {
         ERROR("Get % data failed in %.", taskDBInfo.tableName, taskDBPath);
         return false;
     }
-    communicationData.oriOpData = LoadOpData(opDBInfo);
     if (communicationData.oriOpData.empty())
     {
         ERROR("Get % data failed in %.", opDBInfo.tableName, opDBPath);
@@ -51,7 +51,7 @@ class CommunicationInfoProcessor : public DataProcessor
         OriOpDataFormat oriKfcOpData;
         uint16_t deviceId = UINT16_MAX;
         Utils::ProfTimeRecord timeRecord;
-        GeHashMap hashMap;
+        std::shared_ptr<GeHashMap> hashMap;  // 与DataInventory共享，不拷贝
     };
     struct HcclTaskSingleDeviceData
     {
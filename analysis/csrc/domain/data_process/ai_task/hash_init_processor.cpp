@@ -16,6 +16,11 @@
 
 #include "analysis/csrc/domain/data_process/ai_task/hash_init_processor.h"
 
+#include <map>
+#include <mutex>
+
+#include "analysis/csrc/infrastructure/utils/stage_manifest.h"
+
 namespace Analysis
 {
 namespace Domain
@@ -23,6 +28,15 @@ namespace Domain
 using namespace Analysis::Application;
 using GeHashFormat = std::vector<std::tuple<std::string, std::string>>;
 using LogicStream = std::vector<std::tuple<uint32_t, uint32_t>>;
+namespace
+{
+const std::string GE_HASH_DB = "ge_hash.db";
+const std::string GE_HASH_TABLE = "GeHashInfo";
+std::mutex g_sharedHashMutex;
+// ge_hash.db路径到共享字典的映射
+std::unordered_map<std::string, std::shared_ptr<GeHashMap>> g_sharedHashMaps;
+}  // namespace
+
 HashInitProcessor::HashInitProcessor(const std::string &profPath) : DataProcessor(profPath) {}
 
 bool HashInitProcessor::ProcessLogicStream(DataInventory &dataInventory)
@@ -63,24 +77,20 @@ bool HashInitProcessor::ProcessLogicStream(DataInventory &dataInventory)
     return true;
 }
 
-bool HashInitProcessor::ProcessHashMap(DataInventory &dataInventory)
+bool HashInitProcessor::LoadHashMap(const std::string &dbPath, std::shared_ptr<GeHashMap> &res)
 {
-    INFO("Init Hash data, dir is %", profPath_);
-    DBInfo hashDB("ge_hash.db", "GeHashInfo");
+    DBInfo hashDB(GE_HASH_DB, GE_HASH_TABLE);
     GeHashFormat hashData;
-    std::string dbPath = Utils::File::PathJoin({profPath_, HOST, SQLITE, hashDB.dbName});
     if (!hashDB.ConstructDBRunner(dbPath))
     {
         return false;
     }
     GeHashMap hashMap;
-    std::shared_ptr<GeHashMap> res;
     // 并不是所有场景都有ge hash数据
     auto flag = CheckPathAndTable(dbPath, hashDB);
     if (flag != CHECK_SUCCESS)
     {
         MAKE_SHARED_RETURN_VALUE(res, GeHashMap, false, std::move(hashMap));
-        dataInventory.Inject(res);
         return flag != CHECK_FAILED;
     }
     std::string sql = "SELECT hash_key, hash_value FROM " + hashDB.tableName;
@@ -94,10 +104,74 @@ bool HashInitProcessor::ProcessHashMap(DataInventory &dataInventory)
         hashMap[std::get<0>(item)] = std::get<1>(item);
     }
     MAKE_SHARED_RETURN_VALUE(res, GeHashMap, false, std::move(hashMap));
-    dataInventory.Inject(res);
     return true;
 }
 
+std::shared_ptr<GeHashMap> HashInitProcessor::FindSharedHashMap(const std::string &dbPath)
+{
+    std::lock_guard<std::mutex> lock(g_sharedHashMutex);
+    auto it = g_sharedHashMaps.find(dbPath);
+    return it == g_sharedHashMaps.end() ? nullptr : it->second;
+}
+
+size_t HashInitProcessor::ShareHashMaps(const std::vector<std::string> &profPaths)
+{
+    // 按文件大小与内容hash识别相同的字典
+    std::map<std::pair<uint64_t, uint64_t>, std::shared_ptr<GeHashMap>> contentMaps;
+    std::lock_guard<std::mutex> lock(g_sharedHashMutex);
+    for (const auto &profPath : profPaths)
+    {
+        std::string dbPath = Utils::File::PathJoin({profPath, HOST, SQLITE, GE_HASH_DB});
+        Utils::FileFingerprint fingerprint;
+        if (!Utils::File::Exist(dbPath) || !Utils::StageManifest::GetFingerprint(dbPath, fingerprint, true))
+        {
+            continue;
+        }
+        auto key = std::make_pair(fingerprint.size, fingerprint.hash);
+        auto it = contentMaps.find(key);
+        if (it != contentMaps.end())
+        {
+            g_sharedHashMaps[dbPath] = it->second;
+            continue;
+        }
+        std::shared_ptr<GeHashMap> hashMap;
+        if (!LoadHashMap(dbPath, hashMap) || hashMap == nullptr)
+        {
+            WARN("Load hash data of % failed, it will be loaded when exporting.", profPath);
+            continue;
+        }
+        contentMaps.emplace(key, hashMap);
+        g_sharedHashMaps[dbPath] = hashMap;
+    }
+    INFO("Share % hash dictionaries among % prof paths.", contentMaps.size(), g_sharedHashMaps.size());
+    return contentMaps.size();
+}
+
+void HashInitProcessor::ClearSharedHashMaps()
+{
+    std::lock_guard<std::mutex> lock(g_sharedHashMutex);
+    g_sharedHashMaps.clear();
+}
+
+bool HashInitProcessor::ProcessHashMap(DataInventory &dataInventory)
+{
+    INFO("Init Hash data, dir is %", profPath_);
+    std::string dbPath = Utils::File::PathJoin({profPath_, HOST, SQLITE, GE_HASH_DB});
+    auto res = FindSharedHashMap(dbPath);
+    if (res != nullptr)
+    {
+        INFO("Reuse the shared hash data of %.", dbPath);
+        dataInventory.Inject(res);
+        return true;
+    }
+    bool ret = LoadHashMap(dbPath, res);
+    if (res != nullptr)
+    {
+        dataInventory.Inject(res);
+    }
+    return ret;
+}
+
 bool HashInitProcessor::Process(DataInventory &dataInventory)
 {
     bool res = true;
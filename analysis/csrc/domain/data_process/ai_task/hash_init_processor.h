@@ -17,7 +17,9 @@
 #ifndef ANALYSIS_DOMAIN_HASH_INIT_PROCESS_H
 #define ANALYSIS_DOMAIN_HASH_INIT_PROCESS_H
 
+#include <memory>
 #include <unordered_map>
+#include <vector>
 #include "analysis/csrc/domain/data_process/data_processor.h"
 
 namespace Analysis {
@@ -30,11 +32,16 @@ class HashInitProcessor : public DataProcessor {
 public:
     HashInitProcessor() = default;
     explicit HashInitProcessor(const std::string &profPath);
+    // 批量导出时预加载各PROF的hash字典，内容相同的ge_hash.db只加载一次，导出时直接复用，返回加载的字典数
+    static size_t ShareHashMaps(const std::vector<std::string> &profPaths);
+    static void ClearSharedHashMaps();
 
 private:
     bool Process(DataInventory& dataInventory) override;
     bool ProcessLogicStream(DataInventory &dataInventory);
     bool ProcessHashMap(DataInventory &dataInventory);
+    static bool LoadHashMap(const std::string &dbPath, std::shared_ptr<GeHashMap> &res);
+    static std::shared_ptr<GeHashMap> FindSharedHashMap(const std::string &dbPath);
 };
 }
 }
@@ -36,7 +36,7 @@ bool KfcCommProcessor::Process(DataInventory& dataInventory)
         ERROR("Can't get hash data.");
         return false;
     }
-    communicationData.hashMap = *hashMap;
+    communicationData.hashMap = hashMap;
     for (const auto& devicePath : deviceList) {
         flag = ProcessSingleDevice(communicationData, devicePath, resTask, resOp) && flag;
     }
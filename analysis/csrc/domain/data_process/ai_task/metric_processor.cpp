@@ -28,9 +28,11 @@ namespace Analysis
 namespace Domain
 {
 using namespace Environment;
+using Infra::ColumnTable;
 namespace
 {
 const int PERCENTAGE_FACTOR = 100;
+const size_t TASK_ID_COLUMN_NUM = 4;  // subtask_id, stream_id, task_id, batch_id
 const uint64_t INVALID_DB_SIZE = 0;
 const std::unordered_set<std::string> INVALID_COLUMN_NAMES = {
     "job_id",    "host_id",    "device_id",         "task_id",   "stream_id", "index_id",
@@ -214,32 +216,43 @@ bool MetricProcessor::ProcessData(const std::unordered_map<std::string, uint16_t
                                   Analysis::Infra::DBInfo &metricDB, std::vector<std::string> &headers,
                                   DataInventory &dataInventory)
 {
-    bool flag = true;
-    std::map<TaskId, std::vector<std::vector<std::string>>> processedData;
-    for (const auto &pair : dbPathAndDeviceID)
+    auto metricSummaryHeaders = ModifySummaryHeaders(headers);
+    if (metricSummaryHeaders.empty())
     {
-        if (!TaskBasedProcessByDevice(pair, headers, metricDB, processedData))
-        {
-            ERROR("TaskBasedProcess: process data failed, dbPath is %.", pair.first);
-            flag = false;
-        }
+        ERROR("Processing data: get modified metric Summary failed, no metric data will be reserved.");
+        return false;
     }
-    auto metricSummaryHeaders = ModifySummaryHeaders(headers);
+    metricNum_ = headers.size();
     // add memory data 当前看A2并不支持memoryBound数据处理 实际为无效代码
-    if (AddMemoryBound(processedData, metricSummaryHeaders))
+    withMemoryBound_ = CheckAndGetMemoryBoundRelatedDataIndex(metricSummaryHeaders, memoryBoundIndex_);
+    if (withMemoryBound_)
     {
         metricSummaryHeaders.emplace_back("memory_bound");
     }
+    else
+    {
+        INFO("can't find memory bound needed column, no memory bound data added.");
+    }
     // cube_utilization需要task_duration字段, 当前处理dur以外的部分
-    if (AddCubeUsageWithoutDur(processedData, metricSummaryHeaders))
+    withCubeUsage_ = CheckAndGetCubeUsageRelatedDataIndex(metricSummaryHeaders, cubeUsageIndex_);
+    if (withCubeUsage_)
     {
         metricSummaryHeaders.emplace_back("cube_utilization(%)");
     }
+    else
+    {
+        INFO("No need to calculate cube usage.");
+    }
 
-    if (metricSummaryHeaders.empty())
+    bool flag = true;
+    std::map<TaskId, std::vector<std::vector<std::string>>> processedData;
+    for (const auto &pair : dbPathAndDeviceID)
     {
-        ERROR("Processing data: get modified metric Summary failed, no metric data will be reserved.");
-        return false;
+        if (!TaskBasedProcessByDevice(pair, headers, metricDB, processedData))
+        {
+            ERROR("TaskBasedProcess: process data failed, dbPath is %.", pair.first);
+            flag = false;
+        }
     }
 
     MetricSummary processedMetric = MetricSummary(metricSummaryHeaders, processedData);
@@ -258,8 +271,12 @@ bool MetricProcessor::TaskBasedProcessByDevice(const std::pair<const std::string
                                                Analysis::Infra::DBInfo &metricDB,
                                                std::map<TaskId, std::vector<std::vector<std::string>>> &processedData)
 {
-    std::vector<std::vector<std::string>> oriData = GetTaskBasedData(dbPathAndDeviceID.first, headers, metricDB);
-
+    ColumnTable oriData;
+    if (!GetTaskBasedData(dbPathAndDeviceID.first, headers, metricDB, oriData))
+    {
+        ERROR("Get task-based data failed, dbPath is %.", dbPathAndDeviceID.first);
+        return false;
+    }
     if (!FormatTaskBasedData(oriData, processedData, dbPathAndDeviceID.second))
     {
         ERROR("FormatData failed, dbPath is %, deviceID is %.", dbPathAndDeviceID.first, dbPathAndDeviceID.second);
@@ -269,149 +286,111 @@ bool MetricProcessor::TaskBasedProcessByDevice(const std::pair<const std::string
     return true;
 }
 
-std::vector<std::vector<std::string>> MetricProcessor::GetTaskBasedData(const std::string &dbPath,
-                                                                        const std::vector<std::string> &headers,
-                                                                        DBInfo &metricDB)
+bool MetricProcessor::GetTaskBasedData(const std::string &dbPath, const std::vector<std::string> &headers,
+                                       DBInfo &metricDB, ColumnTable &oriData)
 {
-    std::vector<std::vector<std::string>> oriData;
-    std::vector<std::tuple<std::string>> lineData;
     auto version = Context::GetInstance().GetPlatformVersion(DEFAULT_DEVICE_ID, profPath_);
     const bool IS_CHIP_V1 = Context::GetInstance().IsChipV1(version);
 
-    MAKE_SHARED_RETURN_VALUE(metricDB.dbRunner, DBRunner, oriData, dbPath);
+    MAKE_SHARED_RETURN_VALUE(metricDB.dbRunner, DBRunner, false, dbPath);
     if (metricDB.dbRunner == nullptr)
     {
         ERROR("Create % connection failed.", dbPath);
-        return oriData;
+        return false;
     }
-    // 遍历tableColumns, 按列请求每个tableColumnKey的数据,再直接把vector<string> data列按表头顺序拼起来, 形成metric表
-    for (auto &header : headers)
+    // 指标列与taskId列在一条sql中查询, 只扫描一次表, 结果列依次为: 指标列..., subtask_id, stream_id, task_id, batch_id
+    std::vector<std::string> columns;
+    columns.reserve(headers.size() + TASK_ID_COLUMN_NUM);
+    for (const auto &header : headers)
     {
-        std::string sql;
-        if (header.find("cycle") != std::string::npos)
-        {
-            sql = "SELECT " + header + " FROM " + metricDB.tableName;
-        }
-        else
-        {
-            sql = "SELECT ROUND(" + header + ", 3) FROM " + metricDB.tableName;
-        }
-        if (!metricDB.dbRunner->QueryData(sql, lineData))
+        // 如果chip类型为chipV1, 对于chipV1不支持的表头, 直接把该表头对应的列数据置为 "N/A"
+        if (IS_CHIP_V1 && NOT_SUPPORT_PMU_FOR_CHIP_V1.find(header) != NOT_SUPPORT_PMU_FOR_CHIP_V1.end())
         {
-            ERROR("Query % data failed, db path is %.", header, dbPath);
-            continue;
+            INFO("For V1 chips, % data is not support, filling with N/A.", header);
+            columns.emplace_back("'" + Analysis::Common::NA + "'");
         }
-        // 如果chip类型为chipV1, 对于chipV1不支持的表头, 直接把该表头对应的列数据置为 "N/A"
-        if (IS_CHIP_V1)
+        else if (header.find("cycle") != std::string::npos)
         {
-            if (NOT_SUPPORT_PMU_FOR_CHIP_V1.find(header) != NOT_SUPPORT_PMU_FOR_CHIP_V1.end())
-            {
-                INFO("For V1 chips, % data is not support, filling with N/A.", header);
-                std::vector<std::string> tempVectorData(lineData.size(), Analysis::Common::NA);
-                oriData.emplace_back(tempVectorData);
-                continue;
-            }
+            columns.emplace_back(header);
         }
-        InsertLineDataToOriData(oriData, lineData);
-    }
-
-    std::vector<std::string> taskIdColumns = {"stream_id", "task_id", "batch_id"};
-    std::string subtask_id_format = "subtask_id";
-    if (!Context::GetInstance().IsChipV4(version))
-    {
-        subtask_id_format = "'" + Analysis::Common::NA + "' AS subtask_id";
-    }
-    taskIdColumns.insert(taskIdColumns.begin(), subtask_id_format);
-    // 获得taskIdColumns的数据, 插入oriData表
-    for (auto &taskIdColumn : taskIdColumns)
-    {
-        std::string sql = "SELECT " + taskIdColumn + " FROM " + metricDB.tableName;
-        if (!metricDB.dbRunner->QueryData(sql, lineData))
+        else
         {
-            ERROR("Query taskId data failed, db path is %.", dbPath);
-            continue;
+            columns.emplace_back("ROUND(" + header + ", 3)");
         }
-        InsertLineDataToOriData(oriData, lineData);
     }
-    return oriData;
-}
-
-void MetricProcessor::InsertLineDataToOriData(std::vector<std::vector<std::string>> &oriData,
-                                              std::vector<std::tuple<std::string>> &lineData)
-{
-    std::vector<std::string> tempVectorData;
-    tempVectorData.reserve(lineData.size());
-    for (auto &data : lineData)
+    // 非chipV4的subtask_id不作为匹配依据, 查询为NULL
+    columns.emplace_back(Context::GetInstance().IsChipV4(version) ? "subtask_id" : "NULL");
+    columns.insert(columns.end(), {"stream_id", "task_id", "batch_id"});
+    std::string sql = "SELECT " + Utils::Join(columns, ", ") + " FROM " + metricDB.tableName;
+    if (!metricDB.dbRunner->QueryColumns(sql, oriData))
     {
-        tempVectorData.emplace_back(std::get<0>(data));
+        ERROR("Query task-based data failed, db path is %.", dbPath);
+        return false;
     }
-    oriData.emplace_back(tempVectorData);
-    lineData.clear();
+    return true;
 }
 
-bool MetricProcessor::FormatTaskBasedData(const std::vector<std::vector<std::string>> &oriData,
+bool MetricProcessor::FormatTaskBasedData(const ColumnTable &oriData,
                                           std::map<TaskId, std::vector<std::vector<std::string>>> &processedData,
                                           const uint16_t &deviceId)
 {
     INFO("FormatTaskBasedData.");
-    if (oriData.empty() || oriData[0].empty())
+    if (oriData.Empty())
     {
         ERROR("Task-based original data is empty.");
         return false;
     }
-    const int DATA_OFFSET = 4;
-    const int KEY_OFFSET = 3;
-    // oriDatum.at(-3) = stream_id -2-task_id -1-batch_id -4-subtask_id==context_id
-    // subtask_id = N/A时不作为匹配依据, 以stream_id, task_id, batch_id 作为key进行group, 此时一个key可能对应多行数据
-    const auto colSize = oriData.size();
-    if (colSize < DATA_OFFSET)
+    if (oriData.ColumnCount() != metricNum_ + TASK_ID_COLUMN_NUM)
     {
         ERROR("Processed metric data is not complete, please check fetching data process.");
         return false;
     }
-    for (size_t row = 0; row < oriData[0].size(); ++row)
+    const size_t subtaskIdCol = metricNum_;
+    const size_t streamIdCol = metricNum_ + 1;
+    const size_t taskIdCol = metricNum_ + 2;  // 2: task_id
+    const size_t batchIdCol = metricNum_ + 3;  // 3: batch_id
+    std::tuple<double, uint16_t> cubeUsageInfo;
+    if (withCubeUsage_)
     {
-        std::vector<std::string> processedDatum;
-        for (size_t col = 0; col < colSize - DATA_OFFSET; ++col)
-        {
-            processedDatum.emplace_back(oriData[col][row]);
-        }
-        std::vector<uint32_t> tmpId;
-        for (size_t col = colSize - KEY_OFFSET; col < colSize; ++col)
+        cubeUsageInfo = GetCubeUsageByDeviceId(deviceId);
+    }
+    const size_t lineSize = metricNum_ + static_cast<size_t>(withMemoryBound_) + static_cast<size_t>(withCubeUsage_);
+    for (size_t row = 0; row < oriData.RowCount(); ++row)
+    {
+        uint32_t streamId = 0;
+        uint32_t taskId = 0;
+        uint32_t batchId = 0;
+        if (!oriData.GetUint32(streamIdCol, row, streamId) || !oriData.GetUint32(taskIdCol, row, taskId) ||
+            !oriData.GetUint32(batchIdCol, row, batchId))
         {
-            uint32_t temp;
-            if (Utils::StrToU32(temp, oriData[col][row]))
-            {
-                break;
-            }
-            tmpId.emplace_back(temp);
+            ERROR("Convert taskId info failed, row is %.", row);
+            continue;
         }
-        if (tmpId.size() < 3)
+        // subtask_id为NULL时不作为匹配依据, 以stream_id, task_id, batch_id 作为key进行group, 此时一个key可能对应多行数据
+        uint32_t contextId = UINT32_MAX;
+        if (oriData.GetType(subtaskIdCol, row) != ColumnTable::VALUE_NULL &&
+            !oriData.GetUint32(subtaskIdCol, row, contextId))
         {
-            ERROR("Convert taskId info failed, row is %.", row);
+            WARN("Convert context id failed, the row data will be discarded.");
             continue;
         }
-
-        uint32_t tempContextId = UINT32_MAX;
-        if (oriData[colSize - DATA_OFFSET][row] != Analysis::Common::NA)
+        std::vector<std::string> lineData;
+        lineData.reserve(lineSize);
+        for (size_t col = 0; col < metricNum_; ++col)
         {
-            if (Utils::StrToU32(tempContextId, oriData[colSize - DATA_OFFSET][row]) == ANALYSIS_ERROR)
-            {
-                WARN("Convert context id failed, the row data will be discarded.");
-                continue;
-            }
+            lineData.emplace_back(oriData.ToString(col, row));
         }
-        TaskId tempTaskId = {static_cast<uint16_t>(tmpId[0]), static_cast<uint16_t>(tmpId[2]), tmpId[1], tempContextId,
-                             deviceId};
-
-        if (processedData.find(tempTaskId) != processedData.end())
+        if (withMemoryBound_)
         {
-            processedData[tempTaskId].emplace_back(processedDatum);
+            AddMemoryBound(oriData, row, lineData);
         }
-        else
+        if (withCubeUsage_)
         {
-            processedData[tempTaskId] = std::vector<std::vector<std::string>>({processedDatum});
+            AddCubeUsageWithoutDur(oriData, row, cubeUsageInfo, lineData);
         }
+        TaskId tempTaskId = {static_cast<uint16_t>(streamId), static_cast<uint16_t>(batchId), taskId, contextId,
+                             deviceId};
+        processedData[tempTaskId].emplace_back(std::move(lineData));
     }
 
     if (processedData.empty())
@@ -421,44 +400,33 @@ bool MetricProcessor::FormatTaskBasedData(const std::vector<std::vector<std::str
     return !processedData.empty();
 }
 
-bool MetricProcessor::AddMemoryBound(std::map<TaskId, std::vector<std::vector<std::string>>> &processedData,
-                                     std::vector<std::string> &headers)
+void MetricProcessor::AddMemoryBound(const ColumnTable &oriData, size_t row, std::vector<std::string> &lineData)
 {
-    INFO("Calculating memory bound...");
-    std::vector<uint32_t> needDataIndex;
-    if (!CheckAndGetMemoryBoundRelatedDataIndex(headers, needDataIndex))
-    {
-        INFO("can't find memory bound needed column, no memory bound data added.");
-        return false;
-    }
-    // 若字段存在, 则进行下一步计算, 遍历processedData, lineData用string存储,
-    // needDataIndex[0] mac_ratio_index, [1] vec_ratio_index, [2] mte2_ratio_index
+    // memoryBoundIndex_[0] mac_ratio_index, [1] vec_ratio_index, [2] mte2_ratio_index
     const int macRatioIndex = 0;
     const int vecRatioIndex = 1;
     const int mte2RatioIndex = 2;
-    for (auto &processedDatum : processedData)
+    const size_t macRatioCol = memoryBoundIndex_[macRatioIndex];
+    const size_t vecRatioCol = memoryBoundIndex_[vecRatioIndex];
+    const size_t mte2RatioCol = memoryBoundIndex_[mte2RatioIndex];
+    if (!oriData.IsNumeric(macRatioCol, row) || !oriData.IsNumeric(vecRatioCol, row) ||
+        !oriData.IsNumeric(mte2RatioCol, row))
     {
-        for (auto &lineData : processedDatum.second)
-        {
-            double macRatioDouble, vecRatioDouble, mte2RatioDouble;
-            if (Utils::StrToDouble(macRatioDouble, lineData[needDataIndex[macRatioIndex]]) ||
-                Utils::StrToDouble(vecRatioDouble, lineData[needDataIndex[vecRatioIndex]]) ||
-                Utils::StrToDouble(mte2RatioDouble, lineData[needDataIndex[mte2RatioIndex]]))
-            {
-                WARN("failed to convert memory bound data to double, set memory bound data N/A");
-                lineData.emplace_back(Analysis::Common::NA);
-                continue;
-            }
-            if (Utils::IsDoubleEqual(macRatioDouble, 0.0) || Utils::IsDoubleEqual(vecRatioDouble, 0.0))
-            {
-                lineData.emplace_back(Analysis::Common::NA);
-                continue;
-            }
-            lineData.emplace_back(std::to_string(mte2RatioDouble / std::max(macRatioDouble, vecRatioDouble)));
-        }
+        WARN("failed to convert memory bound data to double, set memory bound data N/A");
+        lineData.emplace_back(Analysis::Common::NA);
+        return;
     }
-    return true;
+    double macRatioDouble = oriData.GetDouble(macRatioCol, row);
+    double vecRatioDouble = oriData.GetDouble(vecRatioCol, row);
+    if (Utils::IsDoubleEqual(macRatioDouble, 0.0) || Utils::IsDoubleEqual(vecRatioDouble, 0.0))
+    {
+        lineData.emplace_back(Analysis::Common::NA);
+        return;
+    }
+    lineData.emplace_back(std::to_string(oriData.GetDouble(mte2RatioCol, row) /
+                                         std::max(macRatioDouble, vecRatioDouble)));
 }
+
 bool MetricProcessor::CheckAndGetMemoryBoundRelatedDataIndex(const std::vector<std::string> &headers,
                                                              std::vector<uint32_t> &neededDataIndex)
 {
@@ -541,46 +509,29 @@ std::tuple<double, uint16_t> MetricProcessor::GetCubeUsageByDeviceId(uint16_t de
     }
 }
 
-bool MetricProcessor::AddCubeUsageWithoutDur(std::map<TaskId, std::vector<std::vector<std::string>>> &processedData,
-                                             const std::vector<std::string> &headers)
+void MetricProcessor::AddCubeUsageWithoutDur(const ColumnTable &oriData, size_t row,
+                                             const std::tuple<double, uint16_t> &cubeUsageInfo,
+                                             std::vector<std::string> &lineData)
 {
-    INFO("Add cube usage");
-    std::vector<uint32_t> needDataIndex;
-    if (!CheckAndGetCubeUsageRelatedDataIndex(headers, needDataIndex))
+    double freq;
+    uint16_t coreNum;
+    std::tie(freq, coreNum) = cubeUsageInfo;
+    // cubeUsageIndex_[0] mac_ratio_index, [1] total_cycle
+    const size_t macRatioCol = cubeUsageIndex_[0];
+    const size_t totalCycleCol = cubeUsageIndex_[1];
+    if (lineData[macRatioCol] == Analysis::Common::NA || Utils::IsDoubleEqual(freq, 0.0) || coreNum == 0)
     {
-        INFO("No need to calculate cube usage.");
-        return false;
+        lineData.emplace_back(Analysis::Common::NA);
+        return;
     }
-    // 若字段存在, 则进行下一步计算, 遍历processedData, lineData用string存储,
-    // needDataIndex[0] mac_ratio_index, [1] total_cycle
-    for (auto &processedDatum : processedData)
+    uint64_t totalCycle;
+    if (!oriData.IsNumeric(macRatioCol, row) || !oriData.GetUint64(totalCycleCol, row, totalCycle))
     {
-        const auto cubeUsageInfo = GetCubeUsageByDeviceId(processedDatum.first.deviceId);
-        double freq;
-        uint16_t coreNum;
-        std::tie(freq, coreNum) = cubeUsageInfo;
-
-        for (auto &lineData : processedDatum.second)
-        {
-            if (lineData[needDataIndex[0]] == Analysis::Common::NA || Utils::IsDoubleEqual(freq, 0.0) || coreNum == 0)
-            {
-                lineData.emplace_back(Analysis::Common::NA);
-                continue;
-            }
-            double macRatioDouble;
-            uint64_t totalCycle;
-            if ((Utils::StrToDouble(macRatioDouble, lineData[needDataIndex[0]]) != ANALYSIS_OK) ||
-                (Utils::StrToU64(totalCycle, lineData[needDataIndex[1]]) != ANALYSIS_OK))
-            {
-                WARN("failed to convert cube usage data to double, set usage data N/A");
-                lineData.emplace_back(Analysis::Common::NA);
-                continue;
-            }
-
-            lineData.push_back(std::to_string(static_cast<double>(totalCycle) / (freq * coreNum) * PERCENTAGE_FACTOR));
-        }
+        WARN("failed to convert cube usage data to double, set usage data N/A");
+        lineData.emplace_back(Analysis::Common::NA);
+        return;
     }
-    return true;
+    lineData.push_back(std::to_string(static_cast<double>(totalCycle) / (freq * coreNum) * PERCENTAGE_FACTOR));
 }
 
 std::vector<std::string> MetricProcessor::ModifySummaryHeaders(const std::vector<std::string> &oriHeaders)
@@ -41,10 +41,10 @@ private:
                                   const std::vector<std::string> &headers, DBInfo &metricDB,
                                   std::map<TaskId, std::vector<std::vector<std::string>>> &dataInventory);
 
-    std::vector<std::vector<std::string>> GetTaskBasedData(const std::string &dbPath,
-                                                           const std::vector<std::string> &headers, DBInfo &metricDB);
+    bool GetTaskBasedData(const std::string &dbPath, const std::vector<std::string> &headers, DBInfo &metricDB,
+                          Infra::ColumnTable &oriData);
 
-    bool FormatTaskBasedData(const std::vector<std::vector<std::string>> &oriData,
+    bool FormatTaskBasedData(const Infra::ColumnTable &oriData,
                              std::map<TaskId, std::vector<std::vector<std::string>>> &processedData,
                              const uint16_t &deviceId);
 
@@ -53,11 +53,10 @@ private:
     bool CheckAndGetCubeUsageRelatedDataIndex(const std::vector<std::string> &headers,
                                               std::vector<uint32_t> &neededDataIndex);
     std::tuple<double, uint16_t> GetCubeUsageByDeviceId(uint16_t deviceId);
-    bool AddCubeUsageWithoutDur(std::map<TaskId, std::vector<std::vector<std::string>>> &processedData,
-                                const std::vector<std::string> &headers);
+    void AddCubeUsageWithoutDur(const Infra::ColumnTable &oriData, size_t row,
+                                const std::tuple<double, uint16_t> &cubeUsageInfo, std::vector<std::string> &lineData);
 
-    bool AddMemoryBound(std::map<TaskId, std::vector<std::vector<std::string>>> &processedData,
-                        std::vector<std::string> &headers);
+    void AddMemoryBound(const Infra::ColumnTable &oriData, size_t row, std::vector<std::string> &lineData);
 
     bool CheckAndGetMemoryBoundRelatedDataIndex(const std::vector<std::string> &headers,
                                                 std::vector<uint32_t> &neededDataIndex);
@@ -67,11 +66,13 @@ private:
 
     std::vector<std::string> ModifySummaryHeaders(const std::vector<std::string> &oriHeaders);
 
-    void InsertLineDataToOriData(std::vector<std::vector<std::string>> &oriData,
-                                 std::vector<std::tuple<std::string>> &lineData);
-
 private:
     std::unordered_map<uint16_t, std::tuple<double, uint16_t>> cubeUsageInfo_;
+    size_t metricNum_ = 0;
+    bool withMemoryBound_ = false;
+    bool withCubeUsage_ = false;
+    std::vector<uint32_t> memoryBoundIndex_;
+    std::vector<uint32_t> cubeUsageIndex_;
 };
 
 } // Domain
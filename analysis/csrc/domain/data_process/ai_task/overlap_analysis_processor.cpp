@@ -17,9 +17,15 @@
 #include "analysis/csrc/domain/data_process/ai_task/overlap_analysis_processor.h"
 
 #include <algorithm>
+#include <set>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 #include "analysis/csrc/application/database/db_constant.h"
+#include "analysis/csrc/domain/valueobject/include/task_join.h"
+#include "analysis/csrc/infrastructure/utils/thread_pool.h"
 #include "analysis/csrc/infrastructure/utils/time_logger.h"
 #include "analysis/csrc/infrastructure/utils/utils.h"
 
@@ -34,19 +40,55 @@ namespace
 {
 const std::set<std::string> FILTER_TYPE = {"KERNEL_AICORE",  "KERNEL_AIVEC",     "FFTS_PLUS",        "KERNEL_MIX_AIC",
                                            "KERNEL_MIX_AIV", "PROFILING_ENABLE", "PROFILING_DISABLE"};
+const uint32_t MAX_DEVICE_THREADS = 8;
 
-void SepOneTask(std::vector<TimeDuration> &times, std::set<uint16_t> &mc2StreamsTable, TaskInfoData &task,
-                std::unordered_map<uint16_t, std::vector<TimeDuration>> &compSections)
+enum HostTypeCode : uint8_t
 {
-    if (mc2StreamsTable.find(task.streamId) != mc2StreamsTable.end() || EndsWith(task.opName, AICPU_KERNEL) ||
-        EndsWith(task.opName, AIV_KERNEL))
+    HOST_TYPE_COUNTED = 0,
+    HOST_TYPE_FILTERED
+};
+
+// 预先将每个任务的hostType解析为整数编码，hostType取值只有少数几种，每种只查一次FILTER_TYPE
+// 相邻任务的hostType大多相同，先与上一个值比较以减少查表
+std::vector<uint8_t> EncodeHostTypes(const std::vector<AscendTaskData> &tasks)
+{
+    std::vector<uint8_t> codes;
+    if (!Utils::Resize(codes, tasks.size()))
     {
-        return;
+        ERROR("Resize host type codes failed.");
+        return codes;
     }
-    for (auto &timeDur : times)
+    std::unordered_map<std::string, uint8_t> codeTable;
+    const std::string *last = nullptr;
+    uint8_t lastCode = HOST_TYPE_COUNTED;
+    for (size_t i = 0; i < tasks.size(); ++i)
     {
-        compSections[task.deviceId].emplace_back(timeDur);
+        const std::string &hostType = tasks[i].hostType;
+        if (last == nullptr || *last != hostType)
+        {
+            auto it = codeTable.find(hostType);
+            if (it == codeTable.end())
+            {
+                bool filtered = FILTER_TYPE.find(hostType) != FILTER_TYPE.end();
+                it = codeTable.emplace(hostType, filtered ? HOST_TYPE_FILTERED : HOST_TYPE_COUNTED).first;
+            }
+            last = &hostType;
+            lastCode = it->second;
+        }
+        codes[i] = lastCode;
     }
+    return codes;
+}
+
+inline TaskKey TaskKeyOf(uint16_t deviceId, uint32_t streamId, uint32_t batchId, uint32_t taskId, uint32_t contextId)
+{
+    return PackTaskKey(deviceId, static_cast<uint16_t>(streamId), static_cast<uint16_t>(batchId), taskId, contextId);
+}
+
+bool IsExcludedCompTask(const TaskInfoData &task, const std::set<uint32_t> &mc2StreamsTable)
+{
+    return mc2StreamsTable.find(task.streamId) != mc2StreamsTable.end() || EndsWith(task.opName, AICPU_KERNEL) ||
+           EndsWith(task.opName, AIV_KERNEL);
 }
 }  // namespace
 
@@ -99,59 +141,30 @@ void OverlapAnalysisProcessor::RecordCompAndCommTaskTime(
     const std::shared_ptr<std::vector<KfcOpData>> &kfcOps,
     const std::shared_ptr<std::vector<MC2CommInfoData>> &mc2CommInfos)
 {
-    std::map<TaskId, std::vector<TimeDuration>> allTaskPool;
-    if (ascendTasks)
-    {
-        for (auto &task : *ascendTasks)
-        {
-            TaskId id{static_cast<uint16_t>(task.streamId), static_cast<uint16_t>(task.batchId), task.taskId,
-                      task.contextId, task.deviceId};
-            TimeDuration timePair{task.timestamp, task.timestamp + static_cast<uint64_t>(task.duration)};
-            if (allTaskPool.find(id) != allTaskPool.end())
-            {
-                allTaskPool[id].emplace_back(timePair);
-            }
-            else
-            {
-                allTaskPool[id] = {timePair};
-            }
-            deviceIds_.insert(task.deviceId);
-        }
-    }
-
-    std::unordered_map<uint16_t, std::vector<TimeDuration>> compSections;
-    SepCompTaskAndKFCCommSections(allTaskPool, compTasks, mc2CommInfos, compSections);
-    std::unordered_map<uint16_t, std::vector<TimeDuration>> tradCommSections;
-    GetCommTaskSections(tradCommSections, commOps);
-    GetCommTaskSections(tradCommSections, kfcOps);
-    UpdateTaskTimeExtremes(ascendTasks);
-
-    for (auto &pair : tradCommSections)
+    if (!ascendTasks)
     {
-        TimeLogger logger("sort and union all trad comm task in overlap analysis for device " +
-                          std::to_string(pair.first));
-        std::sort(pair.second.begin(), pair.second.end());
-        commTaskRecords_[pair.first] = UnionOneSet(pair.second);
+        return;
     }
-    for (auto &pair : compSections)
+    for (const auto &task : *ascendTasks)
     {
-        TimeLogger logger("sort and union all comp task in overlap analysis for device " + std::to_string(pair.first));
-        std::sort(pair.second.begin(), pair.second.end());
-        compTaskRecords_[pair.first] = UnionOneSet(pair.second);
+        devices_[task.deviceId];
     }
+    SepCompTaskAndKFCCommSections(*ascendTasks, compTasks, mc2CommInfos);
+    GetCommTaskSections(commOps);
+    GetCommTaskSections(kfcOps);
+    UpdateTaskTimeExtremes(*ascendTasks);
 }
 
 void OverlapAnalysisProcessor::SepCompTaskAndKFCCommSections(
-    std::map<TaskId, std::vector<TimeDuration>> &allTaskPool,
+    const std::vector<AscendTaskData> &ascendTasks,
     const std::shared_ptr<std::vector<TaskInfoData>> &compTasks,
-    const std::shared_ptr<std::vector<MC2CommInfoData>> &mc2CommInfos,
-    std::unordered_map<uint16_t, std::vector<TimeDuration>> &compSections)
+    const std::shared_ptr<std::vector<MC2CommInfoData>> &mc2CommInfos)
 {
     if (!compTasks)
     {
         return;
     }
-    std::set<uint16_t> mc2StreamsTable;
+    std::set<uint32_t> mc2StreamsTable;
     if (mc2CommInfos)
     {
         for (auto &mc2CommInfo : *mc2CommInfos)
@@ -159,34 +172,61 @@ void OverlapAnalysisProcessor::SepCompTaskAndKFCCommSections(
             mc2StreamsTable.insert(mc2CommInfo.aiCpuKfcStreamId);
         }
     }
+    std::vector<TaskKey> keys;
+    if (!Utils::Resize(keys, ascendTasks.size()))
+    {
+        ERROR("Resize task keys failed.");
+        return;
+    }
+    for (size_t i = 0; i < ascendTasks.size(); ++i)
+    {
+        const auto &task = ascendTasks[i];
+        keys[i] = TaskKeyOf(task.deviceId, task.streamId, task.batchId, task.taskId, task.contextId);
+    }
+    TaskKeyIndex index;
+    std::vector<uint8_t> usedGroups;
+    if (!index.Build(keys) || !Utils::Resize(usedGroups, index.GroupCount()))
+    {
+        ERROR("Build task index for overlap analysis failed.");
+        return;
+    }
     uint64_t mismatchCount = 0;
-    std::set<TaskId> usedTaskIds;
-    for (auto &task : *compTasks)
+    std::unordered_set<TaskKey, TaskKeyHasher> mismatchKeys;
+    // 同一TaskId的计算任务只取第一个，按其决定是否计入计算区间；未匹配的TaskId同样只计数一次
+    for (const auto &task : *compTasks)
     {
-        TaskId id{static_cast<uint16_t>(task.streamId), static_cast<uint16_t>(task.batchId), task.taskId,
-                  task.contextId, task.deviceId};
-        if (usedTaskIds.find(id) != usedTaskIds.end())
+        TaskKey key = TaskKeyOf(task.deviceId, task.streamId, task.batchId, task.taskId, task.contextId);
+        size_t group = index.FindGroup(key);
+        if (group == INVALID_JOIN_ROW)
+        {
+            if (mismatchKeys.insert(key).second)
+            {
+                mismatchCount++;
+            }
+            continue;
+        }
+        if (usedGroups[group] != 0)
         {
             continue;
         }
-        usedTaskIds.insert(id);
-        auto it = allTaskPool.find(id);
-        if (it != allTaskPool.end())
+        usedGroups[group] = 1;
+        if (IsExcludedCompTask(task, mc2StreamsTable))
         {
-            SepOneTask(it->second, mc2StreamsTable, task, compSections);
+            continue;
         }
-        else
+        auto &comp = devices_[task.deviceId].comp;
+        JoinRows rows = index.GroupRows(group);
+        for (const auto *row = rows.begin; row != rows.end; ++row)
         {
-            mismatchCount++;
+            const auto &ascendTask = ascendTasks[*row];
+            comp.Add(ascendTask.timestamp, ascendTask.timestamp + static_cast<uint64_t>(ascendTask.duration));
         }
     }
     INFO("Find % comp tasks not in all tasks.", mismatchCount);
 }
 
 template <typename T>
-void OverlapAnalysisProcessor::GetCommTaskSections(
-    std::unordered_map<uint16_t, std::vector<TimeDuration>> &commOpSections,
-    const std::shared_ptr<std::vector<T>> &commOps)
+void OverlapAnalysisProcessor::GetCommTaskSections(const std::shared_ptr<std::vector<T>> &commOps)
 {
     if (!commOps)
     {
@@ -194,229 +234,131 @@ void OverlapAnalysisProcessor::GetCommTaskSections(
     }
     for (auto &op : *commOps)
     {
-        deviceIds_.insert(op.deviceId);
-        commOpSections[op.deviceId].emplace_back(op.timestamp, op.end);
+        devices_[op.deviceId].comm.Add(op.timestamp, op.end);
     }
 }
 
-void OverlapAnalysisProcessor::UpdateTaskTimeExtremes(const std::shared_ptr<std::vector<AscendTaskData>> &ascendTasks)
+void OverlapAnalysisProcessor::UpdateTaskTimeExtremes(const std::vector<AscendTaskData> &ascendTasks)
 {
-    for (const auto &deviceId : deviceIds_)
+    auto hostTypeCodes = EncodeHostTypes(ascendTasks);
+    if (hostTypeCodes.size() != ascendTasks.size())
     {
-        end_[deviceId] = 0;
-        begin_[deviceId] = UINT64_MAX;
+        return;
     }
-    for (const AscendTaskData &task : *ascendTasks)
+    for (size_t i = 0; i < ascendTasks.size(); ++i)
     {
-        if (FILTER_TYPE.find(task.hostType) != FILTER_TYPE.end())
+        if (hostTypeCodes[i] == HOST_TYPE_FILTERED)
         {
             continue;
         }
+        const AscendTaskData &task = ascendTasks[i];
         uint64_t taskStartTime = task.timestamp;
         uint64_t taskEndTime = task.timestamp + static_cast<uint64_t>(task.duration);
-        uint16_t deviceId = task.deviceId;
-        if (taskEndTime > end_[deviceId])
-        {
-            end_[deviceId] = taskEndTime;
-        }
-        if (taskStartTime < begin_[deviceId])
-        {
-            begin_[deviceId] = taskStartTime;
-        }
+        auto &device = devices_[task.deviceId];
+        device.end = std::max(device.end, taskEndTime);
+        device.begin = std::min(device.begin, taskStartTime);
     }
 }
 
-void OverlapAnalysisProcessor::UpdateTimeExtremesBySections(uint16_t deviceId,
-                                                            const std::vector<TimeDuration> &sections)
+void OverlapAnalysisProcessor::UpdateTimeExtremesBySections(const IntervalSet &sections, DeviceSections &device)
 {
-    for (auto &section : sections)
+    // 区间已合并，起止时间均单调递增
+    if (sections.Empty())
     {
-        begin_[deviceId] = std::min(begin_[deviceId], section.start);
-        end_[deviceId] = std::max(end_[deviceId], section.end);
+        return;
     }
+    device.begin = std::min(device.begin, sections.Start(0));
+    device.end = std::max(device.end, sections.End(sections.Size() - 1));
 }
 
 std::vector<OverlapAnalysisData> OverlapAnalysisProcessor::BuildOverlapAnalysisData()
 {
-    std::vector<OverlapAnalysisData> overlapData;
-    if (!Utils::Reserve(overlapData, deviceIds_.size()))
+    TimeLogger logger("build overlap analysis data for " + std::to_string(devices_.size()) + " devices");
+    std::vector<std::pair<uint16_t, DeviceSections *>> devices;
+    for (auto &device : devices_)
     {
-        ERROR("Reserve overlap analysis data error");
-        return {};
+        devices.emplace_back(device.first, &device.second);
     }
-    for (auto &deviceId : deviceIds_)
+    std::vector<std::vector<OverlapAnalysisData>> deviceEvents(devices.size());
+    uint32_t threadsNum = std::min({static_cast<uint32_t>(devices.size()), std::thread::hardware_concurrency(),
+                                    MAX_DEVICE_THREADS});
+    if (threadsNum <= 1)
     {
-        auto computeSections = compTaskRecords_.find(deviceId) == compTaskRecords_.end() ? std::vector<TimeDuration>()
-                                                                                         : compTaskRecords_[deviceId];
-        auto communicationSections = commTaskRecords_.find(deviceId) == commTaskRecords_.end()
-                                         ? std::vector<TimeDuration>()
-                                         : commTaskRecords_[deviceId];
-        auto commNotOverlapCompSections = GetDifferenceSet(communicationSections, computeSections);
-        UpdateTimeExtremesBySections(deviceId, computeSections);
-        UpdateTimeExtremesBySections(deviceId, communicationSections);
-        AppendEvents(deviceId, computeSections, OverlapAnalysisType::COMPUTE, overlapData);
-        AppendEvents(deviceId, communicationSections, OverlapAnalysisType::COMMUNICATION, overlapData);
-        AppendEvents(deviceId, commNotOverlapCompSections, OverlapAnalysisType::COMM_NOT_OVERLAP_COMP, overlapData);
-        if (end_[deviceId] > begin_[deviceId])
+        for (size_t i = 0; i < devices.size(); ++i)
         {
-            auto unionRecords = UnionTwoSet(computeSections, communicationSections);
-            std::vector<TimeDuration> allTimeSection{{begin_[deviceId], end_[deviceId]}};
-            AppendEvents(deviceId, GetDifferenceSet(allTimeSection, unionRecords), OverlapAnalysisType::FREE,
-                         overlapData);
+            BuildDeviceEvents(devices[i].first, *devices[i].second, 0, deviceEvents[i]);
         }
     }
-    return overlapData;
-}
-
-void OverlapAnalysisProcessor::AppendEvents(uint16_t deviceId, const std::vector<TimeDuration> &sections,
-                                            OverlapAnalysisType type, std::vector<OverlapAnalysisData> &events)
-{
-    for (auto &section : sections)
+    else
     {
-        if (section.end <= section.start)
+        // 各device的区间相互独立，按device并行，device内排序使用单线程
+        ThreadPool pool(threadsNum);
+        pool.Start();
+        for (size_t i = 0; i < devices.size(); ++i)
         {
-            continue;
+            pool.AddTask([&devices, &deviceEvents, i]() {
+                BuildDeviceEvents(devices[i].first, *devices[i].second, 1, deviceEvents[i]);
+            });
         }
-        OverlapAnalysisData event;
-        event.deviceId = deviceId;
-        event.timestamp = section.start;
-        event.duration = section.end - section.start;
-        event.type = type;
-        events.emplace_back(event);
-    }
-}
-
-std::vector<TimeDuration> OverlapAnalysisProcessor::UnionTwoSet(const std::vector<TimeDuration> &vecA,
-                                                                const std::vector<TimeDuration> &vecB)
-{
-    std::vector<TimeDuration> vec;
-    if (!Utils::Reserve(vec, vecA.size() + vecB.size()))
-    {
-        ERROR("Reserve vec error");
-        return {};
+        pool.WaitAllTasks();
+        pool.Stop();
     }
-    vec.insert(vec.end(), vecA.begin(), vecA.end());
-    vec.insert(vec.end(), vecB.begin(), vecB.end());
-    std::sort(vec.begin(), vec.end());
-    return UnionOneSet(vec);
-}
-
-std::vector<TimeDuration> OverlapAnalysisProcessor::GetDifferenceSet(const std::vector<TimeDuration> &vecA,
-                                                                     const std::vector<TimeDuration> &vecB)
-{
-    if (vecA.empty() || vecB.empty())
+    size_t total = 0;
+    for (const auto &events : deviceEvents)
     {
-        return vecA;
-    }
-    std::vector<TimeDuration> res;
-    uint32_t i = 0;
-    uint32_t j = 0;
-    uint64_t lastRecordEnd = vecA.front().start;
-    while (i < vecA.size() && j < vecB.size())
-    {
-        while (j < vecB.size() && vecB[j].end <= vecA[i].start)
-        {
-            j++;
-        }
-        if (j >= vecB.size())
-        {
-            break;
-        }
-        if (vecA[i].end <= vecB[j].start)
-        {
-            ProcessSetAIsOnTheLeftOfSetB(vecA[i], lastRecordEnd, res);
-            i++;
-            continue;
-        }
-        else if (vecA[i].start >= vecB[j].start && vecA[i].end <= vecB[j].end)
-        {
-            i++;
-            continue;
-        }
-        else if ((vecA[i].start <= vecB[j].start && vecA[i].end >= vecB[j].end) ||
-                 (vecA[i].end >= vecB[j].start && vecA[i].start <= vecB[j].start))
-        {
-            ProcessLeftOfSetAIntersectRightOfSetBOrSetAContainsSetB(vecA[i], vecB[j], lastRecordEnd, res);
-            j++;
-            continue;
-        }
-        else if (vecA[i].start >= vecB[j].start && vecA[i].start <= vecB[j].end)
-        {
-            lastRecordEnd = vecB[j].end;
-            j++;
-            continue;
-        }
-        else
-        {
-            ERROR("Illegal section situation, secA: (%, %), secB: (%, %)", vecA[i].start, vecA[i].end, vecB[j].start,
-                  vecB[j].end);
-            i++;
-        }
+        total += events.size();
     }
-    while (i < vecA.size())
+    std::vector<OverlapAnalysisData> overlapData;
+    if (!Utils::Reserve(overlapData, total))
     {
-        uint64_t startRecord = std::max(vecA[i].start, lastRecordEnd);
-        if (startRecord < vecA[i].end)
-        {
-            res.emplace_back(startRecord, vecA[i].end);
-        }
-        lastRecordEnd = vecA[i].end;
-        i++;
+        ERROR("Reserve overlap analysis data error");
+        return {};
     }
-    return res;
-}
-
-void OverlapAnalysisProcessor::ProcessSetAIsOnTheLeftOfSetB(const TimeDuration &durationA, uint64_t &lastRecordEnd,
-                                                            std::vector<TimeDuration> &res)
-{
-    if (durationA.end >= lastRecordEnd)
+    for (auto &events : deviceEvents)
     {
-        uint64_t recordStart = std::max(lastRecordEnd, durationA.start);
-        if (recordStart < durationA.end)
-        {
-            res.emplace_back(recordStart, durationA.end);
-        }
-        lastRecordEnd = durationA.end;
+        overlapData.insert(overlapData.end(), std::make_move_iterator(events.begin()),
+                           std::make_move_iterator(events.end()));
     }
+    return overlapData;
 }
 
-void OverlapAnalysisProcessor::ProcessLeftOfSetAIntersectRightOfSetBOrSetAContainsSetB(const TimeDuration &durationA,
-                                                                                       const TimeDuration &durationB,
-                                                                                       uint64_t &lastRecordEnd,
-                                                                                       std::vector<TimeDuration> &res)
+void OverlapAnalysisProcessor::BuildDeviceEvents(uint16_t deviceId, DeviceSections &sections,
+                                                 uint32_t sortThreadsNum, std::vector<OverlapAnalysisData> &events)
 {
-    if (durationB.start >= lastRecordEnd)
+    sections.comp.Normalize(sortThreadsNum);
+    sections.comm.Normalize(sortThreadsNum);
+    auto commNotOverlapCompSections = IntervalSet::Difference(sections.comm, sections.comp);
+    UpdateTimeExtremesBySections(sections.comp, sections);
+    UpdateTimeExtremesBySections(sections.comm, sections);
+    AppendEvents(deviceId, sections.comp, OverlapAnalysisType::COMPUTE, events);
+    AppendEvents(deviceId, sections.comm, OverlapAnalysisType::COMMUNICATION, events);
+    AppendEvents(deviceId, commNotOverlapCompSections, OverlapAnalysisType::COMM_NOT_OVERLAP_COMP, events);
+    if (sections.end > sections.begin)
     {
-        uint64_t recordStart = std::max(lastRecordEnd, durationA.start);
-        if (recordStart < durationB.start)
-        {
-            res.emplace_back(recordStart, durationB.start);
-        }
-        lastRecordEnd = durationB.end;
+        IntervalSet allTimeSection;
+        allTimeSection.Add(sections.begin, sections.end);
+        auto busySections = IntervalSet::Union(sections.comp, sections.comm);
+        AppendEvents(deviceId, IntervalSet::Difference(allTimeSection, busySections), OverlapAnalysisType::FREE,
+                     events);
     }
 }
 
-std::vector<TimeDuration> OverlapAnalysisProcessor::UnionOneSet(const std::vector<TimeDuration> &vecA)
+void OverlapAnalysisProcessor::AppendEvents(uint16_t deviceId, const IntervalSet &sections, OverlapAnalysisType type,
+                                            std::vector<OverlapAnalysisData> &events)
 {
-    if (vecA.empty())
+    for (size_t i = 0; i < sections.Size(); ++i)
     {
-        return {};
-    }
-    std::vector<TimeDuration> merged;
-    for (auto &i : vecA)
-    {
-        uint64_t left = i.start;
-        uint64_t right = i.end;
-        if (merged.empty() || merged.back().end < left)
+        if (sections.End(i) <= sections.Start(i))
         {
-            merged.emplace_back(left, right);
-        }
-        else
-        {
-            merged.back().end = std::max(merged.back().end, right);
+            continue;
         }
+        OverlapAnalysisData event;
+        event.deviceId = deviceId;
+        event.timestamp = sections.Start(i);
+        event.duration = sections.End(i) - sections.Start(i);
+        event.type = type;
+        events.emplace_back(event);
     }
-    return merged;
 }
 }  // namespace Domain
 }  // namespace Analysis
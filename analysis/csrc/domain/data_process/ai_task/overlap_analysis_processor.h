@@ -18,18 +18,15 @@
 #define ANALYSIS_DOMAIN_OVERLAP_ANALYSIS_PROCESSOR_H
 
 #include <map>
-#include <set>
-#include <unordered_map>
 
 #include "analysis/csrc/domain/data_process/data_processor.h"
-#include "analysis/csrc/domain/entities/time/time_duration.h"
 #include "analysis/csrc/domain/entities/viewer_data/ai_task/include/ascend_task_data.h"
 #include "analysis/csrc/domain/entities/viewer_data/ai_task/include/communication_info_data.h"
 #include "analysis/csrc/domain/entities/viewer_data/ai_task/include/kfc_turn_data.h"
 #include "analysis/csrc/domain/entities/viewer_data/ai_task/include/mc2_comm_info_data.h"
 #include "analysis/csrc/domain/entities/viewer_data/ai_task/include/task_info_data.h"
 #include "analysis/csrc/domain/entities/viewer_data/system/include/overlap_analysis_data.h"
-#include "analysis/csrc/domain/valueobject/include/task_id.h"
+#include "analysis/csrc/infrastructure/utils/interval_set.h"
 
 namespace Analysis
 {
@@ -42,43 +39,37 @@ class OverlapAnalysisProcessor : public DataProcessor
     explicit OverlapAnalysisProcessor(const std::string &profPath);
 
    private:
+    // 单个device的计算、通信区间以及任务时间范围
+    struct DeviceSections
+    {
+        Utils::IntervalSet comp;
+        Utils::IntervalSet comm;
+        uint64_t begin = UINT64_MAX;
+        uint64_t end = 0;
+    };
+
     bool Process(DataInventory &dataInventory) override;
     void RecordCompAndCommTaskTime(const std::shared_ptr<std::vector<AscendTaskData>> &ascendTasks,
                                    const std::shared_ptr<std::vector<TaskInfoData>> &compTasks,
                                    const std::shared_ptr<std::vector<CommunicationOpData>> &commOps,
                                    const std::shared_ptr<std::vector<KfcOpData>> &kfcOps,
                                    const std::shared_ptr<std::vector<MC2CommInfoData>> &mc2CommInfos);
-    static void SepCompTaskAndKFCCommSections(std::map<TaskId, std::vector<TimeDuration>> &allTaskPool,
-                                              const std::shared_ptr<std::vector<TaskInfoData>> &compTasks,
-                                              const std::shared_ptr<std::vector<MC2CommInfoData>> &mc2CommInfos,
-                                              std::unordered_map<uint16_t, std::vector<TimeDuration>> &compSections);
+    void SepCompTaskAndKFCCommSections(const std::vector<AscendTaskData> &ascendTasks,
+                                       const std::shared_ptr<std::vector<TaskInfoData>> &compTasks,
+                                       const std::shared_ptr<std::vector<MC2CommInfoData>> &mc2CommInfos);
     template <typename T>
-    void GetCommTaskSections(std::unordered_map<uint16_t, std::vector<TimeDuration>> &commOpSections,
-                             const std::shared_ptr<std::vector<T>> &commOps);
-    void UpdateTaskTimeExtremes(const std::shared_ptr<std::vector<AscendTaskData>> &ascendTasks);
-    void UpdateTimeExtremesBySections(uint16_t deviceId, const std::vector<TimeDuration> &sections);
+    void GetCommTaskSections(const std::shared_ptr<std::vector<T>> &commOps);
+    void UpdateTaskTimeExtremes(const std::vector<AscendTaskData> &ascendTasks);
     std::vector<OverlapAnalysisData> BuildOverlapAnalysisData();
-    static void AppendEvents(uint16_t deviceId, const std::vector<TimeDuration> &sections, OverlapAnalysisType type,
+    static void BuildDeviceEvents(uint16_t deviceId, DeviceSections &sections, uint32_t sortThreadsNum,
+                                  std::vector<OverlapAnalysisData> &events);
+    static void UpdateTimeExtremesBySections(const Utils::IntervalSet &sections, DeviceSections &device);
+    static void AppendEvents(uint16_t deviceId, const Utils::IntervalSet &sections, OverlapAnalysisType type,
                              std::vector<OverlapAnalysisData> &events);
 
-    static std::vector<TimeDuration> UnionOneSet(const std::vector<TimeDuration> &vecA);
-    static std::vector<TimeDuration> UnionTwoSet(const std::vector<TimeDuration> &vecA,
-                                                 const std::vector<TimeDuration> &vecB);
-    static std::vector<TimeDuration> GetDifferenceSet(const std::vector<TimeDuration> &vecA,
-                                                      const std::vector<TimeDuration> &vecB);
-    static void ProcessSetAIsOnTheLeftOfSetB(const TimeDuration &durationA, uint64_t &lastRecordEnd,
-                                             std::vector<TimeDuration> &res);
-    static void ProcessLeftOfSetAIntersectRightOfSetBOrSetAContainsSetB(const TimeDuration &durationA,
-                                                                        const TimeDuration &durationB,
-                                                                        uint64_t &lastRecordEnd,
-                                                                        std::vector<TimeDuration> &res);
-
    private:
-    std::unordered_map<uint16_t, std::vector<TimeDuration>> compTaskRecords_;
-    std::unordered_map<uint16_t, std::vector<TimeDuration>> commTaskRecords_;
-    std::unordered_map<uint16_t, uint64_t> begin_;
-    std::unordered_map<uint16_t, uint64_t> end_;
-    std::set<uint16_t> deviceIds_;
+    // 按deviceId有序，保证输出顺序稳定
+    std::map<uint16_t, DeviceSections> devices_;
 };
 }  // namespace Domain
 }  // namespace Analysis
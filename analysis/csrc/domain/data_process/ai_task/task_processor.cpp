@@ -20,6 +20,13 @@ namespace Analysis {
 namespace Domain {
 using namespace Analysis::Domain::Environment;
 using namespace Analysis::Utils;
+namespace {
+const std::vector<std::string> ASCEND_TASK_COLUMNS = {
+    "start_time", "duration", "model_id", "index_id", "stream_id", "task_id", "context_id", "batch_id",
+    "connection_id", "host_task_type", "device_task_type"};
+const size_t DEVICE_TASK_TYPE_INDEX = 10;
+const std::string UNKNOWN_TASK_TYPE = "UNKNOWN";
+}
 
 TaskProcessor::TaskProcessor(const std::string &profPath) : DataProcessor(profPath) {}
 
@@ -43,15 +50,24 @@ bool TaskProcessor::ProcessSingleDevice(const std::string &devicePath, std::vect
     ProfTimeRecord record;
     DBInfo ascendTaskDB("ascend_task.db", "AscendTask");
     std::string dbPath = Utils::File::PathJoin({devicePath, SQLITE, ascendTaskDB.dbName});
-    if (!ascendTaskDB.ConstructDBRunner(dbPath)) {
-        return false;
-    }
-    auto status = CheckPathAndTable(dbPath, ascendTaskDB);
-    if (status != CHECK_SUCCESS) {
-        if (status == CHECK_FAILED) {
+    OriAscendTaskData oriData;
+    if (LoadColumnFile(dbPath, ascendTaskDB.tableName, ASCEND_TASK_COLUMNS, oriData) == CHECK_SUCCESS) {
+        // 与sqlite查询的过滤条件一致
+        oriData.erase(std::remove_if(oriData.begin(), oriData.end(), [](const OriAscendTaskData::value_type &row) {
+            return std::get<DEVICE_TASK_TYPE_INDEX>(row) == UNKNOWN_TASK_TYPE;
+        }), oriData.end());
+    } else {
+        if (!ascendTaskDB.ConstructDBRunner(dbPath)) {
             return false;
         }
-        return true;
+        auto status = CheckPathAndTable(dbPath, ascendTaskDB);
+        if (status != CHECK_SUCCESS) {
+            if (status == CHECK_FAILED) {
+                return false;
+            }
+            return true;
+        }
+        oriData = LoadData(ascendTaskDB, dbPath);
     }
     uint16_t deviceId = GetDeviceIdByDevicePath(devicePath);
     if (deviceId == INVALID_DEVICE_ID) {
@@ -62,7 +78,6 @@ bool TaskProcessor::ProcessSingleDevice(const std::string &devicePath, std::vect
         ERROR("GetProfTimeRecordInfo failed, profPath is %.", profPath_);
         return false;
     }
-    auto oriData = LoadData(ascendTaskDB, dbPath);
     if (oriData.empty()) {
         ERROR("AscendTask original data is empty. DBPath is %", dbPath);
         return false;
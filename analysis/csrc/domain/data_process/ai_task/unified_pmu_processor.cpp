@@ -28,6 +28,7 @@ namespace Domain
 {
 using namespace Environment;
 using namespace Application::Credential;
+using Infra::ColumnTable;
 
 namespace
 {
@@ -40,15 +41,7 @@ const std::set<std::string> INVALID_COLUMN_NAMES = {"task_id",    "stream_id", "
                                                     "start_time", "end_time",  "ffts_type",  "core_type"};
 const std::string TASK_BASED = "task-based";
 const double DOUBLE_ZERO = 0.0;
-
-struct TaskPmuData
-{
-    uint32_t streamId = UINT32_MAX;
-    uint32_t taskId = UINT32_MAX;
-    uint32_t subtaskId = UINT32_MAX;
-    uint32_t batchId = UINT32_MAX;
-    double value = 0.0;
-};
+const size_t TASK_ID_COLUMN_NUM = 4;  // stream_id, task_id, subtask_id, batch_id
 
 struct SampleTimelineData
 {
@@ -178,13 +171,10 @@ bool UnifiedPmuProcessor::ProcessTaskBasedData(const std::unordered_map<std::str
     std::vector<UnifiedTaskPmu> processedData;
     for (const auto &dbPathAndDeviceId : dbPathAndDeviceIds)
     {
-        for (const auto &header : headers)
+        if (!ProcessTaskBasedDataByDevice(dbPathAndDeviceId, metricDB, headers, processedData))
         {
-            if (!ProcessTaskBasedDataByHeader(dbPathAndDeviceId, metricDB, header, processedData))
-            {
-                flag = false;
-                ERROR("Process task_based data failed, failed device is %", dbPathAndDeviceId.second);
-            }
+            flag = false;
+            ERROR("Process task_based data failed, failed device is %", dbPathAndDeviceId.second);
         }
     }
     if (!SaveToDataInventory<UnifiedTaskPmu>(std::move(processedData), dataInventory, PROCESSOR_NAME_TASK_PMU_INFO))
@@ -195,17 +185,28 @@ bool UnifiedPmuProcessor::ProcessTaskBasedData(const std::unordered_map<std::str
     return flag;
 }
 
-bool UnifiedPmuProcessor::ProcessTaskBasedDataByHeader(const std::pair<std::string, uint16_t> &dbPathAndDeviceId,
-                                                       Analysis::Infra::DBInfo &metricDB, const std::string &header,
+bool UnifiedPmuProcessor::ProcessTaskBasedDataByDevice(const std::pair<std::string, uint16_t> &dbPathAndDeviceId,
+                                                       Analysis::Infra::DBInfo &metricDB,
+                                                       const std::vector<std::string> &headers,
                                                        std::vector<UnifiedTaskPmu> &processedData)
 {
-    if (INVALID_COLUMN_NAMES.find(header) != INVALID_COLUMN_NAMES.end())
+    std::vector<std::string> columnNames;
+    for (const auto &header : headers)
+    {
+        if (INVALID_COLUMN_NAMES.find(header) != INVALID_COLUMN_NAMES.end())
+        {
+            INFO("This column[%] does not need to be processed.", header);
+            continue;
+        }
+        columnNames.emplace_back(header);
+    }
+    if (columnNames.empty())
     {
-        INFO("This column[%] does not need to be processed.", header);
         return true;
     }
-    OTFormat pmuData = GetTaskBasedData(dbPathAndDeviceId.first, header, metricDB);
-    if (!FormatTaskBasedData(pmuData, processedData, header, dbPathAndDeviceId.second))
+    ColumnTable oriData;
+    if (!GetTaskBasedData(dbPathAndDeviceId.first, columnNames, metricDB, oriData) ||
+        !FormatTaskBasedData(oriData, processedData, columnNames, dbPathAndDeviceId.second))
     {
         ERROR("FormatData failed, dbPath is %.", dbPathAndDeviceId.first);
         return false;
@@ -213,16 +214,15 @@ bool UnifiedPmuProcessor::ProcessTaskBasedDataByHeader(const std::pair<std::stri
     return true;
 }
 
-UnifiedPmuProcessor::OTFormat UnifiedPmuProcessor::GetTaskBasedData(const std::string &dbPath,
-                                                                    const std::string &columnName, DBInfo &metricDB)
+bool UnifiedPmuProcessor::GetTaskBasedData(const std::string &dbPath, const std::vector<std::string> &columnNames,
+                                           DBInfo &metricDB, ColumnTable &oriData)
 {
-    INFO("GetTaskBasedData, dbPath is %, column name is %.", dbPath, columnName);
-    OTFormat oriData;
-    MAKE_SHARED_RETURN_VALUE(metricDB.dbRunner, DBRunner, oriData, dbPath);
+    INFO("GetTaskBasedData, dbPath is %, column num is %.", dbPath, columnNames.size());
+    MAKE_SHARED_RETURN_VALUE(metricDB.dbRunner, DBRunner, false, dbPath);
     if (metricDB.dbRunner == nullptr)
     {
         ERROR("Create % connection failed.", dbPath);
-        return oriData;
+        return false;
     }
     std::string subtaskIdSql;
     uint16_t version = Context::GetInstance().GetPlatformVersion(DEFAULT_DEVICE_ID, profPath_);
@@ -234,14 +234,16 @@ UnifiedPmuProcessor::OTFormat UnifiedPmuProcessor::GetTaskBasedData(const std::s
     {
         subtaskIdSql = "subtask_id, ";
     }
+    // 所有指标列在一条sql中查询, 只扫描一次表
     std::string sql = "SELECT stream_id, task_id, ";
-    sql.append(subtaskIdSql).append(" batch_id, ").append(columnName).append(" FROM ").append(metricDB.tableName);
-    if (!metricDB.dbRunner->QueryData(sql, oriData))
+    sql.append(subtaskIdSql).append("batch_id, ").append(Utils::Join(columnNames, ", "))
+        .append(" FROM ").append(metricDB.tableName);
+    if (!metricDB.dbRunner->QueryColumns(sql, oriData))
     {
-        ERROR("Query task-based % data failed, db path is %.", columnName, dbPath);
-        return oriData;
+        ERROR("Query task-based data failed, db path is %.", dbPath);
+        return false;
     }
-    return oriData;
+    return true;
 }
 
 uint64_t UnifiedPmuProcessor::UpdateColumnName(std::string &columnName)
@@ -271,29 +273,46 @@ uint64_t UnifiedPmuProcessor::UpdateColumnName(std::string &columnName)
     return 1;
 }
 
-bool UnifiedPmuProcessor::FormatTaskBasedData(const OTFormat &oriData, std::vector<UnifiedTaskPmu> &processedData,
-                                              std::string columnName, const uint16_t &deviceId)
+bool UnifiedPmuProcessor::FormatTaskBasedData(const ColumnTable &oriData, std::vector<UnifiedTaskPmu> &processedData,
+                                              const std::vector<std::string> &columnNames, const uint16_t &deviceId)
 {
     INFO("FormatTaskBasedData.");
-    if (oriData.empty())
+    if (oriData.Empty())
     {
-        ERROR("Task-based original data is empty, columnName is %.", columnName);
+        ERROR("Task-based original data is empty, device id is %.", deviceId);
         return false;
     }
-    if (!Utils::Reserve(processedData, oriData.size()))
+    if (oriData.ColumnCount() != TASK_ID_COLUMN_NUM + columnNames.size())
     {
-        ERROR("Reserve for % task-based data failed, columnName is %.", columnName);
+        ERROR("Task-based original data is not complete, device id is %.", deviceId);
+        return false;
+    }
+    const size_t rowNum = oriData.RowCount();
+    if (!Utils::Reserve(processedData, processedData.size() + rowNum * columnNames.size()))
+    {
+        ERROR("Reserve for task-based data failed, device id is %.", deviceId);
         return false;
     }
     // 当前task-based pmu存在一个问题:
     // 1、没有考虑memory_bound或是cube utilization的计算
-    auto valueScale = UpdateColumnName(columnName);
-    TaskPmuData tempData;
-    for (const auto &row : oriData)
-    {
-        std::tie(tempData.streamId, tempData.taskId, tempData.subtaskId, tempData.batchId, tempData.value) = row;
-        processedData.emplace_back(deviceId, tempData.streamId, tempData.taskId, tempData.subtaskId, tempData.batchId,
-                                   columnName, tempData.value * valueScale);
+    // 0 stream_id, 1 task_id, 2 subtask_id, 3 batch_id
+    const size_t streamIdCol = 0;
+    const size_t taskIdCol = 1;
+    const size_t subtaskIdCol = 2;
+    const size_t batchIdCol = 3;
+    for (size_t i = 0; i < columnNames.size(); ++i)
+    {
+        auto columnName = columnNames[i];
+        auto valueScale = UpdateColumnName(columnName);
+        const size_t valueCol = TASK_ID_COLUMN_NUM + i;
+        for (size_t row = 0; row < rowNum; ++row)
+        {
+            processedData.emplace_back(deviceId, static_cast<uint32_t>(oriData.GetInt64(streamIdCol, row)),
+                                       static_cast<uint32_t>(oriData.GetInt64(taskIdCol, row)),
+                                       static_cast<uint32_t>(oriData.GetInt64(subtaskIdCol, row)),
+                                       static_cast<uint32_t>(oriData.GetInt64(batchIdCol, row)), columnName,
+                                       oriData.GetDouble(valueCol, row) * valueScale);
+        }
     }
     if (processedData.empty())
     {
@@ -33,9 +33,6 @@ using OSTFormat = std::vector<std::tuple<uint64_t, std::string, uint32_t>>;
 // Original Sample Summary Format:aicore/ai_vector_core中的MetricSummary
 // metric, value, coreid
 using OSSFormat = std::vector<std::tuple<std::string, double, uint32_t>>;
-// Original Task Format: 只取id + 对应字段的value
-// stream_id, task_id, subtask_id, batch_id, value
-using OTFormat = std::vector<std::tuple<uint32_t, uint32_t, uint32_t, uint32_t, double>>;
 
 public:
     UnifiedPmuProcessor() = default;
@@ -50,14 +47,14 @@ private:
     bool ProcessTaskBasedData(const std::unordered_map<std::string, uint16_t> &dbPathAndDeviceId,
                                       Analysis::Infra::DBInfo &metricDB, std::vector<std::string> &headers,
                                       DataInventory &dataInventory);
-    bool ProcessTaskBasedDataByHeader(const std::pair<std::string, uint16_t> &dbPathAndDeviceId,
-                                        Analysis::Infra::DBInfo &metricDB, const std::string &header,
-                                        std::vector<UnifiedTaskPmu> &processedData);
-    UnifiedPmuProcessor::OTFormat GetTaskBasedData(const std::string &dbPath, const std::string &columnName,
-                                                                            DBInfo &metricDB);
+    bool ProcessTaskBasedDataByDevice(const std::pair<std::string, uint16_t> &dbPathAndDeviceId,
+                                      Analysis::Infra::DBInfo &metricDB, const std::vector<std::string> &headers,
+                                      std::vector<UnifiedTaskPmu> &processedData);
+    bool GetTaskBasedData(const std::string &dbPath, const std::vector<std::string> &columnNames, DBInfo &metricDB,
+                          Infra::ColumnTable &oriData);
     static uint64_t UpdateColumnName(std::string &columnName);
-    bool FormatTaskBasedData(const OTFormat &oriData, std::vector<UnifiedTaskPmu> &processedData,
-                                                      std::string columnName, const uint16_t &deviceId);
+    bool FormatTaskBasedData(const Infra::ColumnTable &oriData, std::vector<UnifiedTaskPmu> &processedData,
+                             const std::vector<std::string> &columnNames, const uint16_t &deviceId);
     bool SampleBasedProcess(const std::string &fileDir);
     bool SampleBasedTimelineProcess(
                 const std::unordered_map<std::string, std::tuple<uint16_t, uint64_t>> &dbPathTable,
@@ -19,6 +19,8 @@
 #include <unordered_map>
 
 #include "analysis/csrc/infrastructure/dfx/error_code.h"
+#include "analysis/csrc/infrastructure/utils/arena_allocator.h"
+#include "analysis/csrc/infrastructure/utils/self_trace.h"
 
 namespace Analysis
 {
@@ -35,6 +37,9 @@ DataProcessor::DataProcessor(const std::string &profPath) : profPath_(profPath)
 bool DataProcessor::Run(DataInventory &dataInventory, const std::string &processorName)
 {
     INFO("% Run. Dir is %", processorName, profPath_);
+    Utils::TraceSpan span(Utils::TRACE_CAT_PROCESSOR, processorName, true);
+    // Process中通过StageArena分配的临时数据在processor结束时统一释放
+    Utils::ArenaStageScope arenaScope(processorName);
     auto retFlag = Process(dataInventory);
     if (!retFlag)
     {
@@ -22,7 +22,9 @@
 
 #include "analysis/csrc/application/database/db_constant.h"
 #include "analysis/csrc/infrastructure/data_inventory/include/data_inventory.h"
+#include "analysis/csrc/infrastructure/db/include/column_file.h"
 #include "analysis/csrc/infrastructure/db/include/db_info.h"
+#include "analysis/csrc/infrastructure/utils/run_control.h"
 
 namespace Analysis
 {
@@ -51,6 +53,11 @@ class DataProcessor
     static uint8_t CheckPathAndTable(const std::string& path, const DBInfo& dbInfo, bool enableStrictCheck = true);
     static uint16_t GetEnumTypeValue(const std::string& key, const std::string& tableName,
                                      const std::unordered_map<std::string, uint16_t>& enumTable);
+    // 持久化阶段生成的列式文件存在时按列名mmap读取，返回CHECK_SUCCESS；
+    // 文件不存在返回NOT_EXIST，文件损坏返回CHECK_FAILED，两种情况调用方都应回退到sqlite读取
+    template <typename... Args>
+    static uint8_t LoadColumnFile(const std::string& dbPath, const std::string& tableName,
+                                  const std::vector<std::string>& columns, std::vector<std::tuple<Args...>>& data);
     template <typename Tp>
     void FilterDataByStartTime(std::vector<Tp>& data, uint64_t startTimeNs, const std::string& processorName,
                                std::function<bool(const Tp&, uint64_t)> condition = nullptr);
@@ -65,6 +72,26 @@ class DataProcessor
     virtual bool Process(DataInventory& dataInventory) = 0;
 };
 
+template <typename... Args>
+uint8_t DataProcessor::LoadColumnFile(const std::string& dbPath, const std::string& tableName,
+                                      const std::vector<std::string>& columns, std::vector<std::tuple<Args...>>& data)
+{
+    auto path = GetColumnFilePath(dbPath, tableName);
+    if (!Utils::File::Exist(path))
+    {
+        return NOT_EXIST;
+    }
+    ColumnFileReader reader;
+    if (!reader.Open(path) || !reader.Read(columns, data))
+    {
+        WARN("Read column file % failed, fall back to %.", path, dbPath);
+        data.clear();
+        return CHECK_FAILED;
+    }
+    INFO("Load % rows of % from column file %.", data.size(), tableName, path);
+    return CHECK_SUCCESS;
+}
+
 template <typename Tp>
 void DataProcessor::FilterDataByStartTime(std::vector<Tp>& datas, uint64_t startTimeNs,
                                           const std::string& processorName,
@@ -90,7 +117,12 @@ bool DataProcessor::SaveToDataInventory(std::vector<Tp>&& data, DataInventory& d
     }
     std::shared_ptr<std::vector<Tp>> oneSharedData;
     MAKE_SHARED_RETURN_VALUE(oneSharedData, std::vector<Tp>, false, std::move(data));
-    dataInventory.Inject(oneSharedData);
+    Utils::RunControl::GetInstance().AddRecords(oneSharedData->size());
+    if (!dataInventory.Inject(oneSharedData))
+    {
+        ERROR("Inject % data into dataInventory failed.", processorName);
+        return false;
+    }
     return true;
 }
 }  // namespace Domain
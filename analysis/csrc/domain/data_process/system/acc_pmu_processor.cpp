@@ -16,11 +16,19 @@
 
 #include "analysis/csrc/domain/data_process/system/acc_pmu_processor.h"
 #include "analysis/csrc/domain/services/environment/context.h"
+#include "analysis/csrc/infrastructure/utils/radix_sort.h"
 
 namespace Analysis {
 namespace Domain {
 using namespace Analysis::Domain::Environment;
 using namespace Analysis::Utils;
+namespace {
+const std::vector<std::string> ACC_PMU_COLUMNS = {
+    "acc_id", "read_bandwidth", "write_bandwidth", "read_ost", "write_ost", "timestamp"};
+const size_t ACC_ID_INDEX = 0;
+const size_t TIMESTAMP_INDEX = 5;
+}
+
 AccPmuProcessor::AccPmuProcessor(const std::string &profPath) : DataProcessor(profPath) {}
 
 bool AccPmuProcessor::Process(DataInventory &dataInventory)
@@ -52,14 +60,24 @@ bool AccPmuProcessor::ProcessOneDevice(const std::string& devicePath, std::vecto
     }
     DBInfo accPmuDB("acc_pmu.db", "AccPmu");
     std::string dbPath = Utils::File::PathJoin({devicePath, SQLITE, accPmuDB.dbName});
-    if (!accPmuDB.ConstructDBRunner(dbPath)) {
-        return false;
-    }
-    auto status = CheckPathAndTable(dbPath, accPmuDB);
-    if (status != CHECK_SUCCESS) {
-        return status != CHECK_FAILED;
+    OriAccPmuData oriData;
+    if (LoadColumnFile(dbPath, accPmuDB.tableName, ACC_PMU_COLUMNS, oriData) == CHECK_SUCCESS) {
+        // 与sqlite查询的ORDER BY timestamp, acc_id一致
+        Utils::RadixSort::SortByKeys(oriData,
+            [](const OriAccPmuData::value_type &row) {
+                return Utils::RadixKeyOfDouble(std::get<TIMESTAMP_INDEX>(row));
+            },
+            [](const OriAccPmuData::value_type &row) { return std::get<ACC_ID_INDEX>(row); });
+    } else {
+        if (!accPmuDB.ConstructDBRunner(dbPath)) {
+            return false;
+        }
+        auto status = CheckPathAndTable(dbPath, accPmuDB);
+        if (status != CHECK_SUCCESS) {
+            return status != CHECK_FAILED;
+        }
+        oriData = LoadData(accPmuDB, dbPath);
     }
-    auto oriData = LoadData(accPmuDB, dbPath);
     if (oriData.empty()) {
         ERROR("Get acc_pmu original data failed in %.", dbPath);
         return false;
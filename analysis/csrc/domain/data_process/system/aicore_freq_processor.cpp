@@ -24,6 +24,10 @@ namespace Domain
 {
 using namespace Analysis::Domain::Environment;
 using namespace Analysis::Utils;
+namespace
+{
+const std::vector<std::string> FREQ_COLUMNS = {"syscnt", "freq"};
+}
 
 AicoreFreqProcessor::AicoreFreqProcessor(const std::string& profPath) : DataProcessor(profPath) {}
 
@@ -90,18 +94,21 @@ bool AicoreFreqProcessor::ProcessData(const std::string& devicePath, AicoreFreqP
 {
     DBInfo dbInfo("freq.db", "FreqParse");
     std::string dbPath = File::PathJoin({devicePath, SQLITE, dbInfo.dbName});
-    if (!dbInfo.ConstructDBRunner(dbPath))
-    {
-        return false;
-    }
-    auto status = CheckPathAndTable(dbPath, dbInfo);
-    if (status == CHECK_FAILED)
-    {
-        return false;
-    }
-    else if (status == CHECK_SUCCESS)
+    if (LoadColumnFile(dbPath, dbInfo.tableName, FREQ_COLUMNS, oriData) != CHECK_SUCCESS)
     {
-        oriData = LoadData(dbPath, dbInfo);
+        if (!dbInfo.ConstructDBRunner(dbPath))
+        {
+            return false;
+        }
+        auto status = CheckPathAndTable(dbPath, dbInfo);
+        if (status == CHECK_FAILED)
+        {
+            return false;
+        }
+        else if (status == CHECK_SUCCESS)
+        {
+            oriData = LoadData(dbPath, dbInfo);
+        }
     }
     if (oriData.empty())
     {
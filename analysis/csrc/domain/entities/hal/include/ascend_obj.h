@@ -23,6 +23,7 @@
 #include <utility>
 
 #include "analysis/csrc/infrastructure/utils/prof_common.h"
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis
 {
@@ -161,6 +162,11 @@ struct HostTask
     std::shared_ptr<Operator> op = nullptr;
 };
 
+inline uint64_t OwnedBytes(const HostTask &data)
+{
+    return Utils::OwnedBytesOf(data.taskTypeStr, data.kernelNameStr, data.op);
+}
+
 // 存储GeFusionOpInfo表
 struct GeFusionOpInfo
 {
@@ -21,6 +21,7 @@
 #include "analysis/csrc/domain/entities/hal/include/hal.h"
 #include "analysis/csrc/domain/entities/pmu/include/pmu_info.h"
 #include "analysis/csrc/domain/entities/hal/include/hal_log.h"
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis {
 namespace Domain {
@@ -35,6 +36,11 @@ struct DeviceTask {
     AcceleratorType acceleratorType = INVALID;
     std::unique_ptr<PmuBaseInfo> pmuInfo = nullptr;
 };
+
+inline uint64_t OwnedBytes(const DeviceTask &data)
+{
+    return Utils::OwnedBytesOf(data.pmuInfo);
+}
 }
 }
 #endif // MSPROF_ANALYSIS_DEVICE_TASK_H
@@ -20,6 +20,7 @@
 #include <stdint.h>
 
 #include <string>
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 struct TopDownTask
 {
@@ -56,4 +57,9 @@ struct TopDownTask
     {
     }
 };
+
+inline uint64_t OwnedBytes(const TopDownTask &data)
+{
+    return Analysis::Utils::OwnedBytesOf(data.deviceTaskType, data.hostTaskType);
+}
 #endif  // ANALYSIS_DOMAIN_ENTITIES_HAL_TOP_DOWN_TASK_H
@@ -20,6 +20,7 @@
 #include <stdint.h>
 
 #include <string>
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis
 {
@@ -47,6 +48,12 @@ struct HcclOp
     uint32_t rankSize;
 };
 
+inline uint64_t OwnedBytes(const HcclOp &data)
+{
+    return Utils::OwnedBytesOf(data.opName, data.taskType, data.opType, data.isDynamic, data.dataType, data.algType,
+                               data.groupName);
+}
+
 struct HcclTask
 {
     uint64_t modelId;
@@ -73,6 +80,12 @@ struct HcclTask
     std::string rdmaType;
     uint32_t rankSize;
 };
+
+inline uint64_t OwnedBytes(const HcclTask &data)
+{
+    return Utils::OwnedBytesOf(data.name, data.groupName, data.transportType, data.dataType, data.linkType,
+                               data.notifyId, data.rdmaType);
+}
 }  // namespace Domain
 }  // namespace Analysis
 
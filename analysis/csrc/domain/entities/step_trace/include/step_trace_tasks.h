@@ -20,6 +20,7 @@
 #include <vector>
 #include <map>
 #include <stdint.h>
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis {
 namespace Domain {
@@ -38,6 +39,11 @@ struct StepTraceTasks {
     std::vector<TimePair> trainingTrace;
 };
 
+inline uint64_t OwnedBytes(const StepTraceTasks &data)
+{
+    return Utils::OwnedBytesOf(data.allReduceTable, data.getNextTable, data.trainingTrace);
+}
+
 }
 }
 
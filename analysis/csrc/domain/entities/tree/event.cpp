@@ -24,19 +24,19 @@ namespace Domain {
 std::atomic<uint32_t> g_eventIDCnt{0};
 
 Event::Event(std::shared_ptr<MsprofApi> eventPtr, const EventInfo &eventInfo)
-    : apiPtr(std::move(eventPtr)), info(eventInfo), id(++g_eventIDCnt)
+    : apiPtr(eventPtr.get()), owner(std::move(eventPtr)), info(eventInfo), id(++g_eventIDCnt)
 {}
 
 Event::Event(std::shared_ptr<MsprofAdditionalInfo> eventPtr, const EventInfo &eventInfo)
-    : additionPtr(std::move(eventPtr)), info(eventInfo), id(++g_eventIDCnt)
+    : additionPtr(eventPtr.get()), owner(std::move(eventPtr)), info(eventInfo), id(++g_eventIDCnt)
 {}
 
 Event::Event(std::shared_ptr<MsprofCompactInfo> eventPtr, const EventInfo &eventInfo)
-    : compactPtr(std::move(eventPtr)), info(eventInfo), id(++g_eventIDCnt)
+    : compactPtr(eventPtr.get()), owner(std::move(eventPtr)), info(eventInfo), id(++g_eventIDCnt)
 {}
 
 Event::Event(std::shared_ptr<ConcatTensorInfo> eventPtr, const EventInfo &eventInfo)
-    : tensorPtr(std::move(eventPtr)), info(eventInfo), id(++g_eventIDCnt)
+    : tensorPtr(eventPtr.get()), owner(std::move(eventPtr)), info(eventInfo), id(++g_eventIDCnt)
 {}
 } // namespace Entities
 } // namespace Analysis
\ No newline at end of file
@@ -15,6 +15,7 @@
  * -------------------------------------------------------------------------*/
 
 #include "analysis/csrc/infrastructure/dfx/log.h"
+#include "analysis/csrc/infrastructure/utils/radix_sort.h"
 #include "analysis/csrc/infrastructure/utils/time_logger.h"
 #include "analysis/csrc/domain/entities/tree/include/event_queue.h"
 
@@ -31,12 +32,11 @@ void EventQueue::Sort()
     std::string loggerName = "Sort event num " + std::to_string(tail_) +
         " in thread " + std::to_string(threadId_);
     Utils::TimeLogger logger(loggerName);
-    auto comp = [](const std::shared_ptr<Event> &event1,
-                   const std::shared_ptr<Event> &event2) {
-        return event1->info.start < event2->info.start ||
-            (event1->info.start == event2->info.start && event1->info.level > event2->info.level);
-    };
-    std::sort(data_.begin(), data_.begin() + tail_, comp);
+    // 按start升序，start相同时level大的在前
+    Utils::RadixSort::SortByKeys(
+        data_.begin(), data_.begin() + tail_,
+        [](const std::shared_ptr<Event> &event) { return event->info.start; },
+        [](const std::shared_ptr<Event> &event) { return static_cast<uint64_t>(UINT16_MAX - event->info.level); });
 }
 
 void EventQueue::Push(const std::shared_ptr<Event> &event)
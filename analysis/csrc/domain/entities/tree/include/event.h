@@ -75,32 +75,29 @@ struct EventInfo {
 };
 
 // Event为本工程对软硬件上报的各类信息(Trace)的抽象, 表示一个时间点或时间片发生的事件
+// 载荷指针直接指向解析得到的原始记录，原始记录由ChunkGenerator按块连续存放，owner持有记录所在的块；
+// 读取载荷字段不增减引用计数，需要在Event之外长期持有记录时通过Share获取与owner共享生命周期的智能指针
 struct Event {
     Event(std::shared_ptr<MsprofApi> eventPtr, const EventInfo &eventInfo);
     Event(std::shared_ptr<MsprofAdditionalInfo> eventPtr, const EventInfo &eventInfo);
     Event(std::shared_ptr<MsprofCompactInfo> eventPtr, const EventInfo &eventInfo);
     Event(std::shared_ptr<ConcatTensorInfo> eventPtr, const EventInfo &eventInfo);
+
+    template<typename T>
+    std::shared_ptr<T> Share(T *payload) const
+    {
+        return payload == nullptr ? nullptr : std::shared_ptr<T>(owner, payload);
+    }
+
     union {
-        std::shared_ptr<MsprofApi> apiPtr;
-        std::shared_ptr<MsprofAdditionalInfo> additionPtr;
-        std::shared_ptr<MsprofCompactInfo> compactPtr;
-        std::shared_ptr<ConcatTensorInfo> tensorPtr;
+        MsprofApi *apiPtr;
+        MsprofAdditionalInfo *additionPtr;
+        MsprofCompactInfo *compactPtr;
+        ConcatTensorInfo *tensorPtr;
     };
+    std::shared_ptr<void> owner;  // 载荷所在的记录块
     EventInfo info;
     int64_t id = 0;    // 全局唯一ID
-
-    ~Event()
-    {
-        if (apiPtr) {
-            apiPtr.~shared_ptr();
-        } else if (additionPtr) {
-            additionPtr.~shared_ptr();
-        } else if (compactPtr) {
-            compactPtr.~shared_ptr();
-        } else if (tensorPtr) {
-            tensorPtr.~shared_ptr();
-        }
-    }
 };
 
 } // namespace Domain
@@ -19,6 +19,7 @@
 
 #include <string>
 #include "analysis/csrc/domain/entities/viewer_data/basic_data.h"
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis {
 namespace Domain {
@@ -32,6 +33,11 @@ struct ApiData : public BasicData {
     std::string id;  // api数据中的id字段为acl层数据的apiName
     std::string itemId; // api数据中hccl层数据的apiName
 };
+
+inline uint64_t OwnedBytes(const ApiData &data)
+{
+    return Utils::OwnedBytesOf(data.apiName, data.structType, data.id, data.itemId);
+}
 }
 }
 
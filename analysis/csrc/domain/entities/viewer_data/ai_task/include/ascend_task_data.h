@@ -19,6 +19,7 @@
 
 #include <string>
 #include "analysis/csrc/domain/entities/viewer_data/basic_data.h"
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis {
 namespace Domain {
@@ -39,6 +40,11 @@ struct AscendTaskData : public BasicData {
     std::string taskType;
 };
 
+inline uint64_t OwnedBytes(const AscendTaskData &data)
+{
+    return Utils::OwnedBytesOf(data.hostType, data.deviceType, data.taskType);
+}
+
 struct MsprofTxDeviceData : public BasicData {
     uint16_t deviceId = UINT16_MAX;
     uint32_t modelId = UINT32_MAX;
@@ -51,6 +57,11 @@ struct MsprofTxDeviceData : public BasicData {
     double duration = 0.0;
     std::string taskType = TASK_TYPE_MSTX;
 };
+
+inline uint64_t OwnedBytes(const MsprofTxDeviceData &data)
+{
+    return Utils::OwnedBytesOf(data.taskType);
+}
 }
 }
 #endif // ANALYSIS_DOMAIN_ASCENDTASK_DATA_H
@@ -19,6 +19,7 @@
 
 #include <string>
 #include <stdint.h>
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis {
 namespace Domain {
@@ -51,6 +52,11 @@ struct CCUMissionTimelineData {
     std::string inputDataType;
     std::string outputDataType;
 };
+
+inline uint64_t OwnedBytes(const CCUMissionTimelineData &data)
+{
+    return Utils::OwnedBytesOf(data.timeType, data.reduceOpType, data.inputDataType, data.outputDataType);
+}
 } // Domain
 } // Analysis
 
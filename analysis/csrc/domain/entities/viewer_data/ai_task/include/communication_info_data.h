@@ -20,6 +20,7 @@
 #include <string>
 
 #include "analysis/csrc/domain/entities/viewer_data/basic_data.h"
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis
 {
@@ -51,6 +52,11 @@ struct CommunicationTaskData : public BasicData
     std::string notifyId;
     std::string opKey;
 };
+
+inline uint64_t OwnedBytes(const CommunicationTaskData &data)
+{
+    return Utils::OwnedBytesOf(data.opName, data.taskType, data.groupName, data.notifyId, data.opKey);
+}
 struct CommunicationOpData : public BasicData
 {
     uint16_t deviceId = UINT16_MAX;
@@ -68,6 +74,11 @@ struct CommunicationOpData : public BasicData
     std::string algType;
     std::string opType;
 };
+
+inline uint64_t OwnedBytes(const CommunicationOpData &data)
+{
+    return Utils::OwnedBytesOf(data.opKey, data.opName, data.groupName, data.algType, data.opType);
+}
 }  // namespace Domain
 }  // namespace Analysis
 #endif  // ANALYSIS_DOMAIN_COMMUNICATION_INFO_DATA_H
@@ -20,6 +20,7 @@
 #include <string>
 
 #include "analysis/csrc/domain/entities/viewer_data/basic_data.h"
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis
 {
@@ -54,6 +55,13 @@ struct DPUData : public BasicData
     std::string rdmaType;
     std::string transportType;
 };
+
+inline uint64_t OwnedBytes(const DPUData &data)
+{
+    return Utils::OwnedBytesOf(data.taskType, data.dataType, data.dstAddr, data.srcAddr, data.groupName,
+                               data.groupNameId, data.linkType, data.notifyId, data.opName, data.opType, data.rdmaType,
+                               data.transportType);
+}
 }  // namespace Domain
 }  // namespace Analysis
 
@@ -19,6 +19,7 @@
 
 #include <string>
 #include "analysis/csrc/domain/entities/viewer_data/basic_data.h"
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis {
 namespace Domain {
@@ -33,6 +34,12 @@ struct FusionOpInfo : public BasicData {
     std::string memoryTotal;
     std::string opNames;
 };
+
+inline uint64_t OwnedBytes(const FusionOpInfo &data)
+{
+    return Utils::OwnedBytesOf(data.fusionName, data.memoryInput, data.memoryOutput, data.memoryWeight,
+                               data.memoryWorkspace, data.memoryTotal, data.opNames);
+}
 }
 }
 
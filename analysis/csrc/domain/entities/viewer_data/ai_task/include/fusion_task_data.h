@@ -20,6 +20,7 @@
 #include <stdint.h>
 
 #include <string>
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis
 {
@@ -42,6 +43,11 @@ struct FusionTaskTimelineData
     std::string taskType;
     std::string fusionTaskType;
 };
+
+inline uint64_t OwnedBytes(const FusionTaskTimelineData &data)
+{
+    return Utils::OwnedBytesOf(data.taskType, data.fusionTaskType);
+}
 }  // namespace Domain
 }  // namespace Analysis
 
@@ -20,6 +20,7 @@
 #include <limits>
 #include <string>
 #include <stdint.h>
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis {
 namespace Domain {
@@ -33,6 +34,11 @@ struct HcclStatisticData {
     double avg = 0.0;
     double ratio = 0.0;
 };
+
+inline uint64_t OwnedBytes(const HcclStatisticData &data)
+{
+    return Utils::OwnedBytesOf(data.opType, data.count);
+}
 }
 }
 
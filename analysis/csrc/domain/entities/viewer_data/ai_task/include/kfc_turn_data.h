@@ -19,6 +19,7 @@
 #include <string>
 #include <utility>
 #include "analysis/csrc/domain/entities/viewer_data/basic_data.h"
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis {
 namespace Domain {
@@ -36,6 +37,11 @@ public:
           duration(_duration) {}
 };
 
+inline uint64_t OwnedBytes(const KfcTurnData &data)
+{
+    return Utils::OwnedBytesOf(data.opName);
+}
+
 struct KfcTaskData : public BasicData {
     uint16_t isMaster = 0;
     uint16_t deviceId = UINT16_MAX;
@@ -76,6 +82,11 @@ struct KfcTaskData : public BasicData {
         opKey(_opKey),  rdmaType(_rdmaType) {};
 };
 
+inline uint64_t OwnedBytes(const KfcTaskData &data)
+{
+    return Utils::OwnedBytesOf(data.hcclName, data.notifyId, data.taskType, data.opName, data.opKey, data.groupName);
+}
+
 struct KfcOpData : public BasicData {
     uint16_t deviceId = UINT16_MAX;
     uint32_t modelId = UINT32_MAX;
@@ -100,6 +111,11 @@ struct KfcOpData : public BasicData {
         connectionId(_connectionId), modelId(_modelId), dataType(_dataType), count(_count), algType(_algType),
         rankSize(_rankSize),  relay(_relay), retry(_retry), opType(_opType), opKey(_opKey) {};
 };
+
+inline uint64_t OwnedBytes(const KfcOpData &data)
+{
+    return Utils::OwnedBytesOf(data.groupName, data.opName, data.algType, data.opType, data.opKey);
+}
 }
 }
 
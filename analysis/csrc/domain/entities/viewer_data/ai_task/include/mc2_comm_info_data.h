@@ -18,6 +18,7 @@
 #define ANALYSIS_DOMAIN_MC2_COMM_INFO_H
 
 #include <stdint.h>
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis {
 namespace Domain {
@@ -25,6 +26,11 @@ struct MC2CommInfoData {
     uint16_t aiCpuKfcStreamId = UINT16_MAX;   // 通信大算子所在stream
     std::string commStreamIds;    // 通信小算子所在stream
 };
+
+inline uint64_t OwnedBytes(const MC2CommInfoData &data)
+{
+    return Utils::OwnedBytesOf(data.commStreamIds);
+}
 }
 }
 
@@ -22,6 +22,7 @@
 #include <utility>
 #include <vector>
 #include "analysis/csrc/domain/valueobject/include/task_id.h"
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis {
 namespace Domain {
@@ -33,6 +34,11 @@ struct MetricSummary {
                   std::map<TaskId, std::vector<std::vector<std::string>>> _data)
         : labels(std::move(_labels)), data(std::move(_data)) {}
 };
+
+inline uint64_t OwnedBytes(const MetricSummary &data)
+{
+    return Utils::OwnedBytesOf(data.labels, data.data);
+}
 }
 }
 #endif // ANALYSIS_DOMAIN_METRIC_SUMMARY_H
@@ -19,6 +19,7 @@
 
 #include <string>
 #include <stdint.h>
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis {
 namespace Domain {
@@ -26,6 +27,11 @@ struct ModelName {
     uint32_t modelId;
     std::string modelName;
 };
+
+inline uint64_t OwnedBytes(const ModelName &data)
+{
+    return Utils::OwnedBytesOf(data.modelName);
+}
 }
 }
 
@@ -21,6 +21,7 @@
 
 #include "analysis/csrc/application/database/db_constant.h"
 #include "analysis/csrc/domain/entities/viewer_data/basic_data.h"
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis
 {
@@ -41,6 +42,11 @@ struct MsprofTxHostData : public BasicData
     std::string domain;
     std::string message;
 };
+
+inline uint64_t OwnedBytes(const MsprofTxHostData &data)
+{
+    return Utils::OwnedBytesOf(data.domain, data.message);
+}
 }  // namespace Domain
 }  // namespace Analysis
 #endif  // ANALYSIS_DOMAIN_MSPROF_TX_HOST_DATA_H
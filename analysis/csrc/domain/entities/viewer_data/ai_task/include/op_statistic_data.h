@@ -20,6 +20,7 @@
 #include <limits>
 #include <string>
 #include <stdint.h>
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis {
 namespace Domain {
@@ -34,6 +35,11 @@ struct OpStatisticData {
     double avg = 0.0;
     double ratio = 0.0;
 };
+
+inline uint64_t OwnedBytes(const OpStatisticData &data)
+{
+    return Utils::OwnedBytesOf(data.opType, data.coreType, data.count);
+}
 }
 }
 
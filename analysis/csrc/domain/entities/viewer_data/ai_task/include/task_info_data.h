@@ -19,6 +19,7 @@
 #include <stdint.h>
 
 #include <string>
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis
 {
@@ -88,6 +89,13 @@ struct TaskInfoData
         return res;
     }
 };
+
+inline uint64_t OwnedBytes(const TaskInfoData &data)
+{
+    return Utils::OwnedBytesOf(data.opState, data.hashId, data.opName, data.taskType, data.opType, data.opFlag,
+                               data.inputFormats, data.inputDataTypes, data.inputShapes, data.outputFormats,
+                               data.outputDataTypes, data.outputShapes, data.gridDim, data.blockDim);
+}
 }  // namespace Domain
 }  // namespace Analysis
 #endif  // ANALYSIS_DOMAIN_TASK_INFO_DATA_H
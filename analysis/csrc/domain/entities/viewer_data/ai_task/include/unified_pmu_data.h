@@ -23,6 +23,7 @@
 #include <vector>
 #include "analysis/csrc/domain/valueobject/include/task_id.h"
 #include "analysis/csrc/domain/entities/viewer_data/basic_data.h"
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis {
 namespace Domain {
@@ -42,6 +43,11 @@ struct UnifiedTaskPmu {
                                                          header(std::move(header_)), value(value_) {};
 };
 
+inline uint64_t OwnedBytes(const UnifiedTaskPmu &data)
+{
+    return Utils::OwnedBytesOf(data.header);
+}
+
 struct UnifiedSampleTimelinePmu : public BasicData {
     uint16_t deviceId = UINT16_MAX;
     uint16_t coreId = UINT16_MAX;
@@ -69,6 +75,11 @@ struct UnifiedSampleSummaryPmu {
                             uint64_t coreType_) : deviceId(deviceId_), metric(std::move(metric_)),
                                                   value(value_), coreId(coreId_), coreType(coreType_) {};
 };
+
+inline uint64_t OwnedBytes(const UnifiedSampleSummaryPmu &data)
+{
+    return Utils::OwnedBytesOf(data.metric);
+}
 }
 }
 #endif // MSPROF_ANALYSIS_UNIFIED_PMU_DATA_H
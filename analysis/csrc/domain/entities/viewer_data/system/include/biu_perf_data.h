@@ -19,6 +19,7 @@
 
 #include <string>
 #include "analysis/csrc/domain/entities/viewer_data/basic_data.h"
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis {
 namespace Domain {
@@ -30,6 +31,11 @@ struct BiuPerfData : public BasicData {
     std::string coreType;
     std::string instruction;
 };
+
+inline uint64_t OwnedBytes(const BiuPerfData &data)
+{
+    return Utils::OwnedBytesOf(data.coreType, data.instruction);
+}
 }
 }
 
@@ -19,6 +19,7 @@
 
 #include <string>
 #include "analysis/csrc/domain/entities/viewer_data/basic_data.h"
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis {
 namespace Domain {
@@ -28,6 +29,11 @@ struct PaLinkInfoData : public BasicData {
     std::string paLinkTrafficMonitRx;
     std::string paLinkTrafficMonitTx;
 };
+
+inline uint64_t OwnedBytes(const PaLinkInfoData &data)
+{
+    return Utils::OwnedBytesOf(data.paLinkTrafficMonitRx, data.paLinkTrafficMonitTx);
+}
 struct PcieInfoData : public BasicData {
     uint16_t deviceId = UINT16_MAX;
     uint32_t pcieId;
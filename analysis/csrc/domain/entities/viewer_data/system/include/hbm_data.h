@@ -19,6 +19,7 @@
 
 #include <string>
 #include "analysis/csrc/domain/entities/viewer_data/basic_data.h"
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis {
 namespace Domain {
@@ -29,6 +30,11 @@ struct HbmData : public BasicData {
     std::string eventType; // read和write
 };
 
+inline uint64_t OwnedBytes(const HbmData &data)
+{
+    return Utils::OwnedBytesOf(data.eventType);
+}
+
 struct HbmSummaryData {
     uint16_t deviceId = UINT16_MAX;
     uint8_t hbmId = UINT8_MAX; // hbmId为UINT8_MAX，表示Average,否则表示内存访问单元的ID
@@ -19,6 +19,7 @@
 
 #include <string>
 #include "analysis/csrc/domain/entities/viewer_data/basic_data.h"
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis {
 namespace Domain {
@@ -27,6 +28,11 @@ struct CpuUsageData : public BasicData {
     std::string cpuNo;
 };
 
+inline uint64_t OwnedBytes(const CpuUsageData &data)
+{
+    return Utils::OwnedBytesOf(data.cpuNo);
+}
+
 struct MemUsageData : public BasicData {
     double usage = 0.0;
 };
@@ -48,6 +54,11 @@ struct OSRuntimeApiData : public BasicData {
     uint64_t tid = 0;
     uint64_t endTime = 0;
 };
+
+inline uint64_t OwnedBytes(const OSRuntimeApiData &data)
+{
+    return Utils::OwnedBytesOf(data.name);
+}
 }
 }
 
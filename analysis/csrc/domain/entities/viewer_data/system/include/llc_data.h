@@ -19,6 +19,7 @@
 
 #include <string>
 #include "analysis/csrc/domain/entities/viewer_data/basic_data.h"
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis {
 namespace Domain {
@@ -30,6 +31,11 @@ struct LLcData : public BasicData {
     std::string mode; // read和write,从json文件里面读
 };
 
+inline uint64_t OwnedBytes(const LLcData &data)
+{
+    return Utils::OwnedBytesOf(data.mode);
+}
+
 struct LLcSummaryData {
     uint8_t llcId = UINT8_MAX; // llcId为UINT8_MAX，表示Average,否则表示任务ID
     uint16_t deviceId = UINT16_MAX;
@@ -37,6 +43,11 @@ struct LLcSummaryData {
     double throughput = 0;
     std::string mode;
 };
+
+inline uint64_t OwnedBytes(const LLcSummaryData &data)
+{
+    return Utils::OwnedBytesOf(data.mode);
+}
 }
 }
 
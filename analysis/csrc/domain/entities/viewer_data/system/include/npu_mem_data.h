@@ -19,6 +19,7 @@
 
 #include <string>
 #include "analysis/csrc/domain/entities/viewer_data/basic_data.h"
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis {
 namespace Domain {
@@ -29,6 +30,11 @@ struct NpuMemData : public BasicData {
     uint64_t memory = 0; // ddr与hbm之和
     std::string event;
 };
+
+inline uint64_t OwnedBytes(const NpuMemData &data)
+{
+    return Utils::OwnedBytesOf(data.event);
+}
 }
 }
 
@@ -18,6 +18,7 @@
 #define ANALYSIS_DOMAIN_NPU_MODULE_MEM_DATA_H
 
 #include "analysis/csrc/domain/entities/viewer_data/basic_data.h"
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis {
 namespace Domain {
@@ -27,6 +28,11 @@ struct NpuModuleMemData : public BasicData {
     uint64_t totalReserved = UINT64_MAX;
     std::string deviceType;
 };
+
+inline uint64_t OwnedBytes(const NpuModuleMemData &data)
+{
+    return Utils::OwnedBytesOf(data.deviceType);
+}
 }
 }
 
@@ -19,6 +19,7 @@
 
 #include <string>
 #include "analysis/csrc/domain/entities/viewer_data/basic_data.h"
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis {
 namespace Domain {
@@ -32,6 +33,11 @@ struct NpuOpMemData : public BasicData {
     uint64_t addr = UINT64_MAX;
     std::string operatorName;
 };
+
+inline uint64_t OwnedBytes(const NpuOpMemData &data)
+{
+    return Utils::OwnedBytesOf(data.operatorName);
+}
 }
 }
 
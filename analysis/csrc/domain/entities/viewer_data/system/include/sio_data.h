@@ -20,6 +20,7 @@
 #include <string>
 
 #include "analysis/csrc/domain/entities/viewer_data/basic_data.h"
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis
 {
@@ -39,6 +40,11 @@ struct SioData : public BasicData
     double datTxBandwidth = 0;
     std::string name;
 };
+
+inline uint64_t OwnedBytes(const SioData &data)
+{
+    return Utils::OwnedBytesOf(data.name);
+}
 }  // namespace Domain
 }  // namespace Analysis
 
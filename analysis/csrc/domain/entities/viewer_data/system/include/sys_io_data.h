@@ -20,6 +20,7 @@
 #include <string>
 #include <vector>
 #include "analysis/csrc/domain/entities/viewer_data/basic_data.h"
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis {
 namespace Domain {
@@ -72,25 +73,55 @@ struct NicOriginalData {
     std::vector<SysIOOriginalData> sysIOOriginalData;
 };
 
+inline uint64_t OwnedBytes(const NicOriginalData &data)
+{
+    return Utils::OwnedBytesOf(data.sysIOOriginalData);
+}
+
 struct NicReportData {
     std::vector<SysIOReportData> sysIOReportData;
 };
 
+inline uint64_t OwnedBytes(const NicReportData &data)
+{
+    return Utils::OwnedBytesOf(data.sysIOReportData);
+}
+
 struct NicReceiveSendData {
     std::vector<SysIOReceiveSendData> sysIOReceiveSendData;
 };
 
+inline uint64_t OwnedBytes(const NicReceiveSendData &data)
+{
+    return Utils::OwnedBytesOf(data.sysIOReceiveSendData);
+}
+
 struct RoceOriginalData {
     std::vector<SysIOOriginalData> sysIOOriginalData;
 };
 
+inline uint64_t OwnedBytes(const RoceOriginalData &data)
+{
+    return Utils::OwnedBytesOf(data.sysIOOriginalData);
+}
+
 struct RoceReportData {
     std::vector<SysIOReportData> sysIOReportData;
 };
 
+inline uint64_t OwnedBytes(const RoceReportData &data)
+{
+    return Utils::OwnedBytesOf(data.sysIOReportData);
+}
+
 struct RoceReceiveSendData {
     std::vector<SysIOReceiveSendData> sysIOReceiveSendData;
 };
+
+inline uint64_t OwnedBytes(const RoceReceiveSendData &data)
+{
+    return Utils::OwnedBytesOf(data.sysIOReceiveSendData);
+}
 }
 }
 
@@ -25,6 +25,7 @@
 #include "analysis/csrc/domain/entities/hal/include/top_down_task.h"
 #include "analysis/csrc/domain/services/device_context/device_context.h"
 #include "analysis/csrc/domain/services/device_context/load_host_data.h"
+#include "analysis/csrc/domain/valueobject/include/task_join.h"
 #include "analysis/csrc/infrastructure/dfx/error_code.h"
 #include "analysis/csrc/infrastructure/process/include/process_register.h"
 #include "analysis/csrc/infrastructure/resource/chip_id.h"
@@ -88,6 +89,31 @@ SyscntConversionParams GetSyscntConversionParams(const DeviceContext& context)
     SyscntConversionParams params{deviceInfo.hwtsFrequency, deviceStartLog.cntVct, hostMonotonic};
     return params;
 }
+
+// 同一键下的host/device条目行号，device侧streamId被回填后同一键可能对应多个条目
+struct TaskJoinGroup
+{
+    TaskKey key;
+    std::vector<size_t> hostRows;
+    std::vector<size_t> deviceRows;
+};
+
+// 同一键下所有host条目的任务，只有一个条目时直接引用，避免拷贝
+using HostEntry = std::map<TaskId, std::vector<HostTask>>::iterator;
+std::vector<HostTask>& CollectHostTasks(const std::vector<HostEntry>& entries, const std::vector<size_t>& rows,
+                                        std::vector<HostTask>& merged)
+{
+    if (rows.size() == 1)
+    {
+        return entries[rows.front()]->second;
+    }
+    for (auto row : rows)
+    {
+        const auto& tasks = entries[row]->second;
+        merged.insert(merged.end(), tasks.begin(), tasks.end());
+    }
+    return merged;
+}
 }  // namespace
 
 std::string GetDeviceTaskTypeStr(const DeviceTask& task)
@@ -154,34 +180,69 @@ std::vector<TopDownTask> GenerateTopDownTask(std::map<TaskId, std::vector<HostTa
                                              std::map<TaskId, std::vector<DeviceTask>>& deviceTasks,
                                              SyscntConversionParams& params)
 {
-    std::set<TaskId> totalTaskId;
-    std::transform(hostTasks.begin(), hostTasks.end(), std::inserter(totalTaskId, totalTaskId.begin()),
-                   [](const std::pair<TaskId, std::vector<HostTask>>& p) { return p.first; });
-    for (auto& it : deviceTasks)
+    using DeviceEntry = std::map<TaskId, std::vector<DeviceTask>>::iterator;
+    std::vector<HostEntry> hostEntries;
+    std::vector<DeviceEntry> deviceEntries;
+    std::vector<TaskJoinGroup> groups;
+    std::vector<TopDownTask> res;
+    if (!Reserve(hostEntries, hostTasks.size()) || !Reserve(deviceEntries, deviceTasks.size()))
     {
-        totalTaskId.insert(it.first);
+        ERROR("Reserve for task association failed.");
+        return res;
     }
-    std::vector<TopDownTask> res;
+    for (auto it = hostTasks.begin(); it != hostTasks.end(); ++it)
+    {
+        hostEntries.emplace_back(it);
+    }
+    for (auto it = deviceTasks.begin(); it != deviceTasks.end(); ++it)
+    {
+        deviceEntries.emplace_back(it);
+    }
+    // 两侧键通常均有序，按键升序做sort-merge；device侧streamId被回填后可能无序，此时走hash join
+    TaskJoin::Join(
+        hostEntries, deviceEntries, [](const HostEntry& entry) { return PackTaskKey(entry->first); },
+        [](const DeviceEntry& entry) { return PackTaskKey(entry->first); },
+        [&groups](const TaskKey& key, const JoinRows& hostRows, const JoinRows& deviceRows)
+        {
+            groups.push_back({key, std::vector<size_t>(hostRows.begin, hostRows.end),
+                              std::vector<size_t>(deviceRows.begin, deviceRows.end)});
+        });
+    // hash join的分组顺序不确定，按TaskId升序输出，同一键下的条目按map中的顺序合并
+    std::sort(groups.begin(), groups.end(),
+              [](const TaskJoinGroup& lhs, const TaskJoinGroup& rhs) { return lhs.key < rhs.key; });
     size_t matchSize = 0;
-    for (auto& key : totalTaskId)
+    for (auto& group : groups)
     {
-        auto hostIt = hostTasks.find(key);
-        auto deviceIt = deviceTasks.find(key);
-        if (hostIt != hostTasks.end() && deviceIt != deviceTasks.end())
+        std::sort(group.hostRows.begin(), group.hostRows.end());
+        std::sort(group.deviceRows.begin(), group.deviceRows.end());
+        std::vector<HostTask> mergedHosts;
+        auto& hosts = CollectHostTasks(hostEntries, group.hostRows, mergedHosts);
+        if (group.deviceRows.empty())
+        {
+            MergeByOnlyHostTask(res, hosts);
+            continue;
+        }
+        for (auto row : group.deviceRows)
         {
-            if (hostIt->second.size() > 1 && deviceIt->second.size() > 1)
+            const auto& key = deviceEntries[row]->first;
+            auto& devices = deviceEntries[row]->second;
+            if (hosts.empty())
+            {
+                MergeByOnlyDeviceTask(res, devices, key, params);
+                continue;
+            }
+            if (hosts.size() > 1 && devices.size() > 1)
             {
                 ERROR(
                     "There are % hostTask and % deviceTask, can't match streamId is: %, taskId is: %, ctxId is: %,"
                     "batchId is: %",
-                    hostIt->second.size(), deviceIt->second.size(), key.streamId, key.taskId, key.contextId,
-                    key.batchId);
+                    hosts.size(), devices.size(), key.streamId, key.taskId, key.contextId, key.batchId);
                 continue;
             }
-            if (hostIt->second.size() == 1)
+            if (hosts.size() == 1)
             {
-                MergeByHostAndDeviceTask(res, hostIt->second[0], deviceIt->second, params);
-                matchSize += deviceIt->second.size();
+                MergeByHostAndDeviceTask(res, hosts[0], devices, params);
+                matchSize += devices.size();
             }
             else
             {
@@ -189,14 +250,6 @@ std::vector<TopDownTask> GenerateTopDownTask(std::map<TaskId, std::vector<HostTa
                       key.streamId, key.taskId, key.contextId, key.batchId);
             }
         }
-        else if (hostIt == hostTasks.end())
-        {
-            MergeByOnlyDeviceTask(res, deviceIt->second, key, params);
-        }
-        else
-        {  // 因为所有的key都是从hostTasks与deviceTasks中取的，所以一定不会有两者都找不到key的情况，该分支为device为空
-            MergeByOnlyHostTask(res, hostIt->second);
-        }
     }
     INFO("Found % host device matched task, generate % topDownTask", matchSize, res.size());
     return res;
@@ -17,14 +17,18 @@
 
 #include <algorithm>
 #include <cctype>
+#include <thread>
 #include <tuple>
 #include <utility>
 
 #include "analysis/csrc/domain/services/association/include/ascend_task_association.h"
 #include "analysis/csrc/domain/services/device_context/device_context.h"
 #include "analysis/csrc/domain/services/device_context/load_host_data.h"
+#include "analysis/csrc/domain/valueobject/include/task_join.h"
 #include "analysis/csrc/infrastructure/dfx/error_code.h"
 #include "analysis/csrc/infrastructure/resource/chip_id.h"
+#include "analysis/csrc/infrastructure/utils/radix_sort.h"
+#include "analysis/csrc/infrastructure/utils/thread_pool.h"
 
 namespace Analysis
 {
@@ -55,6 +59,38 @@ const std::string NA = "N/A";
 const int POS_COMPARE_BASE = 3;
 const std::string AICPU_KERNEL = "AicpuKernel";
 const std::string NORMAL = "Normal";
+const uint32_t MAX_BANDWIDTH_THREADS = 8;
+// task数量较少时线程调度开销大于收益，在当前线程计算
+const size_t PARALLEL_BANDWIDTH_MIN_TASKS = 4096;
+const int PARTITION_OP_SHIFT = 32;
+
+// 字符串到连续整数ID的映射，相邻数据多为同一字符串，先与上一次的结果比较
+class StringInterner
+{
+   public:
+    uint32_t Intern(const std::string& str)
+    {
+        if (last_ != nullptr && *last_ == str)
+        {
+            return lastId_;
+        }
+        // unordered_map扩容不会改变元素地址，last_始终有效
+        auto it = ids_.emplace(str, static_cast<uint32_t>(ids_.size())).first;
+        last_ = &it->first;
+        lastId_ = it->second;
+        return lastId_;
+    }
+
+    size_t Size() const
+    {
+        return ids_.size();
+    }
+
+   private:
+    std::unordered_map<std::string, uint32_t> ids_;
+    const std::string* last_ = nullptr;
+    uint32_t lastId_ = 0;
+};
 }  // namespace
 
 uint32_t HcclCalculator::ProcessEntry(DataInventory& dataInventory, const Context& context)
@@ -67,9 +103,9 @@ uint32_t HcclCalculator::ProcessEntry(DataInventory& dataInventory, const Contex
     }
 
     // 前面多线程数据处理 此处的task可能不保序 重新排序
-    std::sort(
-        taskData_.begin(), taskData_.end(), [](const DeviceHcclTask& task1, const DeviceHcclTask& task2)
-        { return std::tie(task1.hostTimestamp, task1.timestamp) < std::tie(task2.hostTimestamp, task2.timestamp); });
+    Utils::RadixSort::SortByKeys(
+        taskData_, [](const DeviceHcclTask& task) { return task.hostTimestamp; },
+        [](const DeviceHcclTask& task) { return Utils::RadixKeyOfDouble(task.timestamp); });
 
     const auto& deviceContext = dynamic_cast<const DeviceContext&>(context);
     DeviceStartInfo startInfo;
@@ -126,15 +162,26 @@ bool HcclCalculator::MergeHcclTaskData(const std::shared_ptr<std::vector<TopDown
                                        std::vector<DeviceHcclTask>& deviceHcclTasks)
 {
     INFO("Start merge hccl task and ascend task.");
-    std::sort(ascendTasks->begin(), ascendTasks->end(),
-              [](const TopDownTask& task1, const TopDownTask& task2) { return task1.startTime < task2.startTime; });
-    std::sort(hcclTasks->begin(), hcclTasks->end(),
-              [](const HcclTask& task1, const HcclTask& task2) { return task1.timestamp < task2.timestamp; });
-    std::map<TaskId, std::vector<TopDownTask>> taskTable;
+    Utils::RadixSort::Sort(*ascendTasks,
+                           [](const TopDownTask& task) { return Utils::RadixKeyOfDouble(task.startTime); });
+    Utils::RadixSort::Sort(*hcclTasks, [](const HcclTask& task) { return task.timestamp; });
+    // 以ascend task建立hash索引，组内行号保持startTime升序；按时间顺序逐个探测hccl task
+    std::vector<TaskKey> ascendKeys;
+    if (!Utils::Reserve(ascendKeys, ascendTasks->size()))
+    {
+        ERROR("Reserve for ascend task key failed.");
+        return false;
+    }
     for (const auto& task : *ascendTasks)
     {
-        TaskId tempId(task.streamId, task.batchId, task.taskId, task.contextId);
-        taskTable[tempId].emplace_back(task);
+        ascendKeys.emplace_back(
+            PackTaskKey(0, static_cast<uint16_t>(task.streamId), task.batchId, task.taskId, task.contextId));
+    }
+    TaskKeyIndex taskIndex;
+    if (!taskIndex.Build(ascendKeys))
+    {
+        ERROR("Build ascend task index failed.");
+        return false;
     }
     if (!Utils::Reserve(deviceHcclTasks, hcclTasks->size()))
     {
@@ -143,15 +190,17 @@ bool HcclCalculator::MergeHcclTaskData(const std::shared_ptr<std::vector<TopDown
     }
     for (const auto& task : *hcclTasks)
     {
-        TaskId tempId(task.streamId, task.batchId, task.taskId, task.contextId);
-        if (taskTable.find(tempId) == taskTable.end())
+        auto rows = taskIndex.Find(
+            PackTaskKey(0, static_cast<uint16_t>(task.streamId), task.batchId, task.taskId, task.contextId));
+        if (rows.Empty())
         {
             ERROR("Hccl task can't match ascend task, streamId is: %, taskId is: %, contextId is: %, batchId is: %",
                   task.streamId, task.taskId, task.contextId, task.batchId);
             continue;
         }
-        for (const auto& ascendTask : taskTable[tempId])
+        for (auto row = rows.begin; row != rows.end; ++row)
         {
+            const auto& ascendTask = (*ascendTasks)[*row];
             if (!Utils::IsDoubleEqual(ascendTask.startTime, -1))
             {
                 deviceHcclTasks.emplace_back(InitHcclTaskData(ascendTask, task));
@@ -193,13 +242,12 @@ DeviceHcclTask HcclCalculator::InitHcclTaskData(const TopDownTask& topDownTask,
 }
 
 void HcclCalculator::MergeOpDataByThreadId(std::vector<HcclOp>& hcclOps, std::vector<DeviceHcclTask>& hcclTasks,
-                                           std::map<TaskId, uint16_t>& opCount)
+                                           std::unordered_map<TaskKey, uint16_t, TaskKeyHasher>& opCount)
 {
-    std::sort(hcclOps.begin(), hcclOps.end(),
-              [](const HcclOp& op1, const HcclOp& op2) { return op1.timestamp < op2.timestamp; });
-    std::sort(
-        hcclTasks.begin(), hcclTasks.end(), [](const DeviceHcclTask& task1, const DeviceHcclTask& task2)
-        { return std::tie(task1.hostTimestamp, task1.timestamp) < std::tie(task2.hostTimestamp, task2.timestamp); });
+    Utils::RadixSort::Sort(hcclOps, [](const HcclOp& op) { return op.timestamp; });
+    Utils::RadixSort::SortByKeys(
+        hcclTasks, [](const DeviceHcclTask& task) { return task.hostTimestamp; },
+        [](const DeviceHcclTask& task) { return Utils::RadixKeyOfDouble(task.timestamp); });
     size_t taskIdx = 0;
     for (auto& op : hcclOps)
     {
@@ -213,10 +261,10 @@ void HcclCalculator::MergeOpDataByThreadId(std::vector<HcclOp>& hcclOps, std::ve
 
         while ((taskIdx < hcclTasks.size()) && (hcclTasks[taskIdx].hostTimestamp <= (op.timestamp + op.duration)))
         {
-            TaskId tempId(hcclTasks[taskIdx].streamId, hcclTasks[taskIdx].batchId, hcclTasks[taskIdx].taskId,
-                          hcclTasks[taskIdx].contextId);
-            uint16_t count = (opCount.find(tempId) == opCount.end()) ? 1 : (opCount[tempId] + 1);
-            opCount[tempId] = count;
+            const auto& task = hcclTasks[taskIdx];
+            auto& count = opCount[PackTaskKey(0, static_cast<uint16_t>(task.streamId), task.batchId, task.taskId,
+                                              task.contextId)];
+            ++count;
             taskData_.emplace_back(GetCompleteHcclTaskData(op, hcclTasks[taskIdx], count));
             op.rankSize = hcclTasks[taskIdx].rankSize;
             taskIdx++;
@@ -256,16 +304,17 @@ bool HcclCalculator::MergeHcclOpData(const std::shared_ptr<std::vector<HcclOp>>&
         hcclTaskThreadMap[task.threadId].emplace_back(task);
     }
 
-    std::map<TaskId, uint16_t> opCount;
+    std::unordered_map<TaskKey, uint16_t, TaskKeyHasher> opCount;
     for (auto& pair : hcclOpThreadMap)
     {
-        if (hcclTaskThreadMap.find(pair.first) == hcclTaskThreadMap.end())
+        auto taskIt = hcclTaskThreadMap.find(pair.first);
+        if (taskIt == hcclTaskThreadMap.end())
         {
             ERROR("Op data can't match any task, thread id is %.", pair.first);
         }
         else
         {
-            MergeOpDataByThreadId(pair.second, hcclTaskThreadMap[pair.first], opCount);
+            MergeOpDataByThreadId(pair.second, taskIt->second, opCount);
         }
     }
     return true;
@@ -312,14 +361,20 @@ HcclOp HcclCalculator::GetCompleteHcclOpData(const HcclOp& op)
 void HcclCalculator::UpdateHcclOpNameByGroupName(uint64_t clockMonotonicRaw)
 {
     INFO("Start UpdateHcclOpNameByGroupName.");
-    std::unordered_map<std::string, GroupData> hcclGroup;
+    // groupName映射为整数ID，(groupId, 是否AicpuKernel)对应hcclGroup中的一项
+    StringInterner groupIds;
+    std::vector<GroupData> hcclGroup;
     //  if data start in warmup, index will be set -1
     //  else index++ when groupName and taskType in group_dict or group name set first
     for (auto& data : taskData_)
     {
-        auto taskType = (data.opName.find(AICPU_KERNEL) != std::string::npos) ? AICPU_KERNEL : NORMAL;
-        auto key = Utils::Join("_", taskType, data.groupName);
-        auto& groupEntry = hcclGroup[key];
+        auto isAicpu = data.opName.find(AICPU_KERNEL) != std::string::npos;
+        auto groupIdx = static_cast<size_t>(groupIds.Intern(data.groupName)) * 2 + (isAicpu ? 1 : 0);
+        if (groupIdx >= hcclGroup.size())
+        {
+            hcclGroup.resize(groupIds.Size() * 2);
+        }
+        auto& groupEntry = hcclGroup[groupIdx];
         if (data.timestamp > clockMonotonicRaw && data.firstTimestamp > groupEntry.firstTimestamp)
         {
             groupEntry.firstTimestamp = data.firstTimestamp;
@@ -340,27 +395,87 @@ void HcclCalculator::UpdateHcclBandwidth()
 {
     INFO("Start UpdateHcclBandwidth.");
     // 按时间升序排序，确保后续payload遍历时数据顺序正确
-    std::sort(taskData_.begin(), taskData_.end(), [](const DeviceHcclTask& task1, const DeviceHcclTask& task2)
-              { return task1.timestamp < task2.timestamp; });
-    std::unordered_map<std::string, std::unordered_map<int32_t, std::vector<DeviceHcclTask*>>> taskTable;
-    for (auto& data : taskData_)
+    Utils::RadixSort::Sort(taskData_,
+                           [](const DeviceHcclTask& task) { return Utils::RadixKeyOfDouble(task.timestamp); });
+    // opName(已带group后缀)映射为整数ID，与planeId组成分区键；稳定排序后同一分区连续且保持时间升序
+    StringInterner opIds;
+    std::vector<uint64_t> partitionKeys;
+    if (!Utils::Reserve(partitionKeys, taskData_.size()))
     {
-        // 没有提前reserve，这里可能很耗时
-        taskTable[data.opName][data.planeId].push_back(&data);
+        ERROR("Reserve for hccl partition key failed.");
+        return;
     }
-    for (auto& planeTable : taskTable)
+    for (const auto& data : taskData_)
     {
-        for (auto& taskData : planeTable.second)
+        partitionKeys.emplace_back((static_cast<uint64_t>(opIds.Intern(data.opName)) << PARTITION_OP_SHIFT) |
+                                   static_cast<uint32_t>(data.planeId));
+    }
+    std::vector<size_t> order;
+    if (!Utils::RadixSort::ArgSort(partitionKeys, [](uint64_t key) { return key; }, order))
+    {
+        ERROR("Sort hccl task by op and plane failed.");
+        return;
+    }
+    std::vector<DeviceHcclTask*> tasks;
+    std::vector<size_t> bounds;
+    if (!Utils::Resize(tasks, order.size()) || !Utils::Reserve(bounds, opIds.Size() + 1))
+    {
+        ERROR("Reserve for hccl partition failed.");
+        return;
+    }
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        tasks[i] = &taskData_[order[i]];
+        if (i == 0 || partitionKeys[order[i]] != partitionKeys[order[i - 1]])
         {
-            CalculateTaskBandwidth(taskData.second);
+            bounds.emplace_back(i);
         }
     }
+    bounds.emplace_back(tasks.size());
+    CalculatePartitionsBandwidth(tasks, bounds);
+}
+
+void HcclCalculator::CalculatePartitionsBandwidth(const std::vector<DeviceHcclTask*>& tasks,
+                                                  const std::vector<size_t>& bounds)
+{
+    size_t partitionNum = bounds.size() - 1;
+    uint32_t threadsNum = std::min(std::max(std::thread::hardware_concurrency(), 1U), MAX_BANDWIDTH_THREADS);
+    if (tasks.size() < PARALLEL_BANDWIDTH_MIN_TASKS || partitionNum < 2 || threadsNum < 2)
+    {
+        for (size_t i = 0; i < partitionNum; ++i)
+        {
+            CalculateTaskBandwidth(tasks, bounds[i], bounds[i + 1]);
+        }
+        return;
+    }
+    // 按task数量把连续的分区切成若干块，每块一个任务；各分区的task互不相交，结果与串行计算一致
+    size_t chunkTasks = (tasks.size() + threadsNum - 1) / threadsNum;
+    Utils::ThreadPool pool(threadsNum);
+    pool.Start();
+    size_t first = 0;
+    while (first < partitionNum)
+    {
+        size_t last = first + 1;
+        while (last < partitionNum && bounds[last] - bounds[first] < chunkTasks)
+        {
+            ++last;
+        }
+        pool.AddTask([this, &tasks, &bounds, first, last]() {
+            for (size_t i = first; i < last; ++i)
+            {
+                CalculateTaskBandwidth(tasks, bounds[i], bounds[i + 1]);
+            }
+        });
+        first = last;
+    }
+    pool.WaitAllTasks();
+    pool.Stop();
 }
 
-void HcclCalculator::CalculateTaskBandwidth(std::vector<DeviceHcclTask*> hcclTasks)
+void HcclCalculator::CalculateTaskBandwidth(const std::vector<DeviceHcclTask*>& hcclTasks, size_t begin, size_t end)
 {
-    uint16_t idx_jump = GetJumpNum(*hcclTasks.front());
-    for (size_t idx = 0; idx < hcclTasks.size(); ++idx)
+    uint16_t idx_jump = GetJumpNum(*hcclTasks[begin]);
+    for (size_t idx = begin; idx < end; ++idx)
     {
         // 非RDMA_SEND_PAYLOAD类型直接计算；RDMA_SEND_PAYLOAD类型走其他计算逻辑
         if (hcclTasks[idx]->rdmaType != RDMA_SEND_PAYLOAD)
@@ -368,14 +483,14 @@ void HcclCalculator::CalculateTaskBandwidth(std::vector<DeviceHcclTask*> hcclTas
             hcclTasks[idx]->bandwidth = CalculateBandwidth(hcclTasks[idx]->size, hcclTasks[idx]->duration);
             continue;
         }
-        uint16_t payloadCnt = FindConsecutivePayloadTask(hcclTasks, idx);
+        uint16_t payloadCnt = FindConsecutivePayloadTask(hcclTasks, idx, end);
         auto closeIdx = idx + payloadCnt + idx_jump - 2;
-        if ((closeIdx) >= hcclTasks.size())
+        if ((closeIdx) >= end)
         {
             WARN(
                 "Bandwidth calculation abnormal. Missing closure tasks. op_name: %, index is: %, paypladCnt is: %, "
                 "idx_jump is: %,",
-                hcclTasks[idx]->opName, idx, payloadCnt, idx_jump);
+                hcclTasks[idx]->opName, idx - begin, payloadCnt, idx_jump);
             hcclTasks[idx]->bandwidth = CalculateBandwidth(hcclTasks[idx]->size, hcclTasks[idx]->duration);
             continue;
         }
@@ -412,10 +527,10 @@ double HcclCalculator::CalculateBandwidth(double size, double duration)
     return (Utils::IsDoubleEqual(duration, 0.0) || (duration <= 0)) ? 0 : static_cast<double>(size) / duration;
 }
 
-uint16_t HcclCalculator::FindConsecutivePayloadTask(std::vector<DeviceHcclTask*> tasks, size_t idx)
+uint16_t HcclCalculator::FindConsecutivePayloadTask(const std::vector<DeviceHcclTask*>& tasks, size_t idx, size_t end)
 {
     uint16_t count = 0;
-    while (idx < tasks.size() && tasks[idx]->rdmaType == RDMA_SEND_PAYLOAD)
+    while (idx < end && tasks[idx]->rdmaType == RDMA_SEND_PAYLOAD)
     {
         idx++;
         count++;
@@ -18,12 +18,15 @@
 #define ANALYSIS_DOMAIN_SERVICES_ASSOCIATION_CALCULATOR_HCCL_CALCULATOR_H
 
 #include <limits>
+#include <unordered_map>
 #include <vector>
 
 #include "analysis/csrc/domain/entities/hal/include/top_down_task.h"
 #include "analysis/csrc/domain/entities/hccl/include/hccl_task.h"
 #include "analysis/csrc/domain/valueobject/include/task_id.h"
+#include "analysis/csrc/domain/valueobject/include/task_join.h"
 #include "analysis/csrc/infrastructure/process/include/process.h"
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis
 {
@@ -68,6 +71,12 @@ struct DeviceHcclTask
     std::string opName;
 };
 
+inline uint64_t OwnedBytes(const DeviceHcclTask &data)
+{
+    return Utils::OwnedBytesOf(data.notifyId, data.rdmaType, data.dataType, data.linkType, data.transportType,
+                               data.isDynamic, data.taskType, data.opType, data.hcclName, data.groupName, data.opName);
+}
+
 struct HcclStatistics
 {
     std::string opType;
@@ -79,6 +88,11 @@ struct HcclStatistics
     double ratio = 0.0;
 };
 
+inline uint64_t OwnedBytes(const HcclStatistics &data)
+{
+    return Utils::OwnedBytesOf(data.opType);
+}
+
 class HcclCalculator : public Process
 {
    private:
@@ -89,17 +103,19 @@ class HcclCalculator : public Process
                            std::vector<DeviceHcclTask>& deviceHcclTasks);
     DeviceHcclTask InitHcclTaskData(const TopDownTask& topDownTask, const HcclTask& hcclTask);
     void MergeOpDataByThreadId(std::vector<HcclOp>& hcclOps, std::vector<DeviceHcclTask>& hcclTasks,
-                               std::map<TaskId, uint16_t>& opCount);
+                               std::unordered_map<TaskKey, uint16_t, TaskKeyHasher>& opCount);
     bool MergeHcclOpData(const std::shared_ptr<std::vector<HcclOp>>& hcclOps,
                          const std::vector<DeviceHcclTask>& deviceHcclTasks);
     DeviceHcclTask GetCompleteHcclTaskData(const HcclOp& op, const DeviceHcclTask& hcclTask, uint16_t count);
     HcclOp GetCompleteHcclOpData(const HcclOp& op);
     void UpdateHcclOpNameByGroupName(uint64_t clockMonotonicRaw);
     void UpdateHcclBandwidth();
-    void CalculateTaskBandwidth(std::vector<DeviceHcclTask*> hcclTasks);
+    // bounds[i]到bounds[i + 1]为同一(opName, planeId)分区的task，各分区并行计算带宽
+    void CalculatePartitionsBandwidth(const std::vector<DeviceHcclTask*>& tasks, const std::vector<size_t>& bounds);
+    void CalculateTaskBandwidth(const std::vector<DeviceHcclTask*>& hcclTasks, size_t begin, size_t end);
     uint16_t GetJumpNum(const DeviceHcclTask& task);
     double CalculateBandwidth(double size, double duration);
-    uint16_t FindConsecutivePayloadTask(std::vector<DeviceHcclTask*> tasks, size_t idx);
+    uint16_t FindConsecutivePayloadTask(const std::vector<DeviceHcclTask*>& tasks, size_t idx, size_t end);
     bool GetHcclStatisticsData(uint64_t clockMonotonicRaw);
     bool InjectData(DataInventory& inventory);
 
@@ -31,202 +31,128 @@ double Calculator::CalculatorTotalTime(uint64_t totalCycle, uint64_t blockNum, u
     return res;
 }
 
-double Calculator::CalculatorMetricByAdditions(CalculationElements& allParams, size_t index)
+namespace {
+// 计数器事件与核数取决于上报PMU的核类型
+void GetEventsAndCoreNum(const SampleInfo& info, const DeviceInfo& deviceInfo, const HalPmuData& pmu,
+                         std::vector<uint32_t>& events, uint32_t& coreNum)
 {
-    double res = 0.0;
-    if (allParams.taskCyc != 0) {
-        for (size_t i = 0; i < allParams.pmuList.size(); ++i) {
-            res += ((*allParams.floatBit)[index] * allParams.pmuList[i] / allParams.taskCyc);
-        }
-    }
-    return res;
-}
-
-double Calculator::CalculatorMetricByDivision(CalculationElements &allParams, size_t index)
-{
-    double res = 0.0;
-    if (allParams.taskCyc == 0) {
-        return res;
-    }
-    for (size_t i = 0; i < allParams.pmuList.size(); ++i) {
-        if (allParams.pmuList[i] == 0) {
-            return 0.0;
-        }
-        if (i == 0) {
-            res += ((*allParams.floatBit)[index] * allParams.pmuList[i] / allParams.taskCyc);
-        } else {
-            if (!Utils::IsDoubleEqual((*allParams.floatBit)[index], 0.0)) {
-                res /= ((*allParams.floatBit)[index] * allParams.pmuList[i] / allParams.taskCyc);
-            }
-        }
-    }
-    return res;
-}
-
-double Calculator::CalculatorMetricByNothing(CalculationElements& allParams, size_t index)
-{
-    double res = 0.0;
-    for (const auto& value : allParams.pmuList) {
-        res += value;
-    }
-    return res;
-}
-
-double Calculator::CalculatorMetricByAdditionsWithFreq(CalculationElements& allParams, size_t index)
-{
-    double res = 0.0;
-    if (allParams.taskCyc != 0 && allParams.bwFreq != 0) {
-        double freq = static_cast<double>(allParams.bwFreq);
-        for (size_t i = 0; i < allParams.pmuList.size(); ++i) {
-            res += ((*allParams.floatBit)[index] * allParams.pmuList[i] * (*allParams.pipSize)[index] *
-                    (*allParams.scalar)[index] / (allParams.taskCyc / freq) / OFFSET);
-        }
-    }
-    return res;
-}
-
-double Calculator::CalculatorTimeByMultiplication(CalculationElements& allParams, size_t index)
-{
-    return allParams.totalTime * CalculatorMetricByAdditions(allParams, index);
-}
-
-double Calculator::CalculatorCubeFops(CalculationElements& allParams, size_t index)
-{
-    double res = 0.0;
-    if (allParams.taskCyc != 0) {
-        if (allParams.pmuList.size() > allParams.cubeParams->size()) {
-            ERROR("The cube params count is small than the pmu count, can't calculator!");
-            return res;
-        }
-        for (size_t i = 0; i < allParams.pmuList.size(); ++i) {
-            res += ((*allParams.floatBit)[index] * allParams.pmuList[i] * (*allParams.cubeParams)[i]);
-        }
-    }
-    return res;
+    bool useAicEvents = (pmu.pmu.acceleratorType == MIX_AIC || pmu.pmu.acceleratorType == AIC) == (pmu.type == PMU);
+    const auto& source = useAicEvents ? info.aiCoreProfilingEvents : info.aivProfilingEvents;
+    events.assign(source.begin(), source.end());
+    coreNum = useAicEvents ? deviceInfo.aiCoreNum : deviceInfo.aivNum;
 }
 
-double Calculator::CalculatorVectorFops(CalculationElements& allParams, size_t index)
+// freqData已按sysCnt升序排列，取timestamp之前最后一次变频的频率
+uint64_t GetFreq(const std::vector<HalFreqLpmData>& freqData, uint64_t freq, uint64_t timestamp)
 {
-    double res = 0.0;
-    if (allParams.taskCyc != 0) {
-        if (allParams.pmuList.size() > allParams.vectorParams->size()) {
-            ERROR("The vector params count is small than the pmu count, can't calculator!");
-            return res;
-        }
-        for (size_t i = 0; i < allParams.pmuList.size(); ++i) {
-            res += ((*allParams.floatBit)[index] * allParams.pmuList[i] * (*allParams.vectorParams)[i]);
-        }
-    }
-    return res;
-}
-
-double Calculator::CalculateMetricWithoutCycByAdd(CalculationElements &allParams, size_t index)
-{
-    double res = 0.0;
-    for (size_t i = 0; i < allParams.pmuList.size(); ++i) {
-        res += (*allParams.floatBit)[index] * static_cast<double>(allParams.pmuList[i]);
-    }
-    return res;
-}
-
-double Calculator::CalculateMetricWithoutCycBySub(CalculationElements &allParams, size_t index)
-{
-    double res = 0.0;
-    double tmpRes;
-    for (size_t i = 0; i < allParams.pmuList.size(); ++i) {
-        tmpRes = (*allParams.floatBit)[index] * static_cast<double>(allParams.pmuList[i]);
-        if (i == 0) {
-            res += tmpRes;
-        } else {
-            res -= tmpRes;
-        }
+    auto it = std::upper_bound(freqData.begin(), freqData.end(), timestamp,
+                               [](uint64_t ts, const HalFreqLpmData& data) { return ts < data.sysCnt; });
+    if (it == freqData.begin()) {
+        return freq;
     }
-    return res;
+    uint64_t res = std::prev(it)->freq * FREQ_TO_Hz;
+    return res != 0 ? res : freq;
 }
-
-std::unordered_map<uint32_t, uint64_t> MetricCalculator::GetValueMappingOffset(CalculationElements& params,
-                                                                               HalPmuData& pmuData)
-{
-    std::unordered_map<uint32_t, uint64_t> res;
-    if (params.events.size() != pmuData.pmu.pmuList.size()) {
-        ERROR("PMU length is not equal with pmu events, please check");
-        return res;
-    }
-    for (size_t i = 0; i < params.events.size(); ++i) {
-        res.insert({params.events[i], pmuData.pmu.pmuList[i]});
-    }
-    return res;
 }
 
-void SetBlockNum(DeviceTask& task, CalculationElements& allParams, HalPmuData& pmu)
+bool MetricCalculator::PreparePlan(const DeviceContext& context, const std::vector<uint32_t>& events)
 {
-    if (pmu.type == PMU) {
-        allParams.blockNum = task.blockNum;
-    } else {
-        allParams.blockNum = task.mixBlockNum;
+    if (planReady_ && planEvents_ == events) {
+        return true;
     }
+    planReady_ = BuildPlan(context, events);
+    planEvents_ = events;
+    return planReady_;
 }
 
-uint64_t GetFreq(std::vector<HalFreqLpmData>& freqData, uint64_t freq, HalPmuData& pmu)
+bool MetricCalculator::CalculatePmuMetrics(DataInventory& dataInventory, const DeviceContext& context,
+                                           const std::vector<HalPmuData*>& pmus,
+                                           const std::vector<DeviceTask*>& tasks, PmuMetricResult& result)
 {
-    std::sort(freqData.begin(), freqData.end(), [](HalFreqLpmData& lData, HalFreqLpmData& rData) {
-        return lData.sysCnt < rData.sysCnt;
-    });
-    bool hasZeroFreq = std::any_of(freqData.begin(), freqData.end(), [](HalFreqLpmData& data) {
-        return data.freq == 0;
-    });
-    if (hasZeroFreq) {
-        return freq;
-    }
-    auto res = freq;
-    for (auto& data : freqData) {
-        if (pmu.pmu.timeList[1] < data.sysCnt) {
-            break;
-        }
-        res = data.freq * FREQ_TO_Hz;
+    result.metrics.clear();
+    result.totalTimes.clear();
+    if (pmus.empty() || pmus.size() != tasks.size()) {
+        return pmus.size() == tasks.size();
     }
-    return res != 0 ? res : freq;
-}
-
-std::vector<double> MetricCalculator::CalculatePmuMetric(DataInventory& dataInventory, const DeviceContext& context,
-                                                         CalculationElements& params, HalPmuData& pmu, DeviceTask& task)
-{
     DeviceInfo deviceInfo{};
     context.Getter(deviceInfo);
     SampleInfo info;
     context.Getter(info);
     uint64_t freq = deviceInfo.aicFrequency * FREQ_TO_Hz;
-    params.bwFreq = freq;
-    // chip4的PMU计算需要判断解析的频率信息
+    // chip4的PMU计算需要判断解析的频率信息，变频数据整批只排序一次
+    std::shared_ptr<std::vector<HalFreqLpmData>> freqData;
     if (context.GetChipID() == CHIP_V4_1_0) {
-        auto freqData = dataInventory.GetPtr<std::vector<HalFreqLpmData>>();
-        if (freqData != nullptr) {
-            freq = GetFreq(*freqData, freq, pmu);
+        freqData = dataInventory.GetPtr<std::vector<HalFreqLpmData>>();
+    }
+    if (freqData != nullptr) {
+        std::sort(freqData->begin(), freqData->end(), [](const HalFreqLpmData& lData, const HalFreqLpmData& rData) {
+            return lData.sysCnt < rData.sysCnt;
+        });
+        bool hasZeroFreq = std::any_of(freqData->begin(), freqData->end(), [](const HalFreqLpmData& data) {
+            return data.freq == 0;
+        });
+        if (hasZeroFreq) {
+            freqData.reset();
         }
     }
-    params.timeFreq = freq;
-    params.taskCyc = pmu.pmu.totalCycle;
-    if (!Utils::Resize(params.events, info.aiCoreProfilingEvents.size())) {
-        ERROR("pmu events resize failed!");
-        return {};
+    std::vector<uint32_t> events;
+    uint32_t coreNum = 0;
+    GetEventsAndCoreNum(info, deviceInfo, *pmus.front(), events, coreNum);
+
+    // 转为按列存放
+    const size_t rows = pmus.size();
+    PmuColumns columns;
+    columns.rows = rows;
+    columns.bwFreq = freq;
+    if (!Utils::Resize(columns.counters, events.size()) || !Utils::Resize(columns.taskCyc, rows) ||
+        !Utils::Resize(columns.totalTime, rows)) {
+        ERROR("pmu columns resize failed!");
+        return false;
+    }
+    for (auto& counter : columns.counters) {
+        if (!Utils::Resize(counter, rows)) {
+            ERROR("pmu columns resize failed!");
+            return false;
+        }
     }
-    if (pmu.pmu.acceleratorType == MIX_AIC || pmu.pmu.acceleratorType == AIC) {
-        if (pmu.type == PMU) {
-            std::copy(info.aiCoreProfilingEvents.begin(), info.aiCoreProfilingEvents.end(), params.events.begin());
+    size_t invalidNum = 0;
+    for (size_t r = 0; r < rows; ++r) {
+        const auto& pmu = *pmus[r];
+        // 计数器个数与事件个数不一致时该task的计数器均按0计算
+        if (pmu.pmu.pmuList.size() == events.size()) {
+            for (size_t i = 0; i < events.size(); ++i) {
+                columns.counters[i][r] = pmu.pmu.pmuList[i];
+            }
         } else {
-            std::copy(info.aivProfilingEvents.begin(), info.aivProfilingEvents.end(), params.events.begin());
+            ++invalidNum;
         }
-        params.coreNum = pmu.type == PMU ? deviceInfo.aiCoreNum : deviceInfo.aivNum;
-    } else {
-        if (pmu.type == PMU) {
-            std::copy(info.aivProfilingEvents.begin(), info.aivProfilingEvents.end(), params.events.begin());
-        } else {
-            std::copy(info.aiCoreProfilingEvents.begin(), info.aiCoreProfilingEvents.end(), params.events.begin());
+        auto blockNum = pmu.type == PMU ? tasks[r]->blockNum : tasks[r]->mixBlockNum;
+        auto timeFreq = freqData != nullptr ? GetFreq(*freqData, freq, pmu.pmu.timeList[1]) : freq;
+        columns.taskCyc[r] = pmu.pmu.totalCycle;
+        columns.totalTime[r] = Calculator::CalculatorTotalTime(pmu.pmu.totalCycle, blockNum, coreNum, timeFreq);
+    }
+    if (invalidNum != 0) {
+        ERROR("PMU length is not equal with pmu events, please check, count is %", invalidNum);
+    }
+    result.totalTimes = columns.totalTime;
+    if (!Utils::Resize(result.metrics, rows)) {
+        return false;
+    }
+    std::vector<std::vector<double>> metricColumns;
+    if (!PreparePlan(context, events) || !plan_.Evaluate(columns, metricColumns)) {
+        return false;
+    }
+    // 结果按task转置
+    for (size_t r = 0; r < rows; ++r) {
+        auto& metrics = result.metrics[r];
+        if (!Utils::Resize(metrics, metricColumns.size())) {
+            return false;
+        }
+        for (size_t m = 0; m < metricColumns.size(); ++m) {
+            metrics[m] = metricColumns[m][r];
         }
-        params.coreNum = pmu.type == PMU ? deviceInfo.aivNum : deviceInfo.aiCoreNum;
     }
-    SetBlockNum(task, params, pmu);
-    return SetAllParamsAndCalculator(params, context, pmu);
+    return true;
 }
 }
 }
@@ -29,76 +29,51 @@
 #include "analysis/csrc/infrastructure/process/include/process.h"
 #include "analysis/csrc/domain/entities/hal/include/hal_pmu.h"
 #include "analysis/csrc/domain/entities/hal/include/device_task.h"
+#include "analysis/csrc/domain/services/association/calculator/metric/metric_plan.h"
 
 namespace Analysis {
 namespace Domain {
 using namespace Analysis::Infra;
-const uint64_t OFFSET = 1LL << 33;  // 2^33,pmu计算规则里带有BW的计算需要除以2^33
 const uint64_t FREQ_TO_Hz = 1000000;
 const uint8_t AIV_CORE_TYPE = 1;
 const uint8_t AIC_CORE_TYPE = 0;
-struct CalculationElements {
-    uint32_t blockNum{0};
-    uint32_t coreNum{0};
-    uint64_t taskCyc{0};
-    uint64_t bwFreq{0};  // 这个频率为从info.json中读出来的aic_frequency
-    uint64_t timeFreq{0};  // 这个频率需要考虑变频，如果有变频数据，则使用变频数据的频率，没有就是有aic_frequency
-    double totalTime{0.0};
-    std::vector<uint32_t> events;
-    std::vector<uint64_t> pmuList;
-    std::shared_ptr<std::vector<double>> floatBit;
-    std::shared_ptr<std::vector<double>> pipSize;
-    std::shared_ptr<std::vector<double>> scalar;
-    std::shared_ptr<std::vector<uint64_t>> cubeParams;
-    std::shared_ptr<std::vector<uint64_t>> vectorParams;
-};
-
-using DoublePtrType = std::vector<double>;
-using IntPtrType = std::vector<uint64_t>;
 
 class Calculator {
 public:
-    Calculator(std::vector<uint32_t> registers, std::function<double(CalculationElements &params, size_t index)> func)
-        : registers(std::move(registers)), calculatorFunc(std::move(func)) {}
-    static double CalculatorMetricByNothing(CalculationElements &allParams, size_t index);
-    static double CalculatorMetricByAdditions(CalculationElements &allParams, size_t index);
-    static double CalculatorMetricByDivision(CalculationElements &allParams, size_t index);
-    static double CalculatorMetricByAdditionsWithFreq(CalculationElements &allParams, size_t index);
-    static double CalculatorTimeByMultiplication(CalculationElements &allParams, size_t index);
-    static double CalculatorCubeFops(CalculationElements &allParams, size_t index);
-    static double CalculatorVectorFops(CalculationElements &allParams, size_t index);
+    Calculator(std::vector<uint32_t> registers, MetricKernel kernel)
+        : registers(std::move(registers)), kernel(kernel) {}
     static double CalculatorTotalTime(uint64_t totalCycle, uint64_t blockNum, uint64_t coreNum, uint64_t freq);
-    static double CalculateMetricWithoutCycByAdd(CalculationElements &allParams, size_t index);
-    static double CalculateMetricWithoutCycBySub(CalculationElements &allParams, size_t index);
 public:
     std::vector<uint32_t> registers;
-    std::function<double(CalculationElements &params, size_t index)> calculatorFunc;
+    MetricKernel kernel;
 };
 
+// 一批task的PMU计算结果
+struct PmuMetricResult {
+    std::vector<std::vector<double>> metrics;  // metrics[task][指标]
+    std::vector<double> totalTimes;
+};
 
 class MetricCalculator {
 public:
     template<typename T>
-    std::vector<double> CalculatePmu(HalPmuData pmuData, std::map<T, Calculator> calTable, CalculationElements& params)
+    bool CompilePlan(const std::map<T, Calculator> &calTable, const MetricCoefficients &coefs,
+                     const std::vector<uint32_t> &events)
     {
-        auto pmuTable = GetValueMappingOffset(params, pmuData);
-        params.totalTime = Calculator::CalculatorTotalTime(pmuData.pmu.totalCycle, params.blockNum, params.coreNum,
-                                                           params.timeFreq);
-        std::vector<double> res;
-        if (calTable.size() != params.floatBit->size()) {
+        plan_.Clear();
+        if (calTable.size() != coefs.floatBit.size()) {
             ERROR("pmu calculator params init error please check!");
-            return res;
+            return false;
         }
         size_t index = 0;
-        for (auto& cal : calTable) {
-            params.pmuList.clear();
-            for (auto reg : cal.second.registers) {
-                params.pmuList.push_back(pmuTable[reg]);
+        for (const auto &cal : calTable) {
+            if (!plan_.AddMetric(cal.second.kernel, cal.second.registers, events, coefs, index)) {
+                plan_.Clear();
+                return false;
             }
-            res.push_back(cal.second.calculatorFunc(params, index));
             ++index;
         }
-        return res;
+        return true;
     }
 
     template<typename K, typename V>
@@ -126,16 +101,21 @@ public:
         return flag;
     }
 
-    std::vector<double> CalculatePmuMetric(DataInventory& dataInventory, const DeviceContext& context,
-                                           CalculationElements& allParams, HalPmuData& pmuData, DeviceTask& task);
+    // 按列批量计算一组task的PMU指标，pmus与tasks一一对应，且须为同一类核上报(计数器事件相同)
+    bool CalculatePmuMetrics(DataInventory& dataInventory, const DeviceContext& context,
+                             const std::vector<HalPmuData*>& pmus, const std::vector<DeviceTask*>& tasks,
+                             PmuMetricResult& result);
     virtual ~MetricCalculator() = default;
     virtual std::vector<std::string> GetPmuHeader() = 0;
     virtual bool CheckMetricEventValid(std::vector<uint32_t> &event) = 0;
 private:
-    virtual std::vector<double> SetAllParamsAndCalculator(CalculationElements& allParams, const DeviceContext& context,
-                                                          HalPmuData& pmuData) = 0;
-    static std::unordered_map<uint32_t, uint64_t> GetValueMappingOffset(CalculationElements& params,
-                                                                        HalPmuData& pmuData);
+    // 根据芯片与计数器事件编译计算计划，同一个calculator的事件不变，计划只编译一次
+    virtual bool BuildPlan(const DeviceContext& context, const std::vector<uint32_t>& events) = 0;
+    bool PreparePlan(const DeviceContext& context, const std::vector<uint32_t>& events);
+private:
+    MetricPlan plan_;
+    bool planReady_ = false;
+    std::vector<uint32_t> planEvents_;
 };
 }
 }
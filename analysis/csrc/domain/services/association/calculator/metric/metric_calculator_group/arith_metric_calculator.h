@@ -37,30 +37,22 @@ public:
         return CheckMetricEventBySubType(arithMetricUtTable, event);
     }
 private:
-    std::vector<double> SetAllParamsAndCalculator(CalculationElements& allParams, const DeviceContext& context,
-                                                  HalPmuData& pmuData) override
+    bool BuildPlan(const DeviceContext& context, const std::vector<uint32_t>& events) override
     {
-        std::vector<double> res;
-        MAKE_SHARED_RETURN_VALUE(allParams.cubeParams, IntPtrType, res, cubeParams);
-        MAKE_SHARED_RETURN_VALUE(allParams.floatBit, DoublePtrType, res, floatBitVec);
-        if (std::count(chip_3.begin(), chip_3.end(), context.GetChipID()) > 0) {
-            MAKE_SHARED_RETURN_VALUE(allParams.vectorParams, IntPtrType, res, vectorParamsForChip3);
-        } else {
-            MAKE_SHARED_RETURN_VALUE(allParams.vectorParams, IntPtrType, res, vectorParams);
-        }
-        res = CalculatePmu(pmuData, arithMetricUtTable, allParams);
-        return res;
+        bool isChip3 = std::count(chip_3.begin(), chip_3.end(), context.GetChipID()) > 0;
+        const auto &vectorParamsVec = isChip3 ? vectorParamsForChip3 : vectorParams;
+        return CompilePlan(arithMetricUtTable, {floatBitVec, {}, {}, cubeParams, vectorParamsVec}, events);
     }
 private:
     const std::map<ArithMetricIndex, Calculator> arithMetricUtTable{
-        {ArithMetricIndex::MacFp16Ratio, {{0x49}, Calculator::CalculatorMetricByAdditions}},
-        {ArithMetricIndex::MacInt8Ratio, {{0x4a}, Calculator::CalculatorMetricByAdditions}},
-        {ArithMetricIndex::VecFp32Ratio, {{0x4b}, Calculator::CalculatorMetricByAdditions}},
-        {ArithMetricIndex::VecFp16Ratio, {{0x4c, 0x4d}, Calculator::CalculatorMetricByAdditions}},
-        {ArithMetricIndex::VecInt32Ratio, {{0x4e}, Calculator::CalculatorMetricByAdditions}},
-        {ArithMetricIndex::VecMiscRatio, {{0x4f}, Calculator::CalculatorMetricByAdditions}},
-        {ArithMetricIndex::CubeFops, {{0x49, 0x4a}, Calculator::CalculatorCubeFops}},
-        {ArithMetricIndex::VectorFops, {{0x4c, 0x4d, 0x4b, 0x4e, 0x4f}, Calculator::CalculatorVectorFops}}
+        {ArithMetricIndex::MacFp16Ratio, {{0x49}, MetricKernel::ADDITIONS}},
+        {ArithMetricIndex::MacInt8Ratio, {{0x4a}, MetricKernel::ADDITIONS}},
+        {ArithMetricIndex::VecFp32Ratio, {{0x4b}, MetricKernel::ADDITIONS}},
+        {ArithMetricIndex::VecFp16Ratio, {{0x4c, 0x4d}, MetricKernel::ADDITIONS}},
+        {ArithMetricIndex::VecInt32Ratio, {{0x4e}, MetricKernel::ADDITIONS}},
+        {ArithMetricIndex::VecMiscRatio, {{0x4f}, MetricKernel::ADDITIONS}},
+        {ArithMetricIndex::CubeFops, {{0x49, 0x4a}, MetricKernel::CUBE_FOPS}},
+        {ArithMetricIndex::VectorFops, {{0x4c, 0x4d, 0x4b, 0x4e, 0x4f}, MetricKernel::VECTOR_FOPS}}
     };
 
     const std::vector<ChipId> chip_3{CHIP_V3_1_0, CHIP_V3_2_0, CHIP_V3_3_0};
@@ -35,22 +35,18 @@ public:
         return CheckMetricEventBySubType(l2CacheTable, event);
     }
 private:
-    std::vector<double> SetAllParamsAndCalculator(CalculationElements& allParams, const DeviceContext& context,
-                                                  HalPmuData& pmuData) override
+    bool BuildPlan(const DeviceContext& context, const std::vector<uint32_t>& events) override
     {
-        std::vector<double> res;
-        MAKE_SHARED_RETURN_VALUE(allParams.floatBit, DoublePtrType, res, floatBitVec);
-        res = CalculatePmu(pmuData, l2CacheTable, allParams);
-        return res;
+        return CompilePlan(l2CacheTable, {floatBitVec, {}, {}, {}, {}}, events);
     }
 private:
     const std::map<L2CacheIndex, Calculator> l2CacheTable {
-        {L2CacheIndex::WriteCacheHit, {{0x500}, Calculator::CalculatorMetricByNothing}},
-        {L2CacheIndex::WriteCacheMissAllocate, {{0x502}, Calculator::CalculatorMetricByNothing}},
-        {L2CacheIndex::R0ReadCacheHit, {{0x504}, Calculator::CalculatorMetricByNothing}},
-        {L2CacheIndex::R0ReadCacheMissAllocate, {{0x506}, Calculator::CalculatorMetricByNothing}},
-        {L2CacheIndex::R1ReadCacheHit, {{0x508}, Calculator::CalculatorMetricByNothing}},
-        {L2CacheIndex::R1ReadCacheMissAllocate, {{0x50a}, Calculator::CalculatorMetricByNothing}},
+        {L2CacheIndex::WriteCacheHit, {{0x500}, MetricKernel::NOTHING}},
+        {L2CacheIndex::WriteCacheMissAllocate, {{0x502}, MetricKernel::NOTHING}},
+        {L2CacheIndex::R0ReadCacheHit, {{0x504}, MetricKernel::NOTHING}},
+        {L2CacheIndex::R0ReadCacheMissAllocate, {{0x506}, MetricKernel::NOTHING}},
+        {L2CacheIndex::R1ReadCacheHit, {{0x508}, MetricKernel::NOTHING}},
+        {L2CacheIndex::R1ReadCacheMissAllocate, {{0x50a}, MetricKernel::NOTHING}},
     };
     const std::vector<double> floatBitVec{1.0, 1.0, 1.0, 1.0, 1.0, 1.0};
 };
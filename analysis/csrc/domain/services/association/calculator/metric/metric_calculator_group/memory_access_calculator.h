@@ -35,23 +35,19 @@ public:
         return CheckMetricEventBySubType(memoryAccess, event);
     }
 private:
-    std::vector<double> SetAllParamsAndCalculator(CalculationElements& allParams, const DeviceContext& context,
-                                                  HalPmuData& pmuData) override
+    bool BuildPlan(const DeviceContext& context, const std::vector<uint32_t>& events) override
     {
-        std::vector<double> res;
-        MAKE_SHARED_RETURN_VALUE(allParams.floatBit, DoublePtrType, res, floatBitVec);
-        res = CalculatePmu(pmuData, memoryAccess, allParams);
-        return res;
+        return CompilePlan(memoryAccess, {floatBitVec, {}, {}, {}, {}}, events);
     }
 private:
     const std::map<MemoryAccessIndex, Calculator> memoryAccess{
-        {MemoryAccessIndex::ReadMainMemoryData, {{0x50d, 0x50e}, Calculator::CalculateMetricWithoutCycByAdd}},
-        {MemoryAccessIndex::WriteMainMemoryData, {{0x50c}, Calculator::CalculateMetricWithoutCycByAdd}},
-        {MemoryAccessIndex::GmToL1Data, {{0x32, 0x206}, Calculator::CalculateMetricWithoutCycBySub}},
-        {MemoryAccessIndex::L0CToL1Data, {{0x206}, Calculator::CalculateMetricWithoutCycByAdd}},
-        {MemoryAccessIndex::L0CToGmData, {{0x20c, 0x206}, Calculator::CalculateMetricWithoutCycBySub}},
-        {MemoryAccessIndex::GmToUbData, {{0x3e}, Calculator::CalculateMetricWithoutCycByAdd}},
-        {MemoryAccessIndex::UbToGmData, {{0x3d}, Calculator::CalculateMetricWithoutCycByAdd}},
+        {MemoryAccessIndex::ReadMainMemoryData, {{0x50d, 0x50e}, MetricKernel::WITHOUT_CYC_BY_ADD}},
+        {MemoryAccessIndex::WriteMainMemoryData, {{0x50c}, MetricKernel::WITHOUT_CYC_BY_ADD}},
+        {MemoryAccessIndex::GmToL1Data, {{0x32, 0x206}, MetricKernel::WITHOUT_CYC_BY_SUB}},
+        {MemoryAccessIndex::L0CToL1Data, {{0x206}, MetricKernel::WITHOUT_CYC_BY_ADD}},
+        {MemoryAccessIndex::L0CToGmData, {{0x20c, 0x206}, MetricKernel::WITHOUT_CYC_BY_SUB}},
+        {MemoryAccessIndex::GmToUbData, {{0x3e}, MetricKernel::WITHOUT_CYC_BY_ADD}},
+        {MemoryAccessIndex::UbToGmData, {{0x3d}, MetricKernel::WITHOUT_CYC_BY_ADD}},
     };
     const std::vector<double> floatBitVec{0.125, 0.125, 0.25, 0.125, 0.125, 0.125, 0.125};
 };
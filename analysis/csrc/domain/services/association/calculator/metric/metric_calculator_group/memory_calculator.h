@@ -35,26 +35,20 @@ public:
         return CheckMetricEventBySubType(memoryTable, event);
     }
 private:
-    std::vector<double> SetAllParamsAndCalculator(CalculationElements& allParams, const DeviceContext& context,
-                                                  HalPmuData& pmuData) override
+    bool BuildPlan(const DeviceContext& context, const std::vector<uint32_t>& events) override
     {
-        std::vector<double> res;
-        MAKE_SHARED_RETURN_VALUE(allParams.floatBit, DoublePtrType, res, floatBitVec);
-        MAKE_SHARED_RETURN_VALUE(allParams.pipSize, DoublePtrType, res, pipeSizeVec);
-        MAKE_SHARED_RETURN_VALUE(allParams.scalar, DoublePtrType, res, scalarVec);
-        res = CalculatePmu(pmuData, memoryTable, allParams);
-        return res;
+        return CompilePlan(memoryTable, {floatBitVec, pipeSizeVec, scalarVec, {}, {}}, events);
     }
 private:
     const std::map<MemoryIndex, Calculator> memoryTable{
-        {MemoryIndex::UBReadBw, {{0x15}, Calculator::CalculatorMetricByAdditionsWithFreq}},
-        {MemoryIndex::UBWriteBw, {{0x16}, Calculator::CalculatorMetricByAdditionsWithFreq}},
-        {MemoryIndex::L1ReadBw, {{0x31}, Calculator::CalculatorMetricByAdditionsWithFreq}},
-        {MemoryIndex::L1WriteBw, {{0x32}, Calculator::CalculatorMetricByAdditionsWithFreq}},
-        {MemoryIndex::MainMemReadBw, {{0x12}, Calculator::CalculatorMetricByAdditionsWithFreq}},
-        {MemoryIndex::MainMemWriteBw, {{0x13}, Calculator::CalculatorMetricByAdditionsWithFreq}},
-        {MemoryIndex::L2ReadBw, {{0xf}, Calculator::CalculatorMetricByAdditionsWithFreq}},
-        {MemoryIndex::L2WriteBw, {{0x10}, Calculator::CalculatorMetricByAdditionsWithFreq}},
+        {MemoryIndex::UBReadBw, {{0x15}, MetricKernel::ADDITIONS_WITH_FREQ}},
+        {MemoryIndex::UBWriteBw, {{0x16}, MetricKernel::ADDITIONS_WITH_FREQ}},
+        {MemoryIndex::L1ReadBw, {{0x31}, MetricKernel::ADDITIONS_WITH_FREQ}},
+        {MemoryIndex::L1WriteBw, {{0x32}, MetricKernel::ADDITIONS_WITH_FREQ}},
+        {MemoryIndex::MainMemReadBw, {{0x12}, MetricKernel::ADDITIONS_WITH_FREQ}},
+        {MemoryIndex::MainMemWriteBw, {{0x13}, MetricKernel::ADDITIONS_WITH_FREQ}},
+        {MemoryIndex::L2ReadBw, {{0xf}, MetricKernel::ADDITIONS_WITH_FREQ}},
+        {MemoryIndex::L2WriteBw, {{0x10}, MetricKernel::ADDITIONS_WITH_FREQ}},
     };
 
     const std::vector<double> floatBitVec{1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0};
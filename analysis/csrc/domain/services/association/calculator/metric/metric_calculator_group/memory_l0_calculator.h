@@ -35,26 +35,20 @@ public:
         return CheckMetricEventBySubType(memoryL0Table, event);
     }
 private:
-    std::vector<double> SetAllParamsAndCalculator(CalculationElements& allParams, const DeviceContext& context,
-                                                  HalPmuData& pmuData) override
+    bool BuildPlan(const DeviceContext& context, const std::vector<uint32_t>& events) override
     {
-        std::vector<double> res;
-        MAKE_SHARED_RETURN_VALUE(allParams.floatBit, DoublePtrType, res, floatBitVec);
-        MAKE_SHARED_RETURN_VALUE(allParams.pipSize, DoublePtrType, res, pipeSizeVec);
-        MAKE_SHARED_RETURN_VALUE(allParams.scalar, DoublePtrType, res, scalarVec);
-        res = CalculatePmu(pmuData, memoryL0Table, allParams);
-        return res;
+        return CompilePlan(memoryL0Table, {floatBitVec, pipeSizeVec, scalarVec, {}, {}}, events);
     }
 private:
     const std::map<MemoryL0Index, Calculator> memoryL0Table{
-        {MemoryL0Index::L0aReadBw, {{0x1b}, Calculator::CalculatorMetricByAdditionsWithFreq}},
-        {MemoryL0Index::L0aWriteBw, {{0x1c}, Calculator::CalculatorMetricByAdditionsWithFreq}},
-        {MemoryL0Index::L0bReadBw, {{0x21}, Calculator::CalculatorMetricByAdditionsWithFreq}},
-        {MemoryL0Index::L0bWriteBw, {{0x22}, Calculator::CalculatorMetricByAdditionsWithFreq}},
-        {MemoryL0Index::L0cReadBw, {{0x27}, Calculator::CalculatorMetricByAdditionsWithFreq}},
-        {MemoryL0Index::L0cWriteBw, {{0x29}, Calculator::CalculatorMetricByAdditionsWithFreq}},
-        {MemoryL0Index::L0cReadBwCube, {{0x28}, Calculator::CalculatorMetricByAdditionsWithFreq}},
-        {MemoryL0Index::L0cWriteBwCube, {{0x2a}, Calculator::CalculatorMetricByAdditionsWithFreq}},
+        {MemoryL0Index::L0aReadBw, {{0x1b}, MetricKernel::ADDITIONS_WITH_FREQ}},
+        {MemoryL0Index::L0aWriteBw, {{0x1c}, MetricKernel::ADDITIONS_WITH_FREQ}},
+        {MemoryL0Index::L0bReadBw, {{0x21}, MetricKernel::ADDITIONS_WITH_FREQ}},
+        {MemoryL0Index::L0bWriteBw, {{0x22}, MetricKernel::ADDITIONS_WITH_FREQ}},
+        {MemoryL0Index::L0cReadBw, {{0x27}, MetricKernel::ADDITIONS_WITH_FREQ}},
+        {MemoryL0Index::L0cWriteBw, {{0x29}, MetricKernel::ADDITIONS_WITH_FREQ}},
+        {MemoryL0Index::L0cReadBwCube, {{0x28}, MetricKernel::ADDITIONS_WITH_FREQ}},
+        {MemoryL0Index::L0cWriteBwCube, {{0x2a}, MetricKernel::ADDITIONS_WITH_FREQ}},
     };
 
     const std::vector<double> floatBitVec{1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0};
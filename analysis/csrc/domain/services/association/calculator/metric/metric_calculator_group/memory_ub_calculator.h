@@ -35,22 +35,16 @@ public:
         return CheckMetricEventBySubType(memoryUBTable, event);
     }
 private:
-    std::vector<double> SetAllParamsAndCalculator(CalculationElements& allParams, const DeviceContext& context,
-                                                  HalPmuData& pmuData) override
+    bool BuildPlan(const DeviceContext& context, const std::vector<uint32_t>& events) override
     {
-        std::vector<double> res;
-        MAKE_SHARED_RETURN_VALUE(allParams.floatBit, DoublePtrType, res, floatBitVec);
-        MAKE_SHARED_RETURN_VALUE(allParams.pipSize, DoublePtrType, res, pipeSizeVec);
-        MAKE_SHARED_RETURN_VALUE(allParams.scalar, DoublePtrType, res, scalarVec);
-        res = CalculatePmu(pmuData, memoryUBTable, allParams);
-        return res;
+        return CompilePlan(memoryUBTable, {floatBitVec, pipeSizeVec, scalarVec, {}, {}}, events);
     }
 private:
     const std::map<MemoryUBIndex, Calculator> memoryUBTable{
-        {MemoryUBIndex::UbReadBwVector, {{0x43}, Calculator::CalculatorMetricByAdditionsWithFreq}},
-        {MemoryUBIndex::UbWriteBwVector, {{0x44}, Calculator::CalculatorMetricByAdditionsWithFreq}},
-        {MemoryUBIndex::UbReadBwScalar, {{0x37}, Calculator::CalculatorMetricByAdditionsWithFreq}},
-        {MemoryUBIndex::UbWriteBwScalar, {{0x38}, Calculator::CalculatorMetricByAdditionsWithFreq}}
+        {MemoryUBIndex::UbReadBwVector, {{0x43}, MetricKernel::ADDITIONS_WITH_FREQ}},
+        {MemoryUBIndex::UbWriteBwVector, {{0x44}, MetricKernel::ADDITIONS_WITH_FREQ}},
+        {MemoryUBIndex::UbReadBwScalar, {{0x37}, MetricKernel::ADDITIONS_WITH_FREQ}},
+        {MemoryUBIndex::UbWriteBwScalar, {{0x38}, MetricKernel::ADDITIONS_WITH_FREQ}}
     };
 
     const std::vector<double> floatBitVec{1.0, 1.0, 1.0, 1.0};
@@ -35,29 +35,25 @@ public:
         return CheckMetricEventBySubType(pipeLineUtTable, event);
     }
 private:
-    std::vector<double> SetAllParamsAndCalculator(CalculationElements& allParams, const DeviceContext& context,
-                                                  HalPmuData& pmuData) override
+    bool BuildPlan(const DeviceContext& context, const std::vector<uint32_t>& events) override
     {
-        std::vector<double> res;
-        MAKE_SHARED_RETURN_VALUE(allParams.floatBit, DoublePtrType, res, floatBitVec);
-        res = CalculatePmu(pmuData, pipeLineUtTable, allParams);
-        return res;
+        return CompilePlan(pipeLineUtTable, {floatBitVec, {}, {}, {}, {}}, events);
     }
 private:
     const std::map<PipeLineUtIndex, Calculator> pipeLineUtTable{
-        {PipeLineUtIndex::VecRatio, {{0x8}, Calculator::CalculatorMetricByAdditions}},
-        {PipeLineUtIndex::VecTime, {{0x8}, Calculator::CalculatorTimeByMultiplication}},
-        {PipeLineUtIndex::MacRatio, {{0xa}, Calculator::CalculatorMetricByAdditions}},
-        {PipeLineUtIndex::MacTime, {{0xa}, Calculator::CalculatorTimeByMultiplication}},
-        {PipeLineUtIndex::ScalarRatio, {{0x9}, Calculator::CalculatorMetricByAdditions}},
-        {PipeLineUtIndex::ScalarTime, {{0x9}, Calculator::CalculatorTimeByMultiplication}},
-        {PipeLineUtIndex::Mte1Ratio, {{0xb}, Calculator::CalculatorMetricByAdditions}},
-        {PipeLineUtIndex::Mte1Time, {{0xb}, Calculator::CalculatorTimeByMultiplication}},
-        {PipeLineUtIndex::Mte2Ratio, {{0xc}, Calculator::CalculatorMetricByAdditions}},
-        {PipeLineUtIndex::Mte2Time, {{0xc}, Calculator::CalculatorTimeByMultiplication}},
-        {PipeLineUtIndex::Mte3Ratio, {{0xd}, Calculator::CalculatorMetricByAdditions}},
-        {PipeLineUtIndex::Mte3Time, {{0xd}, Calculator::CalculatorTimeByMultiplication}},
-        {PipeLineUtIndex::ICacheMissRate, {{0x55, 0x54}, Calculator::CalculatorMetricByDivision}}
+        {PipeLineUtIndex::VecRatio, {{0x8}, MetricKernel::ADDITIONS}},
+        {PipeLineUtIndex::VecTime, {{0x8}, MetricKernel::TIME_BY_MULTIPLICATION}},
+        {PipeLineUtIndex::MacRatio, {{0xa}, MetricKernel::ADDITIONS}},
+        {PipeLineUtIndex::MacTime, {{0xa}, MetricKernel::TIME_BY_MULTIPLICATION}},
+        {PipeLineUtIndex::ScalarRatio, {{0x9}, MetricKernel::ADDITIONS}},
+        {PipeLineUtIndex::ScalarTime, {{0x9}, MetricKernel::TIME_BY_MULTIPLICATION}},
+        {PipeLineUtIndex::Mte1Ratio, {{0xb}, MetricKernel::ADDITIONS}},
+        {PipeLineUtIndex::Mte1Time, {{0xb}, MetricKernel::TIME_BY_MULTIPLICATION}},
+        {PipeLineUtIndex::Mte2Ratio, {{0xc}, MetricKernel::ADDITIONS}},
+        {PipeLineUtIndex::Mte2Time, {{0xc}, MetricKernel::TIME_BY_MULTIPLICATION}},
+        {PipeLineUtIndex::Mte3Ratio, {{0xd}, MetricKernel::ADDITIONS}},
+        {PipeLineUtIndex::Mte3Time, {{0xd}, MetricKernel::TIME_BY_MULTIPLICATION}},
+        {PipeLineUtIndex::ICacheMissRate, {{0x55, 0x54}, MetricKernel::DIVISION}}
     };
 
     const std::vector<double> floatBitVec{1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0};
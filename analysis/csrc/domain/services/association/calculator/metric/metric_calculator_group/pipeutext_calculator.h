@@ -35,27 +35,23 @@ public:
         return CheckMetricEventBySubType(pipeUtExTable, event);
     }
 private:
-    std::vector<double> SetAllParamsAndCalculator(CalculationElements& allParams, const DeviceContext& context,
-                                                  HalPmuData& pmuData) override
+    bool BuildPlan(const DeviceContext& context, const std::vector<uint32_t>& events) override
     {
-        std::vector<double> res;
-        MAKE_SHARED_RETURN_VALUE(allParams.floatBit, DoublePtrType, res, floatBitVec);
-        res = CalculatePmu(pmuData, pipeUtExTable, allParams);
-        return res;
+        return CompilePlan(pipeUtExTable, {floatBitVec, {}, {}, {}, {}}, events);
     }
 private:
     const std::map<PipeUtilizationExctIndex, Calculator> pipeUtExTable{
-        {PipeUtilizationExctIndex::MacRatioExtra, {{0x416, 0x417}, Calculator::CalculatorMetricByAdditions}},
-        {PipeUtilizationExctIndex::ScalarRatio, {{0x9}, Calculator::CalculatorMetricByAdditions}},
-        {PipeUtilizationExctIndex::Mte1RatioExtra, {{0x302}, Calculator::CalculatorMetricByAdditions}},
-        {PipeUtilizationExctIndex::Mte2Ratio, {{0xc}, Calculator::CalculatorMetricByAdditions}},
-        {PipeUtilizationExctIndex::FixPipeRatio, {{0x303}, Calculator::CalculatorMetricByAdditions}},
-        {PipeUtilizationExctIndex::ICacheMissRate, {{0x55, 0x54}, Calculator::CalculatorMetricByDivision}},
-        {PipeUtilizationExctIndex::MacTime, {{0x416, 0x417}, Calculator::CalculatorTimeByMultiplication}},
-        {PipeUtilizationExctIndex::ScalarTime, {{0x9}, Calculator::CalculatorTimeByMultiplication}},
-        {PipeUtilizationExctIndex::Mte1Time, {{0x302}, Calculator::CalculatorTimeByMultiplication}},
-        {PipeUtilizationExctIndex::Mte2Time, {{0xc}, Calculator::CalculatorTimeByMultiplication}},
-        {PipeUtilizationExctIndex::FixPipeTime, {{0x303}, Calculator::CalculatorTimeByMultiplication}}
+        {PipeUtilizationExctIndex::MacRatioExtra, {{0x416, 0x417}, MetricKernel::ADDITIONS}},
+        {PipeUtilizationExctIndex::ScalarRatio, {{0x9}, MetricKernel::ADDITIONS}},
+        {PipeUtilizationExctIndex::Mte1RatioExtra, {{0x302}, MetricKernel::ADDITIONS}},
+        {PipeUtilizationExctIndex::Mte2Ratio, {{0xc}, MetricKernel::ADDITIONS}},
+        {PipeUtilizationExctIndex::FixPipeRatio, {{0x303}, MetricKernel::ADDITIONS}},
+        {PipeUtilizationExctIndex::ICacheMissRate, {{0x55, 0x54}, MetricKernel::DIVISION}},
+        {PipeUtilizationExctIndex::MacTime, {{0x416, 0x417}, MetricKernel::TIME_BY_MULTIPLICATION}},
+        {PipeUtilizationExctIndex::ScalarTime, {{0x9}, MetricKernel::TIME_BY_MULTIPLICATION}},
+        {PipeUtilizationExctIndex::Mte1Time, {{0x302}, MetricKernel::TIME_BY_MULTIPLICATION}},
+        {PipeUtilizationExctIndex::Mte2Time, {{0xc}, MetricKernel::TIME_BY_MULTIPLICATION}},
+        {PipeUtilizationExctIndex::FixPipeTime, {{0x303}, MetricKernel::TIME_BY_MULTIPLICATION}}
     };
 
     const std::vector<double> floatBitVec{1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0};
@@ -35,19 +35,15 @@ public:
         return CheckMetricEventBySubType(resourceConflictTable, event);
     }
 private:
-    std::vector<double> SetAllParamsAndCalculator(CalculationElements& allParams, const DeviceContext& context,
-                                                  HalPmuData& pmuData) override
+    bool BuildPlan(const DeviceContext& context, const std::vector<uint32_t>& events) override
     {
-        std::vector<double> res;
-        MAKE_SHARED_RETURN_VALUE(allParams.floatBit, DoublePtrType, res, floatBitVec);
-        res = CalculatePmu(pmuData, resourceConflictTable, allParams);
-        return res;
+        return CompilePlan(resourceConflictTable, {floatBitVec, {}, {}, {}, {}}, events);
     }
 private:
     const std::map<ResourceConflictIndex, Calculator> resourceConflictTable{
-        {ResourceConflictIndex::VecBankGroupCfltRatio, {{0x64}, Calculator::CalculatorMetricByAdditions}},
-        {ResourceConflictIndex::VecBankCfltRatio, {{0x65}, Calculator::CalculatorMetricByAdditions}},
-        {ResourceConflictIndex::VecRescCfltRatio, {{0x66}, Calculator::CalculatorMetricByAdditions}}
+        {ResourceConflictIndex::VecBankGroupCfltRatio, {{0x64}, MetricKernel::ADDITIONS}},
+        {ResourceConflictIndex::VecBankCfltRatio, {{0x65}, MetricKernel::ADDITIONS}},
+        {ResourceConflictIndex::VecRescCfltRatio, {{0x66}, MetricKernel::ADDITIONS}}
     };
 
     const std::vector<double> floatBitVec{1.0, 1.0, 1.0};
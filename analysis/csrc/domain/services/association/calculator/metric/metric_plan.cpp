@@ -0,0 +1,231 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#include "analysis/csrc/domain/services/association/calculator/metric/metric_plan.h"
+#include <algorithm>
+#include "analysis/csrc/infrastructure/dfx/log.h"
+#include "analysis/csrc/infrastructure/utils/utils.h"
+
+namespace Analysis {
+namespace Domain {
+namespace {
+using Column = const uint64_t *;
+const double BW_OFFSET = static_cast<double>(OFFSET);
+
+void ApplyMask(const double *mask, size_t rows, double *out)
+{
+    for (size_t r = 0; r < rows; ++r) {
+        out[r] *= mask[r];
+    }
+}
+
+void CalculateAdditions(const std::vector<Column> &cols, double floatBit, const double *cyc, size_t rows, double *out)
+{
+    for (auto col : cols) {
+        for (size_t r = 0; r < rows; ++r) {
+            out[r] += floatBit * col[r] / cyc[r];
+        }
+    }
+}
+
+// mask初始为taskCyc掩码，任一寄存器为0时置0；除数中的0替换为1，避免产生inf/nan
+void CalculateDivision(const std::vector<Column> &cols, double floatBit, const double *cyc, size_t rows,
+                       double *mask, double *out)
+{
+    for (size_t i = 0; i < cols.size(); ++i) {
+        auto col = cols[i];
+        for (size_t r = 0; r < rows; ++r) {
+            mask[r] *= col[r] != 0 ? 1.0 : 0.0;
+        }
+        if (i == 0) {
+            for (size_t r = 0; r < rows; ++r) {
+                out[r] += floatBit * col[r] / cyc[r];
+            }
+        } else if (!Utils::IsDoubleEqual(floatBit, 0.0)) {
+            for (size_t r = 0; r < rows; ++r) {
+                uint64_t value = col[r] != 0 ? col[r] : 1;
+                out[r] /= floatBit * value / cyc[r];
+            }
+        }
+    }
+}
+
+void CalculateBandwidth(const std::vector<Column> &cols, const MetricStep &step, const double *cycTime, size_t rows,
+                        double *out)
+{
+    for (auto col : cols) {
+        for (size_t r = 0; r < rows; ++r) {
+            out[r] += step.floatBit * col[r] * step.pipSize * step.scalar / cycTime[r] / BW_OFFSET;
+        }
+    }
+}
+
+void CalculateFops(const std::vector<Column> &cols, const MetricStep &step, size_t rows, double *out)
+{
+    for (size_t i = 0; i < cols.size(); ++i) {
+        auto col = cols[i];
+        auto weight = step.weights[i];
+        for (size_t r = 0; r < rows; ++r) {
+            out[r] += step.floatBit * col[r] * weight;
+        }
+    }
+}
+
+void CalculateWithoutCyc(const std::vector<Column> &cols, double floatBit, bool subtract, size_t rows, double *out)
+{
+    for (size_t i = 0; i < cols.size(); ++i) {
+        auto col = cols[i];
+        if (i == 0 || !subtract) {
+            for (size_t r = 0; r < rows; ++r) {
+                out[r] += floatBit * static_cast<double>(col[r]);
+            }
+        } else {
+            for (size_t r = 0; r < rows; ++r) {
+                out[r] -= floatBit * static_cast<double>(col[r]);
+            }
+        }
+    }
+}
+}
+
+bool MetricPlan::AddMetric(MetricKernel kernel, const std::vector<uint32_t> &registers,
+                           const std::vector<uint32_t> &events, const MetricCoefficients &coefs, size_t index)
+{
+    if (index >= coefs.floatBit.size() ||
+        (kernel == MetricKernel::ADDITIONS_WITH_FREQ && (index >= coefs.pipSize.size() ||
+                                                         index >= coefs.scalar.size()))) {
+        ERROR("pmu calculator params init error please check!");
+        return false;
+    }
+    MetricStep step;
+    step.kernel = kernel;
+    step.floatBit = coefs.floatBit[index];
+    if (kernel == MetricKernel::ADDITIONS_WITH_FREQ) {
+        step.pipSize = coefs.pipSize[index];
+        step.scalar = coefs.scalar[index];
+    }
+    for (auto reg : registers) {
+        // 事件重复时与逐task计算一致，取首次出现的计数器
+        auto it = std::find(events.begin(), events.end(), reg);
+        step.columns.push_back(it == events.end() ? -1 : static_cast<int64_t>(it - events.begin()));
+    }
+    if (kernel == MetricKernel::CUBE_FOPS || kernel == MetricKernel::VECTOR_FOPS) {
+        const auto &params = kernel == MetricKernel::CUBE_FOPS ? coefs.cubeParams : coefs.vectorParams;
+        if (registers.size() > params.size()) {
+            // 与逐task计算一致，系数不足时该指标结果为0
+            ERROR("The fops params count is small than the pmu count, can't calculator!");
+            step.columns.clear();
+        } else {
+            step.weights.assign(params.begin(), params.begin() + registers.size());
+        }
+    }
+    steps_.emplace_back(std::move(step));
+    return true;
+}
+
+bool MetricPlan::Evaluate(const PmuColumns &columns, std::vector<std::vector<double>> &results) const
+{
+    const size_t rows = columns.rows;
+    if (columns.taskCyc.size() != rows || columns.totalTime.size() != rows) {
+        ERROR("The pmu columns size is not equal with rows: %.", rows);
+        return false;
+    }
+    std::vector<double> cyc;
+    std::vector<double> cycMask;
+    std::vector<double> cycTime;
+    std::vector<double> mask;
+    std::vector<uint64_t> zeros;
+    if (!Utils::Resize(results, steps_.size()) || !Utils::Resize(cyc, rows) || !Utils::Resize(cycMask, rows) ||
+        !Utils::Resize(cycTime, rows) || !Utils::Resize(mask, rows) || !Utils::Resize(zeros, rows)) {
+        return false;
+    }
+    // 每行公共的因子只计算一次，taskCyc为0的行用1代替并由掩码置0
+    auto freq = static_cast<double>(columns.bwFreq);
+    for (size_t r = 0; r < rows; ++r) {
+        auto taskCyc = columns.taskCyc[r];
+        cycMask[r] = taskCyc != 0 ? 1.0 : 0.0;
+        cyc[r] = static_cast<double>(taskCyc != 0 ? taskCyc : 1);
+        cycTime[r] = cyc[r] / freq;
+    }
+    std::vector<Column> cols;
+    for (size_t m = 0; m < steps_.size(); ++m) {
+        const auto &step = steps_[m];
+        auto &res = results[m];
+        res.assign(rows, 0.0);
+        cols.clear();
+        for (auto index : step.columns) {
+            bool valid = index >= 0 && static_cast<size_t>(index) < columns.counters.size() &&
+                         columns.counters[index].size() == rows;
+            cols.push_back(valid ? columns.counters[index].data() : zeros.data());
+        }
+        auto out = res.data();
+        switch (step.kernel) {
+            case MetricKernel::NOTHING:
+                for (auto col : cols) {
+                    for (size_t r = 0; r < rows; ++r) {
+                        out[r] += col[r];
+                    }
+                }
+                break;
+            case MetricKernel::ADDITIONS:
+                CalculateAdditions(cols, step.floatBit, cyc.data(), rows, out);
+                ApplyMask(cycMask.data(), rows, out);
+                break;
+            case MetricKernel::TIME_BY_MULTIPLICATION:
+                CalculateAdditions(cols, step.floatBit, cyc.data(), rows, out);
+                ApplyMask(cycMask.data(), rows, out);
+                for (size_t r = 0; r < rows; ++r) {
+                    out[r] = columns.totalTime[r] * out[r];
+                }
+                break;
+            case MetricKernel::DIVISION:
+                mask = cycMask;
+                CalculateDivision(cols, step.floatBit, cyc.data(), rows, mask.data(), out);
+                ApplyMask(mask.data(), rows, out);
+                break;
+            case MetricKernel::ADDITIONS_WITH_FREQ:
+                if (columns.bwFreq != 0) {
+                    CalculateBandwidth(cols, step, cycTime.data(), rows, out);
+                    ApplyMask(cycMask.data(), rows, out);
+                }
+                break;
+            case MetricKernel::CUBE_FOPS:
+            case MetricKernel::VECTOR_FOPS:
+                CalculateFops(cols, step, rows, out);
+                ApplyMask(cycMask.data(), rows, out);
+                break;
+            case MetricKernel::WITHOUT_CYC_BY_ADD:
+            case MetricKernel::WITHOUT_CYC_BY_SUB:
+                CalculateWithoutCyc(cols, step.floatBit, step.kernel == MetricKernel::WITHOUT_CYC_BY_SUB, rows, out);
+                break;
+            default:
+                break;
+        }
+    }
+    return true;
+}
+
+size_t MetricPlan::MetricNum() const
+{
+    return steps_.size();
+}
+
+void MetricPlan::Clear()
+{
+    steps_.clear();
+}
+}
+}
@@ -0,0 +1,88 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#ifndef ANALYSIS_DOMAIN_SERVICE_ASSOCIATION_METRIC_PLAN_H
+#define ANALYSIS_DOMAIN_SERVICE_ASSOCIATION_METRIC_PLAN_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Analysis {
+namespace Domain {
+const uint64_t OFFSET = 1LL << 33;  // 2^33,pmu计算规则里带有BW的计算需要除以2^33
+
+// PMU指标的计算方式
+enum class MetricKernel : uint8_t {
+    NOTHING = 0,             // 寄存器值直接求和
+    ADDITIONS,               // sum(floatBit * pmu / taskCyc)
+    DIVISION,                // 首个寄存器的占比依次除以其余寄存器的占比，任一寄存器为0时结果为0
+    ADDITIONS_WITH_FREQ,     // 带宽: sum(floatBit * pmu * pipSize * scalar / (taskCyc / freq) / 2^33)
+    TIME_BY_MULTIPLICATION,  // totalTime * ADDITIONS
+    CUBE_FOPS,               // sum(floatBit * pmu * cubeParams[i])
+    VECTOR_FOPS,             // sum(floatBit * pmu * vectorParams[i])
+    WITHOUT_CYC_BY_ADD,      // sum(floatBit * pmu)
+    WITHOUT_CYC_BY_SUB       // floatBit * pmu0 - sum(floatBit * pmui)
+};
+
+// 指标计算用到的常量系数，按指标顺序存放
+struct MetricCoefficients {
+    std::vector<double> floatBit;
+    std::vector<double> pipSize;
+    std::vector<double> scalar;
+    std::vector<uint64_t> cubeParams;
+    std::vector<uint64_t> vectorParams;
+};
+
+// 按列(SoA)存放的一批task的PMU数据，counters[i][row]为第i个事件在第row个task上的计数
+struct PmuColumns {
+    size_t rows = 0;
+    std::vector<std::vector<uint64_t>> counters;
+    std::vector<uint64_t> taskCyc;
+    std::vector<double> totalTime;
+    uint64_t bwFreq = 0;  // 带宽计算使用的频率，不考虑变频
+};
+
+// 编译后的单个指标
+struct MetricStep {
+    MetricKernel kernel = MetricKernel::NOTHING;
+    std::vector<int64_t> columns;  // 寄存器对应的计数器列，-1表示事件中没有该寄存器，按0计算
+    std::vector<double> weights;   // fops类指标每个寄存器的系数
+    double floatBit = 0.0;
+    double pipSize = 0.0;
+    double scalar = 0.0;
+};
+
+// 某一芯片/metric模式下的指标计算计划
+// AddMetric时将寄存器解析为计数器列号、系数展开为常量，Evaluate时逐指标对整列数据计算，
+// 循环内没有按task的函数调用与查表，taskCyc为0、寄存器为0等判断通过掩码完成，便于编译器向量化
+// 计算顺序与逐task计算保持一致，结果逐位相同
+class MetricPlan {
+public:
+    // 追加一个指标，index为指标在系数表中的序号，events为计数器列对应的事件
+    bool AddMetric(MetricKernel kernel, const std::vector<uint32_t> &registers, const std::vector<uint32_t> &events,
+                   const MetricCoefficients &coefs, size_t index);
+    // 计算结果按指标存放，results[metric][row]
+    bool Evaluate(const PmuColumns &columns, std::vector<std::vector<double>> &results) const;
+    size_t MetricNum() const;
+    void Clear();
+
+private:
+    std::vector<MetricStep> steps_;
+};
+}
+}
+#endif // ANALYSIS_DOMAIN_SERVICE_ASSOCIATION_METRIC_PLAN_H
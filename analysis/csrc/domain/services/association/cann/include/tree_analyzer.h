@@ -27,6 +27,7 @@
 #include "analysis/csrc/domain/entities/tree/include/event.h"
 #include "analysis/csrc/domain/entities/tree/include/tree.h"
 #include "analysis/csrc/domain/services/parser/host/cann/type_data.h"
+#include "analysis/csrc/infrastructure/utils/flat_key_map.h"
 #include "analysis/csrc/infrastructure/utils/utils.h"
 
 namespace Analysis {
@@ -40,8 +41,8 @@ using HostTasks = std::vector<std::shared_ptr<HostTask>>;
 using Operator = Analysis::Domain::Operator;
 // HCCL大算子描述信息
 using HCCLBigOpDescs = std::vector<std::shared_ptr<Operator>>;
-// 计算类算子描述信息，Key为opName和timestamp拼接成的字符串
-using ComputeOpDescs = std::unordered_map<std::string, std::shared_ptr<Operator>>;
+// 计算类算子描述信息，Key为Node层event id，占位算子的Key为UINT64_MAX，迭代顺序为插入顺序
+using ComputeOpDescs = Utils::FlatKeyMap<std::shared_ptr<Operator>>;
 // HCCL小算子描述信息，Key为ctxId
 using HCCLSmallOpDescs = std::unordered_map<uint32_t, std::shared_ptr<Operator>>;
 
@@ -73,17 +74,17 @@ private:
     template<typename T, std::shared_ptr<T> Domain::OpDesc::*element>
     void UpdateComputeOpDescs(ComputeOpDescs &opDescs, const std::shared_ptr<T> &trace, uint64_t opName, uint64_t nodeEventId)
     {
-        std::string key = std::to_string(nodeEventId);
-        if (opDescs.find(key) == opDescs.end()) {
+        auto existOp = opDescs.Find(nodeEventId);
+        if (existOp == nullptr) {
             std::shared_ptr<Domain::OpDesc> desc;
             MAKE_SHARED0_RETURN_VOID(desc, Domain::OpDesc);
             (*desc).*element = trace;
             std::shared_ptr<Operator> op;
             MAKE_SHARED_RETURN_VOID(op, Operator, desc, opName,
                                     Domain::OpType::OPTYPE_COMPUTE);
-            opDescs.insert({key, op});
+            opDescs.Emplace(nodeEventId, op);
         } else {
-            auto desc = opDescs[key]->opDesc;
+            auto desc = (*existOp)->opDesc;
             (*desc).*element = trace;
         }
     }
@@ -129,8 +130,7 @@ private:
                                 uint8_t isMaster);
 
     // 根据输入参数生成HostTask，该函数纯粹负责HostTask生成
-    std::shared_ptr<HostTask> GenHostTask(const std::shared_ptr<MsprofCompactInfo> &track,
-                                          const std::shared_ptr<MsprofApi> &modelApi,
+    std::shared_ptr<HostTask> GenHostTask(const MsprofCompactInfo *track, const MsprofApi *modelApi,
                                           const std::shared_ptr<Operator> &opPtr,
                                           uint32_t ctxId, uint16_t taskType,
                                           int64_t connectionId);
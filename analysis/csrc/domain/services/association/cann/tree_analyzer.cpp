@@ -50,6 +50,8 @@ const uint16_t AICORE_TASK_TYPE = 0;
 const uint16_t AICPU_TASK_TYPE = 1;
 const uint64_t INVALID_MODEL_ID = 4294967295;
 const uint64_t PLACEHOLDER_OP_NAME = UINT64_MAX;
+// 占位算子在ComputeOpDescs中的Key，event id非负，不会与其冲突
+const uint64_t PLACEHOLDER_OP_KEY = UINT64_MAX;
 const std::string KERNEL_TASK_PREFIX = "KERNEL";
 const std::string LCCL_PREFIX = "Lccl";
 const std::string GE_STEP_INFO_API_TYPE = "step_info";
@@ -73,7 +75,7 @@ const std::set<std::string> KERNEL_COMPUTE_WHITE_LIST = {
     KERNEL_AI_CPU_TASK_TYPE,  Analysis::Common::KERNEL_SIMT_TASK_TYPE,
     KERNEL_MIX_AIC_TASK_TYPE, KERNEL_MIX_AIV_TASK_TYPE};
 
-uint64_t GetModelId(const std::shared_ptr<MsprofApi> &api, uint16_t deviceId, uint32_t streamId, uint16_t batchId,
+uint64_t GetModelId(const MsprofApi *api, uint16_t deviceId, uint32_t streamId, uint16_t batchId,
                     uint64_t timestamp)
 {
     return api != nullptr ? api->itemId
@@ -180,9 +182,9 @@ void TreeAnalyzer::AnalyzeRuntimeNode(const std::shared_ptr<TreeNode> &node)
         {
             tasks_.emplace_back(otherTask);
 
-            auto taskType = TypeData::GetInstance().Get(MSPROF_REPORT_RUNTIME_LEVEL, otherTask->taskType);
+            auto taskType = TypeData::GetInstance().GetRef(MSPROF_REPORT_RUNTIME_LEVEL, otherTask->taskType);
             // 对于纯rts_track数据,只有算子类型在白名单中才生成computeTask数据
-            if (KERNEL_COMPUTE_WHITE_LIST.find(taskType) != KERNEL_COMPUTE_WHITE_LIST.end())
+            if (KERNEL_COMPUTE_WHITE_LIST.find(taskType.ToString()) != KERNEL_COMPUTE_WHITE_LIST.end())
             {
                 computeTasks_.emplace_back(otherTask);
             }
@@ -229,12 +231,12 @@ bool TreeAnalyzer::IsComputeTask(const std::shared_ptr<TreeNode> &node)
 
     // 临时规避 lccl算子过滤,后续依据lccl 特征独立判定
     auto node_api = path_[MSPROF_REPORT_NODE_LEVEL]->event->apiPtr;
-    if (!node_api || TypeData::GetInstance().Get(node_api->level, node_api->type) == GE_STEP_INFO_API_TYPE)
+    if (!node_api || TypeData::GetInstance().GetRef(node_api->level, node_api->type) == GE_STEP_INFO_API_TYPE)
     {
         return false;
     }
-    std::string itemId = HashData::GetInstance().Get(node_api->itemId);
-    if (itemId.substr(0, LCCL_PREFIX.size()) == LCCL_PREFIX)
+    auto itemId = HashData::GetInstance().GetRef(node_api->itemId);
+    if (itemId.StartsWith(LCCL_PREFIX))
     {
         return false;
     }
@@ -247,8 +249,8 @@ bool TreeAnalyzer::IsComputeTask(const std::shared_ptr<TreeNode> &node)
         }
 
         auto trace = record->compactPtr;
-        auto taskType = TypeData::GetInstance().Get(node->event->info.level, trace->data.runtimeTrack.taskType);
-        if (taskType.substr(0, KERNEL_TASK_PREFIX.size()) == KERNEL_TASK_PREFIX ||
+        auto taskType = TypeData::GetInstance().GetRef(node->event->info.level, trace->data.runtimeTrack.taskType);
+        if (taskType.StartsWith(KERNEL_TASK_PREFIX) ||
             taskType == KERNEL_STARS_COMMON_TASK_TYPE)
         {
             // 传统core task和dsa task
@@ -296,13 +298,13 @@ void TreeAnalyzer::UpdateHcclBigOpDescs(const std::shared_ptr<TreeNode> &node)
     std::shared_ptr<MsprofCompactInfo> nodeDesc = nullptr;
     if (!nodeRecords.empty() && nodeRecords.front() != nullptr)
     {
-        nodeDesc = nodeRecords.front()->compactPtr;
+        nodeDesc = nodeRecords.front()->Share(nodeRecords.front()->compactPtr);
     }
     auto hcclOpRecords = GetNodeRecordsByType(nodeNode, EventType::EVENT_TYPE_HCCL_OP_INFO);
     std::shared_ptr<MsprofCompactInfo> hcclOpDesc = nullptr;
     if (!hcclOpRecords.empty() && hcclOpRecords.front() != nullptr)
     {
-        hcclOpDesc = hcclOpRecords.front()->compactPtr;
+        hcclOpDesc = hcclOpRecords.front()->Share(hcclOpRecords.front()->compactPtr);
     }
     else
     {
@@ -340,8 +342,7 @@ std::vector<std::shared_ptr<Event>> TreeAnalyzer::GetNodeRecordsByType(const std
     return records;
 }
 
-std::shared_ptr<HostTask> TreeAnalyzer::GenHostTask(const std::shared_ptr<MsprofCompactInfo> &track,
-                                                    const std::shared_ptr<MsprofApi> &modelApi,
+std::shared_ptr<HostTask> TreeAnalyzer::GenHostTask(const MsprofCompactInfo *track, const MsprofApi *modelApi,
                                                     const std::shared_ptr<Operator> &opPtr, uint32_t ctxId,
                                                     uint16_t taskType, int64_t connectionId)
 {
@@ -370,7 +371,7 @@ HostTasks TreeAnalyzer::GenComputeHostTasks(ComputeOpDescs &ops, const std::shar
     auto modelNode = path_.find(MSPROF_REPORT_MODEL_LEVEL) != path_.end() ? path_[MSPROF_REPORT_MODEL_LEVEL] : nullptr;
     auto modelApi = modelNode == nullptr ? nullptr : modelNode->event->apiPtr;
     // L0场景没有上报Node层补充信息且该任务非ctx类任务
-    if (ops.empty())
+    if (ops.Empty())
     {
         // 补充一条有效的Op信息
         auto nodeNode = path_.find(MSPROF_REPORT_NODE_LEVEL) != path_.end() ? path_[MSPROF_REPORT_NODE_LEVEL] : nullptr;
@@ -383,8 +384,8 @@ HostTasks TreeAnalyzer::GenComputeHostTasks(ComputeOpDescs &ops, const std::shar
         MAKE_SHARED_RETURN_VALUE(desc, OpDesc, {});
         desc->runtimeTrackDesc = track;
         MAKE_SHARED_RETURN_VALUE(op, Operator, {}, desc, nodeNode->event->apiPtr->itemId, OpType::OPTYPE_COMPUTE);
-        auto task =
-            GenHostTask(track, modelApi, op, DEFAULT_CONTEXT_ID, track->data.runtimeTrack.taskType, connection_id);
+        auto task = GenHostTask(track.get(), modelApi, op, DEFAULT_CONTEXT_ID, track->data.runtimeTrack.taskType,
+                                connection_id);
         return (task != nullptr) ? HostTasks{task} : HostTasks{};
     }
 
@@ -413,8 +414,8 @@ HostTasks TreeAnalyzer::GenComputeHostTasks(ComputeOpDescs &ops, const std::shar
         desc->runtimeTrackDesc = track;
         for (const auto &ctxId : ctxIds)
         {
-            auto task =
-                GenHostTask(track, modelApi, pair.second, ctxId, track->data.runtimeTrack.taskType, connection_id);
+            auto task = GenHostTask(track.get(), modelApi, pair.second, ctxId, track->data.runtimeTrack.taskType,
+                                    connection_id);
             if (task)
             {
                 results.emplace_back(task);
@@ -426,7 +427,8 @@ HostTasks TreeAnalyzer::GenComputeHostTasks(ComputeOpDescs &ops, const std::shar
 
 void TreeAnalyzer::UpdateComputeDescForFftsSituation(ComputeOpDescs &descs, const std::shared_ptr<Event> &track)
 {
-    std::string specialKey;
+    uint64_t specialKey = 0;
+    bool hasSpecialKey = false;
     // notice： 特殊场景，刷新op描述
     for (auto &pair : descs)
     {
@@ -443,28 +445,28 @@ void TreeAnalyzer::UpdateComputeDescForFftsSituation(ComputeOpDescs &descs, cons
         if (pair.second->opDesc->nodeDesc->data.nodeBasicInfo.taskType == FFTS_PLUS_TASK_TYPE)
         {
             specialKey = pair.first;
+            hasSpecialKey = true;
             // 该数据在一个task中只有1条
             break;
         }
     }
-    if (!specialKey.empty())
+    if (hasSpecialKey)
     {
-        descs.erase(specialKey);
+        descs.Erase(specialKey);
     }
 }
 
 void TreeAnalyzer::UpdateComputeDescForHcclSituation(ComputeOpDescs &descs, const std::shared_ptr<Event> &track,
                                                      uint64_t item_id)
 {
-    if (descs.empty())
+    if (descs.Empty())
     {
         // 补充一个临时的算子描述，只发生在L0场景
         std::shared_ptr<OpDesc> desc;
         std::shared_ptr<Operator> op;
         MAKE_SHARED0_NO_OPERATION(desc, OpDesc);
         MAKE_SHARED0_NO_OPERATION(op, Operator, desc, item_id, OpType::OPTYPE_COMPUTE_HCCL);
-        auto name = Utils::Join("_", std::to_string(PLACEHOLDER_OP_NAME), std::to_string(UINT64_MAX));
-        descs[name] = op;
+        descs[PLACEHOLDER_OP_KEY] = op;
     }
     for (auto &pair : descs)
     {
@@ -481,7 +483,7 @@ void TreeAnalyzer::UpdateComputeDescForHcclSituation(ComputeOpDescs &descs, cons
         // 特殊场景2：hccl类任务将opName刷成item id
         pair.second->opDesc->nodeDesc->data.nodeBasicInfo.opName = item_id;
         auto taskType = track->compactPtr->data.runtimeTrack.taskType;
-        auto taskTypeStr = TypeData::GetInstance().Get(MSPROF_REPORT_RUNTIME_LEVEL, taskType);
+        auto taskTypeStr = TypeData::GetInstance().GetRef(MSPROF_REPORT_RUNTIME_LEVEL, taskType);
         if (taskTypeStr == KERNEL_AI_CPU_TASK_TYPE)
         {
             // 特殊场景3：HCCL AICPU任务，该任务需要将任务类型刷为HCCL_AICPU
@@ -527,9 +529,9 @@ HostTasks TreeAnalyzer::GetComputeTaskDescs(const std::shared_ptr<TreeNode> &nod
         return {};
     }
 
-    std::string type =
-        TypeData::GetInstance().Get(MSPROF_REPORT_RUNTIME_LEVEL, tracks.back()->compactPtr->data.runtimeTrack.taskType);
-    bool useCtxId = CONTEXT_ID_WHITE_LIST.find(type) != CONTEXT_ID_WHITE_LIST.end();
+    auto type = TypeData::GetInstance().GetRef(MSPROF_REPORT_RUNTIME_LEVEL,
+                                               tracks.back()->compactPtr->data.runtimeTrack.taskType);
+    bool useCtxId = CONTEXT_ID_WHITE_LIST.find(type.ToString()) != CONTEXT_ID_WHITE_LIST.end();
     ComputeOpDescs ops = GetComputeOpDescs(nodeNode, useCtxId);
     // 特殊场景，刷新算子描述
     UpdateComputeDescForFftsSituation(ops, tracks.back());
@@ -544,7 +546,8 @@ HostTasks TreeAnalyzer::GetComputeTaskDescs(const std::shared_ptr<TreeNode> &nod
     {
         UpdateComputeDescForHelperSituation(ops);
     }
-    auto track = tracks.back()->compactPtr;
+    // 算子描述会持有task track，共享记录块而非拷贝
+    auto track = tracks.back()->Share(tracks.back()->compactPtr);
 
     auto results = GenComputeHostTasks(ops, track, nodeNode->event->id);
     return results;
@@ -601,8 +604,8 @@ std::shared_ptr<HostTask> TreeAnalyzer::GetOtherTaskDesc(const std::shared_ptr<T
         ERROR("TreeNode task track records is empty, threadId = %", threadId_);
         return nullptr;
     }
-    auto track = tracks.back()->compactPtr;
-    auto taskType = TypeData::GetInstance().Get(MSPROF_REPORT_RUNTIME_LEVEL, track->data.runtimeTrack.taskType);
+    auto track = tracks.back()->Share(tracks.back()->compactPtr);
+    auto taskType = TypeData::GetInstance().GetRef(MSPROF_REPORT_RUNTIME_LEVEL, track->data.runtimeTrack.taskType);
     uint32_t contextId = (taskType == KERNEL_MIX_AIC_TASK_TYPE || taskType == KERNEL_MIX_AIV_TASK_TYPE) && !IsChipV6()
                              ? 0
                              : DEFAULT_CONTEXT_ID;
@@ -612,7 +615,8 @@ std::shared_ptr<HostTask> TreeAnalyzer::GetOtherTaskDesc(const std::shared_ptr<T
     MAKE_SHARED_RETURN_VALUE(desc, OpDesc, {});
     desc->runtimeTrackDesc = track;
     MAKE_SHARED_RETURN_VALUE(op, Operator, {}, desc, track->data.runtimeTrack.kernelName, OpType::OPTYPE_RESERVED);
-    auto task = GenHostTask(track, modelApi, op, contextId, track->data.runtimeTrack.taskType, node->parent->event->id);
+    auto task =
+        GenHostTask(track.get(), modelApi, op, contextId, track->data.runtimeTrack.taskType, node->parent->event->id);
     return task;
 }
 
@@ -675,8 +679,7 @@ ComputeOpDescs TreeAnalyzer::GetComputeOpDescs(const std::shared_ptr<TreeNode> &
         std::shared_ptr<Operator> op;
         // 层次太深，参数传递过于复杂，逃生通道，用opType区分是否为占位的任务（标记ffts+任务群对应的大任务）
         MAKE_SHARED_RETURN_VALUE(op, Operator, {}, desc, PLACEHOLDER_OP_NAME, OpType::OPTYPE_INVALID);
-        auto name = Utils::Join("_", std::to_string(PLACEHOLDER_OP_NAME), std::to_string(UINT64_MAX));
-        opDescs.insert({name, op});
+        opDescs.Emplace(PLACEHOLDER_OP_KEY, op);
     }
     return opDescs;
 }
@@ -687,7 +690,7 @@ HCCLSmallOpDescs TreeAnalyzer::GetHcclSmallOpDescs(const std::shared_ptr<TreeNod
     auto ctxIdRecords = GetNodeRecordsByType(hcclNode, EventType::EVENT_TYPE_CONTEXT_ID);
     auto hcclInfoRecords = GetNodeRecordsByType(hcclNode, EventType::EVENT_TYPE_HCCL_INFO);
     auto hcclApi = hcclNode->event->apiPtr;
-    auto isMaster = TypeData::GetInstance().Get(hcclApi->level, hcclApi->type) == "master" ? 1 : 0;
+    auto isMaster = TypeData::GetInstance().GetRef(hcclApi->level, hcclApi->type) == "master" ? 1 : 0;
 
     if (!ctxIdRecords.empty())
     {
@@ -756,7 +759,7 @@ bool TreeAnalyzer::UpdateHcclSmallOpDescs(HCCLSmallOpDescs &descs,
     // HcclInfo更新
     for (const auto &record : hcclInfoRecords)
     {
-        auto trace = record->additionPtr;
+        auto trace = record->Share(record->additionPtr);
         auto hcclTrace = ReinterpretConvert<MsprofHcclInfo *>(trace->data);
         auto key = hcclTrace->ctxID;
         if (descs.find(key) != descs.end())
@@ -777,7 +780,7 @@ bool TreeAnalyzer::UpdateHcclSmallOpDescs(HCCLSmallOpDescs &descs,
 {
     for (const auto &record : hcclInfoRecords)
     {
-        auto trace = record->additionPtr;
+        auto trace = record->Share(record->additionPtr);
         auto hcclTrace = ReinterpretConvert<MsprofHcclInfo *>(trace->data);
         auto key = hcclTrace->ctxID;
 
@@ -28,22 +28,31 @@ namespace Analysis {
 namespace Domain {
 using namespace Analysis::Infra;
 class PmuAssociation : public Process {
+private:
+    // 待计算的context pmu及其匹配的task，一一对应
+    struct ContextPmuBatch {
+        std::vector<HalPmuData*> pmus;
+        std::vector<DeviceTask*> tasks;
+    };
 private:
     void SplitPmu(std::vector<HalPmuData>& pmuData);
     void MergeContextPmuToDeviceTask(std::vector<HalPmuData*>& pmuVec, std::vector<DeviceTask>& deviceVec,
-                                     DataInventory& dataInventory, const DeviceContext& context, uint64_t& filterEnd);
+                                     uint64_t& filterEnd);
     size_t MergeBlockPmuToDeviceTask(std::vector<HalPmuData*>& pmuData, DeviceTask& deviceTask,
                                      DataInventory& dataInventory, const DeviceContext& context, uint64_t& filterEnd);
     void AssociationByPmuType(std::map<TaskId, std::vector<DeviceTask>>& deviceTask, DataInventory& dataInventory,
                               const DeviceContext& context);
-    void CalculateContextPmu(HalPmuData &pmu, DeviceTask &task, DataInventory &dataInventory,
-                              const DeviceContext &context);
+    void CollectContextPmu(HalPmuData &pmuData, DeviceTask &task);
+    void CalculateContextPmu(ContextPmuBatch &batch, MetricCalculator &calculator, DataInventory &dataInventory,
+                             const DeviceContext &context);
     uint32_t ProcessEntry(Infra::DataInventory& dataInventory, const Infra::Context& context) override;
 private:
     std::map<TaskId, std::vector<HalPmuData*>> contextPmuTask_;
     std::map<TaskId, std::vector<HalPmuData*>> blockPmuTask_;
     std::unique_ptr<MetricCalculator> aicCalculator_;
     std::unique_ptr<MetricCalculator> aivCalculator_;
+    ContextPmuBatch aicContextBatch_;
+    ContextPmuBatch aivContextBatch_;
 };
 }
 }
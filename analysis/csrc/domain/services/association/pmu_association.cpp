@@ -54,7 +54,6 @@ void BlockPmuResultAccumulate(std::vector<uint64_t> &dstVec, std::vector<uint64_
 }
 
 void PmuAssociation::MergeContextPmuToDeviceTask(std::vector<HalPmuData*>& pmuVec, std::vector<DeviceTask>& deviceVec,
-                                                 DataInventory& dataInventory, const DeviceContext& context,
                                                  uint64_t& filterEnd)
 {
     size_t pmuIndex = 0;
@@ -73,46 +72,58 @@ void PmuAssociation::MergeContextPmuToDeviceTask(std::vector<HalPmuData*>& pmuVe
             taskIndex++;
             continue;
         }
-        CalculateContextPmu(*pmuVec[pmuIndex], deviceVec[taskIndex], dataInventory, context);
+        CollectContextPmu(*pmuVec[pmuIndex], deviceVec[taskIndex]);
         filterEnd = std::min(filterEnd, deviceVec[taskIndex].taskEnd);
         taskIndex++;
         pmuIndex++;
     }
 }
 
-void PmuAssociation::CalculateContextPmu(HalPmuData &pmuData, DeviceTask &task, DataInventory &dataInventory,
-                                         const DeviceContext &context)
+void PmuAssociation::CollectContextPmu(HalPmuData &pmuData, DeviceTask &task)
 {
     task.acceleratorType = pmuData.pmu.acceleratorType;
-    CalculationElements params;
-    if (task.acceleratorType == MIX_AIC || task.acceleratorType == MIX_AIV) {
-        PmuInfoMixAccelerator pmuInfoMix;
-        if (pmuData.pmu.acceleratorType == MIX_AIC) {
-            pmuInfoMix.aicTotalCycles = pmuData.pmu.totalCycle;
-            auto res = aicCalculator_->CalculatePmuMetric(dataInventory, context, params, pmuData, task);
-            pmuInfoMix.aicPmuResult.swap(res);
-            pmuInfoMix.aiCoreTime = params.totalTime;
-        } else {
-            pmuInfoMix.aivTotalCycles = pmuData.pmu.totalCycle;
-            auto res = aivCalculator_->CalculatePmuMetric(dataInventory, context, params, pmuData, task);
-            pmuInfoMix.aivPmuResult.swap(res);
-            pmuInfoMix.aivTime = params.totalTime;
-        }
-        pmuInfoMix.mainTimestamp = pmuData.pmu.timeList[1];
-        task.pmuInfo = MAKE_UNIQUE_PTR<PmuInfoMixAccelerator>(pmuInfoMix);
-    } else {
-        PmuInfoSingleAccelerator pmuInfoNormal;
-        pmuInfoNormal.totalCycles = pmuData.pmu.totalCycle;
+    auto &batch = (pmuData.pmu.acceleratorType == MIX_AIC || pmuData.pmu.acceleratorType == AIC) ? aicContextBatch_
+                                                                                                  : aivContextBatch_;
+    batch.pmus.push_back(&pmuData);
+    batch.tasks.push_back(&task);
+}
+
+void PmuAssociation::CalculateContextPmu(ContextPmuBatch &batch, MetricCalculator &calculator,
+                                         DataInventory &dataInventory, const DeviceContext &context)
+{
+    PmuMetricResult result;
+    calculator.CalculatePmuMetrics(dataInventory, context, batch.pmus, batch.tasks, result);
+    for (size_t i = 0; i < batch.pmus.size(); ++i) {
+        auto &pmuData = *batch.pmus[i];
+        auto &task = *batch.tasks[i];
         std::vector<double> res;
-        if (pmuData.pmu.acceleratorType == AIC) {
-            res = aicCalculator_->CalculatePmuMetric(dataInventory, context, params, pmuData, task);
+        if (i < result.metrics.size()) {
+            res.swap(result.metrics[i]);
+        }
+        double totalTime = i < result.totalTimes.size() ? result.totalTimes[i] : 0.0;
+        if (task.acceleratorType == MIX_AIC || task.acceleratorType == MIX_AIV) {
+            PmuInfoMixAccelerator pmuInfoMix;
+            if (pmuData.pmu.acceleratorType == MIX_AIC) {
+                pmuInfoMix.aicTotalCycles = pmuData.pmu.totalCycle;
+                pmuInfoMix.aicPmuResult.swap(res);
+                pmuInfoMix.aiCoreTime = totalTime;
+            } else {
+                pmuInfoMix.aivTotalCycles = pmuData.pmu.totalCycle;
+                pmuInfoMix.aivPmuResult.swap(res);
+                pmuInfoMix.aivTime = totalTime;
+            }
+            pmuInfoMix.mainTimestamp = pmuData.pmu.timeList[1];
+            task.pmuInfo = MAKE_UNIQUE_PTR<PmuInfoMixAccelerator>(pmuInfoMix);
         } else {
-            res = aivCalculator_->CalculatePmuMetric(dataInventory, context, params, pmuData, task);
+            PmuInfoSingleAccelerator pmuInfoNormal;
+            pmuInfoNormal.totalCycles = pmuData.pmu.totalCycle;
+            pmuInfoNormal.totalTime = totalTime;
+            pmuInfoNormal.pmuResult.swap(res);
+            task.pmuInfo = MAKE_UNIQUE_PTR<PmuInfoSingleAccelerator>(pmuInfoNormal);
         }
-        pmuInfoNormal.totalTime = params.totalTime;
-        pmuInfoNormal.pmuResult.swap(res);
-        task.pmuInfo = MAKE_UNIQUE_PTR<PmuInfoSingleAccelerator>(pmuInfoNormal);
     }
+    batch.pmus.clear();
+    batch.tasks.clear();
 }
 
 size_t PmuAssociation::MergeBlockPmuToDeviceTask(std::vector<HalPmuData*>& pmuData, DeviceTask& deviceTask,
@@ -129,7 +140,6 @@ size_t PmuAssociation::MergeBlockPmuToDeviceTask(std::vector<HalPmuData*>& pmuDa
     if (deviceTask.acceleratorType == MIX_AIC) {
         core_type = AIV_CORE_TYPE;
     }
-    CalculationElements params;
     HalPmuData tempPmuData;
     tempPmuData.type = BLOCK_PMU;
     auto res = dynamic_cast<PmuInfoMixAccelerator *>(deviceTask.pmuInfo.get());
@@ -154,15 +164,21 @@ size_t PmuAssociation::MergeBlockPmuToDeviceTask(std::vector<HalPmuData*>& pmuDa
             ++it;
         }
     }
+    PmuMetricResult pmuRes;
+    auto &calculator = core_type ? *aivCalculator_ : *aicCalculator_;
+    calculator.CalculatePmuMetrics(dataInventory, context, {&tempPmuData}, {&deviceTask}, pmuRes);
+    std::vector<double> metrics;
+    if (!pmuRes.metrics.empty()) {
+        metrics.swap(pmuRes.metrics.front());
+    }
+    double totalTime = pmuRes.totalTimes.empty() ? 0.0 : pmuRes.totalTimes.front();
     if (core_type) {
-        auto pmuRes = aivCalculator_->CalculatePmuMetric(dataInventory, context, params, tempPmuData, deviceTask);
-        res->aivTime = params.totalTime;
-        res->aivPmuResult.swap(pmuRes);
+        res->aivTime = totalTime;
+        res->aivPmuResult.swap(metrics);
         res->aivTotalCycles = tempPmuData.pmu.totalCycle;
     } else {
-        auto pmuRes = aicCalculator_->CalculatePmuMetric(dataInventory, context, params, tempPmuData, deviceTask);
-        res->aiCoreTime = params.totalTime;
-        res->aicPmuResult.swap(pmuRes);
+        res->aiCoreTime = totalTime;
+        res->aicPmuResult.swap(metrics);
         res->aicTotalCycles = tempPmuData.pmu.totalCycle;
     }
     return pmuData.size();
@@ -185,8 +201,11 @@ void PmuAssociation::AssociationByPmuType(std::map<TaskId, std::vector<DeviceTas
         std::sort(pmu.second.begin(), pmu.second.end(), [](HalPmuData* ld, HalPmuData* rd) {
             return ld->hd.timestamp < rd->hd.timestamp;
         });
-        MergeContextPmuToDeviceTask(pmu.second, it->second, dataInventory, context, filterEnd);
+        MergeContextPmuToDeviceTask(pmu.second, it->second, filterEnd);
     }
+    // 匹配完成后按核类型整批计算，计算完成前不能调整deviceTask中task的位置
+    CalculateContextPmu(aicContextBatch_, *aicCalculator_, dataInventory, context);
+    CalculateContextPmu(aivContextBatch_, *aivCalculator_, dataInventory, context);
     INFO("Context PMU has been calculated!");
     for (auto& pmu : blockPmuTask_) {
         auto it = deviceTask.find(pmu.first);
@@ -25,7 +25,11 @@
 #include <sys/stat.h>
 #include "nlohmann/json.hpp"
 #include "analysis/csrc/infrastructure/utils/utils.h"
+#include "analysis/csrc/infrastructure/utils/admission_controller.h"
 #include "analysis/csrc/infrastructure/utils/file.h"
+#include "analysis/csrc/infrastructure/utils/ingest_cursor.h"
+#include "analysis/csrc/infrastructure/utils/numa_topology.h"
+#include "analysis/csrc/infrastructure/utils/stage_manifest.h"
 #include "analysis/csrc/infrastructure/utils/time_logger.h"
 #include "analysis/csrc/infrastructure/utils/thread_pool.h"
 #include "analysis/csrc/infrastructure/process/include/process_register.h"
@@ -40,6 +44,15 @@ using namespace Infra;
 namespace Analysis {
 
 namespace Domain {
+namespace {
+const std::string DEVICE_PARSE_STAGE = "device_parse";
+const std::string DEVICE_DATA_DIR = "data";
+const std::string STOP_AT_PARAM = "stop_at";
+const std::string FOLLOW_PARAM = "follow";
+// device流水线的内存占用主要由以下数据的规模决定
+const std::vector<std::string> FOOTPRINT_DATA_PREFIXES = {"stars_soc.", "ffts_profile", "ts_track."};
+}
+
 DeviceContext& DeviceContext::Instance()
 {
     thread_local DeviceContext ins;
@@ -92,26 +105,76 @@ std::vector<std::string> GetDeviceDirectories(const std::string &path)
     return subdirs;
 }
 
+uint64_t GetDeviceFootprintInput(const std::string &devicePath)
+{
+    auto dataDir = File::PathJoin({devicePath, DEVICE_DATA_DIR});
+    if (!File::Exist(dataDir)) {
+        return 0;
+    }
+    uint64_t size = 0;
+    for (const auto &prefix : FOOTPRINT_DATA_PREFIXES) {
+        for (const auto &file : File::GetFilesWithPrefix(dataDir, prefix)) {
+            size += File::Size(file);
+        }
+    }
+    return size;
+}
+
 std::vector<DataInventory> DeviceContextEntry(const char *targetDir, const char *stopAt)
+{
+    bool isSuccess = true;
+    return DeviceContextEntry(targetDir, stopAt, isSuccess);
+}
+
+std::vector<DataInventory> DeviceContextEntry(const char *targetDir, const char *stopAt, bool &isSuccess)
 {
     Utils::TimeLogger t{"DeviceContextEntry "};
+    isSuccess = true;
     std::vector<std::string> subdirs = GetDeviceDirectories(targetDir);
     std::vector<DataInventory> processDataVec(subdirs.size());
     std::vector<std::string> processStats(subdirs.size());
+    std::vector<uint8_t> processResults(subdirs.size(), 0);
     if (subdirs.empty()) {
         WARN("No valid device directory, the file name should start with 'device'.");
         return processDataVec;
     }
 
     std::function<void()> func;
+    // 多NUMA节点时各device流水线绑定到不同节点，流水线内的线程池继承绑定
+    auto &numa = NumaTopology::GetInstance();
+    numa.Detect();
 
-    ThreadPool tp(subdirs.size());
-    size_t i = 0;
+    // 按输入规模估计各device流水线的内存占用，大的先启动，同时运行的流水线不超过内存与CPU预算
+    AdmissionController admission;
+    // 已结束流水线的输出保留在DataInventory中，修正占用比例时扣除
+    admission.SetRetainedBytesProbe(&DataInventory::GetResidentBytes);
     for (const auto &subdir: subdirs) {
+        admission.AddJob(GetDeviceFootprintInput(subdir));
+    }
+    ThreadPool tp(subdirs.size());
+    for (auto i : admission.Plan()) {
+        const auto &subdir = subdirs[i];
         auto &processStat = processStats[i];
         auto &processData = processDataVec[i];
-        ++i;
-        func = [subdir, &processStat, &processData, stopAt] {
+        auto &processResult = processResults[i];
+        int numaNode = numa.GetNodeForDevice(i);
+        func = [subdir, &processStat, &processData, &processResult, stopAt, numaNode, &admission, i] {
+            AdmissionGuard admissionGuard(admission, i);
+            NumaBinding binding(numaNode);
+            // 输入数据与参数未变化时复用上次生成的sqlite
+            StageManifest manifest(subdir, DEVICE_PARSE_STAGE);
+            manifest.AddInputDir(subdir);
+            manifest.AddInputDir(File::PathJoin({subdir, DEVICE_DATA_DIR}));
+            // device解析会读取host解析产出的runtime/GE info等sqlite，host重新解析后device也需重新解析
+            manifest.AddInputDir(File::PathJoin({subdir, "..", HOST, SQLITE}));
+            manifest.AddParam(STOP_AT_PARAM, stopAt == nullptr ? "" : stopAt);
+            manifest.AddParam(FOLLOW_PARAM, std::to_string(IngestCursor::GetInstance().IsFollow()));
+            if (manifest.IsUpToDate()) {
+                processStat = "Inputs unchanged, skip!";
+                processResult = 1;
+                return;
+            }
+            manifest.Begin();
             DeviceContext &context = DeviceContext::Instance();
             if (!context.Init(subdir)) {
                 processStat = "Init failed, exit!";
@@ -128,6 +191,17 @@ std::vector<DataInventory> DeviceContextEntry(const char *targetDir, const char
 
             auto stat = processControl.GetExecuteStat();
             RecordProcessStat(stat, subdir, processStat);
+            auto dataDir = File::PathJoin({subdir, DEVICE_DATA_DIR});
+            if (!ret) {
+                IngestCursor::GetInstance().Discard(dataDir);
+                return;
+            }
+            if (IngestCursor::GetInstance().IsFollow()) {
+                IngestCursor::GetInstance().Commit(dataDir);
+            }
+            manifest.AddOutputsModifiedSinceBegin(File::PathJoin({subdir, SQLITE}));
+            manifest.Commit();
+            processResult = 1;
         };
         tp.AddTask(func);
     }
@@ -138,6 +212,8 @@ std::vector<DataInventory> DeviceContextEntry(const char *targetDir, const char
     for (const auto &stat: processStats) {
         INFO("stat info: %", stat);
     }
+    isSuccess = std::all_of(processResults.begin(), processResults.end(), [](uint8_t ret) { return ret != 0; });
+    INFO("DataInventory peak resident bytes: %", DataInventory::GetPeakResidentBytes());
     return processDataVec;
 }
 }
@@ -198,7 +198,11 @@ private:
     bool GetStartInfo();
 };
 std::vector<DataInventory> DeviceContextEntry(const char *targetDir, const char *stopAt);
+// isSuccess为false表示存在初始化或解析失败的device目录
+std::vector<DataInventory> DeviceContextEntry(const char *targetDir, const char *stopAt, bool &isSuccess);
 std::vector<std::string> GetDeviceDirectories(const std::string &path);
+// device目录下决定流水线内存占用的输入数据(stars_soc、ffts_profile、ts_track)大小之和
+uint64_t GetDeviceFootprintInput(const std::string &devicePath);
 }
 }
 
@@ -20,6 +20,7 @@
 #include "analysis/csrc/domain/entities/hal/include/ascend_obj.h"
 #include "analysis/csrc/domain/valueobject/include/task_id.h"
 #include "analysis/csrc/infrastructure/process/include/process_register.h"
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
 
 namespace Analysis {
 namespace Domain {
@@ -31,6 +32,11 @@ struct StreamIdInfo {
     std::unordered_map<uint32_t, uint16_t> streamIdMap;
 };
 
+inline uint64_t OwnedBytes(const StreamIdInfo &data)
+{
+    return Utils::OwnedBytesOf(data.streamIdMap);
+}
+
 class LoadHostData : public Infra::Process {
 public:
     static bool ReadHostRuntimeFromDB(std::string& profPath, TaskId2HostTask& hostRuntime,
@@ -630,6 +630,21 @@ std::vector<std::string> Context::GetQosEvents(uint16_t deviceId, const std::str
 
 void Context::Clear() { context_.clear(); }
 
+std::string Context::Dump(const std::string &profPath)
+{
+    std::string content;
+    auto profInfo = context_.find(profPath);
+    if (profInfo == context_.end())
+    {
+        return content;
+    }
+    for (const auto &deviceInfo : profInfo->second)
+    {
+        content += std::to_string(deviceInfo.first) + ":" + deviceInfo.second.dump() + "\n";
+    }
+    return content;
+}
+
 bool Context::IsStarsChip(uint16_t platformVersion)
 {
     return IsChipV1(platformVersion) || IsChipV4(platformVersion) || IsChipV6(platformVersion);
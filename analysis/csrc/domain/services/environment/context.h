@@ -61,6 +61,8 @@ class Context : public Utils::Singleton<Context>
     bool Load(const std::set<std::string> &profPaths);
     bool IsAllExport();
     void Clear();
+    // 按deviceId顺序序列化prof下已加载的全部上下文，用于判定影响产物的参数是否变化
+    std::string Dump(const std::string &profPath);
 
    public:
     // 获取start_info end_info中的时间
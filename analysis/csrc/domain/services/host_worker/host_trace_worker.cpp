@@ -39,9 +39,15 @@ bool HostTraceWorker::Run()
     auto hostDataPath = Utils::File::PathJoin({hostPath_, "data"});
     std::shared_ptr<EventGrouper> grouper;
     MAKE_SHARED_RETURN_VALUE(grouper, EventGrouper, false, hostDataPath);
-    grouper->Group();
+    if (!grouper->Group())
+    {
+        ERROR("Group host events failed");
+        return false;
+    }
 
     cannWarehouses_ = grouper->GetGroupEvents();
+    // 建树线程只读数据仓，冻结后免锁查找
+    cannWarehouses_.Freeze();
     threadIds_ = grouper->GetThreadIdSet();
     ThreadPool pool(poolSize_);
     pool.Start();
@@ -78,8 +84,12 @@ void HostTraceWorker::MultiThreadBuildTree()
             [this, tid]()
             {
                 INFO("Start multi thread build tree, threadId = %", tid);
+                // 数据仓已冻结，免锁取引用，只在构造建树输入时拷贝一次
+                static const CANNWarehouse emptyWareHouse{};
+                auto wareHouse = cannWarehouses_.Get(tid);
                 std::shared_ptr<CANNWarehouse> cannWareHouse;
-                MAKE_SHARED_RETURN_VOID(cannWareHouse, CANNWarehouse, cannWarehouses_[tid]);
+                MAKE_SHARED_RETURN_VOID(cannWareHouse, CANNWarehouse,
+                                        wareHouse == nullptr ? emptyWareHouse : *wareHouse);
                 std::shared_ptr<TreeBuilder> treeBuilder;
                 MAKE_SHARED_RETURN_VOID(treeBuilder, TreeBuilder, cannWareHouse, tid);
                 auto treeNode = treeBuilder->Build();
@@ -107,6 +117,10 @@ void HostTraceWorker::MultiThreadAnalyzeTreeDumpData()
         pool.AddTask(
             [this, p]()
             {
+                if (Utils::RunControl::GetInstance().IsCancelled())
+                {
+                    return;
+                }
                 INFO("Start analyze tree and dump data, threadId = %", p.first);
                 // 分析
                 TreeAnalyzer ana{p.second, p.first};
@@ -23,7 +23,7 @@
 #include "analysis/csrc/domain/entities/tree/include/tree.h"
 #include "analysis/csrc/domain/services/parser/host/cann/cann_warehouse.h"
 #include "analysis/csrc/domain/services/parser/host/cann/event_grouper.h"
-#include "analysis/csrc/infrastructure/utils/safe_unordered_map.h"
+#include "analysis/csrc/infrastructure/utils/concurrent_hash_map.h"
 #include "analysis/csrc/infrastructure/utils/thread_pool.h"
 
 namespace Analysis
@@ -39,7 +39,7 @@ class HostTraceWorker
 {
     using TreeNode = Analysis::Domain::TreeNode;
     using CANNWarehouse = Analysis::Domain::Host::Cann::CANNWarehouse;
-    using CANNWarehouses = Analysis::Utils::SafeUnorderedMap<uint32_t, CANNWarehouse>;
+    using CANNWarehouses = Analysis::Domain::Host::Cann::CANNWarehouses;
 
    public:
     // hostPath为采集侧落盘host二进制数据路径
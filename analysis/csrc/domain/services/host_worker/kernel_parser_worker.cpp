@@ -24,6 +24,9 @@
 #include "analysis/csrc/domain/services/parser/host/cann/rt_add_info_center.h"
 #include "analysis/csrc/domain/services/environment/context.h"
 #include "analysis/csrc/domain/services/parser/host/cann/type_data.h"
+#include "analysis/csrc/infrastructure/utils/ingest_cursor.h"
+#include "analysis/csrc/infrastructure/utils/run_control.h"
+#include "analysis/csrc/infrastructure/utils/stage_manifest.h"
 
 namespace Analysis {
 namespace Domain {
@@ -31,6 +34,10 @@ using HostTraceWorker = Analysis::Domain::HostTraceWorker;
 using ThreadPool = Analysis::Utils::ThreadPool;
 using namespace Analysis::Domain::Environment;
 using namespace Analysis::Domain::Host::Cann;
+namespace {
+const std::string HOST_PARSE_STAGE = "host_parse";
+const std::string FOLLOW_PARAM = "follow";
+}
 // 解析流程控制类，传入host data所在路径，启动采集流程并返回结果
 KernelParserWorker::KernelParserWorker(std::string hostFilePath) : hostFilePath_(std::move(hostFilePath)),
                                                                    result_(true) {
@@ -44,6 +51,16 @@ int KernelParserWorker::Run()
         return ANALYSIS_ERROR;
     }
     INFO("Start run KernelParserWorker");
+    // host数据未变化时复用上次生成的sqlite
+    Utils::StageManifest manifest(hostFilePath_, HOST_PARSE_STAGE);
+    manifest.AddInputDir(hostFilePath_);
+    manifest.AddInputDir(Utils::File::PathJoin({hostFilePath_, "data"}));
+    manifest.AddParam(FOLLOW_PARAM, std::to_string(Utils::IngestCursor::GetInstance().IsFollow()));
+    if (manifest.IsUpToDate()) {
+        INFO("Host data is unchanged, skip KernelParserWorker");
+        return ANALYSIS_OK;
+    }
+    manifest.Begin();
     // 先创建目录
     std::string sqlBaseDir = Utils::File::PathJoin({hostFilePath_, "sqlite"});
     if (!Utils::File::CreateDir(sqlBaseDir)) {
@@ -64,11 +81,33 @@ int KernelParserWorker::Run()
     });
     pool.WaitAllTasks();
     pool.Stop();
+    auto dataPath = Utils::File::PathJoin({hostFilePath_, "data"});
+    auto &runControl = Utils::RunControl::GetInstance();
+    // 取消在阶段边界生效，被取消的运行不提交游标和manifest
+    if (runControl.IsCancelled()) {
+        Utils::IngestCursor::GetInstance().Discard(dataPath);
+        WARN("KernelParserWorker is cancelled before parsing host trace.");
+        return ANALYSIS_CANCELLED;
+    }
+    // 落盘后原始map不再使用，移入只读字典供trace解析查找
+    HashData::GetInstance().Seal();
+    TypeData::GetInstance().Seal();
     LaunchTraceParser();
+    if (runControl.IsCancelled()) {
+        Utils::IngestCursor::GetInstance().Discard(dataPath);
+        WARN("KernelParserWorker is cancelled.");
+        return ANALYSIS_CANCELLED;
+    }
     if (!result_) {
+        Utils::IngestCursor::GetInstance().Discard(dataPath);
         ERROR("Parse failed or dump failed");
         return ANALYSIS_ERROR;
     }
+    if (Utils::IngestCursor::GetInstance().IsFollow()) {
+        Utils::IngestCursor::GetInstance().Commit(dataPath);
+    }
+    manifest.AddOutputsModifiedSinceBegin(sqlBaseDir);
+    manifest.Commit();
     return ANALYSIS_OK;
 }
 
@@ -79,7 +118,7 @@ void KernelParserWorker::DumpHashData()
     HashData::GetInstance().Load(dataPath);
     INFO("Start load runtime op info data");
     RTAddInfoCenter::GetInstance().Load(Utils::File::PathJoin({hostFilePath_, "sqlite"}));
-    auto hashDataContent = HashData::GetInstance().GetAll();
+    const auto &hashDataContent = HashData::GetInstance().GetAll();
     INFO("success get hash data");
     if (hashDataContent.empty()) {
         WARN("Empty hash data");
@@ -88,6 +127,12 @@ void KernelParserWorker::DumpHashData()
     std::shared_ptr<HashDBDumper> hashDbDumper;
     MAKE_SHARED_RETURN_VOID(hashDbDumper, HashDBDumper, hostFilePath_);
     INFO("success get hashDbDumper");
+    // follow模式下hash字典每次全量加载，先清理上次写入的数据
+    if (Utils::IngestCursor::GetInstance().IsFollow() && !hashDbDumper->ResetTable()) {
+        ERROR("Reset hash data table failed");
+        result_ = false;
+        return;
+    }
     if (!hashDbDumper->DumpData(hashDataContent)) {
         ERROR("Hash data parse failed");
         result_ = false;
@@ -99,12 +144,17 @@ void KernelParserWorker::DumpTypeInfoData()
     auto dataPath = Utils::File::PathJoin({hostFilePath_, "data"});
     INFO("Typeinfo data load from path: %", dataPath);
     TypeData::GetInstance().Load(dataPath);
-    auto typeInfoContent = TypeData::GetInstance().GetAll();
+    const auto &typeInfoContent = TypeData::GetInstance().GetAll();
     if (typeInfoContent.empty()) {
         WARN("Empty type info data");
         return;
     }
     TypeInfoDBDumper typeDbDumper(hostFilePath_);
+    if (Utils::IngestCursor::GetInstance().IsFollow() && !typeDbDumper.ResetTable()) {
+        ERROR("Reset type info table failed");
+        result_ = false;
+        return;
+    }
     auto dumpresult = typeDbDumper.DumpData(typeInfoContent);
     if (!dumpresult) {
         ERROR("Type info parse failed");
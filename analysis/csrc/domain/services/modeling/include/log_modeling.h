@@ -45,6 +45,9 @@ private:
 private:
     std::unordered_map<uint32_t, std::vector<HalLogData*>> acsqStart_, acsqEnd_, fftsStart_, fftsEnd_;
     std::unordered_map<uint16_t, std::vector<HalTrackData*>> flipData_;
+    // follow模式下上次增量解析保留的开始日志，以及本次仍未匹配到结束日志的开始日志
+    std::vector<HalLogData> carriedLogs_;
+    std::vector<HalLogData*> unmatchedStart_;
 };
 
 class LogModelingV6 final : public LogModeling {
@@ -29,9 +29,9 @@ private:
     uint32_t ProcessEntry(Infra::DataInventory& dataInventory, const Infra::Context& context) override;
 
     template<typename T>
-    static bool cmp(T* lData, T* rData)
+    static uint64_t TimestampOf(const T* data)
     {
-        return lData->hd.timestamp < rData->hd.timestamp;
+        return data->hd.timestamp;
     }
     void GenerateBatchId();
     void GroupDataByStream(std::vector<HalPmuData>& pmuData, std::vector<HalTrackData>& flipTrack);
@@ -20,6 +20,10 @@
 #include "analysis/csrc/infrastructure/resource/chip_id.h"
 #include "analysis/csrc/infrastructure/dfx/error_code.h"
 #include "analysis/csrc/domain/services/modeling/batch_id/batch_id.h"
+#include "analysis/csrc/domain/services/device_context/device_context.h"
+#include "analysis/csrc/infrastructure/utils/file.h"
+#include "analysis/csrc/infrastructure/utils/ingest_cursor.h"
+#include "analysis/csrc/infrastructure/utils/radix_sort.h"
 #include "analysis/csrc/infrastructure/utils/time_logger.h"
 #include "analysis/csrc/domain/services/parser/track/include/ts_track_parser.h"
 
@@ -31,6 +35,8 @@ namespace {
 const int CONTEXT_OFFSET = 32;
 const int TASK_OFFSET = 16;
 constexpr uint32_t LOW_16BIT_MASK = 0xffff;
+const std::string DEVICE_DATA_DIR = "data";
+const std::string START_LOG_CARRY = "log_modeling_start";
 
 /*
  * 当开始的任务和结束的任务数量不一致时，按照相同streamId-taskId-contextId的数据，先执行的任务结束时间比后续执行任务的开始
@@ -41,7 +47,8 @@ constexpr uint32_t LOW_16BIT_MASK = 0xffff;
  */
 void MergeStartAndEndByQueue(std::vector<HalLogData *> &start, std::vector<HalLogData *> &end,
                              std::map<TaskId, std::vector<DeviceTask>> &deviceTaskMap,
-                             std::function<void(Domain::DeviceTask&, const HalLogData&, const HalLogData&)> mergeFunc)
+                             std::function<void(Domain::DeviceTask&, const HalLogData&, const HalLogData&)> mergeFunc,
+                             std::vector<HalLogData *> &unmatchedStart)
 {
     size_t sIndex = 0;
     size_t eIndex = 0;
@@ -63,12 +70,15 @@ void MergeStartAndEndByQueue(std::vector<HalLogData *> &start, std::vector<HalLo
             }
         }
     }
+    // 结束日志用完后剩余的开始日志，其结束日志可能还未落盘
+    unmatchedStart.insert(unmatchedStart.end(), start.begin() + sIndex, start.end());
 }
 
 void MergeStartAndEnd(std::map<uint64_t, std::vector<HalLogData *>> &logStart,
                       std::map<uint64_t, std::vector<HalLogData *>> &logEnd,
                       std::map<TaskId, std::vector<DeviceTask>> &deviceTaskMap,
-                      std::function<void(Domain::DeviceTask &, const HalLogData &, const HalLogData &)> mergeFunc)
+                      std::function<void(Domain::DeviceTask &, const HalLogData &, const HalLogData &)> mergeFunc,
+                      std::vector<HalLogData *> &unmatchedStart)
 {
     uint64_t key;
     uint32_t contextId;
@@ -83,9 +93,10 @@ void MergeStartAndEnd(std::map<uint64_t, std::vector<HalLogData *>> &logStart,
         if (it == logEnd.end()) {
             WARN("Start log size(%) not same as End log size(%); context:%, task:%, stream:%",
                  startPair.second.size(), 0, contextId, taskId, streamId);
+            unmatchedStart.insert(unmatchedStart.end(), startPair.second.begin(), startPair.second.end());
             continue;
         } else if (startPair.second.size() != it->second.size()) {
-            MergeStartAndEndByQueue(startPair.second, it->second, deviceTaskMap, mergeFunc);
+            MergeStartAndEndByQueue(startPair.second, it->second, deviceTaskMap, mergeFunc, unmatchedStart);
             WARN("Start log size(%) not same as End log size(%); context:%, task:%, stream:%",
                  startPair.second.size(), it->second.size(), contextId, taskId, streamId);
             continue;
@@ -103,10 +114,8 @@ void LogModeling::SplitLogGroups(std::vector<HalLogData>& logData,
                                  std::shared_ptr<std::vector<HalTrackData>>& flipTrack)
 {
     Utils::TimeLogger t{"LogModeling::SplitLogGroups "};
-    std::sort(logData.begin(), logData.end(), [](HalLogData &ld, HalLogData &rd) {
-        return ld.hd.timestamp < rd.hd.timestamp;
-    });
-    for (auto& halLog : logData) {
+    Utils::RadixSort::Sort(logData, [](const HalLogData &data) { return data.hd.timestamp; });
+    auto addToGroup = [this](HalLogData &halLog) {
         if (halLog.type == ACSQ_LOG) {
             if (halLog.acsq.isEndTimestamp) {
                 acsqEnd_[GenGroupKey(halLog)].push_back(&halLog);
@@ -120,6 +129,14 @@ void LogModeling::SplitLogGroups(std::vector<HalLogData>& logData,
                 fftsStart_[GenGroupKey(halLog)].push_back(&halLog);
             }
         }
+    };
+    // 上次增量解析保留的开始日志早于本次的日志，先加入分组以保持时间顺序
+    Utils::RadixSort::Sort(carriedLogs_, [](const HalLogData &data) { return data.hd.timestamp; });
+    for (auto& halLog : carriedLogs_) {
+        addToGroup(halLog);
+    }
+    for (auto& halLog : logData) {
+        addToGroup(halLog);
     }
     if (flipTrack) {
         auto flipGroup = GetFlipData(*flipTrack);
@@ -166,10 +183,8 @@ void LogModeling::AddToDeviceTask(std::unordered_map<uint32_t, std::vector<HalLo
         std::map<uint64_t, std::vector<HalLogData*>> acsqTaskE;
         auto it = flipGroups.find(streamNode.first);
         if (it != flipGroups.end()) {
-            std::sort(streamNode.second.begin(), streamNode.second.end(),
-                      [](HalLogData* lhs, HalLogData* rhs) {return lhs->hd.timestamp < rhs->hd.timestamp;});
-            std::sort(it->second.begin(), it->second.end(),
-                      [](HalTrackData* lhs, HalTrackData* rhs) {return lhs->hd.timestamp < rhs->hd.timestamp;});
+            Utils::RadixSort::Sort(streamNode.second, [](const HalLogData* data) {return data->hd.timestamp;});
+            Utils::RadixSort::Sort(it->second, [](const HalTrackData* data) {return data->hd.timestamp;});
             ModelingComputeBatchIdBinary(Utils::ReinterpretConvert<HalUniData**>(streamNode.second.data()),
                                          streamNode.second.size(),
                                          Utils::ReinterpretConvert<HalUniData**>(it->second.data()), it->second.size());
@@ -183,21 +198,21 @@ void LogModeling::AddToDeviceTask(std::unordered_map<uint32_t, std::vector<HalLo
         auto itE = endTask.find(streamId);
         if (itE == endTask.end()) {
             ERROR("start exist but end not exist, stream:%", streamId);
+            unmatchedStart_.insert(unmatchedStart_.end(), streamNode.second.begin(), streamNode.second.end());
             continue;
         }
         if (itE->second.size() > 1) {
-            std::sort(itE->second.begin(), itE->second.end(),
-                [](HalLogData* lhs, HalLogData* rhs) {return lhs->hd.timestamp < rhs->hd.timestamp;});
+            Utils::RadixSort::Sort(itE->second, [](const HalLogData* data) {return data->hd.timestamp;});
         }
         for (auto& node : itE->second) {
             acsqTaskE[GenMergeTaskKey(*node)].push_back(node);
         }
         
-        MergeStartAndEnd(acsqTaskS, acsqTaskE, deviceTaskMap, mergeFunc);
+        MergeStartAndEnd(acsqTaskS, acsqTaskE, deviceTaskMap, mergeFunc, unmatchedStart_);
     }
 }
 
-uint32_t LogModeling::ProcessEntry(Infra::DataInventory& dataInventory, const Infra::Context&)
+uint32_t LogModeling::ProcessEntry(Infra::DataInventory& dataInventory, const Infra::Context& context)
 {
     auto logData = dataInventory.GetPtr<std::vector<HalLogData>>();
     auto flipTrack = dataInventory.GetPtr<std::vector<HalTrackData>>();
@@ -207,6 +222,16 @@ uint32_t LogModeling::ProcessEntry(Infra::DataInventory& dataInventory, const In
         return Analysis::ANALYSIS_ERROR;
     }
 
+    auto &cursor = Utils::IngestCursor::GetInstance();
+    std::string dataDir;
+    if (cursor.IsFollow()) {
+        // 增量解析时重放上次未匹配到结束日志的开始日志
+        const auto &deviceContext = static_cast<const DeviceContext &>(context);
+        dataDir = Utils::File::PathJoin({deviceContext.GetDeviceFilePath(), DEVICE_DATA_DIR});
+        carriedLogs_ = Utils::IngestCursor::UnpackRecords<HalLogData>(cursor.TakeCarried(dataDir, START_LOG_CARRY));
+        INFO("Carried start log size:%", carriedLogs_.size());
+    }
+
     // 为了后面补BatchId，按stream和开始结束的维度给log分组
     SplitLogGroups(*logData, flipTrack);
     OutputLogCounts(*logData);
@@ -232,6 +257,15 @@ uint32_t LogModeling::ProcessEntry(Infra::DataInventory& dataInventory, const In
     });
     size_t fftsMatchedCount = GetDeviceTaskNodeSize(*deviceTaskMap) - acsqMatchedCount - deviceTaskNum;
     INFO("FFTS matched count:%", fftsMatchedCount);
+    if (cursor.IsFollow()) {
+        // 结束日志可能在下次增量解析中，保留未匹配的开始日志随游标一起提交
+        std::string records;
+        for (const auto &startLog : unmatchedStart_) {
+            Utils::IngestCursor::AppendRecord(records, *startLog);
+        }
+        INFO("Unmatched start log size:%", unmatchedStart_.size());
+        cursor.Carry(dataDir, START_LOG_CARRY, std::move(records));
+    }
     return Analysis::ANALYSIS_OK;
 }
 
@@ -21,6 +21,7 @@
 #include "analysis/csrc/domain/services/parser/pmu/include/ffts_profile_parser.h"
 #include "analysis/csrc/infrastructure/process/include/process_register.h"
 #include "analysis/csrc/infrastructure/resource/chip_id.h"
+#include "analysis/csrc/infrastructure/utils/radix_sort.h"
 #include "analysis/csrc/domain/services/parser/track/include/ts_track_parser.h"
 
 namespace Analysis {
@@ -43,8 +44,8 @@ void PmuModeling::GenerateBatchId()
     for (auto& pmuVec : pmu_) {
         auto it = flipGroup_.find(pmuVec.first);
         if (it != flipGroup_.end()) {
-            std::sort(pmuVec.second.begin(), pmuVec.second.end(), cmp<HalPmuData>);
-            std::sort(it->second.begin(), it->second.end(), cmp<HalTrackData>);
+            RadixSort::Sort(pmuVec.second, TimestampOf<HalPmuData>);
+            RadixSort::Sort(it->second, TimestampOf<HalTrackData>);
             ModelingComputeBatchIdBinary(ReinterpretConvert<HalUniData**>(pmuVec.second.data()), pmuVec.second.size(),
                                          ReinterpretConvert<HalUniData**>(it->second.data()), it->second.size());
         }
@@ -22,6 +22,7 @@
 #include "analysis/csrc/domain/services/parser/track/include/ts_track_parser.h"
 #include "analysis/csrc/infrastructure/resource/chip_id.h"
 #include "analysis/csrc/infrastructure/process/include/process_register.h"
+#include "analysis/csrc/infrastructure/utils/radix_sort.h"
 
 namespace Analysis {
 namespace Domain {
@@ -167,17 +168,12 @@ private:
 };
 }
 
-bool Compare(const HalTrackData &a, const HalTrackData &b)
-{
-    if (a.stepTrace.modelId == b.stepTrace.modelId) {
-        return a.stepTrace.timestamp < b.stepTrace.timestamp;
-    }
-    return a.stepTrace.modelId < b.stepTrace.modelId;
-}
-
 std::vector<HalTrackData> StepTraceProcess::PreprocessData(std::vector<HalTrackData>& data)
 {
-    std::sort(data.begin(), data.end(), Compare);
+    // 按(modelId, timestamp)升序
+    Utils::RadixSort::SortByKeys(
+        data, [](const HalTrackData &track) { return track.stepTrace.modelId; },
+        [](const HalTrackData &track) { return track.stepTrace.timestamp; });
     auto preprocessor = StepTracePreprocess();
     return preprocessor.Run(data);
 }
@@ -32,9 +32,26 @@ namespace Domain {
 template<typename ParserType>
 class BaseParser {
 public:
+    // 各文件中的记录互不关联时为true，可以按文件范围拆分给多个解析器并行解析，结果按文件顺序拼接
+    static constexpr bool FILE_INDEPENDENT = false;
+
     explicit BaseParser(std::string path, std::string parserName)
         : path_(std::move(path)), parserName_(std::move(parserName)) {}
 
+    // 待解析的文件，已按老化和分片序号排序
+    std::vector<std::string> GetFiles() const
+    {
+        return chunkProducer_ ? chunkProducer_->GetFiles() : std::vector<std::string>{};
+    }
+
+    // 只解析指定的文件，需要在ParseData前调用
+    void SetFiles(const std::vector<std::string> &files)
+    {
+        if (chunkProducer_) {
+            chunkProducer_->SetFiles(files);
+        }
+    }
+
     template<typename T> std::vector<std::shared_ptr<T>> ParseData()
     {
         if (!chunkProducer_) {
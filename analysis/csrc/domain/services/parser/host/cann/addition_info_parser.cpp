@@ -76,17 +76,16 @@ int AdditionInfoParser::ProduceData()
         return ANALYSIS_ERROR;
     }
     while (!chunkProducer_->Empty()) {
-        auto additionalInfo = ReinterpretConvert<MsprofAdditionalInfo *>(chunkProducer_->Pop());
+        auto additionalInfo = chunkProducer_->PopRecord<MsprofAdditionalInfo>();
         if (!additionalInfo) {
             ERROR("%: Pop chunk failed.", parserName_);
             return ANALYSIS_ERROR;
         }
         if (additionalInfo->magicNumber != MSPROF_DATA_HEAD_MAGIC_NUM) {
             ERROR("%: The last %th data check failed.", parserName_, chunkProducer_->Size());
-            delete additionalInfo;
             continue;
         }
-        additionalData_.emplace_back(std::shared_ptr<MsprofAdditionalInfo>(additionalInfo));
+        additionalData_.emplace_back(std::move(additionalInfo));
     }
     return ANALYSIS_OK;
 }
@@ -102,27 +101,24 @@ int TensorInfoParser::ProduceData()
     }
     std::unordered_map<std::string, std::shared_ptr<ConcatTensorInfo>> concatTensorMap;
     while (!chunkProducer_->Empty()) {
-        auto currTensorInfo = ReinterpretConvert<MsprofAdditionalInfo *>(chunkProducer_->Pop());
+        auto currTensorInfo = chunkProducer_->PopRecord<MsprofAdditionalInfo>();
         if (!currTensorInfo) {
             ERROR("%: Pop chunk failed.", parserName_);
             return ANALYSIS_ERROR;
         }
         if (currTensorInfo->magicNumber != MSPROF_DATA_HEAD_MAGIC_NUM) {
             ERROR("%: The last %th data check failed.", parserName_, chunkProducer_->Size());
-            delete currTensorInfo;
             continue;
         }
         auto currTensor = ReinterpretConvert<MsprofTensorInfo *>(currTensorInfo->data);
         std::string key = Utils::Join("_", currTensor->opName, currTensorInfo->timeStamp, currTensorInfo->threadId);
         if (concatTensorMap.find(key) == concatTensorMap.end()) {
-            auto concatTensor = CreateConcatTensorInfo(currTensorInfo);
+            auto concatTensor = CreateConcatTensorInfo(currTensorInfo.get());
             if (!concatTensor) {
                 ERROR("%: Create concat tensor failed.");
-                delete currTensorInfo;
                 return ANALYSIS_ERROR;
             }
             concatTensorMap.insert({key, concatTensor});
-            delete currTensorInfo;
             continue;
         }
         auto concatTensor = concatTensorMap[key];
@@ -135,7 +131,6 @@ int TensorInfoParser::ProduceData()
             }
             concatTensor->tensorNum += 1;
         }
-        delete currTensorInfo;
     }
     for (const auto &kv: concatTensorMap) {
         concatTensorData_.emplace_back(kv.second);
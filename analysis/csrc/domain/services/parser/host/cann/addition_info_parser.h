@@ -30,6 +30,8 @@ namespace Cann {
 // 该类的作用是Addition数据的解析
 class AdditionInfoParser : public BaseParser<AdditionInfoParser> {
 public:
+    static constexpr bool FILE_INDEPENDENT = true;
+
     explicit AdditionInfoParser(const std::string &path, const std::string &parserName)
         : BaseParser(path, parserName) {}
     void Init(const std::vector<std::string> &filePrefix);
@@ -91,6 +93,9 @@ private:
 // 该类的作用是tensor info数据的解析
 class TensorInfoParser final : public AdditionInfoParser {
 public:
+    // 同一算子的tensor分多条记录上报，可能跨文件拼接，不能按文件拆分
+    static constexpr bool FILE_INDEPENDENT = false;
+
     explicit TensorInfoParser(const std::string &path) : AdditionInfoParser(path, "TensorInfoParser")
     {
         Init(filePrefix_);
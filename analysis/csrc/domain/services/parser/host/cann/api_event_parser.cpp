@@ -42,16 +42,12 @@ std::shared_ptr<MsprofApi> CreateMsprofApi(const MsprofEvent *startEvent, const
 }
 
 void ClearStartEventMap(std::map<std::tuple<uint16_t, uint32_t, uint32_t, uint32_t, uint64_t>,
-                        MsprofEvent*>& startEventMap)
+                        const MsprofEvent*>& startEventMap)
 {
     if (startEventMap.empty()) {
         return;
     }
     ERROR("There is remaining start event.");
-    for (auto &startEvent : startEventMap) {
-        delete startEvent.second;
-        startEvent.second = nullptr;
-    }
     startEventMap.clear();
 }
 
@@ -79,13 +75,14 @@ int ApiEventParser::ProduceData()
     if (chunkProducer_->Empty()) {
         return ANALYSIS_OK;
     }
-    std::map<std::tuple<uint16_t, uint32_t, uint32_t, uint32_t, uint64_t>, MsprofEvent*> startEventMap;
+    // start event指向记录块，记录块由chunkProducer_持有，无需释放
+    std::map<std::tuple<uint16_t, uint32_t, uint32_t, uint32_t, uint64_t>, const MsprofEvent*> startEventMap;
     if (!Reserve(apiData_, chunkProducer_->Size())) {
         ERROR("%: Reserve data failed", parserName_);
         return ANALYSIS_ERROR;
     }
     while (!chunkProducer_->Empty()) {
-        auto event = ReinterpretConvert<MsprofEvent*>(chunkProducer_->Pop());
+        auto event = chunkProducer_->PopRecord<MsprofEvent>();
         if (!event) {
             ERROR("%: Pop chunk failed.", parserName_);
             ClearStartEventMap(startEventMap);
@@ -93,26 +90,23 @@ int ApiEventParser::ProduceData()
         }
         if (event->magicNumber != MSPROF_DATA_HEAD_MAGIC_NUM) {
             ERROR("%: The last %th data check failed.", parserName_, chunkProducer_->Size());
-            delete event;
             continue;
         }
         if (event->reserve != MSPROF_EVENT_FLAG) {
             // api data
-            apiData_.emplace_back(std::shared_ptr<MsprofApi>(ReinterpretConvert<MsprofApi*>(event)));
+            apiData_.emplace_back(std::shared_ptr<MsprofApi>(event, ReinterpretConvert<MsprofApi*>(event.get())));
             continue;
         }
         // event data，根据level, type, threadId, requestId, itemId合并start event和end event
         auto key = std::make_tuple(event->level, event->type, event->threadId, event->requestId, event->itemId);
         auto iter = startEventMap.find(key);
         if (iter == startEventMap.end()) {
-            startEventMap[key] = event;
+            startEventMap[key] = event.get();
             continue;
         }
         auto startEvent = iter->second;
-        auto apiData = CreateMsprofApi(startEvent, event);
+        auto apiData = CreateMsprofApi(startEvent, event.get());
         startEventMap.erase(iter);
-        delete startEvent;
-        delete event;
         if (!apiData) {
             ERROR("Api data is null.");
             ClearStartEventMap(startEventMap);
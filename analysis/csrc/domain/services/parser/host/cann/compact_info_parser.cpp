@@ -71,7 +71,7 @@ int CompactInfoParser::ProduceData()
     }
     while (!chunkProducer_->Empty())
     {
-        auto compactInfo = ReinterpretConvert<MsprofCompactInfo *>(chunkProducer_->Pop());
+        auto compactInfo = chunkProducer_->PopRecord<MsprofCompactInfo>();
         if (!compactInfo)
         {
             ERROR("%: Pop chunk failed.", parserName_);
@@ -80,10 +80,9 @@ int CompactInfoParser::ProduceData()
         if (compactInfo->magicNumber != MSPROF_DATA_HEAD_MAGIC_NUM)
         {
             ERROR("%: The last %th data check failed.", parserName_, chunkProducer_->Size());
-            delete compactInfo;
             continue;
         }
-        compactData_.emplace_back(std::shared_ptr<MsprofCompactInfo>(compactInfo));
+        compactData_.emplace_back(std::move(compactInfo));
     }
     return ANALYSIS_OK;
 }
@@ -117,7 +116,7 @@ int NodeBasicInfoParser::ProduceData()
         auto &producer = item.second;
         while (!producer->Empty())
         {
-            auto compactInfo = ReinterpretConvert<MsprofCompactInfo *>(producer->Pop());
+            auto compactInfo = producer->PopRecord<MsprofCompactInfo>();
             if (!compactInfo)
             {
                 ERROR("%: Pop chunk failed.", parserName_);
@@ -126,11 +125,10 @@ int NodeBasicInfoParser::ProduceData()
             if (compactInfo->magicNumber != MSPROF_DATA_HEAD_MAGIC_NUM)
             {
                 ERROR("%: The last %th data check failed with opState %.", parserName_, producer->Size(), opState);
-                delete compactInfo;
                 continue;
             }
             compactInfo->data.nodeBasicInfo.opState = opState;
-            compactData_.emplace_back(std::shared_ptr<MsprofCompactInfo>(compactInfo));
+            compactData_.emplace_back(std::move(compactInfo));
         }
     }
     return ANALYSIS_OK;
@@ -151,7 +149,7 @@ int TaskTrackParser::ProduceData()
     }
     while (!chunkProducer_->Empty())
     {
-        auto compactInfo = ReinterpretConvert<MsprofCompactInfo *>(chunkProducer_->Pop());
+        auto compactInfo = chunkProducer_->PopRecord<MsprofCompactInfo>();
         if (!compactInfo)
         {
             ERROR("%: Pop chunk failed.", parserName_);
@@ -160,13 +158,11 @@ int TaskTrackParser::ProduceData()
         if (compactInfo->magicNumber != MSPROF_DATA_HEAD_MAGIC_NUM)
         {
             ERROR("%: The last %th data check failed.", parserName_, chunkProducer_->Size());
-            delete compactInfo;
             continue;
         }
         if (compactInfo->data.runtimeTrack.taskType == flipTaskType)
         {
-            auto flipTask = Flip::CreateFlipTask(compactInfo);
-            delete compactInfo;
+            auto flipTask = Flip::CreateFlipTask(compactInfo.get());
             if (!flipTask)
             {
                 ERROR("FlipTask is null.");
@@ -179,7 +175,6 @@ int TaskTrackParser::ProduceData()
         // 同时Maintenance task可能会在流销毁的flip task后面，影响batch id的计算，所以过滤掉
         if (compactInfo->data.runtimeTrack.taskType == maintenanceTaskType)
         {
-            delete compactInfo;
             continue;
         }
 
@@ -191,10 +186,9 @@ int TaskTrackParser::ProduceData()
             uint32_t taskId = compactInfo->data.runtimeTrack.taskId;
             uint64_t key = (static_cast<uint64_t>(devId) << 32) | taskId;
             dpuKernelNameMap_[key] = compactInfo->data.runtimeTrack.kernelName;
-            delete compactInfo;
             continue;
         }
-        compactData_.emplace_back(std::shared_ptr<MsprofCompactInfo>(compactInfo));
+        compactData_.emplace_back(std::move(compactInfo));
     }
     Sort<MsprofCompactInfo, uint64_t, &MsprofCompactInfo::timeStamp>(compactData_);
     Sort<FlipTask, uint64_t, &FlipTask::timeStamp>(flipTaskData_);
@@ -38,6 +38,8 @@ namespace Cann
 class CompactInfoParser : public BaseParser<CompactInfoParser>
 {
    public:
+    static constexpr bool FILE_INDEPENDENT = true;
+
     explicit CompactInfoParser(const std::string &path, const std::string &parserName) : BaseParser(path, parserName) {}
     void Init(const std::vector<std::string> &filePrefix);
     template <typename T>
@@ -55,6 +57,9 @@ class CompactInfoParser : public BaseParser<CompactInfoParser>
 class NodeBasicInfoParser final : public CompactInfoParser
 {
    public:
+    // 每个解析器都会读取全部的unaging文件，不能按文件拆分
+    static constexpr bool FILE_INDEPENDENT = false;
+
     explicit NodeBasicInfoParser(const std::string &path) : CompactInfoParser(path, "NodeBasicInfoParser")
     {
         Init(filePrefix_);
@@ -113,6 +118,9 @@ class MemcpyInfoParser final : public CompactInfoParser
 class TaskTrackParser final : public CompactInfoParser
 {
    public:
+    // 需要全局排序并计算flip的batch id，不能按文件拆分
+    static constexpr bool FILE_INDEPENDENT = false;
+
     explicit TaskTrackParser(const std::string &path) : CompactInfoParser(path, "TaskTrackParser")
     {
         Init(filePrefix_);
@@ -16,9 +16,13 @@
 
 #include "analysis/csrc/domain/services/parser/host/cann/event_grouper.h"
 
+#include <cstring>
+#include <thread>
+
 #include "analysis/csrc/domain/services/environment/context.h"
 #include "analysis/csrc/domain/services/parser/host/cann/compact_info_parser.h"
 #include "analysis/csrc/domain/services/parser/host/cann/type_data.h"
+#include "analysis/csrc/infrastructure/utils/file.h"
 
 using namespace Analysis::Utils;
 using TypeData = Analysis::Domain::Host::Cann::TypeData;
@@ -35,6 +39,113 @@ namespace
 {
 const std::string RECORD_EVENT = "aclrtRecordEvent";
 const std::string WAIT_EVENT = "aclrtStreamWaitEvent";
+// 单一类型数据量超过该值时才切分范围并行处理
+const size_t PARALLEL_GROUP_MIN_TRACES = 16384;
+const uint32_t MAX_GROUP_RANGE_THREADS = 4;
+const std::string CARRY_NAME_PREFIX = "cann_event_";
+
+using WarehouseQueue = std::shared_ptr<EventQueue> CANNWarehouse::*;
+const std::vector<WarehouseQueue> ADDITION_QUEUES = {
+    &CANNWarehouse::graphIdMapEvents,  &CANNWarehouse::fusionOpInfoEvents, &CANNWarehouse::nodeBasicInfoEvents,
+    &CANNWarehouse::nodeAttrInfoEvents, &CANNWarehouse::tensorInfoEvents,  &CANNWarehouse::contextIdEvents,
+    &CANNWarehouse::hcclInfoEvents,    &CANNWarehouse::taskTrackEvents,    &CANNWarehouse::hcclOpInfoEvents,
+};
+
+// ConcatTensorInfo中tensorData长度可变，保留时先写定长头部再写各tensor
+struct CarriedTensorHead {
+    uint16_t level = 0;
+    uint32_t type = 0;
+    uint32_t threadId = 0;
+    uint32_t dataLen = 0;
+    uint64_t timeStamp = 0;
+    uint64_t opName = 0;
+    uint32_t tensorNum = 0;
+    uint32_t tensorDataNum = 0;
+};
+
+bool EventLess(const std::shared_ptr<Event> &event1, const std::shared_ptr<Event> &event2)
+{
+    return event1->info.start < event2->info.start ||
+           (event1->info.start == event2->info.start && event1->info.level > event2->info.level);
+}
+
+std::vector<std::shared_ptr<Event>> DrainQueue(const std::shared_ptr<EventQueue> &queue)
+{
+    std::vector<std::shared_ptr<Event>> events;
+    while (queue && !queue->Empty())
+    {
+        events.emplace_back(queue->Pop());
+    }
+    return events;
+}
+
+// 已结束的建树api的最晚结束时间，之后的记录可能属于尚未落盘的api
+// 只统计Node及以上层级，HCCL层api通常嵌套在Node层api内；线程没有建树api时不保留
+uint64_t GetClosedBound(const std::vector<std::shared_ptr<Event>> &kernelEvents)
+{
+    if (kernelEvents.empty())
+    {
+        return UINT64_MAX;
+    }
+    uint64_t bound = 0;
+    uint64_t nodeBound = 0;
+    bool hasNode = false;
+    for (const auto &event : kernelEvents)
+    {
+        bound = std::max(bound, event->info.end);
+        if (event->info.level >= MSPROF_REPORT_NODE_LEVEL)
+        {
+            hasNode = true;
+            nodeBound = std::max(nodeBound, event->info.end);
+        }
+    }
+    return hasNode ? nodeBound : bound;
+}
+
+void PackTensorInfo(std::string &records, const ConcatTensorInfo &trace)
+{
+    CarriedTensorHead head;
+    head.level = trace.level;
+    head.type = trace.type;
+    head.threadId = trace.threadId;
+    head.dataLen = trace.dataLen;
+    head.timeStamp = trace.timeStamp;
+    head.opName = trace.opName;
+    head.tensorNum = trace.tensorNum;
+    head.tensorDataNum = static_cast<uint32_t>(trace.tensorData.size());
+    IngestCursor::AppendRecord(records, head);
+    for (const auto &tensor : trace.tensorData)
+    {
+        IngestCursor::AppendRecord(records, tensor);
+    }
+}
+
+bool PackEvent(std::string &records, const Event &event)
+{
+    switch (event.info.type)
+    {
+        case EventType::EVENT_TYPE_API:
+            IngestCursor::AppendRecord(records, *event.apiPtr);
+            return true;
+        case EventType::EVENT_TYPE_NODE_BASIC_INFO:
+        case EventType::EVENT_TYPE_NODE_ATTR_INFO:
+        case EventType::EVENT_TYPE_TASK_TRACK:
+        case EventType::EVENT_TYPE_HCCL_OP_INFO:
+            IngestCursor::AppendRecord(records, *event.compactPtr);
+            return true;
+        case EventType::EVENT_TYPE_GRAPH_ID_MAP:
+        case EventType::EVENT_TYPE_FUSION_OP_INFO:
+        case EventType::EVENT_TYPE_CONTEXT_ID:
+        case EventType::EVENT_TYPE_HCCL_INFO:
+            IngestCursor::AppendRecord(records, *event.additionPtr);
+            return true;
+        case EventType::EVENT_TYPE_TENSOR_INFO:
+            PackTensorInfo(records, *event.tensorPtr);
+            return true;
+        default:
+            return false;
+    }
+}
 }  // namespace
 
 CANNWarehouses &EventGrouper::GetGroupEvents() { return cannWarehouses_; }
@@ -126,6 +237,17 @@ bool EventGrouper::Group()
 
     pool.WaitAllTasks();
     pool.Stop();
+    if (Utils::RunControl::GetInstance().IsCancelled())
+    {
+        WARN("Group events is cancelled.");
+        return false;
+    }
+    if (IngestCursor::GetInstance().IsFollow())
+    {
+        HoldBackOpenEvents();
+    }
+    // 分组结束后数据仓只读，建树阶段免锁查找
+    cannWarehouses_.Freeze();
     RecordCANNWareHouses();
 
     return true;
@@ -135,25 +257,85 @@ void EventGrouper::RecordCANNWareHouses()
 {
     for (auto thread : threadIds_)
     {
-        if (!cannWarehouses_.Find(thread))
+        auto wareHouse = cannWarehouses_.Get(thread);
+        if (wareHouse == nullptr)
         {
             continue;
         }
-        auto wareHouse = cannWarehouses_[thread];
         INFO(
             "After group events, Kernel: %, GraphId: %, FusionOp: %, NodeBasic: %, NodeAttr: %, Tensor: %,"
             " ContextId: %, HcclInfo: %, TaskTrack: %, HcclOpInfo: %, thread: %",
-            wareHouse.kernelEvents ? wareHouse.kernelEvents->GetSize() : 0,
-            wareHouse.graphIdMapEvents ? wareHouse.graphIdMapEvents->GetSize() : 0,
-            wareHouse.fusionOpInfoEvents ? wareHouse.fusionOpInfoEvents->GetSize() : 0,
-            wareHouse.nodeBasicInfoEvents ? wareHouse.nodeBasicInfoEvents->GetSize() : 0,
-            wareHouse.nodeAttrInfoEvents ? wareHouse.nodeAttrInfoEvents->GetSize() : 0,
-            wareHouse.tensorInfoEvents ? wareHouse.tensorInfoEvents->GetSize() : 0,
-            wareHouse.contextIdEvents ? wareHouse.contextIdEvents->GetSize() : 0,
-            wareHouse.hcclInfoEvents ? wareHouse.hcclInfoEvents->GetSize() : 0,
-            wareHouse.taskTrackEvents ? wareHouse.taskTrackEvents->GetSize() : 0,
-            wareHouse.hcclOpInfoEvents ? wareHouse.hcclOpInfoEvents->GetSize() : 0, thread);
+            wareHouse->kernelEvents ? wareHouse->kernelEvents->GetSize() : 0,
+            wareHouse->graphIdMapEvents ? wareHouse->graphIdMapEvents->GetSize() : 0,
+            wareHouse->fusionOpInfoEvents ? wareHouse->fusionOpInfoEvents->GetSize() : 0,
+            wareHouse->nodeBasicInfoEvents ? wareHouse->nodeBasicInfoEvents->GetSize() : 0,
+            wareHouse->nodeAttrInfoEvents ? wareHouse->nodeAttrInfoEvents->GetSize() : 0,
+            wareHouse->tensorInfoEvents ? wareHouse->tensorInfoEvents->GetSize() : 0,
+            wareHouse->contextIdEvents ? wareHouse->contextIdEvents->GetSize() : 0,
+            wareHouse->hcclInfoEvents ? wareHouse->hcclInfoEvents->GetSize() : 0,
+            wareHouse->taskTrackEvents ? wareHouse->taskTrackEvents->GetSize() : 0,
+            wareHouse->hcclOpInfoEvents ? wareHouse->hcclOpInfoEvents->GetSize() : 0, thread);
+    }
+}
+
+void EventGrouper::HoldBackOpenEvents()
+{
+    std::map<EventType, std::string> carried;
+    std::set<const Event *> heldEvents;
+    for (auto threadId : threadIds_)
+    {
+        cannWarehouses_.Update(threadId, [threadId, &carried, &heldEvents](CANNWarehouse &wareHouse)
+                               { HoldBackWarehouse(threadId, wareHouse, carried, heldEvents); });
+    }
+    // 保留的api在下次解析重放后再落盘
+    auto last = std::remove_if(apiTraces_.begin(), apiTraces_.end(), [&heldEvents](const std::shared_ptr<Event> &event)
+                               { return heldEvents.find(event.get()) != heldEvents.end(); });
+    apiTraces_.erase(last, apiTraces_.end());
+    INFO("Hold back % events until their api is parsed.", heldEvents.size());
+    auto &cursor = IngestCursor::GetInstance();
+    for (auto &item : carried)
+    {
+        cursor.Carry(hostPath_, GetCarryName(item.first), std::move(item.second));
+    }
+}
+
+void EventGrouper::HoldBackWarehouse(uint32_t threadId, CANNWarehouse &wareHouse,
+                                     std::map<EventType, std::string> &carried, std::set<const Event *> &heldEvents)
+{
+    auto kernelEvents = DrainQueue(wareHouse.kernelEvents);
+    auto bound = GetClosedBound(kernelEvents);
+    wareHouse.kernelEvents = HoldBackQueue(threadId, kernelEvents, bound, carried, heldEvents);
+    if (bound == UINT64_MAX)
+    {
+        return;
+    }
+    for (auto element : ADDITION_QUEUES)
+    {
+        auto events = DrainQueue(wareHouse.*element);
+        wareHouse.*element = HoldBackQueue(threadId, events, bound, carried, heldEvents);
+    }
+}
+
+std::shared_ptr<EventQueue> EventGrouper::HoldBackQueue(uint32_t threadId, std::vector<std::shared_ptr<Event>> &events,
+                                                        uint64_t bound, std::map<EventType, std::string> &carried,
+                                                        std::set<const Event *> &heldEvents)
+{
+    std::vector<std::shared_ptr<Event>> kept;
+    for (auto &event : events)
+    {
+        if (event->info.start > bound && PackEvent(carried[event->info.type], *event))
+        {
+            heldEvents.insert(event.get());
+            continue;
+        }
+        kept.emplace_back(std::move(event));
     }
+    return CreateEventQueue(threadId, kept);
+}
+
+std::string EventGrouper::GetCarryName(EventType eventType)
+{
+    return CARRY_NAME_PREFIX + std::to_string(static_cast<int>(eventType));
 }
 
 void EventGrouper::InitLastKernelTimes(const std::set<uint32_t> &threadIds)
@@ -167,50 +349,203 @@ void EventGrouper::InitLastKernelTimes(const std::set<uint32_t> &threadIds)
     }
 }
 
-bool EventGrouper::IsBuildTreeWithAcl(const std::shared_ptr<MsprofApi> &trace)
+bool EventGrouper::IsBuildTreeWithAcl(const MsprofApi &trace)
 {
-    if (trace->level == MSPROF_REPORT_ACL_LEVEL)
+    if (trace.level == MSPROF_REPORT_ACL_LEVEL)
     {
-        auto id = TypeData::GetInstance().Get(trace->level, trace->type);
+        auto id = TypeData::GetInstance().GetRef(trace.level, trace.type);
         return id != RECORD_EVENT && id != WAIT_EVENT;
     }
     return false;
 }
 
-bool EventGrouper::isKernelApiEvent(const std::shared_ptr<MsprofApi> &trace)
+bool EventGrouper::isKernelApiEvent(const MsprofApi &trace)
 {
-    if (trace->level == MSPROF_REPORT_ACL_LEVEL || trace->level == MSPROF_REPORT_MODEL_LEVEL ||
-        trace->level == MSPROF_REPORT_NODE_LEVEL || trace->level == MSPROF_REPORT_HCCL_NODE_LEVEL)
+    if (trace.level == MSPROF_REPORT_ACL_LEVEL || trace.level == MSPROF_REPORT_MODEL_LEVEL ||
+        trace.level == MSPROF_REPORT_NODE_LEVEL || trace.level == MSPROF_REPORT_HCCL_NODE_LEVEL)
     {
-        if (trace->beginTime == trace->endTime)
+        if (trace.beginTime == trace.endTime)
         {
-            ERROR("Invalid api event, threadId = %, level = %, begin = %, end = %", trace->threadId, trace->level,
-                  trace->beginTime, trace->endTime);
+            ERROR("Invalid api event, threadId = %, level = %, begin = %, end = %", trace.threadId, trace.level,
+                  trace.beginTime, trace.endTime);
             return false;
         }
-        if (trace->level == MSPROF_REPORT_NODE_LEVEL)
+        if (trace.level == MSPROF_REPORT_NODE_LEVEL)
         {
             return true;
         }
+        // 各threadId的记录在分组前已初始化，不同threadId并行判断时不修改外层map
+        auto threadIt = lastKernelTimes_.find(trace.threadId);
+        if (threadIt == lastKernelTimes_.end())
+        {
+            ERROR("The last kernel times of threadId % is not initialized.", trace.threadId);
+            return false;
+        }
         // 判断区间相交则为冗余数据
-        auto lastPair = lastKernelTimes_[trace->threadId][trace->level];
-        if (lastPair.second < trace->beginTime or trace->endTime < lastPair.first)
+        auto &lastPair = threadIt->second[trace.level];
+        if (lastPair.second < trace.beginTime or trace.endTime < lastPair.first)
         {
-            lastKernelTimes_[trace->threadId][trace->level] = {trace->beginTime, trace->endTime};
+            lastPair = {trace.beginTime, trace.endTime};
             return true;
         }
         if (IsBuildTreeWithAcl(trace))
         {
             return false;
         }
-        WARN("Redundant api, level: %, time: [%, %], last valid api time: [%, %], threadId = %", trace->level,
-             trace->beginTime, trace->endTime, lastKernelTimes_[trace->threadId][trace->level].first,
-             lastKernelTimes_[trace->threadId][trace->level].second, trace->threadId);
+        WARN("Redundant api, level: %, time: [%, %], last valid api time: [%, %], threadId = %", trace.level,
+             trace.beginTime, trace.endTime, lastPair.first, lastPair.second, trace.threadId);
         return false;
     }
     return false;
 }
 
+EventInfo EventGrouper::MakeEventInfo(EventType eventType, const MsprofApi &trace)
+{
+    return EventInfo{eventType, trace.level, trace.beginTime, trace.endTime};
+}
+
+size_t EventGrouper::GetRangeNum(size_t total)
+{
+    if (total < PARALLEL_GROUP_MIN_TRACES)
+    {
+        return 1;
+    }
+    uint32_t threadsNum = std::min(std::max(std::thread::hardware_concurrency(), 1U), MAX_GROUP_RANGE_THREADS);
+    return std::min(static_cast<size_t>(threadsNum), total / PARALLEL_GROUP_MIN_TRACES + 1);
+}
+
+uint64_t EventGrouper::GetFilesSize(const std::vector<std::string> &files)
+{
+    uint64_t size = 0;
+    for (const auto &file : files)
+    {
+        size += File::Size(file);
+    }
+    return size;
+}
+
+std::vector<std::pair<size_t, size_t>> EventGrouper::SplitRanges(size_t total, size_t rangeNum)
+{
+    std::vector<std::pair<size_t, size_t>> ranges;
+    rangeNum = std::max(std::min(rangeNum, total), static_cast<size_t>(1));
+    size_t step = total / rangeNum;
+    size_t remain = total % rangeNum;
+    size_t begin = 0;
+    for (size_t i = 0; i < rangeNum; ++i)
+    {
+        // 余数分摊到前remain个范围
+        size_t end = begin + step + (i < remain ? 1 : 0);
+        ranges.emplace_back(begin, end);
+        begin = end;
+    }
+    return ranges;
+}
+
+void EventGrouper::RunRanges(size_t rangeNum, const std::function<void(size_t)> &func)
+{
+    if (rangeNum <= 1)
+    {
+        if (rangeNum == 1)
+        {
+            func(0);
+        }
+        return;
+    }
+    ThreadPool pool(static_cast<uint32_t>(rangeNum));
+    pool.Start();
+    for (size_t i = 0; i < rangeNum; ++i)
+    {
+        pool.AddTask([&func, i]() { func(i); });
+    }
+    pool.WaitAllTasks();
+    pool.Stop();
+}
+
+std::set<uint32_t> EventGrouper::CollectThreadIds(const std::vector<RangeEvents> &rangeEvents)
+{
+    std::set<uint32_t> threadIds;
+    for (const auto &range : rangeEvents)
+    {
+        for (const auto &bucket : range.buckets)
+        {
+            threadIds.insert(bucket.first);
+        }
+    }
+    return threadIds;
+}
+
+std::vector<std::shared_ptr<Event>> EventGrouper::MergeBuckets(std::vector<RangeEvents> &rangeEvents,
+                                                               uint32_t threadId)
+{
+    std::vector<std::vector<std::shared_ptr<Event>> *> lists;
+    for (auto &range : rangeEvents)
+    {
+        auto it = range.buckets.find(threadId);
+        if (it != range.buckets.end())
+        {
+            lists.emplace_back(&it->second);
+        }
+    }
+    return MergeEvents(lists);
+}
+
+std::vector<std::shared_ptr<Event>> EventGrouper::MergeEvents(std::vector<std::vector<std::shared_ptr<Event>> *> &lists)
+{
+    std::vector<std::shared_ptr<Event>> result;
+    if (lists.size() == 1)
+    {
+        result.swap(*lists.front());
+        return result;
+    }
+    size_t total = 0;
+    for (const auto list : lists)
+    {
+        total += list->size();
+    }
+    if (!Utils::Reserve(result, total))
+    {
+        ERROR("Reserve merged events failed, size is %.", total);
+        return result;
+    }
+    // 范围个数很少，逐个比较各范围的队头即可
+    std::vector<size_t> heads(lists.size(), 0);
+    while (result.size() < total)
+    {
+        size_t minIndex = lists.size();
+        for (size_t i = 0; i < lists.size(); ++i)
+        {
+            if (heads[i] < lists[i]->size() &&
+                (minIndex == lists.size() || EventLess((*lists[i])[heads[i]], (*lists[minIndex])[heads[minIndex]])))
+            {
+                minIndex = i;
+            }
+        }
+        result.emplace_back(std::move((*lists[minIndex])[heads[minIndex]++]));
+    }
+    for (auto list : lists)
+    {
+        std::vector<std::shared_ptr<Event>>().swap(*list);
+    }
+    return result;
+}
+
+std::shared_ptr<EventQueue> EventGrouper::CreateEventQueue(uint32_t threadId,
+                                                           const std::vector<std::shared_ptr<Event>> &events)
+{
+    if (events.empty())
+    {
+        return nullptr;
+    }
+    // 按元素个数分配EventQueue的大小，避免大量内存浪费
+    std::shared_ptr<EventQueue> que;
+    MAKE_SHARED_RETURN_VALUE(que, EventQueue, nullptr, threadId, events.size());
+    for (const auto &event : events)
+    {
+        que->Push(event);
+    }
+    return que;
+}
+
 // 对于KernelEvents特化
 template <>
 void EventGrouper::GroupEvents<ApiEventParser, MsprofApi, &CANNWarehouse::kernelEvents>(const std::string &typeName,
@@ -220,56 +555,65 @@ void EventGrouper::GroupEvents<ApiEventParser, MsprofApi, &CANNWarehouse::kernel
     Utils::TimeLogger t{"Group " + typeName};
     std::shared_ptr<ApiEventParser> parser;
     MAKE_SHARED_RETURN_VOID(parser, ApiEventParser, hostPath_);
-
     auto traces = parser->ParseData<MsprofApi>();
-    SortByTimeAndLevel(traces);
-    // 统计各个threadId元素个数，用于EventQueue分配精确的内存大小，避免大量内存浪费
-    std::unordered_map<uint32_t, uint64_t> threadIdNum;
-    std::set<uint32_t> threadIds;
-    for (const auto &trace : traces)
+    ReplayCarried(eventType, traces);
+
+    // 2. 按范围并行排序并生成Event，保留范围内全部Event用于合并出有序的全量api
+    size_t rangeNum = GetRangeNum(traces.size());
+    std::vector<RangeEvents> rangeEvents;
+    if (!BuildRangeEvents(traces, eventType, rangeNum, true, rangeEvents))
     {
-        threadIds.insert(trace->threadId);
+        ERROR("Build events failed, event type: %", static_cast<int>(eventType));
+        return;
     }
-    InitLastKernelTimes(threadIds);
-    for (const auto &trace : traces)
+    std::vector<std::vector<std::shared_ptr<Event>> *> lists;
+    for (auto &range : rangeEvents)
     {
-        if (isKernelApiEvent(trace))
-        {
-            threadIdNum[trace->threadId] += 1;
-        }
+        lists.emplace_back(&range.events);
     }
-    InitLastKernelTimes(threadIds);
-    // 使用临时CANNWarehouses用于暂存kernel类型的数据，减小多线程竞争，提升性能
-    CANNWarehouses kernelWarehouses;
-    // 2. 转换生成Event，并将其添加到 CANNWarehouses
-    for (const auto &trace : traces)
-    {
-        EventInfo info{eventType, trace->level, trace->beginTime, trace->endTime};
-        std::shared_ptr<Event> event;
-        MAKE_SHARED_BREAK(event, Event, trace, info);
-        apiTraces_.emplace_back(event);  // 保存一份全量api
-
-        // 只处理符合条件的trace，提升性能
-        if (!isKernelApiEvent(trace))
-        {
-            continue;
-        }
+    apiTraces_ = MergeEvents(lists);  // 保存一份全量api
 
-        // 新建
-        if (!kernelWarehouses.FindAndInsertIfNotExist(trace->threadId))
-        {
-            std::shared_ptr<EventQueue> que;
-            MAKE_SHARED_BREAK(que, EventQueue, trace->threadId, threadIdNum[trace->threadId]);
-            kernelWarehouses[trace->threadId].kernelEvents = que;
-        }
-        // 插入
-        kernelWarehouses[trace->threadId].kernelEvents->Push(event);
+    // 3. 各threadId按时间顺序筛选kernel类型的api，冗余判断只依赖同一threadId的数据，不同threadId可以并行
+    auto threadIds = CollectThreadIds(rangeEvents);
+    InitLastKernelTimes(threadIds);
+    std::vector<uint32_t> tids(threadIds.begin(), threadIds.end());
+    std::vector<std::shared_ptr<EventQueue>> queues(tids.size());
+    auto tidRanges = SplitRanges(tids.size(), rangeNum);
+    std::atomic<bool> failed{false};
+    RunRanges(tidRanges.size(),
+              [this, &rangeEvents, &tids, &tidRanges, &queues, &failed](size_t index)
+              {
+                  for (size_t i = tidRanges[index].first; i < tidRanges[index].second; ++i)
+                  {
+                      auto events = MergeBuckets(rangeEvents, tids[i]);
+                      // 只保留符合条件的trace，提升性能
+                      auto last = std::remove_if(events.begin(), events.end(),
+                                                 [this](const std::shared_ptr<Event> &event)
+                                                 { return !isKernelApiEvent(*event->apiPtr); });
+                      events.erase(last, events.end());
+                      queues[i] = CreateEventQueue(tids[i], events);
+                      // 过滤后为空的threadId没有队列，其余threadId创建失败视为内存申请失败
+                      if (queues[i] == nullptr && !events.empty())
+                      {
+                          failed = true;
+                          return;
+                      }
+                  }
+              });
+    if (failed)
+    {
+        ERROR("Create kernel event queues failed.");
+        return;
     }
 
-    // 将暂存的kernelWarehouses更新到cannWarehouses_
-    for (auto kv : threadIdNum)
+    // 每个threadId只写入一次cannWarehouses_
+    for (size_t i = 0; i < tids.size(); ++i)
     {
-        cannWarehouses_[kv.first].kernelEvents = kernelWarehouses[kv.first].kernelEvents;
+        if (queues[i])
+        {
+            cannWarehouses_.Update(tids[i],
+                                   [&queues, i](CANNWarehouse &wareHouse) { wareHouse.kernelEvents = queues[i]; });
+        }
     }
 
     std::lock_guard<std::mutex> lock(tidLock_);
@@ -287,38 +631,10 @@ void EventGrouper::GroupEvents<TaskTrackParser, MsprofCompactInfo, &CANNWarehous
     MAKE_SHARED_RETURN_VOID(parser, TaskTrackParser, hostPath_);
 
     auto traces = parser->ParseData<MsprofCompactInfo>();
-    SortByTimeAndLevel(traces);
+    ReplayCarried(eventType, traces);
     flipTasks_ = parser->GetData<Adapter::FlipTask>();
     dpuKernelNameMap_ = parser->GetDpuKernelNameMap();
-
-    // 统计各个threadId元素个数，用于EventQueue分配精确的内存大小，避免大量内存浪费
-    std::unordered_map<uint32_t, uint64_t> threadIdNum;
-    std::set<uint32_t> threadIds;
-    for (const auto &trace : traces)
-    {
-        threadIds.insert(trace->threadId);
-        threadIdNum[trace->threadId] += 1;
-    }
-
-    for (const auto &trace : traces)
-    {
-        EventInfo info{eventType, trace->level, trace->timeStamp, trace->timeStamp};
-        std::shared_ptr<Event> event;
-        MAKE_SHARED_BREAK(event, Event, trace, info);
-        // 新建
-        if (!cannWarehouses_.FindAndInsertIfNotExist(trace->threadId) ||
-            !(cannWarehouses_[trace->threadId].taskTrackEvents))
-        {
-            std::shared_ptr<EventQueue> que;
-            MAKE_SHARED_BREAK(que, EventQueue, trace->threadId, threadIdNum[trace->threadId]);
-            cannWarehouses_[trace->threadId].taskTrackEvents = que;
-        }
-
-        // 插入
-        cannWarehouses_[trace->threadId].taskTrackEvents->Push(event);
-    }
-    std::lock_guard<std::mutex> lock(tidLock_);
-    threadIds_.insert(threadIds.begin(), threadIds.end());
+    GroupTraces<MsprofCompactInfo, &CANNWarehouse::taskTrackEvents>(traces, eventType);
 }
 
 // dpuTaskTrack特化
@@ -327,18 +643,57 @@ void EventGrouper::GroupEvents<DpuTaskTrackParser, MsprofCompactInfo, &CANNWareh
     const std::string &typeName, EventType eventType)
 {
     Utils::TimeLogger t{"Group " + typeName};
-    std::shared_ptr<DpuTaskTrackParser> parser;
-    MAKE_SHARED_RETURN_VOID(parser, DpuTaskTrackParser, hostPath_);
-    dpuTrackData_ = parser->ParseData<MsprofCompactInfo>();
+    if (!ParseTraces<DpuTaskTrackParser, MsprofCompactInfo>(dpuTrackData_))
+    {
+        ERROR("Parse % traces failed.", typeName);
+        return;
+    }
     INFO("Parsed DPU task track data, size: %", dpuTrackData_.size());
 }
 
 template <>
-void EventGrouper::SortByTimeAndLevel<MsprofApi>(std::vector<std::shared_ptr<MsprofApi>> &traces)
+std::vector<std::shared_ptr<ConcatTensorInfo>> EventGrouper::UnpackCarried<ConcatTensorInfo>(const std::string &records)
+{
+    std::vector<std::shared_ptr<ConcatTensorInfo>> traces;
+    size_t offset = 0;
+    while (offset + sizeof(CarriedTensorHead) <= records.size())
+    {
+        CarriedTensorHead head;
+        std::memcpy(&head, records.data() + offset, sizeof(head));
+        offset += sizeof(head);
+        uint64_t tensorSize = static_cast<uint64_t>(head.tensorDataNum) * sizeof(MsrofTensorData);
+        if (offset + tensorSize > records.size())
+        {
+            ERROR("The carried tensor info is incomplete, it is dropped.");
+            break;
+        }
+        std::shared_ptr<ConcatTensorInfo> trace;
+        MAKE_SHARED0_RETURN_VALUE(trace, ConcatTensorInfo, traces);
+        trace->level = head.level;
+        trace->type = head.type;
+        trace->threadId = head.threadId;
+        trace->dataLen = head.dataLen;
+        trace->timeStamp = head.timeStamp;
+        trace->opName = head.opName;
+        trace->tensorNum = head.tensorNum;
+        trace->tensorData.resize(head.tensorDataNum);
+        if (head.tensorDataNum > 0)
+        {
+            std::memcpy(static_cast<void *>(trace->tensorData.data()), records.data() + offset, tensorSize);
+        }
+        offset += tensorSize;
+        traces.emplace_back(std::move(trace));
+    }
+    return traces;
+}
+
+template <>
+void EventGrouper::SortByTimeAndLevel<MsprofApi>(std::vector<std::shared_ptr<MsprofApi>>::iterator begin,
+                                                 std::vector<std::shared_ptr<MsprofApi>>::iterator end)
 {
     auto comp = [](std::shared_ptr<MsprofApi> &api1, std::shared_ptr<MsprofApi> &api2)
     { return api1->beginTime < api2->beginTime || (api1->beginTime == api2->beginTime && api1->level > api2->level); };
-    std::sort(traces.begin(), traces.end(), comp);
+    std::sort(begin, end, comp);
 }
 
 }  // namespace Cann
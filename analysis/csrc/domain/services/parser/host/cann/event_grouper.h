@@ -18,10 +18,17 @@
 #define ANALYSIS_PARSER_HOST_CANN_EVENT_GROUPER_H
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
+#include <functional>
+#include <iterator>
+#include <map>
 #include <memory>
 #include <set>
+#include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "analysis/csrc/domain/entities/tree/include/event.h"
 #include "analysis/csrc/domain/entities/tree/include/event_queue.h"
@@ -30,8 +37,10 @@
 #include "analysis/csrc/domain/services/parser/host/cann/cann_warehouse.h"
 #include "analysis/csrc/domain/services/parser/host/cann/compact_info_parser.h"
 #include "analysis/csrc/infrastructure/dfx/log.h"
+#include "analysis/csrc/infrastructure/utils/concurrent_hash_map.h"
+#include "analysis/csrc/infrastructure/utils/ingest_cursor.h"
 #include "analysis/csrc/infrastructure/utils/prof_common.h"
-#include "analysis/csrc/infrastructure/utils/safe_unordered_map.h"
+#include "analysis/csrc/infrastructure/utils/run_control.h"
 #include "analysis/csrc/infrastructure/utils/thread_pool.h"
 #include "analysis/csrc/infrastructure/utils/time_logger.h"
 #include "analysis/csrc/infrastructure/utils/utils.h"
@@ -51,7 +60,7 @@ using EventType = Analysis::Domain::EventType;
 using EventInfo = Analysis::Domain::EventInfo;
 using EventQueue = Analysis::Domain::EventQueue;
 
-using CANNWarehouses = Analysis::Utils::SafeUnorderedMap<uint32_t, CANNWarehouse>;
+using CANNWarehouses = Analysis::Utils::ConcurrentHashMap<uint32_t, CANNWarehouse>;
 
 class EventGrouper
 {
@@ -74,61 +83,255 @@ class EventGrouper
     // 获取DpuKernelNameMap
     std::unordered_map<uint64_t, uint64_t> &GetDpuKernelNameMap();
     // ACL层建树白名单
-    bool IsBuildTreeWithAcl(const std::shared_ptr<MsprofApi> &trace);
+    bool IsBuildTreeWithAcl(const MsprofApi &trace);
 
    private:
-    bool isKernelApiEvent(const std::shared_ptr<MsprofApi> &trace);
+    bool isKernelApiEvent(const MsprofApi &trace);
     void InitLastKernelTimes(const std::set<uint32_t> &threadIds);
     void RecordCANNWareHouses();
+    // follow模式下子记录早于所属api落盘，各线程最后一个已结束的建树api之后的记录本次不建树，保留到下次解析重放
+    void HoldBackOpenEvents();
+    static void HoldBackWarehouse(uint32_t threadId, CANNWarehouse &wareHouse,
+                                  std::map<EventType, std::string> &carried, std::set<const Event *> &heldEvents);
+    static std::shared_ptr<EventQueue> HoldBackQueue(uint32_t threadId, std::vector<std::shared_ptr<Event>> &events,
+                                                     uint64_t bound, std::map<EventType, std::string> &carried,
+                                                     std::set<const Event *> &heldEvents);
+    static std::string GetCarryName(EventType eventType);
+
+    // follow模式下重放上次解析保留的记录
+    template <typename M>
+    void ReplayCarried(EventType eventType, std::vector<std::shared_ptr<M>> &traces)
+    {
+        auto &cursor = Utils::IngestCursor::GetInstance();
+        if (!cursor.IsFollow())
+        {
+            return;
+        }
+        auto carried = UnpackCarried<M>(cursor.TakeCarried(hostPath_, GetCarryName(eventType)));
+        if (!carried.empty())
+        {
+            INFO("Replay % carried records, event type: %", carried.size(), static_cast<int>(eventType));
+            traces.insert(traces.end(), carried.begin(), carried.end());
+        }
+    }
+
+    template <typename M>
+    static std::vector<std::shared_ptr<M>> UnpackCarried(const std::string &records)
+    {
+        std::vector<std::shared_ptr<M>> traces;
+        for (const auto &record : Utils::IngestCursor::UnpackRecords<M>(records))
+        {
+            std::shared_ptr<M> trace;
+            MAKE_SHARED_RETURN_VALUE(trace, M, traces, record);
+            traces.emplace_back(std::move(trace));
+        }
+        return traces;
+    }
 
     template <typename P, typename M, std::shared_ptr<EventQueue> CANNWarehouse::*element>
     void GroupEvents(const std::string &typeName, EventType eventType)
     {
+        // 取消只在任务边界生效，未开始的解析直接跳过
+        if (Utils::RunControl::GetInstance().IsCancelled())
+        {
+            return;
+        }
         // 1. 解析bin
         Utils::TimeLogger t{"Group " + typeName};
+        std::vector<std::shared_ptr<M>> traces;
+        if (!ParseTraces<P, M>(traces))
+        {
+            ERROR("Parse % traces failed.", typeName);
+            return;
+        }
+        ReplayCarried(eventType, traces);
+        GroupTraces<M, element>(traces, eventType);
+    }
+
+    // 各文件记录互不关联的类型按文件范围拆分给多个解析器并行解析，结果按文件顺序拼接
+    // follow模式下游标按目录记录读取位置，不拆分
+    template <typename P, typename M>
+    bool ParseTraces(std::vector<std::shared_ptr<M>> &traces)
+    {
         std::shared_ptr<P> parser;
-        MAKE_SHARED_RETURN_VOID(parser, P, hostPath_);
-        auto traces = parser->template ParseData<M>();
-        SortByTimeAndLevel(traces);
-
-        // 统计各个threadId元素个数，用于EventQueue分配精确的内存大小，避免大量内存浪费
-        std::unordered_map<uint32_t, uint64_t> threadIdNum;
-        std::set<uint32_t> threadIds;
-        for (const auto &trace : traces)
+        MAKE_SHARED_RETURN_VALUE(parser, P, false, hostPath_);
+        auto files = parser->GetFiles();
+        size_t rangeNum = 1;
+        if (P::FILE_INDEPENDENT && !Utils::IngestCursor::GetInstance().IsFollow())
+        {
+            rangeNum = GetRangeNum(GetFilesSize(files) / sizeof(M));
+        }
+        if (rangeNum <= 1 || files.size() <= 1)
         {
-            threadIds.insert(trace->threadId);
-            threadIdNum[trace->threadId] += 1;
+            traces = parser->template ParseData<M>();
+            return true;
         }
+        auto fileRanges = SplitRanges(files.size(), rangeNum);
+        std::vector<std::vector<std::shared_ptr<M>>> parts(fileRanges.size());
+        std::atomic<bool> failed{false};
+        RunRanges(fileRanges.size(),
+                  [this, &files, &fileRanges, &parts, &failed](size_t index)
+                  {
+                      std::shared_ptr<P> rangeParser;
+                      MAKE_SHARED_NO_OPERATION(rangeParser, P, hostPath_);
+                      if (rangeParser == nullptr)
+                      {
+                          failed = true;
+                          return;
+                      }
+                      rangeParser->SetFiles(std::vector<std::string>(files.begin() + fileRanges[index].first,
+                                                                     files.begin() + fileRanges[index].second));
+                      parts[index] = rangeParser->template ParseData<M>();
+                  });
+        if (failed)
+        {
+            return false;
+        }
+        size_t total = 0;
+        for (const auto &part : parts)
+        {
+            total += part.size();
+        }
+        if (!Utils::Reserve(traces, total))
+        {
+            ERROR("Reserve traces failed, size is %.", total);
+            return false;
+        }
+        for (auto &part : parts)
+        {
+            std::move(part.begin(), part.end(), std::back_inserter(traces));
+            std::vector<std::shared_ptr<M>>().swap(part);
+        }
+        return true;
+    }
 
-        for (const auto &trace : traces)
+    // 2. 按范围并行生成Event并按threadId分桶，再按threadId合并到数据仓
+    template <typename M, std::shared_ptr<EventQueue> CANNWarehouse::*element>
+    void GroupTraces(std::vector<std::shared_ptr<M>> &traces, EventType eventType)
+    {
+        size_t rangeNum = GetRangeNum(traces.size());
+        std::vector<RangeEvents> rangeEvents;
+        if (!BuildRangeEvents(traces, eventType, rangeNum, false, rangeEvents))
+        {
+            ERROR("Build events failed, event type: %", static_cast<int>(eventType));
+            return;
+        }
+        auto threadIds = CollectThreadIds(rangeEvents);
+        std::vector<uint32_t> tids(threadIds.begin(), threadIds.end());
+        std::vector<std::shared_ptr<EventQueue>> queues(tids.size());
+        // 每个threadId只由一个任务合并，任务之间不共享可写数据
+        auto tidRanges = SplitRanges(tids.size(), rangeNum);
+        std::atomic<bool> failed{false};
+        RunRanges(tidRanges.size(),
+                  [&rangeEvents, &tids, &tidRanges, &queues, &failed](size_t index)
+                  {
+                      for (size_t i = tidRanges[index].first; i < tidRanges[index].second; ++i)
+                      {
+                          queues[i] = CreateEventQueue(tids[i], MergeBuckets(rangeEvents, tids[i]));
+                          if (queues[i] == nullptr)
+                          {
+                              failed = true;
+                              return;
+                          }
+                      }
+                  });
+        if (failed)
         {
-            EventInfo info{eventType, trace->level, trace->timeStamp, trace->timeStamp};
-            std::shared_ptr<Event> event;
-            MAKE_SHARED_BREAK(event, Event, trace, info);
-            // 新建
-            if (!cannWarehouses_.FindAndInsertIfNotExist(trace->threadId) ||
-                !(cannWarehouses_[trace->threadId].*element))
+            ERROR("Create event queues failed, event type: %", static_cast<int>(eventType));
+            return;
+        }
+        // 每个threadId只写入一次数据仓
+        for (size_t i = 0; i < tids.size(); ++i)
+        {
+            if (queues[i])
             {
-                std::shared_ptr<EventQueue> que;
-                MAKE_SHARED_BREAK(que, EventQueue, trace->threadId, threadIdNum[trace->threadId]);
-                cannWarehouses_[trace->threadId].*element = que;
+                cannWarehouses_.Update(tids[i],
+                                       [&queues, i](CANNWarehouse &wareHouse) { wareHouse.*element = queues[i]; });
             }
-
-            // 插入
-            (cannWarehouses_[trace->threadId].*element)->Push(event);
         }
         std::lock_guard<std::mutex> lock(tidLock_);
         threadIds_.insert(threadIds.begin(), threadIds.end());
     }
 
+    // 一个范围内生成的Event，events为范围内全部Event，buckets按threadId分桶，均按时间和层级有序
+    struct RangeEvents
+    {
+        std::vector<std::shared_ptr<Event>> events;
+        std::unordered_map<uint32_t, std::vector<std::shared_ptr<Event>>> buckets;
+    };
+
+    // 将traces切分为rangeNum个连续范围并行处理，各范围内排序、生成Event并按threadId分桶
+    // keepEvents为true时保留范围内的全部Event，用于合并出全局有序的Event；任一范围内存申请失败时返回false
+    template <typename M>
+    bool BuildRangeEvents(std::vector<std::shared_ptr<M>> &traces, EventType eventType, size_t rangeNum,
+                          bool keepEvents, std::vector<RangeEvents> &rangeEvents)
+    {
+        auto ranges = SplitRanges(traces.size(), rangeNum);
+        rangeEvents.clear();
+        rangeEvents.resize(ranges.size());
+        std::atomic<bool> failed{false};
+        RunRanges(ranges.size(),
+                  [this, &traces, &ranges, &rangeEvents, &failed, eventType, keepEvents](size_t index)
+                  {
+                      size_t begin = ranges[index].first;
+                      size_t end = ranges[index].second;
+                      SortByTimeAndLevel<M>(traces.begin() + begin, traces.begin() + end);
+                      auto &range = rangeEvents[index];
+                      if (keepEvents && !Utils::Reserve(range.events, end - begin))
+                      {
+                          failed = true;
+                          return;
+                      }
+                      for (size_t i = begin; i < end && !failed; ++i)
+                      {
+                          const auto &trace = traces[i];
+                          std::shared_ptr<Event> event;
+                          MAKE_SHARED_NO_OPERATION(event, Event, trace, MakeEventInfo(eventType, *trace));
+                          if (event == nullptr)
+                          {
+                              failed = true;
+                              return;
+                          }
+                          range.buckets[trace->threadId].emplace_back(event);
+                          if (keepEvents)
+                          {
+                              range.events.emplace_back(std::move(event));
+                          }
+                      }
+                  });
+        return !failed;
+    }
+
+    template <typename M>
+    static EventInfo MakeEventInfo(EventType eventType, const M &trace)
+    {
+        return EventInfo{eventType, trace.level, trace.timeStamp, trace.timeStamp};
+    }
+
+    static EventInfo MakeEventInfo(EventType eventType, const MsprofApi &trace);
+    // 按数据量计算切分的范围个数，数据量较小时不切分
+    static size_t GetRangeNum(size_t total);
+    static uint64_t GetFilesSize(const std::vector<std::string> &files);
+    // 将[0, total)均分为最多rangeNum个连续范围
+    static std::vector<std::pair<size_t, size_t>> SplitRanges(size_t total, size_t rangeNum);
+    // 并行执行rangeNum个范围任务，func的参数为范围下标，只有一个范围时在当前线程执行
+    static void RunRanges(size_t rangeNum, const std::function<void(size_t)> &func);
+    static std::set<uint32_t> CollectThreadIds(const std::vector<RangeEvents> &rangeEvents);
+    // 归并各范围中threadId对应的桶，结果按时间和层级有序，相同时间和层级时保持范围的先后顺序
+    static std::vector<std::shared_ptr<Event>> MergeBuckets(std::vector<RangeEvents> &rangeEvents, uint32_t threadId);
+    static std::vector<std::shared_ptr<Event>> MergeEvents(std::vector<std::vector<std::shared_ptr<Event>> *> &lists);
+    static std::shared_ptr<EventQueue> CreateEventQueue(uint32_t threadId,
+                                                        const std::vector<std::shared_ptr<Event>> &events);
+
     template <typename T>
-    void SortByTimeAndLevel(std::vector<std::shared_ptr<T>> &traces)
+    void SortByTimeAndLevel(typename std::vector<std::shared_ptr<T>>::iterator begin,
+                            typename std::vector<std::shared_ptr<T>>::iterator end)
     {
         auto comp = [](std::shared_ptr<T> &api1, std::shared_ptr<T> &api2) {
             return api1->timeStamp < api2->timeStamp ||
                    (api1->timeStamp == api2->timeStamp && api1->level > api2->level);
         };
-        std::sort(traces.begin(), traces.end(), comp);
+        std::sort(begin, end, comp);
     }
 
    private:
@@ -158,7 +361,12 @@ void EventGrouper::GroupEvents<DpuTaskTrackParser, MsprofCompactInfo, &CANNWareh
     const std::string &typeName, EventType eventType);
 
 template <>
-void EventGrouper::SortByTimeAndLevel<MsprofApi>(std::vector<std::shared_ptr<MsprofApi>> &traces);
+std::vector<std::shared_ptr<ConcatTensorInfo>> EventGrouper::UnpackCarried<ConcatTensorInfo>(
+    const std::string &records);
+
+template <>
+void EventGrouper::SortByTimeAndLevel<MsprofApi>(std::vector<std::shared_ptr<MsprofApi>>::iterator begin,
+                                                 std::vector<std::shared_ptr<MsprofApi>>::iterator end);
 
 }  // namespace Cann
 }  // namespace Host
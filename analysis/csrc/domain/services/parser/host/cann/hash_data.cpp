@@ -16,6 +16,8 @@
 
 #include "hash_data.h"
 
+#include <utility>
+
 #include "analysis/csrc/infrastructure/dfx/error_code.h"
 #include "analysis/csrc/infrastructure/dfx/log.h"
 #include "analysis/csrc/infrastructure/utils/utils.h"
@@ -26,9 +28,10 @@ namespace Host {
 namespace Cann {
 
 using namespace Analysis::Utils;
-
 bool Cann::HashData::Load(const std::string &path)
 {
+    // follow模式下每次全量加载，先清理上次的数据
+    Clear();
     auto files = File::GetOriginData(path, filePrefix_, fileFilter_);
     if (files.empty()) {
         WARN("No hash data found.");
@@ -37,13 +40,41 @@ bool Cann::HashData::Load(const std::string &path)
     return ReadFiles(files);
 }
 
-std::string HashData::Get(uint64_t hash)
+void HashData::Seal()
+{
+    if (hashData_.empty()) {
+        return;
+    }
+    if (!dictionary_.Build(std::move(hashData_))) {
+        WARN("Build hash dictionary failed, lookup from hash map instead.");
+    }
+}
+
+bool HashData::Find(uint64_t hash, StringRef &value) const
 {
-    if (hashData_.find(hash) != hashData_.end()) {
-        return hashData_[hash];
+    if (dictionary_.Find(hash, value)) {
+        return true;
+    }
+    auto it = hashData_.find(hash);
+    if (it != hashData_.end()) {
+        value = it->second;
+        return true;
     }
     ERROR("Failed to found str for hash: %", hash);
-    return std::to_string(hash);
+    return false;
+}
+
+std::string HashData::Get(uint64_t hash)
+{
+    StringRef value;
+    return Find(hash, value) ? value.ToString() : std::to_string(hash);
+}
+
+StringRef HashData::GetRef(uint64_t hash) const
+{
+    StringRef value;
+    Find(hash, value);
+    return value;
 }
 
 std::unordered_map<uint64_t, std::string> &HashData::GetAll()
@@ -89,6 +120,7 @@ bool HashData::ReadFiles(const std::vector<std::string> &files)
 void HashData::Clear() const
 {
     hashData_.clear();
+    dictionary_.Clear();
 }
 }  // namespace Cann
 }  // namespace Host
@@ -23,22 +23,29 @@
 #include <unordered_map>
 
 #include "analysis/csrc/infrastructure/utils/singleton.h"
+#include "analysis/csrc/infrastructure/utils/static_dictionary.h"
 
 namespace Analysis {
 namespace Domain {
 namespace Host {
 namespace Cann {
 // 该类是Hash数据单例类，读取数据，保存在hashData_
+// 落盘完成后调用Seal将hashData_移入只读的完美hash字典dictionary_并释放，此后GetAll为空
 class HashData : public Utils::Singleton<HashData> {
 public:
     bool Load(const std::string &path);
+    void Seal();
     void Clear() const;
     std::string Get(uint64_t hash);
+    // 热点路径使用，返回指向字典内部内存的视图，不拷贝字符串，未找到时返回空视图
+    Utils::StringRef GetRef(uint64_t hash) const;
     std::unordered_map<uint64_t, std::string>& GetAll();
 
 private:
     bool ReadFiles(const std::vector<std::string>& files);
+    bool Find(uint64_t hash, Utils::StringRef &value) const;
     mutable std::unordered_map<uint64_t, std::string> hashData_;
+    mutable Utils::StaticDictionary dictionary_;
     std::vector<std::string> filePrefix_ = {
         "unaging.additional.hash_dic.slice",
         "aging.additional.hash_dic.slice",
@@ -37,26 +37,21 @@ void Cann::RTAddInfoCenter::Load(const std::string &path)
     BuildCaptureInfoTimeRange();
 }
 
-RuntimeOpInfo RTAddInfoCenter::Get(uint16_t deviceId, uint32_t streamId, uint16_t taskId)
+const RuntimeOpInfo &RTAddInfoCenter::Get(uint16_t deviceId, uint32_t streamId, uint16_t taskId)
 {
-    std::string key = Utils::Join("_", deviceId, streamId, taskId);
-    auto it = runtimeOpInfoData_.find(key);
-    if (it != runtimeOpInfoData_.end()) {
-        return it->second;
-    }
-    return RuntimeOpInfo();
+    static const RuntimeOpInfo EMPTY_INFO;
+    return runtimeOpInfoData_.Get(RuntimeTaskKey::Pack(deviceId, streamId, taskId), EMPTY_INFO);
 }
 
 uint64_t RTAddInfoCenter::GetModelId(uint16_t deviceId, uint32_t streamId, uint16_t batchId, uint64_t timestamp)
 {
     constexpr uint32_t kDefaultModelId = DEFAULT_MODEL_ID;
 
-    CaptureKey key{deviceId, streamId, batchId};
-    auto it = captureInfoTimeRangeDict_.find(key);
-    if (it == captureInfoTimeRangeDict_.end())
+    auto range = captureInfoTimeRangeDict_.Find(RuntimeTaskKey::Pack(deviceId, streamId, batchId));
+    if (range == nullptr)
         return kDefaultModelId;
 
-    const auto& timeRange = it->second;
+    const auto& timeRange = *range;
     uint64_t start = std::get<0>(timeRange);
     uint64_t end   = std::get<1>(timeRange);
     uint32_t model = std::get<2>(timeRange);
@@ -69,20 +64,19 @@ void RTAddInfoCenter::BuildCaptureInfoTimeRange()
     const uint64_t kInf = std::numeric_limits<uint64_t>::max();
 
     for (const auto& info : captureStreamInfoData_) {
-        CaptureKey key{info.deviceId, info.streamId, info.batchId};
-
-        auto it = captureInfoTimeRangeDict_.find(key);
-        if (it == captureInfoTimeRangeDict_.end()) {
-            it = captureInfoTimeRangeDict_.emplace(key, TimeRangeInfo{0, kInf, info.modelId}).first;
+        auto key = RuntimeTaskKey::Pack(info.deviceId, info.streamId, info.batchId);
+        auto timeRange = captureInfoTimeRangeDict_.Emplace(key, TimeRangeInfo{0, kInf, info.modelId}).first;
+        if (timeRange == nullptr) {
+            ERROR("Build capture info time range failed.");
+            return;
         }
-        auto& timeRange = it->second;
 
         if (info.captureStatus == CAPTURE_STATUS_START) {
-            std::get<0>(timeRange) = info.timeStamp;   // startTime
-            std::get<2>(timeRange) = info.modelId;     // modelId
+            std::get<0>(*timeRange) = info.timeStamp;   // startTime
+            std::get<2>(*timeRange) = info.modelId;     // modelId
         } else if (info.captureStatus == CAPTURE_STATUS_END) {
-            std::get<1>(timeRange) = info.timeStamp;   // endTime
-            std::get<2>(timeRange) = info.modelId;
+            std::get<1>(*timeRange) = info.timeStamp;   // endTime
+            std::get<2>(*timeRange) = info.modelId;
         }
     }
 }
@@ -141,6 +135,10 @@ void RTAddInfoCenter::LoadDB(const std::string &path)
         ERROR("Query runtime op info data failed, db path is %.", hostDbDirectory);
         return;
     }
+    if (!runtimeOpInfoData_.Reserve(runtimeOpInfoData_.Size() + result.size())) {
+        ERROR("Reserve runtime op info failed, size is %.", result.size());
+        return;
+    }
 
     for (auto row : result) {
         uint16_t deviceId, taskId, blockNum, mixBlockNum, opFlag, tensorNum;
@@ -151,7 +149,6 @@ void RTAddInfoCenter::LoadDB(const std::string &path)
         std::tie(deviceId, modelId, streamId, taskId, opName, taskType, opType, hashId, blockNum, mixBlockNum, opFlag,
                  isDynamic, tensorNum, inputFormats, inputDataTypes, inputShapes,
                  outputFormats, outputDataTypes, outputShapes) = row;
-        std::string key = Utils::Join("_", deviceId, streamId, taskId);
         if (Utils::StrToU64(opNameU64, opName) != ANALYSIS_OK || Utils::StrToU64(opTypeU64, opType) != ANALYSIS_OK) {
             ERROR("opName hash is %, opType hash is %.", opName, opType);
             continue;
@@ -161,7 +158,7 @@ void RTAddInfoCenter::LoadDB(const std::string &path)
         RuntimeOpInfo info{deviceId, taskId, blockNum, mixBlockNum, opFlag, tensorNum, streamId, modelId, taskType,
                            opType, opName, hashId, isDynamic, inputFormats, inputDataTypes, inputShapes,
                            outputFormats, outputDataTypes, outputShapes};
-        runtimeOpInfoData_[key] = info;
+        runtimeOpInfoData_[RuntimeTaskKey::Pack(deviceId, streamId, taskId)] = info;
     }
 }
 
@@ -21,11 +21,10 @@
 #include <vector>
 #include <cstdint>
 #include <string>
-#include <unordered_map>
 #include <limits>
-#include <map>
 #include <tuple>
 
+#include "analysis/csrc/infrastructure/utils/flat_key_map.h"
 #include "analysis/csrc/infrastructure/utils/singleton.h"
 #include "analysis/csrc/domain/entities/hal/include/ascend_obj.h"
 
@@ -34,7 +33,8 @@ namespace Domain {
 namespace Host {
 namespace Cann {
 
-using CaptureKey = std::tuple<uint16_t, uint32_t, uint16_t>;
+// deviceId(16位), streamId(32位), taskId/batchId(16位)
+using RuntimeTaskKey = Utils::PackedKey<16, 32, 16>;
 
 using TimeRangeInfo = std::tuple<uint64_t, uint64_t, uint64_t>;
 
@@ -48,16 +48,17 @@ static constexpr uint16_t CAPTURE_STATUS_END = 1;
 class RTAddInfoCenter : public Utils::Singleton<RTAddInfoCenter> {
 public:
     void Load(const std::string &path);
-    RuntimeOpInfo Get(uint16_t deviceId, uint32_t streamId, uint16_t taskId);
+    // 不存在时返回isValid为false的空信息
+    const RuntimeOpInfo &Get(uint16_t deviceId, uint32_t streamId, uint16_t taskId);
     uint64_t GetModelId(uint16_t deviceId, uint32_t streamId, uint16_t batchId, uint64_t timestamp);
 
 private:
     void LoadDB(const std::string &path);
     void LoadCaptureInfoDB(const std::string &path);
     void BuildCaptureInfoTimeRange();
-    std::unordered_map<std::string, RuntimeOpInfo> runtimeOpInfoData_;
+    Utils::FlatKeyMap<RuntimeOpInfo> runtimeOpInfoData_;
     std::vector<CaptureStreamInfo> captureStreamInfoData_;
-    std::map<CaptureKey, TimeRangeInfo> captureInfoTimeRangeDict_;
+    Utils::FlatKeyMap<TimeRangeInfo> captureInfoTimeRangeDict_;
  };  // class RTAddInfoCenter
  }  // namespace Cann
  }  // namespace Host
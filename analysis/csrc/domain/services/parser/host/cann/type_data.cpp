@@ -16,6 +16,8 @@
 
 #include "type_data.h"
 
+#include <utility>
+
 #include "analysis/csrc/infrastructure/dfx/error_code.h"
 #include "analysis/csrc/infrastructure/dfx/log.h"
 #include "analysis/csrc/infrastructure/utils/utils.h"
@@ -34,6 +36,8 @@ const std::unordered_map<uint64_t, std::string> whiteTypeData{
 
 bool TypeData::Load(const std::string &path)
 {
+    // follow模式下每次全量加载，先清理上次的数据
+    Clear();
     auto files = File::GetOriginData(path, filePrefix_, fileFilter_);
     if (files.empty()) {
         WARN("No type data found.");
@@ -42,21 +46,60 @@ bool TypeData::Load(const std::string &path)
     return ReadFiles(files);
 }
 
-std::string TypeData::Get(uint16_t level, uint64_t type)
+void TypeData::Seal()
 {
-    if (typeData_.find(level) == typeData_.end()) {
-        ERROR("Failed to found str for level: %", level);
-        return std::to_string(type);
+    for (auto it = typeData_.begin(); it != typeData_.end();) {
+        std::shared_ptr<StaticDictionary> dictionary;
+        MAKE_SHARED0_NO_OPERATION(dictionary, StaticDictionary);
+        if (dictionary == nullptr || !dictionary->Build(std::move(it->second))) {
+            WARN("Build type info dictionary of level % failed, lookup from type map instead.", it->first);
+            ++it;
+            continue;
+        }
+        dictionaries_.emplace(it->first, std::move(dictionary));
+        it = typeData_.erase(it);
     }
-    if (typeData_[level].find(type) == typeData_[level].end()) {
-        auto it = whiteTypeData.find(type);
-        if (it != whiteTypeData.end()) {
-            return it->second;
+}
+
+bool TypeData::Find(uint16_t level, uint64_t type, StringRef &value) const
+{
+    auto dictIt = dictionaries_.find(level);
+    if (dictIt != dictionaries_.end()) {
+        if (dictIt->second->Find(type, value)) {
+            return true;
+        }
+    } else {
+        auto levelIt = typeData_.find(level);
+        if (levelIt == typeData_.end()) {
+            ERROR("Failed to found str for level: %", level);
+            return false;
+        }
+        auto typeIt = levelIt->second.find(type);
+        if (typeIt != levelIt->second.end()) {
+            value = typeIt->second;
+            return true;
         }
-        ERROR("Failed to found str for type: %", type);
-        return std::to_string(type);
     }
-    return typeData_[level][type];
+    auto it = whiteTypeData.find(type);
+    if (it != whiteTypeData.end()) {
+        value = it->second;
+        return true;
+    }
+    ERROR("Failed to found str for type: %", type);
+    return false;
+}
+
+std::string TypeData::Get(uint16_t level, uint64_t type)
+{
+    StringRef value;
+    return Find(level, type, value) ? value.ToString() : std::to_string(type);
+}
+
+StringRef TypeData::GetRef(uint16_t level, uint64_t type) const
+{
+    StringRef value;
+    Find(level, type, value);
+    return value;
 }
 
 std::unordered_map<uint16_t, std::unordered_map<uint64_t, std::string>> &TypeData::GetAll()
@@ -114,6 +157,7 @@ bool TypeData::ReadFiles(const std::vector<std::string> &files)
 void TypeData::Clear() const
 {
     typeData_.clear();
+    dictionaries_.clear();
 }
 }  // namespace Cann
 }  // namespace Host
@@ -19,26 +19,34 @@
 
 #include <vector>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <unordered_map>
 
 #include "analysis/csrc/infrastructure/utils/singleton.h"
+#include "analysis/csrc/infrastructure/utils/static_dictionary.h"
 
 namespace Analysis {
 namespace Domain {
 namespace Host {
 namespace Cann {
 // 该类是Type数据单例类，读取数据，保存在typeData_
+// 落盘完成后调用Seal将typeData_按level移入只读的完美hash字典dictionaries_并释放，此后GetAll为空
 class TypeData : public Utils::Singleton<TypeData> {
 public:
     bool Load(const std::string &path);
+    void Seal();
     void Clear() const;
     std::string Get(uint16_t level, uint64_t type);
+    // 热点路径使用，返回指向字典内部内存的视图，不拷贝字符串，未找到时返回空视图
+    Utils::StringRef GetRef(uint16_t level, uint64_t type) const;
     std::unordered_map<uint16_t, std::unordered_map<uint64_t, std::string>>& GetAll();
 
 private:
     bool ReadFiles(const std::vector<std::string>& files);
+    bool Find(uint16_t level, uint64_t type, Utils::StringRef &value) const;
     mutable std::unordered_map<uint16_t, std::unordered_map<uint64_t, std::string>> typeData_;
+    mutable std::unordered_map<uint16_t, std::shared_ptr<Utils::StaticDictionary>> dictionaries_;
     std::vector<std::string> filePrefix_ = {
         "unaging.additional.type_info_dic.slice",
         "aging.additional.type_info_dic.slice",
@@ -17,13 +17,14 @@
 #include "analysis/csrc/infrastructure/dfx/log.h"
 #include "analysis/csrc/infrastructure/dfx/error_code.h"
 #include "analysis/csrc/domain/services/parser/host/chunk_generator.h"
+#include "analysis/csrc/infrastructure/utils/ingest_cursor.h"
 
 namespace Analysis {
 namespace Domain {
 using namespace Analysis::Utils;
 
 ChunkGenerator::ChunkGenerator(uint32_t chunkSize, const std::string &path, const std::vector<std::string> &filePrefix)
-    : chunkSize_(chunkSize)
+    : path_(path), chunkSize_(chunkSize)
 {
     auto files = File::GetOriginData(path, filePrefix, {"done", "complete"});
     files = File::SortFilesByAgingAndSliceNum(files);
@@ -48,6 +49,9 @@ int ChunkGenerator::ReadChunk()
         ERROR("Chunk size is invalid");
         return ANALYSIS_ERROR;
     }
+    if (IngestCursor::GetInstance().IsFollow()) {
+        return ReadIncrementalChunk();
+    }
     while (!readFiles_.empty()) {
         auto file = readFiles_.front();
         readFiles_.pop_front();
@@ -66,6 +70,40 @@ int ChunkGenerator::ReadChunk()
     return ANALYSIS_OK;
 }
 
+std::vector<std::string> ChunkGenerator::GetFiles() const
+{
+    return std::vector<std::string>(readFiles_.begin(), readFiles_.end());
+}
+
+void ChunkGenerator::SetFiles(const std::vector<std::string> &files)
+{
+    readFiles_.assign(files.begin(), files.end());
+}
+
+int ChunkGenerator::ReadIncrementalChunk()
+{
+    if (readFiles_.empty()) {
+        return ANALYSIS_OK;
+    }
+    auto &cursor = IngestCursor::GetInstance();
+    std::vector<std::string> files(readFiles_.begin(), readFiles_.end());
+    readFiles_.clear();
+    uint64_t readSize = 0;
+    auto segments = cursor.Plan(path_, files, static_cast<uint64_t>(chunkSize_), false, readSize);
+    if (readSize == 0) {
+        return ANALYSIS_OK;
+    }
+    std::vector<char> buffer;
+    if (!Resize(buffer, readSize) || !IngestCursor::ReadSegments(segments, buffer.data())) {
+        ERROR("The read incremental chunk failed: %", path_);
+        return ANALYSIS_ERROR;
+    }
+    ss_.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    remainSize_ += readSize / static_cast<uint64_t>(chunkSize_);
+    cursor.Advance(path_, segments);
+    return ANALYSIS_OK;
+}
+
 CHAR_PTR ChunkGenerator::Pop()
 {
     if (remainSize_ == 0) {
@@ -82,6 +120,36 @@ CHAR_PTR ChunkGenerator::Pop()
     return chunk;
 }
 
+bool ChunkGenerator::LoadBlock()
+{
+    auto size = remainSize_ * static_cast<size_t>(chunkSize_);
+    try {
+        block_ = std::shared_ptr<char>(new char[size], std::default_delete<char[]>());
+    } catch (...) {
+        ERROR("New record block failed, size is %.", size);
+        block_ = nullptr;
+        blockSize_ = 0;
+        blockOffset_ = 0;
+        return false;
+    }
+    ss_.read(block_.get(), static_cast<std::streamsize>(size));
+    auto readSize = static_cast<size_t>(ss_.gcount());
+    // 数据已全部转移到记录块，释放stringstream中的数据
+    ss_.str("");
+    ss_.clear();
+    if (readSize != size) {
+        ERROR("Read record block failed, expect % bytes, read % bytes.", size, readSize);
+        block_ = nullptr;
+        blockSize_ = 0;
+        blockOffset_ = 0;
+        remainSize_ = 0;
+        return false;
+    }
+    blockSize_ = size;
+    blockOffset_ = 0;
+    return true;
+}
+
 bool ChunkGenerator::Empty() const
 {
     return remainSize_ == 0;
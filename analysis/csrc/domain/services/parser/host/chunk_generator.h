@@ -17,6 +17,7 @@
 #ifndef ANALYSIS_PARSER_CHUNK_GENERATOR_H
 #define ANALYSIS_PARSER_CHUNK_GENERATOR_H
 
+#include <memory>
 #include <string>
 #include <sstream>
 #include <queue>
@@ -30,6 +31,9 @@ namespace Domain {
 // 1. 根据文件名的前后缀，获取要读取的文件路径
 // 2. ReadChunk：从文件读取二进制数据，保存在std::stringstream对象中
 // 3. Pop：从std::stringstream对象Pop出chunkSize_大小的二进制数据
+// 4. follow模式下ReadChunk只读取各文件上次解析之后新增的完整chunk
+// 5. PopRecord：将剩余数据一次性读入连续的记录块，逐条返回与记录块共享生命周期的记录，不能与Pop混用
+// 6. GetFiles/SetFiles：ReadChunk前获取或替换待读取的文件，用于按文件范围并行解析
 class ChunkGenerator {
 public:
     explicit ChunkGenerator(uint32_t chunkSize) : chunkSize_(chunkSize) {}
@@ -37,15 +41,45 @@ public:
     virtual ~ChunkGenerator();
 
     int ReadChunk();
+    std::vector<std::string> GetFiles() const;
+    void SetFiles(const std::vector<std::string> &files);
     Utils::CHAR_PTR Pop();
     bool Empty() const;
     size_t Size() const;
 
+    template<typename T>
+    std::shared_ptr<T> PopRecord()
+    {
+        if (remainSize_ == 0) {
+            WARN("Nothing remain to Pop.");
+            return nullptr;
+        }
+        if (sizeof(T) > static_cast<size_t>(chunkSize_)) {
+            ERROR("The record size % is larger than chunk size %.", sizeof(T), chunkSize_);
+            return nullptr;
+        }
+        if (blockOffset_ >= blockSize_ && !LoadBlock()) {
+            return nullptr;
+        }
+        auto record = Utils::ReinterpretConvert<T *>(block_.get() + blockOffset_);
+        blockOffset_ += static_cast<size_t>(chunkSize_);
+        --remainSize_;
+        return std::shared_ptr<T>(block_, record);
+    }
+
+private:
+    int ReadIncrementalChunk();
+    bool LoadBlock();
+
 private:
     std::stringstream ss_;
+    std::string path_;
     std::deque<std::string> readFiles_;
     std::streamsize chunkSize_ = 0;  // one data chunk bytes
     size_t remainSize_ = 0;  // remain chunk number in ss_
+    std::shared_ptr<char> block_;  // PopRecord的记录块
+    size_t blockSize_ = 0;
+    size_t blockOffset_ = 0;
 };  // class ChunkGenerator
 }  // namespace Domain
 }  // namespace Analysis
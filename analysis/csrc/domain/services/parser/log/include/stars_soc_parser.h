@@ -22,6 +22,7 @@
 #include "analysis/csrc/domain/entities/hal/include/hal_log.h"
 #include "analysis/csrc/domain/services/parser/parser.h"
 #include "analysis/csrc/domain/services/parser/parser_item_factory.h"
+#include "analysis/csrc/domain/services/parser/parser_item/stars_batch_decoder.h"
 
 namespace Analysis
 {
@@ -31,6 +32,9 @@ class StarsSocParser : public Parser
 {
    private:
     uint32_t ParseDataItem(uint8_t* binaryData, uint32_t binaryDataSize, uint8_t* data, uint16_t expandStatus);
+    // acsq log占stars_soc数据的绝大部分，由批量解码的列直接填充，返回是否命中
+    bool ParseAcsqLogColumns(const StarsHeaderColumns& columns, size_t index, uint32_t trunkSize, uint8_t* data);
+    void VerifyCnt(int currentCnt);
     std::vector<std::string> GetFilePattern() override;
     uint32_t GetTrunkSize() override;
     uint32_t ParseData(Infra::DataInventory& dataInventory, const Infra::Context& context) override;
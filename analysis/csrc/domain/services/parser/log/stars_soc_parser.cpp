@@ -19,6 +19,7 @@
 #include "analysis/csrc/domain/entities/hal/include/stream_expand_spec.h"
 #include "analysis/csrc/domain/services/device_context/load_stream_expand_spec_data.h"
 #include "analysis/csrc/domain/services/parser/parser_item_factory.h"
+#include "analysis/csrc/domain/services/parser/parser_item/acsq_log_parser_item.h"
 #include "analysis/csrc/infrastructure/dfx/error_code.h"
 #include "analysis/csrc/infrastructure/process/include/process_register.h"
 #include "analysis/csrc/infrastructure/resource/binary_struct_info.h"
@@ -71,18 +72,48 @@ uint32_t StarsSocParser::ParseDataItem(uint8_t *binaryData, uint32_t binaryDataS
         WARN("There is no Parser function to handle data! functype is %", header->funcType);
         return ANALYSIS_OK;
     }
-    int currentCnt = parser(binaryData, binaryDataSize, data, expandStatus);
+    VerifyCnt(parser(binaryData, binaryDataSize, data, expandStatus));
+    return ANALYSIS_OK;
+}
+
+void StarsSocParser::VerifyCnt(int currentCnt)
+{
     if (cnt_ == DEFAULT_CNT)
     {
         cnt_ = currentCnt;
-        return ANALYSIS_OK;
+        return;
     }
     if (currentCnt != cnt_ + 1 && cnt_ - currentCnt != VALID_CNT)
     {
         WARN("CNT verification failed. prevCnt: %; nowCnt: %", cnt_, currentCnt);
     }
     cnt_ = currentCnt;
-    return ANALYSIS_OK;
+}
+
+bool StarsSocParser::ParseAcsqLogColumns(const StarsHeaderColumns& columns, size_t index, uint32_t trunkSize,
+                                         uint8_t* data)
+{
+    auto funcType = columns.funcType[index];
+    if (columns.magicNum[index] != STARS_MAGIC_NUM ||
+        (funcType != PARSER_ITEM_ACSQ_LOG_START && funcType != PARSER_ITEM_ACSQ_LOG_END))
+    {
+        return false;
+    }
+    if (GetParserType() == LOG_PARSER_V6)
+    {
+        if (trunkSize != sizeof(AcsqLogV6))
+        {
+            return false;
+        }
+        VerifyCnt(AcsqLogParseColumns_V6(columns, index, data));
+        return true;
+    }
+    if (trunkSize != sizeof(AcsqLog))
+    {
+        return false;
+    }
+    VerifyCnt(AcsqLogParseColumns(columns, index, data));
+    return true;
 }
 
 uint32_t StarsSocParser::ParseData(DataInventory &dataInventory, const Infra::Context &context)
@@ -104,10 +135,22 @@ uint32_t StarsSocParser::ParseData(DataInventory &dataInventory, const Infra::Co
         ERROR("The stars_soc data volume is less than 2");
         stat = ANALYSIS_ERROR;
     }
+    // 公共头按列批量解码，acsq log直接由列填充，其余类型仍按funcType分发给对应的解析函数
+    StarsHeaderColumns columns;
+    auto idRule = GetParserType() == LOG_PARSER_V6 ? STARS_ID_RAW : STARS_ID_WITH_SQE_TYPE;
+    if (!StarsBatchDecoder::Decode(this->binaryData.get(), structCount, trunkSize, expandStatus, idRule, columns))
+    {
+        ERROR("Decode StarsSoc data failed!");
+        return ANALYSIS_ERROR;
+    }
     for (uint64_t i = 0; i < structCount; i++)
     {
-        if (this->ParseDataItem(&this->binaryData[i * trunkSize], trunkSize,
-                                ReinterpretConvert<uint8_t *>(&this->halUniData_[i]), expandStatus) == ANALYSIS_ERROR)
+        auto *item = ReinterpretConvert<uint8_t *>(&this->halUniData_[i]);
+        if (ParseAcsqLogColumns(columns, i, trunkSize, item))
+        {
+            continue;
+        }
+        if (this->ParseDataItem(&this->binaryData[i * trunkSize], trunkSize, item, expandStatus) == ANALYSIS_ERROR)
         {
             ERROR("parse data failed, total of % pieces of data are parsed", i);
             stat = ANALYSIS_ERROR;
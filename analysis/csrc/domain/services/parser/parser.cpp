@@ -20,6 +20,7 @@
 #include <iostream>
 
 #include "analysis/csrc/domain/services/parser/parser_error_code.h"
+#include "analysis/csrc/infrastructure/utils/ingest_cursor.h"
 
 namespace Analysis
 {
@@ -153,6 +154,10 @@ uint32_t Parser::ReadDataEntry(const DeviceContext &deviceContext)
 
     // 读取每个处理块大小
     auto trunkSize = this->GetTrunkSize();
+    if (Utils::IngestCursor::GetInstance().IsFollow())
+    {
+        return this->ReadIncrementalData(files, trunkSize, this->GetFilePath(deviceContext));
+    }
 
     // 读取所有文件大小
     auto fileSize = this->GetFilesSize(files);
@@ -183,6 +188,37 @@ uint32_t Parser::ReadDataEntry(const DeviceContext &deviceContext)
     return this->ReadData(files, firstFileOffset);
 }
 
+uint32_t Parser::ReadIncrementalData(const std::vector<std::string> &files, uint32_t trunkSize,
+                                     const std::string &dataDir)
+{
+    auto &cursor = Utils::IngestCursor::GetInstance();
+    uint64_t readSize = 0;
+    auto segments = cursor.Plan(dataDir, files, trunkSize, true, readSize);
+    this->binaryData = nullptr;
+    this->binaryDataSize = 0;
+    if (readSize == 0)
+    {
+        INFO("No new data for filePrefix: %", Analysis::Utils::Join(this->GetFilePattern(), ","));
+        return ANALYSIS_OK;
+    }
+    this->binaryData.reset(new (std::nothrow) uint8_t[readSize]);
+    if (this->binaryData == nullptr)
+    {
+        ERROR("new binary data error!");
+        return Analysis::PARSER_NEW_BINARY_DATA_ERROR;
+    }
+    if (!Utils::IngestCursor::ReadSegments(segments, reinterpret_cast<char *>(this->binaryData.get())))
+    {
+        this->binaryData = nullptr;
+        return Analysis::PARSER_FREAD_ERROR;
+    }
+    this->binaryDataSize = readSize;
+    cursor.Advance(dataDir, segments);
+    INFO("Incremental parse filePrefix is: %, the number of new segments is: %, and the new size is: %",
+         Analysis::Utils::Join(this->GetFilePattern(), ","), segments.size(), readSize);
+    return ANALYSIS_OK;
+}
+
 uint32_t Parser::ProcessEntry(DataInventory &dataInventory, const Infra::Context &context)
 {
     const DeviceContext &deviceContext = static_cast<const DeviceContext &>(context);
@@ -44,6 +44,10 @@ private:
 
     uint32_t ReadDataEntry(const DeviceContext &deviceContext);
 
+    // follow模式下只读取上次解析之后新增的完整记录
+    uint32_t ReadIncrementalData(const std::vector<std::string> &files, uint32_t trunkSize,
+                                 const std::string &dataDir);
+
     // 获取文件路径
     std::string GetFilePath(const DeviceContext &deviceContext);
 
@@ -70,6 +70,38 @@ int AcsqLogParseItem_V6(uint8_t *binaryData, uint32_t binaryDataSize, uint8_t *h
     return log->cnt;
 }
 
+int AcsqLogParseColumns(const StarsHeaderColumns &columns, size_t index, uint8_t *halUniData)
+{
+    auto *unionData = ReinterpretConvert<HalLogData *>(halUniData);
+    unionData->hd.taskId.streamId = columns.streamId[index];
+    unionData->hd.taskId.batchId = 0;
+    unionData->hd.taskId.taskId = columns.taskId[index];
+    unionData->hd.taskId.contextId = INVALID_CONTEXT_ID;
+    unionData->type = ACSQ_LOG;
+    unionData->acsq.isEndTimestamp = columns.funcType[index] != PARSER_ITEM_ACSQ_LOG_START;
+    unionData->hd.timestamp = columns.timestamp[index];
+    unionData->acsq.taskType = columns.highBits[index];
+    unionData->acsq.timestamp = columns.timestamp[index];
+    return columns.cnt[index];
+}
+
+int AcsqLogParseColumns_V6(const StarsHeaderColumns &columns, size_t index, uint8_t *halUniData)
+{
+    auto *unionData = ReinterpretConvert<HalLogData *>(halUniData);
+    unionData->hd.taskId.batchId = 0;
+    unionData->hd.taskId.streamId = 0;
+    // V6的32位taskId在公共头中按streamId(低16位)、taskId(高16位)两列解码
+    unionData->hd.taskId.taskId = static_cast<uint32_t>(columns.streamId[index]) |
+                                  (static_cast<uint32_t>(columns.taskId[index]) << 16);
+    unionData->hd.taskId.contextId = INVALID_CONTEXT_ID;
+    unionData->type = ACSQ_LOG;
+    unionData->acsq.isEndTimestamp = columns.funcType[index] != PARSER_ITEM_ACSQ_LOG_START;
+    unionData->hd.timestamp = columns.timestamp[index];
+    unionData->acsq.taskType = columns.highBits[index];
+    unionData->acsq.timestamp = columns.timestamp[index];
+    return columns.cnt[index];
+}
+
 REGISTER_PARSER_ITEM(LOG_PARSER, PARSER_ITEM_ACSQ_LOG_START, AcsqLogParseItem);
 REGISTER_PARSER_ITEM(LOG_PARSER, PARSER_ITEM_ACSQ_LOG_END, AcsqLogParseItem);
 REGISTER_PARSER_ITEM(LOG_PARSER_V6, PARSER_ITEM_ACSQ_LOG_START, AcsqLogParseItem_V6);
@@ -19,6 +19,7 @@
 
 #include <cstdint>
 #include "analysis/csrc/domain/entities/hal/include/hal_log.h"
+#include "analysis/csrc/domain/services/parser/parser_item/stars_batch_decoder.h"
 
 namespace Analysis {
 namespace Domain {
@@ -54,6 +55,10 @@ struct AcsqLogV6 {
 
 int AcsqLogParseItem(uint8_t *binaryData, uint32_t binaryDataSize, uint8_t *halUniData, uint16_t expandStatus);
 int AcsqLogParseItem_V6(uint8_t *binaryData, uint32_t binaryDataSize, uint8_t *halUniData, uint16_t expandStatus);
+// 由StarsBatchDecoder解码出的第index条记录的列填充acsq log，与逐条解析结果一致，返回cnt
+// V4使用STARS_ID_WITH_SQE_TYPE规则解码，V6使用STARS_ID_RAW规则解码
+int AcsqLogParseColumns(const StarsHeaderColumns &columns, size_t index, uint8_t *halUniData);
+int AcsqLogParseColumns_V6(const StarsHeaderColumns &columns, size_t index, uint8_t *halUniData);
 
 }
 }
@@ -29,19 +29,12 @@ namespace Analysis {
 namespace Domain {
 using namespace Analysis::Utils;
 
-int BlockPmuParseItem(uint8_t *binaryData, uint32_t binaryDataSize, uint8_t *halUniData, uint16_t expandStatus)
+namespace {
+int FillBlockPmu(const BlockPmu *blockPmu, uint16_t streamId, uint16_t taskId, HalPmuData *pmuData)
 {
-    if (binaryDataSize != sizeof(BlockPmu)) {
-        ERROR("The TrunkSize of PMU is not equal with the ContextPmu struct");
-        return PARSER_ERROR_SIZE_MISMATCH;
-    }
-
-    auto *blockPmu = ReinterpretConvert<BlockPmu *>(binaryData);
-    auto *pmuData = ReinterpretConvert<HalPmuData *>(halUniData);
-
-    pmuData->hd.taskId.streamId = StarsCommon::GetStreamId(blockPmu->streamId, blockPmu->taskId, expandStatus);
+    pmuData->hd.taskId.streamId = streamId;
     pmuData->hd.taskId.batchId = INVALID_BATCH_ID;
-    pmuData->hd.taskId.taskId = StarsCommon::GetTaskId(blockPmu->streamId, blockPmu->taskId, expandStatus);
+    pmuData->hd.taskId.taskId = taskId;
     pmuData->hd.taskId.contextId = blockPmu->subTaskId;
     pmuData->hd.timestamp = blockPmu->timeList[1]; // 使用结束时间进行batchId的匹配
 
@@ -61,6 +54,26 @@ int BlockPmuParseItem(uint8_t *binaryData, uint32_t binaryDataSize, uint8_t *hal
     }
     return blockPmu->cnt;
 }
+}
+
+int BlockPmuParseItem(uint8_t *binaryData, uint32_t binaryDataSize, uint8_t *halUniData, uint16_t expandStatus)
+{
+    if (binaryDataSize != sizeof(BlockPmu)) {
+        ERROR("The TrunkSize of PMU is not equal with the ContextPmu struct");
+        return PARSER_ERROR_SIZE_MISMATCH;
+    }
+
+    auto *blockPmu = ReinterpretConvert<BlockPmu *>(binaryData);
+    return FillBlockPmu(blockPmu, StarsCommon::GetStreamId(blockPmu->streamId, blockPmu->taskId, expandStatus),
+                        StarsCommon::GetTaskId(blockPmu->streamId, blockPmu->taskId, expandStatus),
+                        ReinterpretConvert<HalPmuData *>(halUniData));
+}
+
+int BlockPmuParseColumns(const StarsHeaderColumns &columns, size_t index, uint8_t *binaryData, uint8_t *halUniData)
+{
+    return FillBlockPmu(ReinterpretConvert<BlockPmu *>(binaryData), columns.streamId[index], columns.taskId[index],
+                        ReinterpretConvert<HalPmuData *>(halUniData));
+}
 
 REGISTER_PARSER_ITEM(PMU_PARSER, PARSER_ITEM_BLOCK_PMU, BlockPmuParseItem);
 }
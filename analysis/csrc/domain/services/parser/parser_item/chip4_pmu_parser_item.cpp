@@ -28,18 +28,12 @@ namespace Analysis {
 namespace Domain {
 using namespace Analysis::Utils;
 
-int Chip4PmuParseItem(uint8_t *binaryData, uint32_t binaryDataSize, uint8_t *halUniData, uint16_t expandStatus)
+namespace {
+int FillContextPmu(const ContextPmu *contextPmu, uint16_t streamId, uint16_t taskId, HalPmuData *pmuData)
 {
-    if (binaryDataSize != sizeof(ContextPmu)) {
-        ERROR("The TrunkSize of PMU is not equal with the ContextPmu struct");
-        return PARSER_ERROR_SIZE_MISMATCH;
-    }
-    auto *contextPmu = ReinterpretConvert<ContextPmu *>(binaryData);
-    auto *pmuData = ReinterpretConvert<HalPmuData *>(halUniData);
-
-    pmuData->hd.taskId.streamId = StarsCommon::GetStreamId(contextPmu->streamId, contextPmu->taskId, expandStatus);
+    pmuData->hd.taskId.streamId = streamId;
     pmuData->hd.taskId.batchId = INVALID_BATCH_ID;
-    pmuData->hd.taskId.taskId = StarsCommon::GetTaskId(contextPmu->streamId, contextPmu->taskId, expandStatus);
+    pmuData->hd.taskId.taskId = taskId;
     if (contextPmu->fftsType == FFTS_PLUS) {
         pmuData->hd.taskId.contextId = contextPmu->subTaskId;
     } else {
@@ -63,6 +57,26 @@ int Chip4PmuParseItem(uint8_t *binaryData, uint32_t binaryDataSize, uint8_t *hal
     }
     return contextPmu->cnt;
 }
+}
+
+int Chip4PmuParseItem(uint8_t *binaryData, uint32_t binaryDataSize, uint8_t *halUniData, uint16_t expandStatus)
+{
+    if (binaryDataSize != sizeof(ContextPmu)) {
+        ERROR("The TrunkSize of PMU is not equal with the ContextPmu struct");
+        return PARSER_ERROR_SIZE_MISMATCH;
+    }
+    auto *contextPmu = ReinterpretConvert<ContextPmu *>(binaryData);
+    return FillContextPmu(contextPmu,
+                          StarsCommon::GetStreamId(contextPmu->streamId, contextPmu->taskId, expandStatus),
+                          StarsCommon::GetTaskId(contextPmu->streamId, contextPmu->taskId, expandStatus),
+                          ReinterpretConvert<HalPmuData *>(halUniData));
+}
+
+int Chip4PmuParseColumns(const StarsHeaderColumns &columns, size_t index, uint8_t *binaryData, uint8_t *halUniData)
+{
+    return FillContextPmu(ReinterpretConvert<ContextPmu *>(binaryData), columns.streamId[index],
+                          columns.taskId[index], ReinterpretConvert<HalPmuData *>(halUniData));
+}
 
 REGISTER_PARSER_ITEM(PMU_PARSER, PARSER_ITEM_CONTEXT_PMU, Chip4PmuParseItem);
 }
@@ -18,6 +18,7 @@
 #define ANALYSIS_DOMAIN_SERVICE_PARSER_PARSER_ITEM_PMU_PARSER_ITEM_H
 
 #include <cstdint>
+#include "analysis/csrc/domain/services/parser/parser_item/stars_batch_decoder.h"
 
 namespace Analysis {
 namespace Domain {
@@ -50,6 +51,8 @@ struct ContextPmu {
 #pragma pack()
 
 int Chip4PmuParseItem(uint8_t *binaryData, uint32_t binaryDataSize, uint8_t *halUniData, uint16_t expandStatus);
+// streamId/taskId取自StarsBatchDecoder按STARS_ID_COMMON规则解码的列，其余字段取自原始记录
+int Chip4PmuParseColumns(const StarsHeaderColumns &columns, size_t index, uint8_t *binaryData, uint8_t *halUniData);
 
 }
 }
@@ -0,0 +1,200 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#include "analysis/csrc/domain/services/parser/parser_item/stars_batch_decoder.h"
+
+#include <cstring>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "analysis/csrc/domain/services/parser/parser_item/stars_common.h"
+#include "analysis/csrc/infrastructure/dfx/log.h"
+#include "analysis/csrc/infrastructure/utils/utils.h"
+
+namespace Analysis {
+namespace Domain {
+using namespace Analysis::Utils;
+namespace {
+const uint16_t FUNC_TYPE_MASK = 0x3F;
+const uint16_t CNT_MASK = 0xF;
+const int CNT_SHIFT = 6;
+const int HIGH_BITS_SHIFT = 10;
+const size_t MAGIC_OFFSET = 2;
+const size_t STREAM_ID_OFFSET = 4;
+const size_t TASK_ID_OFFSET = 6;
+const size_t TIMESTAMP_OFFSET = 8;
+const uint16_t STREAM_MOD_MASK = STREAM_LOW_OPERATOR - 1;  // streamId % 2048
+
+template <typename T>
+inline T LoadField(const uint8_t *record, size_t offset)
+{
+    T value;
+    std::memcpy(&value, record + offset, sizeof(T));
+    return value;
+}
+
+#if defined(__SSE2__)
+const size_t SIMD_BATCH = 8;  // 一个128位寄存器容纳8条记录的16位字段
+
+inline __m128i Select(__m128i mask, __m128i a, __m128i b)
+{
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+inline __m128i TestBits(__m128i value, uint16_t bits)
+{
+    auto mask = _mm_set1_epi16(static_cast<short>(bits));
+    return _mm_cmpeq_epi16(_mm_and_si128(value, mask), mask);
+}
+
+inline __m128i And(__m128i value, uint16_t bits)
+{
+    return _mm_and_si128(value, _mm_set1_epi16(static_cast<short>(bits)));
+}
+
+// 与StarsCommon::GetStreamId/GetTaskId逐分支等价的掩码实现
+void RemapIds(__m128i &stream, __m128i &task, __m128i sqeType, bool expanding)
+{
+    if (expanding) {
+        auto placeHolder = _mm_or_si128(_mm_cmpeq_epi16(sqeType, _mm_set1_epi16(PLACE_HOLDER_SQE)),
+                                        _mm_cmpeq_epi16(sqeType, _mm_set1_epi16(EVENT_RECORD_SQE)));
+        auto swapped = _mm_andnot_si128(placeHolder, TestBits(stream, STREAM_JUDGE_BIT15_OPERATOR));
+        auto newStream = Select(swapped, And(task, EXPANDING_LOW_OPERATOR), And(stream, EXPANDING_LOW_OPERATOR));
+        auto newTask = Select(swapped, _mm_or_si128(And(task, STREAM_JUDGE_BIT15_OPERATOR),
+                                                    And(stream, EXPANDING_LOW_OPERATOR)), task);
+        stream = newStream;
+        task = newTask;
+        return;
+    }
+    auto bit12 = TestBits(stream, STREAM_JUDGE_BIT12_OPERATOR);
+    auto bit13 = _mm_andnot_si128(bit12, TestBits(stream, STREAM_JUDGE_BIT13_OPERATOR));
+    auto newStream = Select(bit13, And(task, STREAM_MOD_MASK), And(stream, STREAM_MOD_MASK));
+    auto taskBit12 = _mm_or_si128(And(task, TASK_LOW_OPERATOR), And(stream, STREAM_HIGH_OPERATOR));
+    auto taskBit13 = _mm_or_si128(And(stream, COMMON_LOW_OPERATOR), And(task, COMMON_HIGH_OPERATOR));
+    task = Select(bit12, taskBit12, Select(bit13, taskBit13, task));
+    stream = newStream;
+}
+
+inline void Store(std::vector<uint16_t> &column, size_t index, __m128i value)
+{
+    _mm_storeu_si128(ReinterpretConvert<__m128i *>(column.data() + index), value);
+}
+#endif
+}
+
+const size_t StarsBatchDecoder::HEADER_SIZE;
+
+bool StarsHeaderColumns::Resize(size_t count)
+{
+    return Utils::Resize(funcType, count) && Utils::Resize(cnt, count) && Utils::Resize(highBits, count) &&
+           Utils::Resize(magicNum, count) && Utils::Resize(streamId, count) && Utils::Resize(taskId, count) &&
+           Utils::Resize(timestamp, count);
+}
+
+bool StarsBatchDecoder::Decode(const uint8_t *records, size_t count, size_t stride, uint16_t expandStatus,
+                               StarsIdRule idRule, StarsHeaderColumns &columns)
+{
+    if (stride < HEADER_SIZE || (records == nullptr && count != 0)) {
+        ERROR("Invalid stars records to decode, stride is %.", stride);
+        return false;
+    }
+    if (!columns.Resize(count)) {
+        ERROR("Resize stars header columns failed, count is %.", count);
+        return false;
+    }
+    auto decoded = DecodeSimd(records, count, stride, expandStatus, idRule, columns);
+    DecodeScalar(records, decoded, count, stride, expandStatus, idRule, columns);
+    return true;
+}
+
+void StarsBatchDecoder::DecodeScalar(const uint8_t *records, size_t begin, size_t end, size_t stride,
+                                     uint16_t expandStatus, StarsIdRule idRule, StarsHeaderColumns &columns)
+{
+    for (size_t i = begin; i < end; ++i) {
+        const uint8_t *record = records + i * stride;
+        auto head = LoadField<uint16_t>(record, 0);
+        auto stream = LoadField<uint16_t>(record, STREAM_ID_OFFSET);
+        auto task = LoadField<uint16_t>(record, TASK_ID_OFFSET);
+        columns.funcType[i] = head & FUNC_TYPE_MASK;
+        columns.cnt[i] = (head >> CNT_SHIFT) & CNT_MASK;
+        columns.highBits[i] = head >> HIGH_BITS_SHIFT;
+        columns.magicNum[i] = LoadField<uint16_t>(record, MAGIC_OFFSET);
+        columns.timestamp[i] = LoadField<uint64_t>(record, TIMESTAMP_OFFSET);
+        if (idRule == STARS_ID_RAW) {
+            columns.streamId[i] = stream;
+            columns.taskId[i] = task;
+            continue;
+        }
+        uint16_t sqeType = idRule == STARS_ID_WITH_SQE_TYPE ? columns.highBits[i] : 0;
+        columns.streamId[i] = StarsCommon::GetStreamId(stream, task, expandStatus, sqeType);
+        columns.taskId[i] = StarsCommon::GetTaskId(stream, task, expandStatus, sqeType);
+    }
+}
+
+#if defined(__SSE2__)
+size_t StarsBatchDecoder::DecodeSimd(const uint8_t *records, size_t count, size_t stride, uint16_t expandStatus,
+                                     StarsIdRule idRule, StarsHeaderColumns &columns)
+{
+    size_t i = 0;
+    bool expanding = expandStatus == 1;
+    for (; i + SIMD_BATCH <= count; i += SIMD_BATCH) {
+        const uint8_t *base = records + i * stride;
+        __m128i rows[SIMD_BATCH / 2];  // 每行为相邻2条记录的前8字节：h m s t h m s t
+        for (size_t r = 0; r < SIMD_BATCH / 2; ++r) {
+            const uint8_t *first = base + 2 * r * stride;
+            rows[r] = _mm_unpacklo_epi64(_mm_loadl_epi64(ReinterpretConvert<const __m128i *>(first)),
+                                         _mm_loadl_epi64(ReinterpretConvert<const __m128i *>(first + stride)));
+            auto ts = _mm_unpacklo_epi64(
+                _mm_loadl_epi64(ReinterpretConvert<const __m128i *>(first + TIMESTAMP_OFFSET)),
+                _mm_loadl_epi64(ReinterpretConvert<const __m128i *>(first + stride + TIMESTAMP_OFFSET)));
+            _mm_storeu_si128(ReinterpretConvert<__m128i *>(columns.timestamp.data() + i + 2 * r), ts);
+        }
+        // 8x4的16位转置，得到8条记录的头、magicNum、streamId、taskId四列
+        auto a = _mm_unpacklo_epi16(rows[0], rows[1]);  // h0 h2 m0 m2 s0 s2 t0 t2
+        auto b = _mm_unpackhi_epi16(rows[0], rows[1]);  // h1 h3 m1 m3 s1 s3 t1 t3
+        auto c = _mm_unpacklo_epi16(rows[2], rows[3]);  // 2: 第3行
+        auto d = _mm_unpackhi_epi16(rows[2], rows[3]);  // 3: 第4行
+        auto headMagicLow = _mm_unpacklo_epi16(a, b);   // h0 h1 h2 h3 m0 m1 m2 m3
+        auto streamTaskLow = _mm_unpackhi_epi16(a, b);  // s0 s1 s2 s3 t0 t1 t2 t3
+        auto headMagicHigh = _mm_unpacklo_epi16(c, d);
+        auto streamTaskHigh = _mm_unpackhi_epi16(c, d);
+        auto head = _mm_unpacklo_epi64(headMagicLow, headMagicHigh);
+        auto magic = _mm_unpackhi_epi64(headMagicLow, headMagicHigh);
+        auto stream = _mm_unpacklo_epi64(streamTaskLow, streamTaskHigh);
+        auto task = _mm_unpackhi_epi64(streamTaskLow, streamTaskHigh);
+
+        auto highBits = _mm_srli_epi16(head, HIGH_BITS_SHIFT);
+        Store(columns.funcType, i, And(head, FUNC_TYPE_MASK));
+        Store(columns.cnt, i, And(_mm_srli_epi16(head, CNT_SHIFT), CNT_MASK));
+        Store(columns.highBits, i, highBits);
+        Store(columns.magicNum, i, magic);
+        if (idRule != STARS_ID_RAW) {
+            RemapIds(stream, task, idRule == STARS_ID_WITH_SQE_TYPE ? highBits : _mm_setzero_si128(), expanding);
+        }
+        Store(columns.streamId, i, stream);
+        Store(columns.taskId, i, task);
+    }
+    return i;
+}
+#else
+size_t StarsBatchDecoder::DecodeSimd(const uint8_t *, size_t, size_t, uint16_t, StarsIdRule, StarsHeaderColumns &)
+{
+    return 0;
+}
+#endif
+}
+}
@@ -0,0 +1,65 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#ifndef ANALYSIS_DOMAIN_SERVICES_PARSER_PARSER_ITEM_STARS_BATCH_DECODER_H
+#define ANALYSIS_DOMAIN_SERVICES_PARSER_PARSER_ITEM_STARS_BATCH_DECODER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Analysis {
+namespace Domain {
+// STARS定长记录(stars_soc、ffts_profile)公共前16字节的列式解码结果：
+//   16位头(funcType:6 | cnt:4 | 高6位) | 16位magicNum | 16位streamId | 16位taskId | 64位时间戳
+// 下游按列消费，避免逐条记录的位域拆解
+struct StarsHeaderColumns {
+    std::vector<uint16_t> funcType;
+    std::vector<uint16_t> cnt;
+    std::vector<uint16_t> highBits;     // 头部高6位，acsq log中为taskType(sqeType)
+    std::vector<uint16_t> magicNum;
+    std::vector<uint16_t> streamId;     // 按StarsCommon规则换算后的值，STARS_ID_RAW时为原始值
+    std::vector<uint16_t> taskId;
+    std::vector<uint64_t> timestamp;    // 偏移8字节处的64位字段，acsq log中为时间戳
+
+    bool Resize(size_t count);
+    size_t Size() const { return funcType.size(); }
+};
+
+enum StarsIdRule {
+    STARS_ID_RAW = 0,        // 保留原始streamId/taskId，如V6中二者合为32位taskId
+    STARS_ID_COMMON,         // StarsCommon规则，不区分sqeType
+    STARS_ID_WITH_SQE_TYPE   // StarsCommon规则，头部高6位作为sqeType参与换算
+};
+
+// 批量解码count条连续的定长记录，stride为单条记录大小(不小于16字节)
+// x86使用SSE2每次转置8条记录的公共头并用掩码完成streamId/taskId换算，其余平台使用逐条的标量实现，两者结果一致
+class StarsBatchDecoder {
+public:
+    static bool Decode(const uint8_t *records, size_t count, size_t stride, uint16_t expandStatus,
+                       StarsIdRule idRule, StarsHeaderColumns &columns);
+
+    static const size_t HEADER_SIZE = 16;
+
+private:
+    static void DecodeScalar(const uint8_t *records, size_t begin, size_t end, size_t stride,
+                             uint16_t expandStatus, StarsIdRule idRule, StarsHeaderColumns &columns);
+    static size_t DecodeSimd(const uint8_t *records, size_t count, size_t stride, uint16_t expandStatus,
+                             StarsIdRule idRule, StarsHeaderColumns &columns);
+};
+}
+}
+#endif // ANALYSIS_DOMAIN_SERVICES_PARSER_PARSER_ITEM_STARS_BATCH_DECODER_H
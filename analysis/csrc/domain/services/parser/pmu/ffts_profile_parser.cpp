@@ -17,6 +17,8 @@
 #include "analysis/csrc/domain/services/parser/pmu/include/ffts_profile_parser.h"
 #include "analysis/csrc/domain/services/parser/parser_error_code.h"
 #include "analysis/csrc/domain/services/parser/parser_item_factory.h"
+#include "analysis/csrc/domain/services/parser/parser_item/block_pmu_parser_item.h"
+#include "analysis/csrc/domain/services/parser/parser_item/chip4_pmu_parser_item.h"
 #include "analysis/csrc/infrastructure/resource/chip_id.h"
 #include "analysis/csrc/infrastructure/process/include/process_register.h"
 #include "analysis/csrc/infrastructure/resource/binary_struct_info.h"
@@ -62,16 +64,35 @@ uint32_t FftsProfileParser::ParseDataItem(uint8_t* binaryData, uint32_t binaryDa
         WARN("There is no Parser function to handle data! funcType is %", header->funcType);
         return ANALYSIS_OK;
     }
-    int currentCnt = parser(binaryData, binaryDataSize, data, expandStatus);
+    VerifyCnt(parser(binaryData, binaryDataSize, data, expandStatus));
+    return ANALYSIS_OK;
+}
+
+void FftsProfileParser::VerifyCnt(int currentCnt)
+{
     if (cnt_ == DEFAULT_CNT) {
         cnt_ = currentCnt;
-        return ANALYSIS_OK;
+        return;
     }
     if (currentCnt != cnt_ + 1 && cnt_ - currentCnt != VALID_CNT) {
         WARN("CNT verification failed. prevCnt: %; nowCnt: %", cnt_, currentCnt);
     }
     cnt_ = currentCnt;
-    return ANALYSIS_OK;
+}
+
+bool FftsProfileParser::ParsePmuColumns(const StarsHeaderColumns &columns, size_t index, uint8_t *binaryData,
+                                        uint32_t trunkSize, uint8_t *data)
+{
+    auto funcType = columns.funcType[index];
+    if (funcType == PARSER_ITEM_CONTEXT_PMU && trunkSize == sizeof(ContextPmu)) {
+        VerifyCnt(Chip4PmuParseColumns(columns, index, binaryData, data));
+        return true;
+    }
+    if (funcType == PARSER_ITEM_BLOCK_PMU && trunkSize == sizeof(BlockPmu)) {
+        VerifyCnt(BlockPmuParseColumns(columns, index, binaryData, data));
+        return true;
+    }
+    return false;
 }
 
 uint32_t FftsProfileParser::ParseData(DataInventory &dataInventory, const Infra::Context &context)
@@ -85,10 +106,21 @@ uint32_t FftsProfileParser::ParseData(DataInventory &dataInventory, const Infra:
         ERROR("Resize for FftsProfile data failed!");
         return ANALYSIS_ERROR;
     }
+    // 公共头按列批量解码，PMU记录的streamId/taskId直接取自列，其余类型仍按funcType分发
+    StarsHeaderColumns columns;
+    if (!StarsBatchDecoder::Decode(this->binaryData.get(), structCount, trunkSize, expandStatus, STARS_ID_COMMON,
+                                   columns)) {
+        ERROR("Decode FftsProfile data failed!");
+        return ANALYSIS_ERROR;
+    }
     int stat{ANALYSIS_OK};
     for (uint64_t i = 0; i < structCount; i++) {
-        auto res = this->ParseDataItem(&this->binaryData[i * trunkSize], trunkSize,
-                                       ReinterpretConvert<uint8_t *>(&this->halUniData_[i]), expandStatus);
+        auto *record = &this->binaryData[i * trunkSize];
+        auto *item = ReinterpretConvert<uint8_t *>(&this->halUniData_[i]);
+        if (ParsePmuColumns(columns, i, record, trunkSize, item)) {
+            continue;
+        }
+        auto res = this->ParseDataItem(record, trunkSize, item, expandStatus);
         if (res != ANALYSIS_OK) {
             stat = ANALYSIS_ERROR;
             ERROR("FftsProfileData parse error in %th", i);
@@ -20,6 +20,7 @@
 #include <vector>
 #include "analysis/csrc/domain/services/parser/parser.h"
 #include "analysis/csrc/domain/entities/hal/include/hal_pmu.h"
+#include "analysis/csrc/domain/services/parser/parser_item/stars_batch_decoder.h"
 
 namespace Analysis {
 
@@ -29,6 +30,12 @@ class FftsProfileParser : public Parser {
 private:
     uint32_t ParseDataItem(uint8_t* binaryData, uint32_t binaryDataSize, uint8_t* data, uint16_t expandStatus);
 
+    // context/block级别PMU的streamId/taskId取自批量解码的列，返回是否命中
+    bool ParsePmuColumns(const StarsHeaderColumns &columns, size_t index, uint8_t *binaryData, uint32_t trunkSize,
+                         uint8_t *data);
+
+    void VerifyCnt(int currentCnt);
+
     std::vector<std::string> GetFilePattern() override;
 
     uint32_t GetTrunkSize() override;
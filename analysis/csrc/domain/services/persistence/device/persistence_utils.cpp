@@ -16,10 +16,42 @@
 
 #include "analysis/csrc/domain/services/persistence/device/persistence_utils.h"
 
+#include <atomic>
+#include <cstdlib>
+#include <set>
+
 namespace Analysis {
 namespace Domain {
 namespace {
 const uint64_t MILLI_SECOND = 1000;
+// 与TaskProcessor、AccPmuProcessor、AicoreFreqProcessor、CommunicationInfoProcessor中LoadColumnFile读取的表保持一致
+const std::set<std::string> COLUMN_READER_TABLES{
+    "AscendTask", "AccPmu", "FreqParse", "HCCLTaskSingleDevice", "HCCLOpSingleDevice",
+};
+
+std::atomic<bool>& SqliteViewFlag()
+{
+    static std::atomic<bool> flag([]() {
+        const char* value = std::getenv(SQLITE_VIEW_ENV.c_str());
+        return value != nullptr && std::string(value) == "1";
+    }());
+    return flag;
+}
+}
+
+bool IsSqliteViewEnabled()
+{
+    return SqliteViewFlag().load(std::memory_order_relaxed);
+}
+
+void SetSqliteViewEnabled(bool enabled)
+{
+    SqliteViewFlag().store(enabled, std::memory_order_relaxed);
+}
+
+bool HasColumnReader(const std::string& tableName)
+{
+    return COLUMN_READER_TABLES.find(tableName) != COLUMN_READER_TABLES.end();
 }
 
 SyscntConversionParams GenerateSyscntConversionParams(const DeviceContext& context)
@@ -18,6 +18,7 @@
 #define ANALYSIS_DOMAIN_SERVICES_PERSISTENCE_PERSISTENCE_UTILS_H
 
 #include "analysis/csrc/domain/services/device_context/device_context.h"
+#include "analysis/csrc/infrastructure/db/include/column_file.h"
 #include "analysis/csrc/infrastructure/db/include/database.h"
 #include "analysis/csrc/infrastructure/db/include/db_runner.h"
 #include "analysis/csrc/infrastructure/utils/time_utils.h"
@@ -40,6 +41,16 @@ struct DBInfo
     virtual ~DBInfo() = default;
 };
 
+// 只有导出阶段有列式读取的表才写列式文件，其余表仍只写sqlite
+// 列式表默认只写列式文件，C++导出直接读取列式文件；python侧导出仍读取sqlite，
+// 需要时由调用方按需开启sqlite视图(dump_device_data的sqlite_view参数或设置该环境变量为1)，此时额外写一份sqlite
+const std::string SQLITE_VIEW_ENV = "MSPROF_ANALYSIS_SQLITE_VIEW";
+
+bool IsSqliteViewEnabled();
+void SetSqliteViewEnabled(bool enabled);
+// 导出阶段的DataProcessor是否通过LoadColumnFile读取该表
+bool HasColumnReader(const std::string& tableName);
+
 template <typename... Args>
 bool SaveData(const std::vector<std::tuple<Args...>>& data, DBInfo& dbInfo, std::string& dbPath)
 {
@@ -54,12 +65,32 @@ bool SaveData(const std::vector<std::tuple<Args...>>& data, DBInfo& dbInfo, std:
         ERROR("Msprof db database is nullptr.");
         return false;
     }
+    auto cols = dbInfo.database->GetTableCols(dbInfo.tableName);
+    std::vector<std::string> colNames;
+    for (const auto& col : cols)
+    {
+        colNames.emplace_back(col.name);
+    }
+    // 导出阶段的DataProcessor优先读取列式文件，没有列式读取的表只写sqlite
+    if (HasColumnReader(dbInfo.tableName))
+    {
+        ColumnFileWriter writer(GetColumnFilePath(dbPath, dbInfo.tableName));
+        if (!writer.Append(colNames, data))
+        {
+            ERROR("Save % into column file failed.", dbInfo.tableName);
+            return false;
+        }
+        if (!IsSqliteViewEnabled())
+        {
+            return true;
+        }
+    }
     if (dbInfo.dbRunner == nullptr)
     {
         ERROR("Msprof db runner is nullptr.");
         return false;
     }
-    if (!dbInfo.dbRunner->CreateTable(dbInfo.tableName, dbInfo.database->GetTableCols(dbInfo.tableName)))
+    if (!dbInfo.dbRunner->CreateTable(dbInfo.tableName, cols))
     {
         ERROR("Create table: % failed", dbInfo.tableName);
         return false;
@@ -66,6 +66,17 @@ class BaseDumper
         return false;
     };
 
+    // 删除已存在的表，用于每次全量重写的数据(如hash字典)
+    bool ResetTable()
+    {
+        DBRunner dbRunner(Utils::File::PathJoin({dbPath_, database_->GetDBName()}));
+        if (!dbRunner.CheckTableExists(tableName_))
+        {
+            return true;
+        }
+        return dbRunner.DropTable(tableName_);
+    }
+
     BaseDumper(const std::string &hostPath, std::string tableName) : tableName_(std::move(tableName))
     {
         dbPath_ = Utils::File::PathJoin({hostPath, Analysis::Common::SQLITE});
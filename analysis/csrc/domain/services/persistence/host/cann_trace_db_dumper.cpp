@@ -347,7 +347,7 @@ void CANNTraceDBDumper::AddTaskInfoForOnlyTaskTrack(const std::shared_ptr<HostTa
                                                     bool isLevel0)
 {
     // treeAnalyze中通过白名单控制,此时无kernelName算子为非预期算子
-    auto info = RTAddInfoCenter::GetInstance().Get(task->deviceId, task->streamId, task->taskId);
+    const auto &info = RTAddInfoCenter::GetInstance().Get(task->deviceId, task->streamId, task->taskId);
     if (task->kernelName == 0 && !info.isValid)
     {
         WARN("Can't get task's kernel name, streamId is %, taskId is %, batch id is %, timestamp is %.", task->streamId,
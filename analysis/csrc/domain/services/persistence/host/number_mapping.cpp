@@ -276,11 +276,13 @@ std::string NumberMapping::Get(MappingType type, uint32_t key)
         ERROR("wrong mapping type %, please check code", enumValue);
         return std::to_string(key);
     }
-    if (allMaps.at(enumValue).find(key) == allMaps.at(enumValue).end()) {
+    const auto &mapping = allMaps[enumValue];
+    auto it = mapping.find(key);
+    if (it == mapping.end()) {
         ERROR("Unknown key: %, type: %", key, enumValue);
         return std::to_string(key);
     }
-    return allMaps.at(enumValue).at(key);
+    return it->second;
 }
 } // Domain
 } // Analysis
@@ -0,0 +1,462 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#ifndef MSPROF_ANALYSIS_TASK_JOIN_H
+#define MSPROF_ANALYSIS_TASK_JOIN_H
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "analysis/csrc/domain/valueobject/include/task_id.h"
+#include "analysis/csrc/infrastructure/utils/utils.h"
+
+namespace Analysis {
+namespace Domain {
+constexpr int TASK_KEY_DEVICE_SHIFT = 48;
+constexpr int TASK_KEY_TASK_SHIFT = 16;
+constexpr int TASK_KEY_CONTEXT_SHIFT = 16;
+constexpr uint64_t TASK_KEY_FIELD16_MASK = 0xFFFF;
+constexpr uint64_t TASK_KEY_FIELD32_MASK = 0xFFFFFFFF;
+constexpr size_t INVALID_JOIN_ROW = SIZE_MAX;
+constexpr size_t TASK_KEY_INDEX_PARTITION_ROWS = 4096;
+constexpr uint32_t TASK_KEY_INDEX_MAX_PARTITION_BITS = 12;
+
+// TaskId打包后的联合键
+// high: deviceId(16) | taskId(32) | streamId(16)，low: contextId(32) | batchId(16)
+// 按(high, low)比较的顺序与TaskId::operator<一致，有序的TaskId容器打包后仍有序
+struct TaskKey {
+    uint64_t high = 0;
+    uint64_t low = 0;
+
+    bool operator==(const TaskKey &other) const
+    {
+        return high == other.high && low == other.low;
+    }
+
+    bool operator!=(const TaskKey &other) const
+    {
+        return !(*this == other);
+    }
+
+    bool operator<(const TaskKey &other) const
+    {
+        return high < other.high || (high == other.high && low < other.low);
+    }
+};
+
+inline TaskKey PackTaskKey(uint16_t deviceId, uint16_t streamId, uint16_t batchId, uint32_t taskId,
+                           uint32_t contextId)
+{
+    TaskKey key;
+    key.high = (static_cast<uint64_t>(deviceId) << TASK_KEY_DEVICE_SHIFT) |
+               (static_cast<uint64_t>(taskId) << TASK_KEY_TASK_SHIFT) | streamId;
+    key.low = (static_cast<uint64_t>(contextId) << TASK_KEY_CONTEXT_SHIFT) | batchId;
+    return key;
+}
+
+inline TaskKey PackTaskKey(const TaskId &id)
+{
+    return PackTaskKey(id.deviceId, id.streamId, id.batchId, id.taskId, id.contextId);
+}
+
+inline TaskId UnpackTaskKey(const TaskKey &key)
+{
+    return TaskId(static_cast<uint16_t>(key.high & TASK_KEY_FIELD16_MASK),
+                  static_cast<uint16_t>(key.low & TASK_KEY_FIELD16_MASK),
+                  static_cast<uint32_t>((key.high >> TASK_KEY_TASK_SHIFT) & TASK_KEY_FIELD32_MASK),
+                  static_cast<uint32_t>((key.low >> TASK_KEY_CONTEXT_SHIFT) & TASK_KEY_FIELD32_MASK),
+                  static_cast<uint16_t>(key.high >> TASK_KEY_DEVICE_SHIFT));
+}
+
+inline uint64_t HashTaskKey(const TaskKey &key)
+{
+    // splitmix64的混合函数，高位同样分布均匀，分区取高位、桶取低位
+    auto mix = [](uint64_t value) {
+        value ^= value >> 30;
+        value *= 0xBF58476D1CE4E5B9ULL;
+        value ^= value >> 27;
+        value *= 0x94D049BB133111EBULL;
+        return value ^ (value >> 31);
+    };
+    return mix(key.high ^ mix(key.low + 0x9E3779B97F4A7C15ULL));
+}
+
+struct TaskKeyHasher {
+    std::size_t operator()(const TaskKey &key) const
+    {
+        return static_cast<std::size_t>(HashTaskKey(key));
+    }
+};
+
+// 一个键在某一侧数据中的行号，按行号升序(as-of连接中按时间升序)
+struct JoinRows {
+    const size_t *begin = nullptr;
+    const size_t *end = nullptr;
+
+    size_t Size() const
+    {
+        return static_cast<size_t>(end - begin);
+    }
+
+    bool Empty() const
+    {
+        return begin == end;
+    }
+};
+
+// 按TaskKey分组的行号索引
+// 先按hash高位把行划分到若干分区，每个分区使用独立的开放寻址表，分区大小控制在缓存可容纳的范围内
+class TaskKeyIndex {
+public:
+    bool Build(const std::vector<TaskKey> &keys);
+    size_t FindGroup(const TaskKey &key) const;
+    JoinRows Find(const TaskKey &key) const
+    {
+        auto group = FindGroup(key);
+        return group == INVALID_JOIN_ROW ? JoinRows() : GroupRows(group);
+    }
+    size_t GroupCount() const
+    {
+        return groups_.size();
+    }
+    size_t GroupOfRow(size_t row) const
+    {
+        return rowGroup_[row];
+    }
+    JoinRows GroupRows(size_t group) const
+    {
+        JoinRows rows;
+        rows.begin = rows_.data() + groups_[group].begin;
+        rows.end = rows.begin + groups_[group].count;
+        return rows;
+    }
+    // 组内行号按cmp重新排序
+    template<typename Compare>
+    void SortGroupRows(Compare cmp)
+    {
+        for (const auto &group : groups_) {
+            auto begin = rows_.begin() + static_cast<std::ptrdiff_t>(group.begin);
+            std::stable_sort(begin, begin + static_cast<std::ptrdiff_t>(group.count), cmp);
+        }
+    }
+
+private:
+    struct Group {
+        explicit Group(const TaskKey &_key) : key(_key) {}
+        TaskKey key;
+        size_t begin = 0;
+        size_t count = 0;
+    };
+
+    size_t Partition(uint64_t hash) const
+    {
+        return partitionBits_ == 0 ? 0 : static_cast<size_t>(hash >> (64 - partitionBits_));  // 64: hash位宽
+    }
+
+private:
+    uint32_t partitionBits_ = 0;
+    std::vector<Group> groups_;
+    std::vector<size_t> rowGroup_;   // 每行所属的组
+    std::vector<size_t> rows_;       // 按组连续存放的行号
+    std::vector<size_t> slots_;      // 各分区的开放寻址表首尾相接，存放组下标
+    std::vector<size_t> slotBegin_;  // 每个分区在slots_中的起点，共分区数+1项
+};
+
+inline bool TaskKeyIndex::Build(const std::vector<TaskKey> &keys)
+{
+    groups_.clear();
+    const size_t rowNum = keys.size();
+    partitionBits_ = 0;
+    while ((rowNum >> partitionBits_) > TASK_KEY_INDEX_PARTITION_ROWS &&
+           partitionBits_ < TASK_KEY_INDEX_MAX_PARTITION_BITS) {
+        ++partitionBits_;
+    }
+    const size_t partitionNum = static_cast<size_t>(1) << partitionBits_;
+    std::vector<uint64_t> hashes;
+    std::vector<size_t> partitionRows;
+    std::vector<size_t> offsets;
+    if (!Utils::Resize(hashes, rowNum) || !Utils::Resize(partitionRows, rowNum) ||
+        !Utils::Resize(offsets, partitionNum + 1) || !Utils::Resize(rowGroup_, rowNum) ||
+        !Utils::Resize(rows_, rowNum) || !Utils::Resize(slotBegin_, partitionNum + 1)) {
+        ERROR("Alloc memory for task key index failed, row num is %.", rowNum);
+        return false;
+    }
+    std::fill(offsets.begin(), offsets.end(), 0);
+    for (size_t row = 0; row < rowNum; ++row) {
+        hashes[row] = HashTaskKey(keys[row]);
+        ++offsets[Partition(hashes[row]) + 1];
+    }
+    // 每个分区的表容量取不小于2倍行数的2的幂，装载率不超过0.5
+    slotBegin_[0] = 0;
+    for (size_t partition = 0; partition < partitionNum; ++partition) {
+        size_t partitionRowNum = offsets[partition + 1];
+        size_t capacity = 0;
+        if (partitionRowNum > 0) {
+            capacity = 1;
+            while (capacity < partitionRowNum * 2) {  // 2: 装载率的倒数
+                capacity <<= 1;
+            }
+        }
+        slotBegin_[partition + 1] = slotBegin_[partition] + capacity;
+        offsets[partition + 1] += offsets[partition];
+    }
+    if (!Utils::Resize(slots_, slotBegin_[partitionNum])) {
+        ERROR("Alloc memory for task key index failed, row num is %.", rowNum);
+        return false;
+    }
+    std::fill(slots_.begin(), slots_.end(), INVALID_JOIN_ROW);
+    // 稳定地按分区排列行号，组内行号保持升序
+    std::vector<size_t> cursor(offsets.begin(), offsets.end() - 1);
+    for (size_t row = 0; row < rowNum; ++row) {
+        partitionRows[cursor[Partition(hashes[row])]++] = row;
+    }
+    for (size_t partition = 0; partition < partitionNum; ++partition) {
+        const size_t base = slotBegin_[partition];
+        const size_t mask = slotBegin_[partition + 1] - base - 1;
+        for (size_t i = offsets[partition]; i < offsets[partition + 1]; ++i) {
+            const size_t row = partitionRows[i];
+            size_t slot = static_cast<size_t>(hashes[row]) & mask;
+            while (slots_[base + slot] != INVALID_JOIN_ROW && groups_[slots_[base + slot]].key != keys[row]) {
+                slot = (slot + 1) & mask;
+            }
+            if (slots_[base + slot] == INVALID_JOIN_ROW) {
+                slots_[base + slot] = groups_.size();
+                groups_.emplace_back(keys[row]);
+            }
+            rowGroup_[row] = slots_[base + slot];
+            ++groups_[rowGroup_[row]].count;
+        }
+    }
+    size_t begin = 0;
+    for (auto &group : groups_) {
+        group.begin = begin;
+        begin += group.count;
+        group.count = 0;
+    }
+    for (size_t i = 0; i < rowNum; ++i) {
+        auto &group = groups_[rowGroup_[partitionRows[i]]];
+        rows_[group.begin + group.count++] = partitionRows[i];
+    }
+    return true;
+}
+
+inline size_t TaskKeyIndex::FindGroup(const TaskKey &key) const
+{
+    if (slotBegin_.empty()) {
+        return INVALID_JOIN_ROW;
+    }
+    const uint64_t hash = HashTaskKey(key);
+    const size_t partition = Partition(hash);
+    const size_t base = slotBegin_[partition];
+    const size_t capacity = slotBegin_[partition + 1] - base;
+    if (capacity == 0) {
+        return INVALID_JOIN_ROW;
+    }
+    size_t slot = static_cast<size_t>(hash) & (capacity - 1);
+    while (slots_[base + slot] != INVALID_JOIN_ROW) {
+        if (groups_[slots_[base + slot]].key == key) {
+            return slots_[base + slot];
+        }
+        slot = (slot + 1) & (capacity - 1);
+    }
+    return INVALID_JOIN_ROW;
+}
+
+// 基于TaskKey的连接
+// Join: 全外连接，每个键回调一次visitor(key, leftRows, rightRows)，未匹配的一侧为空，可处理一对多、多对多
+//       两侧均已按键有序时走sort-merge，按键升序回调；否则走分区hash join，
+//       先按left中键首次出现的顺序回调，再按right中首次出现的顺序回调仅right存在的键
+// MergeJoin: 对两段已按键有序的区间做全外连接，可直接用于std::map等有序容器
+// AsOfJoin: 为left每行在right同键的行中查找时间不晚于它的最近一行，时间差超过window视为未匹配
+class TaskJoin {
+public:
+    template<typename L, typename R, typename LeftKey, typename RightKey, typename Visitor>
+    static bool Join(const std::vector<L> &left, const std::vector<R> &right, LeftKey leftKey, RightKey rightKey,
+                     Visitor &&visitor)
+    {
+        std::vector<TaskKey> leftKeys;
+        std::vector<TaskKey> rightKeys;
+        if (!CollectKeys(left, leftKey, leftKeys) || !CollectKeys(right, rightKey, rightKeys)) {
+            return false;
+        }
+        if (IsSorted(leftKeys) && IsSorted(rightKeys)) {
+            return SortMergeJoin(leftKeys, rightKeys, visitor);
+        }
+        return HashJoin(leftKeys, rightKeys, visitor);
+    }
+
+    // visitor(key, leftBegin, leftEnd, rightBegin, rightEnd)
+    template<typename LeftIt, typename RightIt, typename LeftKey, typename RightKey, typename Visitor>
+    static void MergeJoin(LeftIt leftBegin, LeftIt leftEnd, RightIt rightBegin, RightIt rightEnd, LeftKey leftKey,
+                          RightKey rightKey, Visitor &&visitor)
+    {
+        auto left = leftBegin;
+        auto right = rightBegin;
+        while (left != leftEnd || right != rightEnd) {
+            bool takeLeft = left != leftEnd;
+            bool takeRight = right != rightEnd;
+            TaskKey key;
+            if (takeLeft && takeRight) {
+                TaskKey lKey = leftKey(*left);
+                TaskKey rKey = rightKey(*right);
+                takeLeft = !(rKey < lKey);
+                takeRight = !(lKey < rKey);
+                key = takeLeft ? lKey : rKey;
+            } else {
+                key = takeLeft ? leftKey(*left) : rightKey(*right);
+            }
+            auto leftRunEnd = left;
+            while (takeLeft && leftRunEnd != leftEnd && leftKey(*leftRunEnd) == key) {
+                ++leftRunEnd;
+            }
+            auto rightRunEnd = right;
+            while (takeRight && rightRunEnd != rightEnd && rightKey(*rightRunEnd) == key) {
+                ++rightRunEnd;
+            }
+            visitor(key, left, leftRunEnd, right, rightRunEnd);
+            left = leftRunEnd;
+            right = rightRunEnd;
+        }
+    }
+
+    // visitor(leftRow, rightRow)，未匹配时rightRow为INVALID_JOIN_ROW
+    template<typename L, typename R, typename LeftKey, typename RightKey, typename LeftTime, typename RightTime,
+             typename TimeType, typename Visitor>
+    static bool AsOfJoin(const std::vector<L> &left, const std::vector<R> &right, LeftKey leftKey, RightKey rightKey,
+                         LeftTime leftTime, RightTime rightTime, TimeType window, Visitor &&visitor)
+    {
+        std::vector<TaskKey> rightKeys;
+        TaskKeyIndex index;
+        if (!CollectKeys(right, rightKey, rightKeys) || !index.Build(rightKeys)) {
+            return false;
+        }
+        index.SortGroupRows([&right, &rightTime](size_t lhs, size_t rhs) {
+            return rightTime(right[lhs]) < rightTime(right[rhs]);
+        });
+        for (size_t row = 0; row < left.size(); ++row) {
+            auto rows = index.Find(leftKey(left[row]));
+            TimeType time = leftTime(left[row]);
+            // 二分查找最后一个时间不晚于time的行
+            size_t low = 0;
+            size_t high = rows.Size();
+            while (low < high) {
+                size_t mid = low + (high - low) / 2;  // 2: 二分
+                if (rightTime(right[rows.begin[mid]]) <= time) {
+                    low = mid + 1;
+                } else {
+                    high = mid;
+                }
+            }
+            size_t matched = INVALID_JOIN_ROW;
+            if (low > 0 && time - rightTime(right[rows.begin[low - 1]]) <= window) {
+                matched = rows.begin[low - 1];
+            }
+            visitor(row, matched);
+        }
+        return true;
+    }
+
+    static bool IsSorted(const std::vector<TaskKey> &keys)
+    {
+        for (size_t i = 1; i < keys.size(); ++i) {
+            if (keys[i] < keys[i - 1]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    template<typename T, typename KeyOf>
+    static bool CollectKeys(const std::vector<T> &data, KeyOf keyOf, std::vector<TaskKey> &keys)
+    {
+        if (!Utils::Resize(keys, data.size())) {
+            ERROR("Alloc memory for task keys failed, size is %.", data.size());
+            return false;
+        }
+        for (size_t i = 0; i < data.size(); ++i) {
+            keys[i] = keyOf(data[i]);
+        }
+        return true;
+    }
+
+    template<typename Visitor>
+    static bool SortMergeJoin(const std::vector<TaskKey> &leftKeys, const std::vector<TaskKey> &rightKeys,
+                              Visitor &visitor)
+    {
+        std::vector<size_t> leftRows;
+        std::vector<size_t> rightRows;
+        if (!Utils::Resize(leftRows, leftKeys.size()) || !Utils::Resize(rightRows, rightKeys.size())) {
+            ERROR("Alloc memory for sort merge join failed.");
+            return false;
+        }
+        std::iota(leftRows.begin(), leftRows.end(), 0);
+        std::iota(rightRows.begin(), rightRows.end(), 0);
+        using RowIt = std::vector<size_t>::const_iterator;
+        MergeJoin(leftRows.cbegin(), leftRows.cend(), rightRows.cbegin(), rightRows.cend(),
+                  [&leftKeys](size_t row) { return leftKeys[row]; },
+                  [&rightKeys](size_t row) { return rightKeys[row]; },
+                  [&](const TaskKey &key, RowIt leftBegin, RowIt leftEnd, RowIt rightBegin, RowIt rightEnd) {
+                      JoinRows lRows;
+                      lRows.begin = leftRows.data() + (leftBegin - leftRows.cbegin());
+                      lRows.end = leftRows.data() + (leftEnd - leftRows.cbegin());
+                      JoinRows rRows;
+                      rRows.begin = rightRows.data() + (rightBegin - rightRows.cbegin());
+                      rRows.end = rightRows.data() + (rightEnd - rightRows.cbegin());
+                      visitor(key, lRows, rRows);
+                  });
+        return true;
+    }
+
+    template<typename Visitor>
+    static bool HashJoin(const std::vector<TaskKey> &leftKeys, const std::vector<TaskKey> &rightKeys, Visitor &visitor)
+    {
+        TaskKeyIndex leftIndex;
+        TaskKeyIndex rightIndex;
+        if (!leftIndex.Build(leftKeys) || !rightIndex.Build(rightKeys)) {
+            return false;
+        }
+        std::vector<bool> rightMatched(rightIndex.GroupCount(), false);
+        // 每组只在其首行处回调一次
+        for (size_t row = 0; row < leftKeys.size(); ++row) {
+            auto leftRows = leftIndex.GroupRows(leftIndex.GroupOfRow(row));
+            if (*leftRows.begin != row) {
+                continue;
+            }
+            JoinRows rightRows;
+            auto rightGroup = rightIndex.FindGroup(leftKeys[row]);
+            if (rightGroup != INVALID_JOIN_ROW) {
+                rightRows = rightIndex.GroupRows(rightGroup);
+                rightMatched[rightGroup] = true;
+            }
+            visitor(leftKeys[row], leftRows, rightRows);
+        }
+        for (size_t row = 0; row < rightKeys.size(); ++row) {
+            auto rightGroup = rightIndex.GroupOfRow(row);
+            auto rightRows = rightIndex.GroupRows(rightGroup);
+            if (*rightRows.begin != row || rightMatched[rightGroup]) {
+                continue;
+            }
+            visitor(rightKeys[row], JoinRows(), rightRows);
+        }
+        return true;
+    }
+};
+}
+}
+#endif // MSPROF_ANALYSIS_TASK_JOIN_H
@@ -15,11 +15,217 @@
  * -------------------------------------------------------------------------*/
 #include "analysis/csrc/infrastructure/data_inventory/include/data_inventory.h"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
+#include "analysis/csrc/infrastructure/utils/file.h"
+
 using namespace Analysis;
 
 namespace Analysis {
 
 namespace Infra {
+namespace {
+const mode_t SPILL_FILE_MODE = 0600;
+
+struct MemoryBudget {
+    std::mutex mutex;
+    uint64_t budget = 0;
+    std::string spillDir;
+    std::atomic<uint64_t> resident{0};
+    std::atomic<uint64_t> peak{0};
+    std::atomic<uint64_t> spillIndex{0};
+};
+
+MemoryBudget &GetBudget()
+{
+    static MemoryBudget budget;
+    return budget;
+}
+
+std::string NewSpillPath()
+{
+    auto &budget = GetBudget();
+    std::string spillDir;
+    {
+        std::lock_guard<std::mutex> lock(budget.mutex);
+        spillDir = budget.spillDir;
+    }
+    if (!Utils::File::Exist(spillDir) && !Utils::File::CreateDir(spillDir)) {
+        ERROR("Create spill dir % failed.", spillDir);
+        return "";
+    }
+    return Utils::File::PathJoin({spillDir, "inventory_" + std::to_string(getpid()) + "_" +
+                                            std::to_string(budget.spillIndex++)});
+}
+
+// 换出目录为所有DataInventory共享，只在目录已空(没有其它实例的换出文件)时删除
+void RemoveSpillDir()
+{
+    auto &budget = GetBudget();
+    std::string spillDir;
+    {
+        std::lock_guard<std::mutex> lock(budget.mutex);
+        spillDir = budget.spillDir;
+    }
+    if (spillDir.empty() || rmdir(spillDir.c_str()) == 0 || errno == ENOENT || errno == ENOTEMPTY ||
+        errno == EEXIST) {
+        return;
+    }
+    WARN("Remove spill dir % failed: %.", spillDir, strerror(errno));
+}
+}
+
+bool SpillWrite(const std::string &path, const void *data, uint64_t bytes)
+{
+    int fd = open(path.c_str(), O_CREAT | O_TRUNC | O_WRONLY, SPILL_FILE_MODE);
+    if (fd < 0) {
+        ERROR("Open spill file % failed: %.", path, strerror(errno));
+        return false;
+    }
+    auto begin = static_cast<const char *>(data);
+    uint64_t written = 0;
+    while (written < bytes) {
+        auto ret = write(fd, begin + written, bytes - written);
+        if (ret <= 0) {
+            ERROR("Write spill file % failed: %.", path, strerror(errno));
+            close(fd);
+            return false;
+        }
+        written += static_cast<uint64_t>(ret);
+    }
+    close(fd);
+    return true;
+}
+
+bool SpillRead(const std::string &path, void *data, uint64_t bytes)
+{
+    if (bytes == 0) {
+        return true;
+    }
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        ERROR("Open spill file % failed: %.", path, strerror(errno));
+        return false;
+    }
+    void *mapped = mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        ERROR("Mmap spill file % failed: %.", path, strerror(errno));
+        return false;
+    }
+    madvise(mapped, bytes, MADV_SEQUENTIAL);
+    std::memcpy(data, mapped, bytes);
+    munmap(mapped, bytes);
+    return true;
+}
+
+void SpillRemove(const std::string &path)
+{
+    if (unlink(path.c_str()) != 0 && errno != ENOENT) {
+        WARN("Remove spill file % failed: %.", path, strerror(errno));
+    }
+}
+
+void DataInventory::SetMemoryBudget(uint64_t budgetBytes, const std::string &spillDir)
+{
+    auto &budget = GetBudget();
+    std::lock_guard<std::mutex> lock(budget.mutex);
+    budget.budget = budgetBytes;
+    budget.spillDir = spillDir;
+    INFO("DataInventory memory budget is % bytes, spill dir is %.", budgetBytes, spillDir);
+}
+
+uint64_t DataInventory::GetResidentBytes()
+{
+    return GetBudget().resident;
+}
+
+uint64_t DataInventory::GetPeakResidentBytes()
+{
+    return GetBudget().peak;
+}
+
+DataInventory::~DataInventory()
+{
+    Clear();
+    RemoveSpillDir();
+}
+
+void DataInventory::Clear()
+{
+    std::lock_guard<std::mutex> lg(mutex_);
+    for (auto &item : data_) {
+        Account(item.second, 0);
+    }
+    data_.clear();
+    frozenView_.Clear();
+    frozen_ = false;
+}
+
+void DataInventory::Account(Entry &entry, uint64_t bytes) const
+{
+    auto &budget = GetBudget();
+    if (bytes >= entry.bytes) {
+        auto resident = budget.resident.fetch_add(bytes - entry.bytes) + (bytes - entry.bytes);
+        auto peak = budget.peak.load();
+        while (resident > peak && !budget.peak.compare_exchange_weak(peak, resident)) {}
+    } else {
+        budget.resident.fetch_sub(entry.bytes - bytes);
+    }
+    entry.bytes = bytes;
+}
+
+void DataInventory::EnforceBudget(std::type_index hotIdx) const
+{
+    auto &budget = GetBudget();
+    uint64_t limit = 0;
+    {
+        std::lock_guard<std::mutex> lock(budget.mutex);
+        limit = budget.budget;
+    }
+    if (limit == 0) {
+        return;
+    }
+    // 调用方可能在GetPtr之后修改了数据，先刷新各数据的大小
+    std::vector<std::pair<uint64_t, std::type_index>> candidates;
+    for (auto &item : data_) {
+        if (item.second.ptr->IsSpilled()) {
+            continue;
+        }
+        Account(item.second, item.second.ptr->ByteSize());
+        if (item.first != hotIdx) {
+            candidates.emplace_back(item.second.lastAccess, item.first);
+        }
+    }
+    if (budget.resident <= limit) {
+        return;
+    }
+    std::sort(candidates.begin(), candidates.end(),
+              [](const std::pair<uint64_t, std::type_index> &lhs, const std::pair<uint64_t, std::type_index> &rhs) {
+                  return lhs.first < rhs.first;
+              });
+    for (const auto &candidate : candidates) {
+        if (budget.resident <= limit) {
+            break;
+        }
+        auto &entry = data_.at(candidate.second);
+        auto bytes = entry.bytes;
+        auto path = NewSpillPath();
+        if (path.empty() || !entry.ptr->Spill(path)) {
+            continue;
+        }
+        Account(entry, 0);
+        INFO("Spill % (% bytes) to %.", candidate.second.name(), bytes, path);
+    }
+}
 
 bool DataInventory::InputToData(std::type_index idx, BaseTypePtr ptr)
 {
@@ -29,18 +235,35 @@ bool DataInventory::InputToData(std::type_index idx, BaseTypePtr ptr)
     }
     
     std::lock_guard<std::mutex> lg(mutex_);
-    auto ret = data_.emplace(idx, ptr);
-    return ret.second;
+    if (frozen_) {
+        ERROR("DataInventory is frozen, inject failed, type name: %", idx.name());
+        return false;
+    }
+    Entry entry;
+    entry.ptr = ptr;
+    entry.lastAccess = ++accessTick_;
+    auto ret = data_.emplace(idx, entry);
+    if (!ret.second) {
+        return false;
+    }
+    Account(ret.first->second, ptr->ByteSize());
+    EnforceBudget(idx);
+    return true;
 }
 
 std::set<std::type_index> DataInventory::RemoveRestData(const std::set<std::type_index>& keepingDataType)
 {
     std::set<std::type_index> removedTypes;
     std::lock_guard<std::mutex> lg(mutex_);
+    if (frozen_) {
+        WARN("DataInventory is frozen, skip removing data.");
+        return removedTypes;
+    }
     for (auto it = data_.begin(); it != data_.end();) {
         if (std::find(keepingDataType.begin(), keepingDataType.end(), it->first) ==
                 std::end(keepingDataType)) {
             removedTypes.insert(it->first);
+            Account(it->second, 0);
             it = data_.erase(it);
             continue;
         }
@@ -49,15 +272,44 @@ std::set<std::type_index> DataInventory::RemoveRestData(const std::set<std::type
     return removedTypes;
 }
 
-BaseTypePtr DataInventory::GetPtr(std::type_index idx) const
+void DataInventory::Freeze()
 {
     std::lock_guard<std::mutex> lg(mutex_);
+    if (frozen_) {
+        return;
+    }
+    frozen_ = true;
+    {
+        auto &budget = GetBudget();
+        std::lock_guard<std::mutex> lock(budget.mutex);
+        if (budget.budget != 0) {
+            INFO("DataInventory memory budget is set, keep locked access after freeze.");
+            return;
+        }
+    }
+    for (const auto &item : data_) {
+        frozenView_.Insert(item.first, item.second.ptr);
+    }
+    frozenView_.Freeze();
+}
+
+BaseTypePtr DataInventory::GetPtr(std::type_index idx) const
+{
     auto it = data_.find(idx);
     if (it == data_.end()) {
         return {};
     }
-
-    return it->second;
+    auto &entry = it->second;
+    entry.lastAccess = ++accessTick_;
+    if (entry.ptr->IsSpilled()) {
+        if (!entry.ptr->Restore()) {
+            ERROR("Restore spilled data failed, type name: %", idx.name());
+            return {};
+        }
+        Account(entry, entry.ptr->ByteSize());
+        EnforceBudget(idx);
+    }
+    return entry.ptr;
 }
 
 }
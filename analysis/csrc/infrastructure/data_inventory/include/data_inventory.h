@@ -19,11 +19,16 @@
 #ifndef ANALYSIS_DEVICE_TASK_DATAINVENTORY_DATA_INVENTORY_H
 #define ANALYSIS_DEVICE_TASK_DATAINVENTORY_DATA_INVENTORY_H
 
+#include <atomic>
 #include <memory>
 #include <set>
 #include <unordered_map>
 #include <typeindex>
+#include <type_traits>
 #include <mutex>
+#include <vector>
+#include "analysis/csrc/infrastructure/utils/byte_size.h"
+#include "analysis/csrc/infrastructure/utils/concurrent_hash_map.h"
 #include "analysis/csrc/infrastructure/utils/utils.h"
 
 using Analysis::Log;
@@ -32,14 +37,104 @@ using Analysis::Format;
 namespace Analysis {
 namespace Infra {
 
+// 换出文件读写，读取时通过mmap映射文件后拷贝回内存
+bool SpillWrite(const std::string &path, const void *data, uint64_t bytes);
+bool SpillRead(const std::string &path, void *data, uint64_t bytes);
+void SpillRemove(const std::string &path);
+
 struct BaseType {
     virtual ~BaseType() = default;
+    // 数据当前占用的内存字节数(含元素持有的字符串等堆内存)
+    virtual uint64_t ByteSize() const { return 0; }
+    virtual bool Spill(const std::string &/*path*/) { return false; }
+    virtual bool Restore() { return true; }
+    virtual bool IsSpilled() const { return false; }
 };
 using BaseTypePtr = std::shared_ptr<BaseType>;
 
+// 数据换出能力，只有元素可平凡拷贝的std::vector支持换出到文件
+template <typename T, typename Enable = void>
+struct SpillTraits {
+    static const bool SPILLABLE = false;
+    static uint64_t ByteSize(const T &obj) { return Utils::ByteSizeOf(obj); }
+    static bool Write(const T &, const std::string &, uint64_t &) { return false; }
+    static bool Read(const std::string &, uint64_t, T &) { return false; }
+};
+
+template <typename T>
+struct SpillTraits<std::vector<T>, typename std::enable_if<!std::is_trivially_copyable<T>::value>::type> {
+    static const bool SPILLABLE = false;
+    static uint64_t ByteSize(const std::vector<T> &vec) { return Utils::ByteSizeOf(vec); }
+    static bool Write(const std::vector<T> &, const std::string &, uint64_t &) { return false; }
+    static bool Read(const std::string &, uint64_t, std::vector<T> &) { return false; }
+};
+
+template <typename T>
+struct SpillTraits<std::vector<T>, typename std::enable_if<std::is_trivially_copyable<T>::value>::type> {
+    static const bool SPILLABLE = true;
+    static uint64_t ByteSize(const std::vector<T> &vec) { return Utils::ByteSizeOf(vec); }
+    static bool Write(const std::vector<T> &vec, const std::string &path, uint64_t &bytes)
+    {
+        bytes = vec.size() * sizeof(T);
+        return SpillWrite(path, vec.data(), bytes);
+    }
+    static bool Read(const std::string &path, uint64_t bytes, std::vector<T> &vec)
+    {
+        return Utils::Resize(vec, bytes / sizeof(T)) && SpillRead(path, vec.data(), bytes);
+    }
+};
+
 template <typename T>
 struct CustomType : public BaseType {
     std::shared_ptr<T> data;
+
+    ~CustomType() override
+    {
+        if (!spillPath_.empty()) {
+            SpillRemove(spillPath_);
+        }
+    }
+    uint64_t ByteSize() const override
+    {
+        return data == nullptr ? 0 : SpillTraits<T>::ByteSize(*data);
+    }
+    bool Spill(const std::string &path) override
+    {
+        // 只有DataInventory是唯一持有者时才能换出，否则调用方持有的指针会与换入后的数据不一致
+        if (!SpillTraits<T>::SPILLABLE || data == nullptr || data.use_count() != 1) {
+            return false;
+        }
+        if (!SpillTraits<T>::Write(*data, path, spillBytes_)) {
+            SpillRemove(path);
+            return false;
+        }
+        spillPath_ = path;
+        data.reset();
+        return true;
+    }
+    bool Restore() override
+    {
+        if (spillPath_.empty()) {
+            return true;
+        }
+        std::shared_ptr<T> restored;
+        MAKE_SHARED0_RETURN_VALUE(restored, T, false);
+        if (!SpillTraits<T>::Read(spillPath_, spillBytes_, *restored)) {
+            return false;
+        }
+        data = restored;
+        SpillRemove(spillPath_);
+        spillPath_.clear();
+        return true;
+    }
+    bool IsSpilled() const override
+    {
+        return !spillPath_.empty();
+    }
+
+private:
+    std::string spillPath_;
+    uint64_t spillBytes_ = 0;
 };
 
 template<typename T>
@@ -76,6 +171,13 @@ public:
     template<typename T>
     std::shared_ptr<T> GetPtr() const
     {
+        // 冻结后的只读视图中不会发生换出，免锁查找
+        if (frozenView_.IsFrozen()) {
+            auto ptr = frozenView_.Get(typeid(T));
+            return ptr == nullptr ? std::shared_ptr<T>() : Cast<T>(*ptr);
+        }
+        // 持锁取出数据指针，避免取出前被其它线程换出
+        std::lock_guard<std::mutex> lg(mutex_);
         return Cast<T>(GetPtr(typeid(T)));
     }
 
@@ -87,16 +189,37 @@ public:
      */
     std::set<std::type_index> RemoveRestData(const std::set<std::type_index>& keepingDataType);
 
+    /**
+     * @brief 结束数据注入，之后拒绝Inject和RemoveRestData
+     *
+     * @note 未设置内存预算时生成只读视图，GetPtr不再持锁；设置了预算时仍需持锁处理换入换出
+     */
+    void Freeze();
+
     std::size_t Size()
     {
         return data_.size();
     }
 
+    /**
+     * @brief 设置进程内所有DataInventory共享的内存预算
+     *
+     * @param budgetBytes 预算字节数，0表示不限制
+     * @param spillDir 超出预算时换出文件的存放目录
+     * @note 超出预算时按最久未访问的顺序，将元素可平凡拷贝的std::vector换出到文件，GetPtr时再换入
+     */
+    static void SetMemoryBudget(uint64_t budgetBytes, const std::string &spillDir);
+    // 当前驻留内存的字节数及其历史峰值
+    static uint64_t GetResidentBytes();
+    static uint64_t GetPeakResidentBytes();
+
     DataInventory() = default;
-    ~DataInventory() = default;
+    ~DataInventory();
     DataInventory(const DataInventory&) = delete;
     DataInventory& operator=(const DataInventory&) = delete;
-    DataInventory(DataInventory&& dataInventory) : data_(std::move(dataInventory.data_))
+    DataInventory(DataInventory&& dataInventory)
+        : data_(std::move(dataInventory.data_)), frozen_(dataInventory.frozen_.load()),
+          frozenView_(std::move(dataInventory.frozenView_))
     {
     }
     DataInventory& operator=(DataInventory&& dataInventory)
@@ -105,7 +228,9 @@ public:
             return *this;
         }
         data_.swap(dataInventory.data_);
-        dataInventory.data_.clear();
+        frozen_ = dataInventory.frozen_.load();
+        frozenView_ = std::move(dataInventory.frozenView_);
+        dataInventory.Clear();
         return *this;
     }
 private:
@@ -118,12 +243,26 @@ private:
         auto customPtr = std::static_pointer_cast<CustomType<T>>(ptr);
         return customPtr->data;
     }
+    struct Entry {
+        BaseTypePtr ptr;
+        uint64_t bytes = 0;  // 已计入驻留内存的字节数，换出后为0
+        uint64_t lastAccess = 0;
+    };
+
     bool InputToData(std::type_index idx, BaseTypePtr ptr);
+    void Clear();
+    // 以下接口需持有mutex_
     BaseTypePtr GetPtr(std::type_index idx) const;
+    void Account(Entry &entry, uint64_t bytes) const;
+    void EnforceBudget(std::type_index hotIdx) const;
 
 private:
-    std::unordered_map<std::type_index, BaseTypePtr> data_;
+    mutable std::unordered_map<std::type_index, Entry> data_;
+    mutable uint64_t accessTick_ = 0;
     mutable std::mutex mutex_;
+    std::atomic<bool> frozen_{false};
+    // Freeze后的只读视图，仅在未设置内存预算时生成
+    Utils::ConcurrentHashMap<std::type_index, BaseTypePtr> frozenView_;
 };
 
 }
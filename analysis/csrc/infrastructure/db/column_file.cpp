@@ -0,0 +1,358 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#include "analysis/csrc/infrastructure/db/include/column_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "analysis/csrc/infrastructure/utils/common_constant.h"
+#include "analysis/csrc/infrastructure/utils/file.h"
+#include "analysis/csrc/infrastructure/utils/utils.h"
+
+namespace Analysis {
+namespace Infra {
+namespace {
+const char MAGIC[] = {'M', 'S', 'P', 'R', 'O', 'F', 'C', 'F'};
+const uint32_t VERSION = 1;
+const size_t WORD_SIZE = sizeof(uint64_t);
+const size_t HEADER_SIZE = 32;
+const size_t COLUMN_NUM_OFFSET = 12;
+const size_t ROW_NUM_OFFSET = 16;
+const size_t SEGMENT_SIZE_OFFSET = 24;
+const size_t WRITE_BUFFER_SIZE = 1024 * 1024;
+const std::string DB_SUFFIX = ".db";
+const std::string COLUMN_FILE_SUFFIX = ".col";
+const mode_t COLUMN_FILE_MODE = 0640;
+
+inline uint64_t AlignUp(uint64_t value)
+{
+    return (value + WORD_SIZE - 1) / WORD_SIZE * WORD_SIZE;
+}
+
+template<typename T>
+T Load(const char *src)
+{
+    T value;
+    std::memcpy(&value, src, sizeof(value));
+    return value;
+}
+}  // namespace
+
+std::string GetColumnFilePath(const std::string &dbPath, const std::string &tableName)
+{
+    auto stem = dbPath;
+    if (Utils::EndsWith(stem, DB_SUFFIX)) {
+        stem.resize(stem.size() - DB_SUFFIX.size());
+    }
+    return stem + "." + tableName + COLUMN_FILE_SUFFIX;
+}
+
+ColumnFileWriter::ColumnFileWriter(const std::string &path) : path_(path) {}
+
+ColumnFileWriter::~ColumnFileWriter()
+{
+    Close();
+}
+
+void ColumnFileWriter::Close()
+{
+    if (file_ != nullptr) {
+        fclose(file_);
+        file_ = nullptr;
+    }
+}
+
+bool ColumnFileWriter::Begin(const std::vector<std::string> &columns, const std::vector<ColumnType> &types,
+                             uint64_t rows)
+{
+    if (file_ != nullptr) {
+        ERROR("The column file % is being written.", path_);
+        return false;
+    }
+    if (!Utils::FileWriter::Check(path_)) {
+        ERROR("Check column file % failed.", path_);
+        return false;
+    }
+    int fd = open(path_.c_str(), O_RDWR | O_CREAT, COLUMN_FILE_MODE);
+    if (fd < 0) {
+        ERROR("Open column file % failed.", path_);
+        return false;
+    }
+    file_ = fdopen(fd, "r+b");
+    if (file_ == nullptr || fseeko(file_, 0, SEEK_END) != 0) {
+        ERROR("Seek column file % failed.", path_);
+        if (file_ == nullptr) {
+            close(fd);
+        }
+        Close();
+        return false;
+    }
+    segmentBegin_ = static_cast<uint64_t>(ftello(file_));
+    written_ = 0;
+    ok_ = true;
+    buffer_.clear();
+    buffer_.reserve(WRITE_BUFFER_SIZE);
+    dict_.clear();
+    dictOrder_.clear();
+
+    auto columnNum = static_cast<uint32_t>(columns.size());
+    uint64_t segmentSize = 0;
+    PutBytes(MAGIC, sizeof(MAGIC));
+    PutBytes(&VERSION, sizeof(VERSION));
+    PutBytes(&columnNum, sizeof(columnNum));
+    PutBytes(&rows, sizeof(rows));
+    PutBytes(&segmentSize, sizeof(segmentSize));
+    for (size_t i = 0; i < columns.size(); ++i) {
+        uint32_t type = types[i];
+        auto nameLen = static_cast<uint32_t>(columns[i].size());
+        PutBytes(&type, sizeof(type));
+        PutBytes(&nameLen, sizeof(nameLen));
+        PutBytes(columns[i].data(), columns[i].size());
+        PutPadding();
+    }
+    return ok_;
+}
+
+bool ColumnFileWriter::End()
+{
+    uint64_t dictNum = dictOrder_.size();
+    PutBytes(&dictNum, sizeof(dictNum));
+    for (const auto *str : dictOrder_) {
+        auto len = static_cast<uint32_t>(str->size());
+        PutBytes(&len, sizeof(len));
+        PutBytes(str->data(), str->size());
+    }
+    PutPadding();
+    // 数据全部落盘后再回填段长度，中途失败的段长度保持为0，读取时可以识别
+    uint64_t segmentSize = written_;
+    if (!Flush() || fflush(file_) != 0 ||
+        fseeko(file_, static_cast<off_t>(segmentBegin_ + SEGMENT_SIZE_OFFSET), SEEK_SET) != 0 ||
+        fwrite(&segmentSize, sizeof(segmentSize), 1, file_) != 1 || fflush(file_) != 0) {
+        ERROR("Write column file % failed.", path_);
+        ok_ = false;
+    }
+    Close();
+    dict_.clear();
+    dictOrder_.clear();
+    std::string().swap(buffer_);
+    return ok_;
+}
+
+void ColumnFileWriter::Put(const std::string &value)
+{
+    auto it = dict_.emplace(value, static_cast<uint32_t>(dictOrder_.size()));
+    if (it.second) {
+        dictOrder_.emplace_back(&it.first->first);
+    }
+    PutWord(it.first->second);
+}
+
+void ColumnFileWriter::PutWord(uint64_t word)
+{
+    PutBytes(&word, sizeof(word));
+}
+
+void ColumnFileWriter::PutBytes(const void *data, size_t len)
+{
+    buffer_.append(static_cast<const char *>(data), len);
+    written_ += len;
+    if (buffer_.size() >= WRITE_BUFFER_SIZE) {
+        Flush();
+    }
+}
+
+void ColumnFileWriter::PutPadding()
+{
+    static const char zeros[WORD_SIZE] = {0};
+    PutBytes(zeros, AlignUp(written_) - written_);
+}
+
+bool ColumnFileWriter::Flush()
+{
+    if (!buffer_.empty() && ok_ && fwrite(buffer_.data(), 1, buffer_.size(), file_) != buffer_.size()) {
+        ERROR("Write column file % failed.", path_);
+        ok_ = false;
+    }
+    buffer_.clear();
+    return ok_;
+}
+
+ColumnFileReader::~ColumnFileReader()
+{
+    Close();
+}
+
+void ColumnFileReader::Close()
+{
+    if (base_ != nullptr) {
+        munmap(const_cast<char *>(base_), size_);
+        base_ = nullptr;
+    }
+    size_ = 0;
+    rows_ = 0;
+    names_.clear();
+    types_.clear();
+    segments_.clear();
+}
+
+bool ColumnFileReader::Open(const std::string &path)
+{
+    Close();
+    path_ = path;
+    if (!Utils::FileReader::Check(path, Common::MAX_DB_BYTES)) {
+        ERROR("Check column file % failed.", path);
+        return false;
+    }
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        ERROR("Open column file % failed.", path);
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(HEADER_SIZE)) {
+        ERROR("Invalid column file %.", path);
+        close(fd);
+        return false;
+    }
+    size_ = static_cast<size_t>(st.st_size);
+    void *addr = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        ERROR("Mmap column file % failed.", path);
+        size_ = 0;
+        return false;
+    }
+    base_ = static_cast<const char *>(addr);
+    uint64_t offset = 0;
+    while (offset < size_) {
+        uint64_t next = 0;
+        if (!ParseSegment(offset, next)) {
+            ERROR("Invalid segment at % in column file %.", offset, path);
+            Close();
+            return false;
+        }
+        offset = next;
+    }
+    return true;
+}
+
+bool ColumnFileReader::ParseSegment(uint64_t offset, uint64_t &next)
+{
+    if (size_ - offset < HEADER_SIZE || std::memcmp(base_ + offset, MAGIC, sizeof(MAGIC)) != 0 ||
+        Load<uint32_t>(base_ + offset + sizeof(MAGIC)) != VERSION) {
+        return false;
+    }
+    auto columnNum = Load<uint32_t>(base_ + offset + COLUMN_NUM_OFFSET);
+    auto rows = Load<uint64_t>(base_ + offset + ROW_NUM_OFFSET);
+    auto segmentSize = Load<uint64_t>(base_ + offset + SEGMENT_SIZE_OFFSET);
+    if (segmentSize < HEADER_SIZE || segmentSize > size_ - offset) {
+        return false;
+    }
+    const uint64_t end = offset + segmentSize;
+    uint64_t pos = offset + HEADER_SIZE;
+    std::vector<std::string> names;
+    std::vector<ColumnType> types;
+    for (uint32_t i = 0; i < columnNum; ++i) {
+        if (end - pos < WORD_SIZE) {
+            return false;
+        }
+        auto type = Load<uint32_t>(base_ + pos);
+        auto nameLen = Load<uint32_t>(base_ + pos + sizeof(uint32_t));
+        pos += WORD_SIZE;
+        if (type < COLUMN_INT64 || type > COLUMN_TEXT || end - pos < nameLen) {
+            return false;
+        }
+        names.emplace_back(base_ + pos, nameLen);
+        types.emplace_back(static_cast<ColumnType>(type));
+        pos = AlignUp(pos + nameLen);
+    }
+    if (segments_.empty()) {
+        names_ = names;
+        types_ = types;
+    } else if (names != names_ || types != types_) {
+        ERROR("The schema of segments in % is inconsistent.", path_);
+        return false;
+    }
+    Segment segment;
+    segment.rows = rows;
+    if (pos > end || rows > (end - pos) / WORD_SIZE / std::max<uint32_t>(columnNum, 1)) {
+        return false;
+    }
+    for (uint32_t i = 0; i < columnNum; ++i) {
+        segment.columns.emplace_back(base_ + pos);
+        pos += rows * WORD_SIZE;
+    }
+    if (end - pos < WORD_SIZE) {
+        return false;
+    }
+    auto dictNum = Load<uint64_t>(base_ + pos);
+    pos += WORD_SIZE;
+    if (dictNum > (end - pos) / sizeof(uint32_t)) {
+        return false;
+    }
+    segment.dict.reserve(static_cast<size_t>(dictNum));
+    for (uint64_t i = 0; i < dictNum; ++i) {
+        if (end - pos < sizeof(uint32_t)) {
+            return false;
+        }
+        auto len = Load<uint32_t>(base_ + pos);
+        pos += sizeof(uint32_t);
+        if (end - pos < len) {
+            return false;
+        }
+        segment.dict.emplace_back(base_ + pos, len);
+        pos += len;
+    }
+    rows_ += rows;
+    segments_.emplace_back(std::move(segment));
+    next = end;
+    return true;
+}
+
+uint64_t ColumnFileReader::GetRowCount() const
+{
+    return rows_;
+}
+
+const std::vector<std::string> &ColumnFileReader::GetColumnNames() const
+{
+    return names_;
+}
+
+bool ColumnFileReader::Decode(ColumnType type, uint64_t word, const Segment &segment, std::string &value)
+{
+    switch (type) {
+        case COLUMN_TEXT:
+            if (word >= segment.dict.size()) {
+                return false;
+            }
+            value.assign(segment.dict[word].first, segment.dict[word].second);
+            return true;
+        case COLUMN_INT64:
+            value = std::to_string(static_cast<int64_t>(word));
+            return true;
+        case COLUMN_UINT64:
+            value = std::to_string(word);
+            return true;
+        default:
+            return false;
+    }
+}
+}  // namespace Infra
+}  // namespace Analysis
@@ -0,0 +1,210 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#include "analysis/csrc/infrastructure/db/include/column_table.h"
+
+#include <cmath>
+
+#include <sqlite3.h>
+
+namespace Analysis {
+namespace Infra {
+namespace {
+// sqlite将REAL转换为文本时使用的格式，'!'保证整数值也带小数点，如5.0
+const char *REAL_TEXT_FORMAT = "%!.15g";
+const int REAL_TEXT_BUFFER_SIZE = 64;
+
+// 与sqlite3_column_int64对REAL的转换一致，超出范围时取边界值
+int64_t RealToInt64(double value)
+{
+    if (std::isnan(value)) {
+        return 0;
+    }
+    if (value <= static_cast<double>(INT64_MIN)) {
+        return INT64_MIN;
+    }
+    if (value >= static_cast<double>(INT64_MAX)) {
+        return INT64_MAX;
+    }
+    return static_cast<int64_t>(value);
+}
+}
+
+const size_t ColumnTable::INVALID_INDEX;
+
+void ColumnTable::Reset(const std::vector<std::string> &names)
+{
+    names_ = names;
+    columns_.clear();
+    columns_.resize(names.size());
+}
+
+void ColumnTable::Append(size_t col, ValueType type, Value value)
+{
+    auto &column = columns_[col];
+    column.types.push_back(type);
+    column.values.push_back(value);
+}
+
+void ColumnTable::AppendNull(size_t col)
+{
+    Value value;
+    value.integer = 0;
+    Append(col, VALUE_NULL, value);
+}
+
+void ColumnTable::AppendInteger(size_t col, int64_t integer)
+{
+    Value value;
+    value.integer = integer;
+    Append(col, VALUE_INTEGER, value);
+}
+
+void ColumnTable::AppendReal(size_t col, double real)
+{
+    Value value;
+    value.real = real;
+    Append(col, VALUE_REAL, value);
+}
+
+void ColumnTable::AppendText(size_t col, std::string &&text, double number, int64_t integer)
+{
+    auto &texts = columns_[col].texts;
+    Value value;
+    value.textIndex = texts.size();
+    texts.push_back({std::move(text), number, integer});
+    Append(col, VALUE_TEXT, value);
+}
+
+bool ColumnTable::Empty() const
+{
+    return RowCount() == 0;
+}
+
+size_t ColumnTable::RowCount() const
+{
+    return columns_.empty() ? 0 : columns_.front().types.size();
+}
+
+size_t ColumnTable::ColumnCount() const
+{
+    return columns_.size();
+}
+
+const std::vector<std::string> &ColumnTable::GetColumnNames() const
+{
+    return names_;
+}
+
+size_t ColumnTable::GetColumnIndex(const std::string &name) const
+{
+    for (size_t i = 0; i < names_.size(); ++i) {
+        if (names_[i] == name) {
+            return i;
+        }
+    }
+    return INVALID_INDEX;
+}
+
+ColumnTable::ValueType ColumnTable::GetType(size_t col, size_t row) const
+{
+    return static_cast<ValueType>(columns_[col].types[row]);
+}
+
+bool ColumnTable::IsNumeric(size_t col, size_t row) const
+{
+    auto type = GetType(col, row);
+    return type == VALUE_INTEGER || type == VALUE_REAL;
+}
+
+double ColumnTable::GetDouble(size_t col, size_t row) const
+{
+    const auto &column = columns_[col];
+    const auto &value = column.values[row];
+    switch (column.types[row]) {
+        case VALUE_INTEGER:
+            return static_cast<double>(value.integer);
+        case VALUE_REAL:
+            return value.real;
+        case VALUE_TEXT:
+            return column.texts[value.textIndex].number;
+        default:
+            return 0.0;
+    }
+}
+
+int64_t ColumnTable::GetInt64(size_t col, size_t row) const
+{
+    const auto &column = columns_[col];
+    const auto &value = column.values[row];
+    switch (column.types[row]) {
+        case VALUE_INTEGER:
+            return value.integer;
+        case VALUE_REAL:
+            return RealToInt64(value.real);
+        case VALUE_TEXT:
+            return column.texts[value.textIndex].integer;
+        default:
+            return 0;
+    }
+}
+
+bool ColumnTable::GetUint32(size_t col, size_t row, uint32_t &value) const
+{
+    if (GetType(col, row) != VALUE_INTEGER) {
+        return false;
+    }
+    auto integer = columns_[col].values[row].integer;
+    if (integer < 0 || integer > UINT32_MAX) {
+        return false;
+    }
+    value = static_cast<uint32_t>(integer);
+    return true;
+}
+
+bool ColumnTable::GetUint64(size_t col, size_t row, uint64_t &value) const
+{
+    if (GetType(col, row) != VALUE_INTEGER) {
+        return false;
+    }
+    auto integer = columns_[col].values[row].integer;
+    if (integer < 0) {
+        return false;
+    }
+    value = static_cast<uint64_t>(integer);
+    return true;
+}
+
+std::string ColumnTable::ToString(size_t col, size_t row) const
+{
+    const auto &column = columns_[col];
+    const auto &value = column.values[row];
+    switch (column.types[row]) {
+        case VALUE_INTEGER:
+            return std::to_string(value.integer);
+        case VALUE_REAL: {
+            char buffer[REAL_TEXT_BUFFER_SIZE] = {0};
+            sqlite3_snprintf(REAL_TEXT_BUFFER_SIZE, buffer, REAL_TEXT_FORMAT, value.real);
+            return std::string(buffer);
+        }
+        case VALUE_TEXT:
+            return column.texts[value.textIndex].text;
+        default:
+            return "";
+    }
+}
+}  // namespace Infra
+}  // namespace Analysis
@@ -131,6 +131,53 @@ std::vector<TableColumn> Connection::ExecuteGetTableColumns(const std::string &t
     return cols;
 }
 
+bool Connection::ExecuteQueryColumns(const std::string &sql, ColumnTable &result)
+{
+    if (!QueryCmd(sql)) {
+        return false;
+    }
+    int colNum = sqlite3_column_count(stmt_);
+    std::vector<std::string> names;
+    for (int col = 0; col < colNum; ++col) {
+        auto name = sqlite3_column_name(stmt_, col);
+        names.emplace_back(name == nullptr ? "" : name);
+    }
+    result.Reset(names);
+    while (true) {
+        auto rc = sqlite3_step(stmt_);
+        if (rc != SQLITE_ROW) {
+            if (rc != SQLITE_DONE) {
+                std::string errorMsg = "Failed to query data: " + std::string(sqlite3_errmsg(db_));
+                ERROR("sqlite3_step return %, %", rc, errorMsg);
+                return false;
+            }
+            break;
+        }
+        for (int col = 0; col < colNum; ++col) {
+            switch (sqlite3_column_type(stmt_, col)) {
+                case SQLITE_INTEGER:
+                    result.AppendInteger(col, sqlite3_column_int64(stmt_, col));
+                    break;
+                case SQLITE_FLOAT:
+                    result.AppendReal(col, sqlite3_column_double(stmt_, col));
+                    break;
+                case SQLITE_NULL:
+                    result.AppendNull(col);
+                    break;
+                default: {
+                    // 先拷贝文本，再做数值转换，避免文本指针失效
+                    auto text = ReinterpretConvert<const char *>(sqlite3_column_text(stmt_, col));
+                    std::string value(text == nullptr ? "" : text);
+                    result.AppendText(col, std::move(value), sqlite3_column_double(stmt_, col),
+                                      sqlite3_column_int64(stmt_, col));
+                    break;
+                }
+            }
+        }
+    }
+    return true;
+}
+
 bool Connection::InsertCmd(const std::string &tableName, const uint32_t &colNum)
 {
     std::string valueStr;
@@ -199,7 +246,7 @@ void Connection::BindParameters(double value)
 
 void Connection::BindParameters(std::string value)
 {
-    sqlite3_bind_text(stmt_, ++index_, value.c_str(), -1, nullptr);
+    sqlite3_bind_text(stmt_, ++index_, value.c_str(), -1, SQLITE_TRANSIENT);
 }
 
 void Connection::GetColumn(int64_t &value)
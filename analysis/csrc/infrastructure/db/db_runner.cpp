@@ -53,6 +53,7 @@ bool DBRunner::CreateTable(const std::string &tableName, const std::vector <Tabl
     INFO("Start create %", tableName);
     std::string valuesStr = GetColumnsString(cols);
     std::string sql = "CREATE TABLE IF NOT EXISTS " + tableName + " (" + valuesStr + ");";
+    TraceSpan span(TRACE_CAT_DB, "CREATE TABLE ", tableName);
     std::shared_ptr<Connection> conn;
     MAKE_SHARED_RETURN_VALUE(conn, Connection, false, path_);
     if (!conn->IsDBOpened()) {
@@ -77,6 +78,7 @@ bool DBRunner::CreateIndex(const std::string &tableName, const std::string &inde
     INFO("Start create % index.", tableName);
     std::string valuesStr = Join(colNames, ",");
     std::string sql = "CREATE INDEX IF NOT EXISTS " + indexName + " ON " + tableName + " (" + valuesStr + ");";
+    TraceSpan span(TRACE_CAT_DB, "CREATE INDEX ", indexName);
     std::shared_ptr<Connection> conn;
     MAKE_SHARED_RETURN_VALUE(conn, Connection, false, path_);
     if (!conn->IsDBOpened()) {
@@ -116,6 +118,7 @@ bool DBRunner::DropTable(const std::string &tableName) const
 bool DBRunner::DeleteData(const std::string &sql) const
 {
     INFO("Start delete data");
+    TraceSpan span(TRACE_CAT_DB, sql);
     std::shared_ptr<Connection> conn;
     MAKE_SHARED_RETURN_VALUE(conn, Connection, false, path_);
     if (!conn->IsDBOpened()) {
@@ -133,6 +136,7 @@ bool DBRunner::DeleteData(const std::string &sql) const
 bool DBRunner::UpdateData(const std::string &sql) const
 {
     INFO("Start update data");
+    TraceSpan span(TRACE_CAT_DB, sql);
     std::shared_ptr<Connection> conn;
     MAKE_SHARED_RETURN_VALUE(conn, Connection, false, path_);
     if (!conn->IsDBOpened()) {
@@ -147,6 +151,24 @@ bool DBRunner::UpdateData(const std::string &sql) const
     return true;
 }
 
+bool DBRunner::QueryColumns(const std::string &sql, ColumnTable &result) const
+{
+    INFO("Start query columns");
+    TraceSpan span(TRACE_CAT_DB, sql);
+    std::shared_ptr<Connection> conn;
+    MAKE_SHARED_RETURN_VALUE(conn, Connection, false, path_);
+    if (!conn->IsDBOpened()) {
+        ERROR("Create connection failed, path is %", path_);
+        return false;
+    }
+    if (!conn->ExecuteQueryColumns(sql, result)) {
+        ERROR("Query columns failed: %", sql);
+        return false;
+    }
+    INFO("Query columns success: %", sql);
+    return true;
+}
+
 std::vector<TableColumn> DBRunner::GetTableColumns(const std::string &tableName)
 {
     INFO("Start get % headers", tableName);
@@ -0,0 +1,300 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#ifndef ANALYSIS_INFRASTRUCTURE_DB_COLUMN_FILE_H
+#define ANALYSIS_INFRASTRUCTURE_DB_COLUMN_FILE_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "analysis/csrc/infrastructure/dfx/log.h"
+
+namespace Analysis {
+namespace Infra {
+// 流水线内部数据的列式中间文件，替代持久化阶段写出、导出阶段再逐行查询的sqlite表
+// 文件由若干段顺序拼接，每次Append写入一段，段内各部分均按8字节对齐：
+//   段头   magic(8) | 版本(4) | 列数(4) | 行数(8) | 段长度(8)，段长度在整段写完后回填，为0表示写入未完成
+//   列描述 每列 类型(4) | 列名长度(4) | 列名
+//   列数据 每列 行数 * 8字节，整数统一扩展为int64/uint64，浮点为double，文本为字典下标
+//   字典   条数(8)，每条 长度(4) | 内容
+// 读取时mmap整个文件，列数据按定长数组直接访问
+enum ColumnType : uint32_t {
+    COLUMN_INT64 = 1,
+    COLUMN_UINT64,
+    COLUMN_DOUBLE,
+    COLUMN_TEXT
+};
+
+// sqlite表对应的列式文件，如sqlite/ascend_task.db的AscendTask表对应sqlite/ascend_task.AscendTask.col
+std::string GetColumnFilePath(const std::string &dbPath, const std::string &tableName);
+
+template<typename T, typename Enable = void>
+struct ColumnTypeOf;
+
+template<typename T>
+struct ColumnTypeOf<T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type> {
+    static const ColumnType value = COLUMN_INT64;
+};
+
+template<typename T>
+struct ColumnTypeOf<T, typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value>::type> {
+    static const ColumnType value = COLUMN_UINT64;
+};
+
+template<typename T>
+struct ColumnTypeOf<T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+    static const ColumnType value = COLUMN_DOUBLE;
+};
+
+template<>
+struct ColumnTypeOf<std::string> {
+    static const ColumnType value = COLUMN_TEXT;
+};
+
+template<size_t I, size_t N>
+struct ColumnFileCodec;
+
+class ColumnFileWriter {
+public:
+    explicit ColumnFileWriter(const std::string &path);
+    ~ColumnFileWriter();
+    ColumnFileWriter(const ColumnFileWriter &) = delete;
+    ColumnFileWriter &operator=(const ColumnFileWriter &) = delete;
+    // 在文件末尾追加一段，columns为列名，与tuple元素一一对应；同一文件各段的列名和类型需一致
+    template<typename... Args>
+    bool Append(const std::vector<std::string> &columns, const std::vector<std::tuple<Args...>> &data);
+
+    template<typename T>
+    typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type Put(T value)
+    {
+        PutWord(static_cast<uint64_t>(static_cast<int64_t>(value)));
+    }
+
+    template<typename T>
+    typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value>::type Put(T value)
+    {
+        PutWord(static_cast<uint64_t>(value));
+    }
+
+    template<typename T>
+    typename std::enable_if<std::is_floating_point<T>::value>::type Put(T value)
+    {
+        double number = static_cast<double>(value);
+        uint64_t word = 0;
+        std::memcpy(&word, &number, sizeof(word));
+        PutWord(word);
+    }
+
+    void Put(const std::string &value);
+
+private:
+    bool Begin(const std::vector<std::string> &columns, const std::vector<ColumnType> &types, uint64_t rows);
+    bool End();
+    void PutWord(uint64_t word);
+    void PutBytes(const void *data, size_t len);
+    void PutPadding();
+    bool Flush();
+    void Close();
+
+private:
+    std::string path_;
+    FILE *file_ = nullptr;
+    bool ok_ = false;
+    uint64_t segmentBegin_ = 0;
+    uint64_t written_ = 0;
+    std::string buffer_;
+    std::unordered_map<std::string, uint32_t> dict_;
+    std::vector<const std::string *> dictOrder_;
+};
+
+class ColumnFileReader {
+public:
+    struct Segment {
+        uint64_t rows = 0;
+        std::vector<const char *> columns;
+        std::vector<std::pair<const char *, uint32_t>> dict;
+    };
+
+    ColumnFileReader() = default;
+    ~ColumnFileReader();
+    ColumnFileReader(const ColumnFileReader &) = delete;
+    ColumnFileReader &operator=(const ColumnFileReader &) = delete;
+    // mmap打开并校验所有段，存在未写完的段时失败
+    bool Open(const std::string &path);
+    uint64_t GetRowCount() const;
+    const std::vector<std::string> &GetColumnNames() const;
+    // 按列名读取所有段，列名与tuple元素一一对应；数值列之间按static_cast转换，整数列可读为文本
+    template<typename... Args>
+    bool Read(const std::vector<std::string> &columns, std::vector<std::tuple<Args...>> &data) const;
+
+    template<typename T>
+    static typename std::enable_if<std::is_arithmetic<T>::value, bool>::type Decode(
+        ColumnType type, uint64_t word, const Segment &segment, T &value)
+    {
+        (void)segment;
+        switch (type) {
+            case COLUMN_INT64:
+                value = static_cast<T>(static_cast<int64_t>(word));
+                return true;
+            case COLUMN_UINT64:
+                value = static_cast<T>(word);
+                return true;
+            case COLUMN_DOUBLE: {
+                double number = 0;
+                std::memcpy(&number, &word, sizeof(number));
+                value = static_cast<T>(number);
+                return true;
+            }
+            default:
+                return false;
+        }
+    }
+
+    static bool Decode(ColumnType type, uint64_t word, const Segment &segment, std::string &value);
+
+private:
+    bool ParseSegment(uint64_t offset, uint64_t &next);
+    void Close();
+
+private:
+    std::string path_;
+    const char *base_ = nullptr;
+    size_t size_ = 0;
+    uint64_t rows_ = 0;
+    std::vector<std::string> names_;
+    std::vector<ColumnType> types_;
+    std::vector<Segment> segments_;
+
+    template<size_t I, size_t N>
+    friend struct ColumnFileCodec;
+};
+
+template<size_t I, size_t N>
+struct ColumnFileCodec {
+    template<typename... Args>
+    static void Encode(ColumnFileWriter &writer, const std::vector<std::tuple<Args...>> &data)
+    {
+        for (const auto &row : data) {
+            writer.Put(std::get<I>(row));
+        }
+        ColumnFileCodec<I + 1, N>::Encode(writer, data);
+    }
+
+    template<typename... Args>
+    static void CollectTypes(std::vector<ColumnType> &types)
+    {
+        using Type = typename std::decay<typename std::tuple_element<I, std::tuple<Args...>>::type>::type;
+        ColumnType type = ColumnTypeOf<Type>::value;
+        types.emplace_back(type);
+        ColumnFileCodec<I + 1, N>::template CollectTypes<Args...>(types);
+    }
+
+    template<typename... Args>
+    static bool Decode(const ColumnFileReader &reader, const ColumnFileReader::Segment &segment,
+                       const std::vector<size_t> &indexes, std::vector<std::tuple<Args...>> &data, size_t offset)
+    {
+        auto type = reader.types_[indexes[I]];
+        const char *src = segment.columns[indexes[I]];
+        for (uint64_t row = 0; row < segment.rows; ++row) {
+            uint64_t word = 0;
+            std::memcpy(&word, src + row * sizeof(word), sizeof(word));
+            if (!ColumnFileReader::Decode(type, word, segment, std::get<I>(data[offset + row]))) {
+                ERROR("Column % in % can't be converted, type is %.", reader.names_[indexes[I]], reader.path_, type);
+                return false;
+            }
+        }
+        return ColumnFileCodec<I + 1, N>::Decode(reader, segment, indexes, data, offset);
+    }
+};
+
+template<size_t N>
+struct ColumnFileCodec<N, N> {
+    template<typename... Args>
+    static void Encode(ColumnFileWriter &, const std::vector<std::tuple<Args...>> &) {}
+
+    template<typename... Args>
+    static void CollectTypes(std::vector<ColumnType> &) {}
+
+    template<typename... Args>
+    static bool Decode(const ColumnFileReader &, const ColumnFileReader::Segment &, const std::vector<size_t> &,
+                       std::vector<std::tuple<Args...>> &, size_t)
+    {
+        return true;
+    }
+};
+
+template<typename... Args>
+bool ColumnFileWriter::Append(const std::vector<std::string> &columns, const std::vector<std::tuple<Args...>> &data)
+{
+    if (columns.size() != sizeof...(Args)) {
+        ERROR("Column number % doesn't match data width % for %.", columns.size(), sizeof...(Args), path_);
+        return false;
+    }
+    std::vector<ColumnType> types;
+    ColumnFileCodec<0, sizeof...(Args)>::template CollectTypes<Args...>(types);
+    if (!Begin(columns, types, data.size())) {
+        return false;
+    }
+    ColumnFileCodec<0, sizeof...(Args)>::Encode(*this, data);
+    return End();
+}
+
+template<typename... Args>
+bool ColumnFileReader::Read(const std::vector<std::string> &columns, std::vector<std::tuple<Args...>> &data) const
+{
+    if (columns.size() != sizeof...(Args)) {
+        ERROR("Column number % doesn't match data width % for %.", columns.size(), sizeof...(Args), path_);
+        return false;
+    }
+    std::vector<size_t> indexes;
+    for (const auto &column : columns) {
+        size_t idx = 0;
+        while (idx < names_.size() && names_[idx] != column) {
+            ++idx;
+        }
+        if (idx == names_.size()) {
+            ERROR("Column % doesn't exist in %.", column, path_);
+            return false;
+        }
+        indexes.emplace_back(idx);
+    }
+    try {
+        data.resize(static_cast<size_t>(rows_));
+    } catch (...) {
+        ERROR("Resize for % rows of % failed.", rows_, path_);
+        return false;
+    }
+    size_t offset = 0;
+    for (const auto &segment : segments_) {
+        if (!ColumnFileCodec<0, sizeof...(Args)>::Decode(*this, segment, indexes, data, offset)) {
+            data.clear();
+            return false;
+        }
+        offset += static_cast<size_t>(segment.rows);
+    }
+    return true;
+}
+}  // namespace Infra
+}  // namespace Analysis
+
+#endif  // ANALYSIS_INFRASTRUCTURE_DB_COLUMN_FILE_H
@@ -0,0 +1,89 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#ifndef ANALYSIS_INFRASTRUCTURE_DB_COLUMN_TABLE_H
+#define ANALYSIS_INFRASTRUCTURE_DB_COLUMN_TABLE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Analysis {
+namespace Infra {
+// 动态表结构的列式查询结果，由DBRunner::QueryColumns一次扫描填充
+// 每列按单元格记录sqlite存储类型和8字节的值：INTEGER存int64，REAL存double，TEXT存列内文本表的下标，
+// 文本及sqlite对其的数值转换结果只在出现TEXT时分配。数值列在ToString之前一直保持数值形式，
+// ToString的结果与sqlite3_column_text一致
+class ColumnTable {
+public:
+    enum ValueType : uint8_t {
+        VALUE_NULL = 0,
+        VALUE_INTEGER,
+        VALUE_REAL,
+        VALUE_TEXT
+    };
+    static const size_t INVALID_INDEX = SIZE_MAX;
+
+    void Reset(const std::vector<std::string> &names);
+    void AppendNull(size_t col);
+    void AppendInteger(size_t col, int64_t integer);
+    void AppendReal(size_t col, double real);
+    // TEXT与BLOB，number/integer为sqlite对该值的数值转换结果
+    void AppendText(size_t col, std::string &&text, double number, int64_t integer);
+
+    bool Empty() const;
+    size_t RowCount() const;
+    size_t ColumnCount() const;
+    const std::vector<std::string> &GetColumnNames() const;
+    // 列名不存在时返回INVALID_INDEX
+    size_t GetColumnIndex(const std::string &name) const;
+
+    ValueType GetType(size_t col, size_t row) const;
+    bool IsNumeric(size_t col, size_t row) const;
+    // 与sqlite3_column_double/sqlite3_column_int64的转换规则一致
+    double GetDouble(size_t col, size_t row) const;
+    int64_t GetInt64(size_t col, size_t row) const;
+    // 仅INTEGER且在取值范围内时成功
+    bool GetUint32(size_t col, size_t row, uint32_t &value) const;
+    bool GetUint64(size_t col, size_t row, uint64_t &value) const;
+    std::string ToString(size_t col, size_t row) const;
+
+private:
+    union Value {
+        int64_t integer;
+        double real;
+        uint64_t textIndex;
+    };
+    struct Text {
+        std::string text;
+        double number;
+        int64_t integer;
+    };
+    struct Column {
+        std::vector<uint8_t> types;
+        std::vector<Value> values;
+        std::vector<Text> texts;
+    };
+    void Append(size_t col, ValueType type, Value value);
+
+private:
+    std::vector<std::string> names_;
+    std::vector<Column> columns_;
+};
+}  // namespace Infra
+}  // namespace Analysis
+
+#endif  // ANALYSIS_INFRASTRUCTURE_DB_COLUMN_TABLE_H
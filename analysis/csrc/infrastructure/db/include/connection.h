@@ -26,6 +26,7 @@
 #include <initializer_list>
 #include <unordered_map>
 
+#include "analysis/csrc/infrastructure/db/include/column_table.h"
 #include "analysis/csrc/infrastructure/dfx/log.h"
 
 namespace Analysis {
@@ -83,6 +84,8 @@ public:
     bool ExecuteDelete(const std::string &sql);
     template<typename... Args>
     bool ExecuteQuery(const std::string &sql, std::vector<std::tuple<Args...>> &result);
+    // 按sql结果的列动态加载，一次扫描得到所有列
+    bool ExecuteQueryColumns(const std::string &sql, ColumnTable &result);
     bool ExecuteUpdate(const std::string &sql);
     std::vector<TableColumn> ExecuteGetTableColumns(const std::string &tableName);
 
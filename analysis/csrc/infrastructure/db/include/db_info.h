@@ -35,7 +35,7 @@ struct DBInfo {
     DBInfo() = default;
     DBInfo(std::string dbName, std::string tableName) : dbName(std::move(dbName)), tableName(std::move(tableName)) {};
 
-    bool ConstructDBRunner(std::string& dbPath)
+    bool ConstructDBRunner(const std::string& dbPath)
     {
         MAKE_SHARED_RETURN_VALUE(dbRunner, DBRunner, false, dbPath);
         return true;
@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "analysis/csrc/infrastructure/db/include/connection.h"
+#include "analysis/csrc/infrastructure/utils/self_trace.h"
 #include "analysis/csrc/infrastructure/utils/utils.h"
 
 namespace Analysis {
@@ -45,6 +46,8 @@ public:
     bool DeleteData(const std::string &sql) const;
     template<typename... Args>
     bool QueryData(const std::string &sql, std::vector<std::tuple<Args...>> &result) const;
+    // 列式查询接口，结果列由sql决定，适用于表结构在运行时才确定的场景
+    bool QueryColumns(const std::string &sql, ColumnTable &result) const;
     bool UpdateData(const std::string &sql) const;
     std::vector<TableColumn> GetTableColumns(const std::string &tableName);
 private:
@@ -59,6 +62,7 @@ bool DBRunner::InsertData(const std::string &tableName, const std::vector<std::t
         return false;
     }
     INFO("Start insert data to %", tableName);
+    Utils::TraceSpan span(Utils::TRACE_CAT_DB, "INSERT ", tableName);
     std::shared_ptr<Connection> conn;
     MAKE_SHARED_RETURN_VALUE(conn, Connection, false, path_);
     if (!conn->IsDBOpened()) {
@@ -77,6 +81,7 @@ template<typename... Args>
 bool DBRunner::QueryData(const std::string &sql, std::vector<std::tuple<Args...>> &result) const
 {
     INFO("Start query data");
+    Utils::TraceSpan span(Utils::TRACE_CAT_DB, sql);
     std::shared_ptr<Connection> conn;
     MAKE_SHARED_RETURN_VALUE(conn, Connection, false, path_);
     if (!conn->IsDBOpened()) {
@@ -0,0 +1,140 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#include "analysis/csrc/infrastructure/dump_tools/include/atomic_output.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include "analysis/csrc/infrastructure/dfx/log.h"
+#include "analysis/csrc/infrastructure/utils/file.h"
+
+namespace Analysis {
+namespace Infra {
+using Analysis::Utils::File;
+namespace {
+const std::string TEMP_PREFIX = ".";
+const std::string TEMP_SUFFIX = ".tmp";
+}
+
+std::string AtomicOutput::GetTempPath(const std::string &path)
+{
+    auto pos = path.find_last_of('/');
+    if (pos == std::string::npos) {
+        return TEMP_PREFIX + path + TEMP_SUFFIX;
+    }
+    return path.substr(0, pos + 1) + TEMP_PREFIX + path.substr(pos + 1) + TEMP_SUFFIX;
+}
+
+std::string AtomicOutput::Stage(const std::string &path)
+{
+    auto tempPath = GetTempPath(path);
+    std::lock_guard<std::mutex> lock(mutex_);
+    staged_[path] = tempPath;
+    return tempPath;
+}
+
+std::string AtomicOutput::Resolve(const std::string &path) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = staged_.find(path);
+    return it == staged_.end() ? path : it->second;
+}
+
+bool AtomicOutput::Publish(const std::string &path, const std::string &suffix)
+{
+    std::string tempPath;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = staged_.find(path);
+        if (it == staged_.end()) {
+            ERROR("The output % is not staged.", path);
+            return false;
+        }
+        tempPath = it->second;
+        staged_.erase(it);
+    }
+    if (!File::Exist(tempPath + suffix)) {
+        INFO("The staged output % is not written, nothing to publish.", tempPath + suffix);
+        return true;
+    }
+    // 同目录内rename为原子操作，读者只会看到完整的旧文件或新文件
+    if (std::rename((tempPath + suffix).c_str(), (path + suffix).c_str()) != 0) {
+        ERROR("Publish % failed: %.", path + suffix, strerror(errno));
+        File::DeleteFile(tempPath + suffix);
+        return false;
+    }
+    return true;
+}
+
+void AtomicOutput::Discard(const std::string &path, const std::string &suffix)
+{
+    std::string tempPath;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = staged_.find(path);
+        if (it == staged_.end()) {
+            return;
+        }
+        tempPath = it->second;
+        staged_.erase(it);
+    }
+    if (File::Exist(tempPath + suffix) && !File::DeleteFile(tempPath + suffix)) {
+        WARN("Delete staged output % failed.", tempPath + suffix);
+    }
+}
+
+void AtomicOutput::RemoveStale(const std::string &dir)
+{
+    DIR *dp = opendir(dir.c_str());
+    if (dp == nullptr) {
+        return;
+    }
+    std::vector<std::string> staleFiles;
+    const struct dirent *entry = nullptr;
+    while ((entry = readdir(dp)) != nullptr) {
+        std::string name = entry->d_name;
+        if (name.compare(0, TEMP_PREFIX.size(), TEMP_PREFIX) != 0 || name.find(TEMP_SUFFIX) == std::string::npos) {
+            continue;
+        }
+        auto path = File::PathJoin({dir, name});
+        struct stat st;
+        if (stat(path.c_str(), &st) == 0 && S_ISREG(st.st_mode)) {
+            staleFiles.emplace_back(path);
+        }
+    }
+    closedir(dp);
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto &file : staleFiles) {
+        bool inUse = false;
+        for (const auto &staged : staged_) {
+            if (file.compare(0, staged.second.size(), staged.second) == 0) {
+                inUse = true;
+                break;
+            }
+        }
+        if (!inUse) {
+            INFO("Remove stale output %.", file);
+            File::DeleteFile(file);
+        }
+    }
+}
+}
+}
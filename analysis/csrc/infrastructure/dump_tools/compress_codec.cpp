@@ -0,0 +1,114 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#include "analysis/csrc/infrastructure/dump_tools/include/compress_codec.h"
+
+#include <zlib.h>
+#include <climits>
+
+#include "analysis/csrc/infrastructure/dfx/log.h"
+
+namespace Analysis {
+namespace Infra {
+namespace {
+const std::string GZIP_SUFFIX = ".gz";
+const int GZIP_WINDOW_BITS = 15 + 16;  // 15为最大窗口，+16表示输出gzip头尾
+const int GZIP_MEM_LEVEL = 8;
+const std::size_t GZIP_WRAPPER_SIZE = 18;  // 10字节头 + 8字节尾
+}
+
+const int GzipCodec::DEFAULT_LEVEL;
+
+const std::string &GzipCodec::Suffix() const
+{
+    return GZIP_SUFFIX;
+}
+
+std::size_t GzipCodec::Bound(std::size_t len) const
+{
+    return compressBound(static_cast<uLong>(len)) + GZIP_WRAPPER_SIZE;
+}
+
+bool GzipCodec::Compress(const char *src, std::size_t len, std::string &dst) const
+{
+    if (src == nullptr && len != 0) {
+        ERROR("The content to compress is nullptr.");
+        return false;
+    }
+    if (len > UINT_MAX) {
+        ERROR("The block to compress is too large: %.", len);
+        return false;
+    }
+    z_stream stream{};
+    if (deflateInit2(&stream, level_, Z_DEFLATED, GZIP_WINDOW_BITS, GZIP_MEM_LEVEL, Z_DEFAULT_STRATEGY) != Z_OK) {
+        ERROR("Gzip deflate init failed.");
+        return false;
+    }
+    try {
+        dst.resize(deflateBound(&stream, static_cast<uLong>(len)));
+    } catch (...) {
+        ERROR("Resize gzip output buffer failed.");
+        deflateEnd(&stream);
+        return false;
+    }
+    stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(src));
+    stream.avail_in = static_cast<uInt>(len);
+    stream.next_out = reinterpret_cast<Bytef *>(&dst[0]);
+    stream.avail_out = static_cast<uInt>(dst.size());
+    auto ret = deflate(&stream, Z_FINISH);
+    deflateEnd(&stream);
+    if (ret != Z_STREAM_END) {
+        ERROR("Gzip deflate failed, ret is %.", ret);
+        return false;
+    }
+    dst.resize(stream.total_out);
+    return true;
+}
+
+std::unordered_map<std::string, CodecCreator> &CompressCodecFactory::CodecTable()
+{
+    static std::unordered_map<std::string, CodecCreator> codecTable{
+        {CODEC_GZIP, []() -> std::shared_ptr<CompressCodec> { return std::make_shared<GzipCodec>(); }},
+    };
+    return codecTable;
+}
+
+std::shared_ptr<CompressCodec> CompressCodecFactory::GetCodec(const std::string &name)
+{
+    auto &table = CodecTable();
+    auto it = table.find(name);
+    if (it == table.end()) {
+        ERROR("Compress codec % is not supported.", name);
+        return nullptr;
+    }
+    try {
+        return it->second();
+    } catch (...) {
+        ERROR("Create compress codec % failed.", name);
+        return nullptr;
+    }
+}
+
+bool CompressCodecFactory::Register(const std::string &name, const CodecCreator &creator)
+{
+    if (name.empty() || name == CODEC_NONE || !creator) {
+        ERROR("Invalid compress codec to register: %.", name);
+        return false;
+    }
+    return CodecTable().emplace(name, creator).second;
+}
+}
+}
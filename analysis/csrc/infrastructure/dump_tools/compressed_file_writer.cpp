@@ -0,0 +1,293 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#include "analysis/csrc/infrastructure/dump_tools/include/compressed_file_writer.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "analysis/csrc/infrastructure/dfx/log.h"
+#include "analysis/csrc/infrastructure/utils/utils.h"
+
+namespace Analysis {
+namespace Infra {
+namespace {
+const std::size_t IN_FLIGHT_PER_THREAD = 2;  // 每个线程一个在压缩的块，一个等待落盘的块
+}
+
+const uint32_t CompressedFileWriter::DEFAULT_THREADS_NUM;
+const std::size_t CompressedFileWriter::DEFAULT_BLOCK_SIZE;
+const std::size_t CompressedFileWriter::TAIL_RESERVE_SIZE;
+
+CompressedFileWriter::CompressedFileWriter(const std::shared_ptr<CompressCodec> &codec, uint32_t threadsNum,
+                                           std::size_t blockSize)
+    : codec_(codec), pool_(std::max(threadsNum, 1U)), blockSize_(std::max(blockSize, TAIL_RESERVE_SIZE)),
+      maxInFlight_(std::max(threadsNum, 1U) * IN_FLIGHT_PER_THREAD)
+{}
+
+CompressedFileWriter::~CompressedFileWriter()
+{
+    if (IsOpen()) {
+        Close();
+    }
+}
+
+bool CompressedFileWriter::Open(const std::string &path, const std::ios_base::openmode &mode)
+{
+    if (codec_ == nullptr) {
+        ERROR("The compress codec is nullptr, can't open %.", path);
+        return false;
+    }
+    if (IsOpen() || started_) {
+        ERROR("The CompressedFileWriter has been opened: '%'.", path);
+        return false;
+    }
+    fileWriter_.Open(path, mode | std::ios::binary);
+    if (!fileWriter_.IsOpen()) {
+        ERROR("Open compressed file '%' failed.", path);
+        return false;
+    }
+    try {
+        pending_.reserve(blockSize_ + TAIL_RESERVE_SIZE);
+    } catch (...) {
+        ERROR("Reserve compress buffer failed.");
+        fileWriter_.Close();
+        return false;
+    }
+    started_ = pool_.Start();
+    if (!started_) {
+        fileWriter_.Close();
+    }
+    return started_;
+}
+
+bool CompressedFileWriter::IsOpen() const
+{
+    return fileWriter_.IsOpen();
+}
+
+std::size_t CompressedFileWriter::GetMemoryBound() const
+{
+    if (codec_ == nullptr) {
+        return 0;
+    }
+    return maxInFlight_ * (blockSize_ + codec_->Bound(blockSize_)) + blockSize_ + TAIL_RESERVE_SIZE;
+}
+
+bool CompressedFileWriter::Write(const char *content, std::size_t len)
+{
+    std::lock_guard<std::mutex> writeLock(writeMutex_);
+    if (!IsOpen()) {
+        ERROR("The CompressedFileWriter is not opened.");
+        return false;
+    }
+    if (content == nullptr && len != 0) {
+        ERROR("The content to write is nullptr.");
+        return false;
+    }
+    // pending_中始终保留最后写入的数据，满足WriteBack回退要求
+    const std::size_t limit = blockSize_ + TAIL_RESERVE_SIZE;
+    while (len > 0) {
+        if (pending_.size() >= limit) {
+            SubmitBlock(blockSize_);
+        }
+        auto take = std::min(len, limit - pending_.size());
+        pending_.append(content, take);
+        content += take;
+        len -= take;
+    }
+    return !failed_;
+}
+
+bool CompressedFileWriter::WriteBack(const std::string &content, int back)
+{
+    std::lock_guard<std::mutex> writeLock(writeMutex_);
+    if (!IsOpen()) {
+        ERROR("The CompressedFileWriter is not opened.");
+        return false;
+    }
+    std::size_t backLen = static_cast<std::size_t>(std::abs(back));
+    if (backLen > pending_.size()) {
+        ERROR("The offset % is over the uncompressed tail range %.", back, pending_.size());
+        return false;
+    }
+    pending_.resize(pending_.size() - backLen);
+    pending_.append(content);
+    return true;
+}
+
+bool CompressedFileWriter::Close()
+{
+    std::lock_guard<std::mutex> writeLock(writeMutex_);
+    if (!IsOpen()) {
+        return !failed_;
+    }
+    if (!pending_.empty()) {
+        SubmitBlock(pending_.size());
+    }
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (!inFlight_.empty()) {
+            FlushFrontBlock(lock);
+        }
+    }
+    pool_.Stop();
+    fileWriter_.Close();
+    std::string().swap(pending_);
+    if (failed_) {
+        ERROR("Some blocks failed to be compressed.");
+    }
+    return !failed_;
+}
+
+void CompressedFileWriter::SubmitBlock(std::size_t len)
+{
+    std::shared_ptr<Block> block;
+    MAKE_SHARED0_NO_OPERATION(block, Block);
+    if (block == nullptr) {
+        failed_ = true;
+        pending_.erase(0, len);
+        return;
+    }
+    block->input.assign(pending_, 0, len);
+    pending_.erase(0, len);
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        // 在途块达到上限时，先将最早的块落盘，保证内存上限
+        while (inFlight_.size() >= maxInFlight_) {
+            FlushFrontBlock(lock);
+        }
+        inFlight_.push_back(block);
+    }
+    pool_.AddTask([this, block]() {
+        bool ret = codec_->Compress(block->input.data(), block->input.size(), block->output);
+        std::string().swap(block->input);
+        std::lock_guard<std::mutex> lock(mutex_);
+        block->success = ret;
+        block->done = true;
+        blockDone_.notify_all();
+    });
+}
+
+void CompressedFileWriter::FlushFrontBlock(std::unique_lock<std::mutex> &lock)
+{
+    auto block = inFlight_.front();
+    blockDone_.wait(lock, [&block] { return block->done; });
+    inFlight_.pop_front();
+    // 落盘时释放锁，不阻塞压缩线程
+    lock.unlock();
+    if (block->success) {
+        fileWriter_.WriteText(block->output.data(), block->output.size());
+    } else {
+        failed_ = true;
+    }
+    lock.lock();
+}
+
+bool CompressedSink::SetCodec(const std::string &name)
+{
+    std::shared_ptr<CompressCodec> codec;
+    if (!name.empty() && name != CODEC_NONE) {
+        codec = CompressCodecFactory::GetCodec(name);
+        if (codec == nullptr) {
+            return false;
+        }
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    codec_ = codec;
+    INFO("Output compression is set to %.", name.empty() ? CODEC_NONE : name);
+    return true;
+}
+
+bool CompressedSink::IsEnabled() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return codec_ != nullptr;
+}
+
+std::string CompressedSink::GetFilePath(const std::string &fileName) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return codec_ == nullptr ? fileName : fileName + codec_->Suffix();
+}
+
+std::shared_ptr<CompressedFileWriter> CompressedSink::GetWriter(const std::string &fileName)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = writers_.find(fileName);
+    if (it != writers_.end()) {
+        return it->second;
+    }
+    if (codec_ == nullptr) {
+        ERROR("Output compression is not enabled.");
+        return nullptr;
+    }
+    std::shared_ptr<CompressedFileWriter> writer;
+    MAKE_SHARED_RETURN_VALUE(writer, CompressedFileWriter, nullptr, codec_);
+    if (!writer->Open(fileName + codec_->Suffix())) {
+        return nullptr;
+    }
+    writers_.emplace(fileName, writer);
+    return writer;
+}
+
+bool CompressedSink::Append(const std::string &fileName, const char *content, std::size_t len)
+{
+    auto writer = GetWriter(fileName);
+    return writer != nullptr && writer->Write(content, len);
+}
+
+bool CompressedSink::WriteBack(const std::string &fileName, const std::string &content, int back)
+{
+    std::shared_ptr<CompressedFileWriter> writer;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = writers_.find(fileName);
+        if (it == writers_.end()) {
+            ERROR("The compressed file of % is not opened.", fileName);
+            return false;
+        }
+        writer = it->second;
+    }
+    return writer->WriteBack(content, back);
+}
+
+bool CompressedSink::Close(const std::string &fileName)
+{
+    std::shared_ptr<CompressedFileWriter> writer;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = writers_.find(fileName);
+        if (it == writers_.end()) {
+            return true;
+        }
+        writer = it->second;
+        writers_.erase(it);
+    }
+    return writer->Close();
+}
+
+bool CompressedSink::WriteFile(const std::string &fileName, const std::string &content)
+{
+    auto writer = GetWriter(fileName);
+    if (writer == nullptr) {
+        return false;
+    }
+    bool ret = writer->Write(content.data(), content.size());
+    return Close(fileName) && ret;
+}
+}
+}
@@ -18,6 +18,7 @@
 
 #include "analysis/csrc/application/summary/summary_constant.h"
 #include "analysis/csrc/infrastructure/dfx/log.h"
+#include "analysis/csrc/infrastructure/dump_tools/include/compressed_file_writer.h"
 #include "analysis/csrc/infrastructure/dump_tools/include/sync_utils.h"
 
 namespace Analysis {
@@ -60,6 +61,10 @@ void CsvWriter::DumpCsvFile(const std::string& filePath, const std::vector<std::
         }
         textStr.append("\n");
     }
+    if (CompressedSink::GetInstance().IsEnabled()) {
+        CompressedSink::GetInstance().WriteFile(filePath, textStr);
+        return;
+    }
     Utils::FileWriter fileWriter(filePath);
     fileWriter.WriteText(textStr);
 }
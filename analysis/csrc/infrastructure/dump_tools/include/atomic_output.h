@@ -0,0 +1,53 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#ifndef ANALYSIS_INFRASTRUCTURE_DUMP_TOOLS_INCLUDE_ATOMIC_OUTPUT_H
+#define ANALYSIS_INFRASTRUCTURE_DUMP_TOOLS_INCLUDE_ATOMIC_OUTPUT_H
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "analysis/csrc/infrastructure/utils/singleton.h"
+
+namespace Analysis {
+namespace Infra {
+// 导出产物的原子落盘
+// Stage登记目标文件并返回同目录下的隐藏临时文件(.<name>.tmp)，写入过程只作用于临时文件；
+// 写完后Publish将临时文件rename为目标文件，取消或失败时Discard删除临时文件。
+// 中途被杀死的运行只会留下隐藏的临时文件，不会被按前缀查找产物的逻辑(如CheckMsprofDb)匹配，
+// 下次导出时由RemoveStale清理。DumpTool写入前通过Resolve将目标文件名映射为临时文件名。
+class AtomicOutput : public Utils::Singleton<AtomicOutput> {
+public:
+    std::string Stage(const std::string &path);
+    // 已登记的目标文件返回其临时文件，否则原样返回
+    std::string Resolve(const std::string &path) const;
+    // suffix为落盘时追加的后缀(如压缩后缀)，临时文件与目标文件均追加后再rename
+    bool Publish(const std::string &path, const std::string &suffix = "");
+    void Discard(const std::string &path, const std::string &suffix = "");
+    // 删除dir下残留的临时文件，跳过当前登记中的文件
+    void RemoveStale(const std::string &dir);
+
+    static std::string GetTempPath(const std::string &path);
+
+private:
+    std::unordered_map<std::string, std::string> staged_;  // 目标文件 -> 临时文件
+    mutable std::mutex mutex_;
+};
+}
+}
+
+#endif // ANALYSIS_INFRASTRUCTURE_DUMP_TOOLS_INCLUDE_ATOMIC_OUTPUT_H
@@ -0,0 +1,74 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#ifndef ANALYSIS_INFRASTRUCTURE_DUMP_TOOLS_INCLUDE_COMPRESS_CODEC_H
+#define ANALYSIS_INFRASTRUCTURE_DUMP_TOOLS_INCLUDE_COMPRESS_CODEC_H
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace Analysis {
+namespace Infra {
+
+const std::string CODEC_NONE = "none";
+const std::string CODEC_GZIP = "gzip";
+
+// 压缩算法接口，每次Compress生成一个可独立解压的数据块(成员)
+// 要求编码格式支持多个数据块直接拼接(如gzip多成员)，以便多线程分块压缩后顺序落盘
+class CompressCodec {
+public:
+    virtual ~CompressCodec() = default;
+    // 压缩文件名后缀，如".gz"
+    virtual const std::string &Suffix() const = 0;
+    // 压缩len字节数据的最坏输出大小，用于估算内存上限
+    virtual std::size_t Bound(std::size_t len) const = 0;
+    // 将src压缩为一个独立数据块，覆盖写入dst，线程安全
+    virtual bool Compress(const char *src, std::size_t len, std::string &dst) const = 0;
+};
+
+class GzipCodec final : public CompressCodec {
+public:
+    explicit GzipCodec(int level = DEFAULT_LEVEL) : level_(level) {}
+    const std::string &Suffix() const override;
+    std::size_t Bound(std::size_t len) const override;
+    bool Compress(const char *src, std::size_t len, std::string &dst) const override;
+
+public:
+    // 6为zlib默认压缩等级，压缩率与速度较均衡
+    static const int DEFAULT_LEVEL = 6;
+
+private:
+    int level_;
+};
+
+using CodecCreator = std::function<std::shared_ptr<CompressCodec>()>;
+class CompressCodecFactory {
+public:
+    // 根据名称获取压缩算法，不支持时返回nullptr
+    static std::shared_ptr<CompressCodec> GetCodec(const std::string &name);
+    // 注册新的压缩算法，名称已存在时返回false
+    static bool Register(const std::string &name, const CodecCreator &creator);
+
+private:
+    static std::unordered_map<std::string, CodecCreator> &CodecTable();
+};
+}
+}
+
+#endif // ANALYSIS_INFRASTRUCTURE_DUMP_TOOLS_INCLUDE_COMPRESS_CODEC_H
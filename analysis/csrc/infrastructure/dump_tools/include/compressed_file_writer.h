@@ -0,0 +1,113 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#ifndef ANALYSIS_INFRASTRUCTURE_DUMP_TOOLS_INCLUDE_COMPRESSED_FILE_WRITER_H
+#define ANALYSIS_INFRASTRUCTURE_DUMP_TOOLS_INCLUDE_COMPRESSED_FILE_WRITER_H
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "analysis/csrc/infrastructure/dump_tools/include/compress_codec.h"
+#include "analysis/csrc/infrastructure/utils/file.h"
+#include "analysis/csrc/infrastructure/utils/singleton.h"
+#include "analysis/csrc/infrastructure/utils/thread_pool.h"
+
+namespace Analysis {
+namespace Infra {
+
+// 分块多线程压缩写文件
+// 1. 输入按blockSize切块，由线程池并行压缩，压缩结果按写入顺序落盘
+// 2. 同时在途的数据块不超过2倍线程数，内存上限与文件大小无关，见GetMemoryBound
+// 3. 末尾保留少量未压缩数据，支持WriteBack覆盖文件末尾内容(如json末尾的",")
+class CompressedFileWriter {
+public:
+    CompressedFileWriter(const std::shared_ptr<CompressCodec> &codec, uint32_t threadsNum = DEFAULT_THREADS_NUM,
+                         std::size_t blockSize = DEFAULT_BLOCK_SIZE);
+    ~CompressedFileWriter();
+    CompressedFileWriter(const CompressedFileWriter &) = delete;
+    CompressedFileWriter &operator=(const CompressedFileWriter &) = delete;
+
+    // path为压缩后的文件全路径，mode为std::ios::out或std::ios::app
+    bool Open(const std::string &path, const std::ios_base::openmode &mode = std::ios::out);
+    bool Write(const char *content, std::size_t len);
+    // 与FileWriter::WriteTextBack语义一致：从末尾回退back个字节后写入content
+    bool WriteBack(const std::string &content, int back);
+    // 压缩剩余数据并等待全部数据块落盘
+    bool Close();
+    bool IsOpen() const;
+    std::size_t GetMemoryBound() const;
+
+public:
+    static const uint32_t DEFAULT_THREADS_NUM = 4;
+    static const std::size_t DEFAULT_BLOCK_SIZE = 1024 * 1024;  // 1MB
+    static const std::size_t TAIL_RESERVE_SIZE = 64;  // WriteBack可回退的最大字节数
+
+private:
+    struct Block {
+        std::string input;
+        std::string output;
+        bool done = false;
+        bool success = false;
+    };
+    void SubmitBlock(std::size_t len);
+    void FlushFrontBlock(std::unique_lock<std::mutex> &lock);
+
+private:
+    std::shared_ptr<CompressCodec> codec_;
+    Utils::ThreadPool pool_;
+    Utils::FileWriter fileWriter_;
+    std::size_t blockSize_;
+    std::size_t maxInFlight_;
+    std::string pending_;
+    std::deque<std::shared_ptr<Block>> inFlight_;
+    std::mutex writeMutex_;  // 串行化Write/WriteBack/Close
+    std::mutex mutex_;       // 保护inFlight_及块的完成状态
+    std::condition_variable blockDone_;
+    bool started_ = false;
+    bool failed_ = false;
+};
+
+// 压缩落盘的全局配置与打开中的压缩文件管理，由DumpTool和CsvWriter使用
+// 传入的文件名均为未压缩文件名，实际落盘文件名追加压缩后缀
+class CompressedSink : public Utils::Singleton<CompressedSink> {
+public:
+    // name为空或"none"时关闭压缩，不支持的压缩算法返回false
+    bool SetCodec(const std::string &name);
+    bool IsEnabled() const;
+    std::string GetFilePath(const std::string &fileName) const;
+    // 追加写入，文件在Close前保持打开
+    bool Append(const std::string &fileName, const char *content, std::size_t len);
+    bool WriteBack(const std::string &fileName, const std::string &content, int back);
+    bool Close(const std::string &fileName);
+    // 一次性写入完整文件
+    bool WriteFile(const std::string &fileName, const std::string &content);
+
+private:
+    std::shared_ptr<CompressedFileWriter> GetWriter(const std::string &fileName);
+
+private:
+    std::shared_ptr<CompressCodec> codec_;
+    std::unordered_map<std::string, std::shared_ptr<CompressedFileWriter>> writers_;
+    mutable std::mutex mutex_;
+};
+}
+}
+
+#endif // ANALYSIS_INFRASTRUCTURE_DUMP_TOOLS_INCLUDE_COMPRESSED_FILE_WRITER_H
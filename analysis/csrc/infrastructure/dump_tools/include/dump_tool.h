@@ -17,6 +17,8 @@
 #ifndef ANALYSIS_INFRASTRUCTURE_DUMP_TOOLS_INCLUDE_DUMP_TOOL_H
 #define ANALYSIS_INFRASTRUCTURE_DUMP_TOOLS_INCLUDE_DUMP_TOOL_H
 
+#include "analysis/csrc/infrastructure/dump_tools/include/atomic_output.h"
+#include "analysis/csrc/infrastructure/dump_tools/include/compressed_file_writer.h"
 #include "analysis/csrc/infrastructure/dump_tools/include/serialization_helper.h"
 #include "analysis/csrc/infrastructure/dump_tools/include/sync_utils.h"
 #include "analysis/csrc/infrastructure/dfx/log.h"
@@ -41,10 +43,12 @@ void DumpInCsvFormat(OStream& oStream, const std::tuple<Args...>& tp)
     SerializationHelper<sizeof...(Args), OStream, decltype(tp)>::DumpInCsvFormat(oStream, tp);
 }
 
+// 目标文件经AtomicOutput登记后，实际写入其临时文件
 class DumpTool {
 public:
-    static bool WriteToFile(const std::string &fileName, const char *content, std::size_t len, FileCategory type)
+    static bool WriteToFile(const std::string &targetName, const char *content, std::size_t len, FileCategory type)
     {
+        auto fileName = AtomicOutput::GetInstance().Resolve(targetName);
         if (content == nullptr || len == 0) {
             ERROR("The content to write is nullptr, or the length to write is zero!");
             return false;
@@ -55,10 +59,28 @@ public:
             return false;
         }
         std::lock_guard<std::mutex> lock(it->second.fileMutex_);
+        // 开启压缩时文件保持打开，由WriteBackAndClose结束压缩落盘
+        if (CompressedSink::GetInstance().IsEnabled()) {
+            return CompressedSink::GetInstance().Append(fileName, content, len);
+        }
         FileWriter fileWriter(fileName, std::ios::app);
         fileWriter.WriteText(content, len);
         return true;
     }
+
+    // 覆盖文件末尾back个字节，并结束该文件的写入
+    static bool WriteBackAndClose(const std::string &targetName, const std::string &content, int back)
+    {
+        auto fileName = AtomicOutput::GetInstance().Resolve(targetName);
+        if (CompressedSink::GetInstance().IsEnabled()) {
+            bool ret = CompressedSink::GetInstance().WriteBack(fileName, content, back);
+            return CompressedSink::GetInstance().Close(fileName) && ret;
+        }
+        // 实测必须使用in、out、ate三种模式打开文件，才可以实现覆盖写入
+        FileWriter writer(fileName, std::ios::in | std::ios::out | std::ios::ate);
+        writer.WriteTextBack(content, back);
+        return true;
+    }
 };
 
 }
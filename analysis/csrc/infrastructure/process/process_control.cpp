@@ -20,6 +20,9 @@
 #include <sstream>
 #include <set>
 #include "analysis/csrc/infrastructure/process/process_topo.h"
+#include "analysis/csrc/infrastructure/utils/arena_allocator.h"
+#include "analysis/csrc/infrastructure/utils/run_control.h"
+#include "analysis/csrc/infrastructure/utils/self_trace.h"
 
 namespace Analysis {
 
@@ -98,8 +101,15 @@ private:
         auto regProcessCopy = chipRelatedProcess; // 这里COPY一份是为了DFX中填dependProcess字段
 
         size_t levelIndex = 0;
+        auto &runControl = Analysis::Utils::RunControl::GetInstance();
+        runControl.SetStage("parse");
         auto preparedProcess = TakeAwayPreparedProcess(chipRelatedProcess);
         while (!preparedProcess.empty()) {
+            // 取消只在层间生效，已开始的Process运行完成后再退出
+            if (runControl.IsCancelled()) {
+                WARN("Process execution is cancelled before level %.", levelIndex);
+                return false;
+            }
             std::vector<ProcessStatistics> stat(preparedProcess.size());
             Analysis::Utils::ThreadPool pool(preparedProcess.size());
             pool.Start();
@@ -138,9 +148,12 @@ private:
                     return;
                 }
                 auto proc = processNode.second.creator();
+                Analysis::Utils::TraceSpan span(Analysis::Utils::TRACE_CAT_PROCESS, processNode.second.processName,
+                                                true);
                 if (proc != nullptr) {
                     stat[concurrentIndex].returnCode = proc->Run(dataInventory, context);
                     stat[concurrentIndex].mandatory = processNode.second.mandatory;
+                    Analysis::Utils::RunControl::GetInstance().AddProcessDone();
                 }
                 auto endTime = std::chrono::steady_clock::now();
 
@@ -191,6 +204,10 @@ private:
             typeStr += " ";
         }
         INFO("Level[%]Release Data Types: %", levelIndex, typeStr);
+        // 释放的数据量较大，将分配器缓存的空闲内存归还系统，避免RSS在各level间只增不减
+        Analysis::Utils::TrimHeap();
+        INFO("Level[%]DataInventory resident bytes: %, peak bytes: %", levelIndex,
+             DataInventory::GetResidentBytes(), DataInventory::GetPeakResidentBytes());
     }
 
     ProcessCollection TakeAwayPreparedProcess(ProcessCollection& chipRelatedProcess) const
@@ -0,0 +1,251 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#include "analysis/csrc/infrastructure/utils/admission_controller.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "analysis/csrc/infrastructure/dfx/error_code.h"
+#include "analysis/csrc/infrastructure/dfx/log.h"
+#include "analysis/csrc/infrastructure/utils/utils.h"
+
+namespace Analysis {
+namespace Utils {
+namespace {
+const uint64_t BYTES_PER_KB = 1024;
+const uint64_t BYTES_PER_MB = 1024 * 1024;
+const double DEFAULT_FOOTPRINT_RATIO = 4.0;
+const double MIN_FOOTPRINT_RATIO = 1.0;
+const double MAX_FOOTPRINT_RATIO = 64.0;
+const double AVAILABLE_MEMORY_FRACTION = 0.8;
+// 输入较小时流水线的固定开销占主导，观测值不用于修正比例
+const uint64_t MIN_FEEDBACK_INPUT_BYTES = 16 * BYTES_PER_MB;
+// 单个job的估计占用下限
+const uint64_t MIN_ESTIMATE_BYTES = 64 * BYTES_PER_MB;
+const std::string PROC_STATUS = "/proc/self/status";
+const std::string PROC_MEMINFO = "/proc/meminfo";
+const std::string VM_RSS = "VmRSS:";
+const std::string VM_HWM = "VmHWM:";
+const std::string MEM_AVAILABLE = "MemAvailable:";
+
+// 读取"Key:   value kB"格式文件中的指定字段，返回字节数，读取失败返回0
+uint64_t ReadKbField(const std::string &path, const std::string &key)
+{
+    std::ifstream in(path);
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.compare(0, key.size(), key) != 0) {
+            continue;
+        }
+        std::istringstream iss(line.substr(key.size()));
+        uint64_t value = 0;
+        return (iss >> value) ? value * BYTES_PER_KB : 0;
+    }
+    return 0;
+}
+
+uint64_t ReadEnvU64(const char *name)
+{
+    const char *value = std::getenv(name);
+    uint64_t result = 0;
+    if (value == nullptr || *value == '\0' || StrToU64(result, value) != ANALYSIS_OK) {
+        return 0;
+    }
+    return result;
+}
+}  // namespace
+
+AdmissionController::AdmissionController(uint64_t memoryBudget, uint32_t cpuBudget)
+    : footprintRatio_(DEFAULT_FOOTPRINT_RATIO)
+{
+    auto envMemory = ReadEnvU64(ADMISSION_MEMORY_ENV);
+    auto envCpu = ReadEnvU64(ADMISSION_CPU_ENV);
+    if (memoryBudget == 0) {
+        memoryBudget = envMemory != 0 ? envMemory * BYTES_PER_MB :
+            static_cast<uint64_t>(ReadKbField(PROC_MEMINFO, MEM_AVAILABLE) * AVAILABLE_MEMORY_FRACTION);
+    }
+    if (cpuBudget == 0) {
+        cpuBudget = envCpu != 0 ? static_cast<uint32_t>(std::min<uint64_t>(envCpu, UINT32_MAX)) :
+            std::thread::hardware_concurrency();
+    }
+    memoryBudget_ = memoryBudget;
+    cpuBudget_ = std::max(cpuBudget, 1U);
+    baselineRss_ = ReadKbField(PROC_STATUS, VM_RSS);
+    // 之前阶段的峰值可能高于本轮，峰值高于起始值时才以VmHWM作为观测值，否则使用job结束时的采样
+    baselineHwm_ = ReadKbField(PROC_STATUS, VM_HWM);
+}
+
+size_t AdmissionController::AddJob(uint64_t inputBytes, uint32_t weight)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    AdmissionJob job;
+    job.inputBytes = inputBytes;
+    job.weight = std::min(std::max(weight, 1U), cpuBudget_);
+    jobs_.emplace_back(job);
+    return jobs_.size() - 1;
+}
+
+std::vector<size_t> AdmissionController::Plan()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    order_.resize(jobs_.size());
+    std::iota(order_.begin(), order_.end(), 0);
+    std::stable_sort(order_.begin(), order_.end(), [this](size_t lhs, size_t rhs) {
+        return jobs_[lhs].inputBytes > jobs_[rhs].inputBytes;
+    });
+    next_ = 0;
+    INFO("Admission plans % jobs, memory budget is % bytes, cpu budget is %, footprint ratio is %.", jobs_.size(),
+         memoryBudget_, cpuBudget_, GetFootprintRatio());
+    return order_;
+}
+
+uint64_t AdmissionController::Estimate(uint64_t inputBytes) const
+{
+    return std::max(MIN_ESTIMATE_BYTES, static_cast<uint64_t>(inputBytes * GetFootprintRatio()));
+}
+
+bool AdmissionController::CanAdmit(const AdmissionJob &job, uint64_t estimate) const
+{
+    if (running_ == 0) {
+        return true;
+    }
+    if (usedCpu_ + job.weight > cpuBudget_) {
+        return false;
+    }
+    return memoryBudget_ == 0 || usedMemory_ + estimate <= memoryBudget_;
+}
+
+bool AdmissionController::Acquire(size_t job)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (job >= jobs_.size() || std::find(order_.begin() + next_, order_.end(), job) == order_.end()) {
+        ERROR("The admission job % is not planned or has been admitted.", job);
+        return false;
+    }
+    auto &item = jobs_[job];
+    admitted_.wait(lock, [this, job, &item]() {
+        return order_[next_] == job && CanAdmit(item, Estimate(item.inputBytes));
+    });
+    item.admittedBytes = Estimate(item.inputBytes);
+    item.admitted = true;
+    usedMemory_ += item.admittedBytes;
+    usedCpu_ += item.weight;
+    runningInput_ += item.inputBytes;
+    peakInput_ = std::max(peakInput_, runningInput_);
+    ++running_;
+    ++next_;
+    INFO("Admit job %, input is % bytes, estimate is % bytes, used memory is %/% bytes, used cpu is %/%.", job,
+         item.inputBytes, item.admittedBytes, usedMemory_, memoryBudget_, usedCpu_, cpuBudget_);
+    // 唤醒下一个job检查预算
+    admitted_.notify_all();
+    return true;
+}
+
+uint64_t AdmissionController::ObservePeakBytes()
+{
+    auto rss = ReadKbField(PROC_STATUS, VM_RSS);
+    sampledPeakRss_ = std::max(sampledPeakRss_, rss);
+    auto hwm = ReadKbField(PROC_STATUS, VM_HWM);
+    auto peak = hwm > baselineHwm_ ? std::max(hwm, sampledPeakRss_) : sampledPeakRss_;
+    auto growth = peak > baselineRss_ ? peak - baselineRss_ : 0;
+    // 已结束job的输出不属于运行中job的占用，不扣除时比例会随结束的job增多而持续上调
+    return growth > retainedBytes_ ? growth - retainedBytes_ : 0;
+}
+
+void AdmissionController::Release(size_t job)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (job >= jobs_.size() || !jobs_[job].admitted) {
+        return;
+    }
+    auto &item = jobs_[job];
+    item.admitted = false;
+    usedMemory_ -= item.admittedBytes;
+    usedCpu_ -= item.weight;
+    runningInput_ -= item.inputBytes;
+    --running_;
+    auto observed = ObservePeakBytes();
+    Feedback(observed, peakInput_);
+    if (retainedProbe_) {
+        auto retained = retainedProbe_();
+        retainedBytes_ = retained > baselineRetained_ ? retained - baselineRetained_ : 0;
+    }
+    INFO("Release job %, observed peak growth is % bytes, retained output is % bytes, footprint ratio is %.", job,
+         observed, retainedBytes_, GetFootprintRatio());
+    admitted_.notify_all();
+}
+
+uint64_t AdmissionController::GetMemoryBudget() const
+{
+    return memoryBudget_;
+}
+
+uint32_t AdmissionController::GetCpuBudget() const
+{
+    return cpuBudget_;
+}
+
+void AdmissionController::SetRetainedBytesProbe(std::function<uint64_t()> probe)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    retainedProbe_ = std::move(probe);
+    // 之前阶段保留的数据已计入起始RSS
+    baselineRetained_ = retainedProbe_ ? retainedProbe_() : 0;
+    retainedBytes_ = 0;
+}
+
+double AdmissionController::GetFootprintRatio() const
+{
+    return footprintRatio_.load();
+}
+
+void AdmissionController::SetFootprintRatio(double ratio)
+{
+    footprintRatio_.store(std::min(std::max(ratio, MIN_FOOTPRINT_RATIO), MAX_FOOTPRINT_RATIO));
+}
+
+void AdmissionController::Feedback(uint64_t observedBytes, uint64_t peakInputBytes)
+{
+    if (peakInputBytes < MIN_FEEDBACK_INPUT_BYTES || observedBytes == 0) {
+        return;
+    }
+    // 观测峰值与并发输入峰值均为本轮累计的最大值，二者之比即为本轮每字节输入的实际占用
+    // 仍在运行的job可能尚未达到峰值，低估比高估更危险：比例偏小时立即上调，偏大时只下调一半
+    auto sample = static_cast<double>(observedBytes) / static_cast<double>(peakInputBytes);
+    auto ratio = GetFootprintRatio();
+    SetFootprintRatio(sample >= ratio ? sample : (ratio + sample) / 2);  // 2: 取中值
+}
+
+AdmissionGuard::AdmissionGuard(AdmissionController &controller, size_t job) : controller_(controller), job_(job)
+{
+    admitted_ = controller_.Acquire(job_);
+}
+
+AdmissionGuard::~AdmissionGuard()
+{
+    if (admitted_) {
+        controller_.Release(job_);
+    }
+}
+}  // namespace Utils
+}  // namespace Analysis
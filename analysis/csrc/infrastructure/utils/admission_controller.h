@@ -0,0 +1,117 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#ifndef ANALYSIS_UTILS_ADMISSION_CONTROLLER_H
+#define ANALYSIS_UTILS_ADMISSION_CONTROLLER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace Analysis {
+namespace Utils {
+// 覆盖默认内存预算(MB)与CPU预算，未设置或为0时内存预算取可用内存的80%，CPU预算取全部cpu核
+const char * const ADMISSION_MEMORY_ENV = "MSPROF_ANALYSIS_ADMISSION_MEMORY_MB";
+const char * const ADMISSION_CPU_ENV = "MSPROF_ANALYSIS_ADMISSION_CPU";
+
+struct AdmissionJob {
+    uint64_t inputBytes = 0;
+    uint32_t weight = 1;          // 占用的CPU预算
+    uint64_t admittedBytes = 0;   // 准入时的估计内存占用，释放时归还
+    bool admitted = false;
+};
+
+// 并发流水线的准入控制
+// 按输入数据量估计每个job的内存占用(输入字节数 * 占用比例)，按估计从大到小依次准入，
+// 同时运行的job估计占用之和不超过内存预算，权重之和不超过CPU预算。严格按规划顺序准入，
+// 队首job预算不足时等待运行中的job结束，避免大job被小job持续插队；没有运行中的job时总是准入
+// job结束时用进程观测到的峰值RSS与同期并发输入量的峰值修正占用比例，供本轮后续job估计使用
+// 已结束job保留的输出(如DataInventory)仍计入RSS，通过SetRetainedBytesProbe读取并从观测值中扣除
+// 用法：
+//   AdmissionController controller;
+//   auto id = controller.AddJob(inputBytes);  ...
+//   for (auto job : controller.Plan()) { 启动线程：controller.Acquire(job); ... controller.Release(job); }
+class AdmissionController {
+public:
+    explicit AdmissionController(uint64_t memoryBudget = 0, uint32_t cpuBudget = 0);
+    AdmissionController(const AdmissionController &) = delete;
+    AdmissionController &operator=(const AdmissionController &) = delete;
+    // 登记job，返回job下标
+    size_t AddJob(uint64_t inputBytes, uint32_t weight = 1);
+    // 按估计占用从大到小确定准入顺序，估计相同时保持登记顺序
+    std::vector<size_t> Plan();
+    // 阻塞直到轮到该job且预算足够
+    bool Acquire(size_t job);
+    // job结束，归还预算并修正占用比例
+    void Release(size_t job);
+    uint64_t Estimate(uint64_t inputBytes) const;
+    uint64_t GetMemoryBudget() const;
+    uint32_t GetCpuBudget() const;
+    // 读取进程当前保留的输出字节数，需在Plan前设置
+    void SetRetainedBytesProbe(std::function<uint64_t()> probe);
+
+    // 每字节输入对应的内存占用
+    double GetFootprintRatio() const;
+    void SetFootprintRatio(double ratio);
+    // 并发输入量峰值为peakInputBytes时观测到observedBytes的内存增长，更新占用比例
+    void Feedback(uint64_t observedBytes, uint64_t peakInputBytes);
+
+private:
+    bool CanAdmit(const AdmissionJob &job, uint64_t estimate) const;
+    uint64_t ObservePeakBytes();
+
+private:
+    std::mutex mutex_;
+    std::condition_variable admitted_;
+    std::vector<AdmissionJob> jobs_;
+    std::vector<size_t> order_;
+    size_t next_ = 0;
+    size_t running_ = 0;
+    uint64_t memoryBudget_ = 0;   // 0表示不限制
+    uint32_t cpuBudget_ = 1;
+    uint64_t usedMemory_ = 0;
+    uint32_t usedCpu_ = 0;
+    uint64_t runningInput_ = 0;
+    uint64_t peakInput_ = 0;
+    uint64_t baselineRss_ = 0;
+    uint64_t baselineHwm_ = 0;
+    uint64_t sampledPeakRss_ = 0;
+    std::function<uint64_t()> retainedProbe_;
+    uint64_t baselineRetained_ = 0;
+    uint64_t retainedBytes_ = 0;  // 已结束job保留的输出字节数
+    std::atomic<double> footprintRatio_;
+};
+
+// 作用域内持有准入，析构时释放
+class AdmissionGuard {
+public:
+    AdmissionGuard(AdmissionController &controller, size_t job);
+    ~AdmissionGuard();
+    AdmissionGuard(const AdmissionGuard &) = delete;
+    AdmissionGuard &operator=(const AdmissionGuard &) = delete;
+
+private:
+    AdmissionController &controller_;
+    size_t job_;
+    bool admitted_ = false;
+};
+}  // namespace Utils
+}  // namespace Analysis
+
+#endif  // ANALYSIS_UTILS_ADMISSION_CONTROLLER_H
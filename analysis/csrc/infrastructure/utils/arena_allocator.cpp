@@ -0,0 +1,242 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#include "analysis/csrc/infrastructure/utils/arena_allocator.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <mutex>
+
+#if defined(ANALYSIS_ALLOCATOR_JEMALLOC)
+#include <jemalloc/jemalloc.h>
+#elif defined(ANALYSIS_ALLOCATOR_TCMALLOC)
+#include <gperftools/malloc_extension_c.h>
+#include <gperftools/tcmalloc.h>
+#elif defined(ANALYSIS_ALLOCATOR_MIMALLOC)
+#include <mimalloc.h>
+#elif defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#include "analysis/csrc/infrastructure/dfx/log.h"
+
+namespace Analysis {
+namespace Utils {
+namespace {
+// 超过块大小的1/4时单独申请一块
+const size_t LARGE_ALLOCATION_DIVISOR = 4;
+const size_t MIN_CHUNK_SIZE = 4096;
+
+std::mutex g_stageStatsMutex;
+std::map<std::string, ArenaStageScope::StageStats> g_stageStats;
+thread_local uint32_t g_stageDepth = 0;
+
+inline size_t AlignUp(size_t value, size_t align)
+{
+    return (value + align - 1) & ~(align - 1);
+}
+
+int64_t GetHeapInUse()
+{
+#if !defined(ANALYSIS_ALLOCATOR_JEMALLOC) && !defined(ANALYSIS_ALLOCATOR_TCMALLOC) && \
+    !defined(ANALYSIS_ALLOCATOR_MIMALLOC) && defined(__GLIBC__) && __GLIBC_PREREQ(2, 33)
+    return static_cast<int64_t>(mallinfo2().uordblks);
+#else
+    return 0;
+#endif
+}
+}  // namespace
+
+void *HeapAllocate(size_t size)
+{
+#if defined(ANALYSIS_ALLOCATOR_JEMALLOC)
+    return size == 0 ? nullptr : mallocx(size, 0);
+#elif defined(ANALYSIS_ALLOCATOR_TCMALLOC)
+    return tc_malloc(size);
+#elif defined(ANALYSIS_ALLOCATOR_MIMALLOC)
+    return mi_malloc(size);
+#else
+    return std::malloc(size);
+#endif
+}
+
+void HeapFree(void *ptr)
+{
+    if (ptr == nullptr) {
+        return;
+    }
+#if defined(ANALYSIS_ALLOCATOR_JEMALLOC)
+    dallocx(ptr, 0);
+#elif defined(ANALYSIS_ALLOCATOR_TCMALLOC)
+    tc_free(ptr);
+#elif defined(ANALYSIS_ALLOCATOR_MIMALLOC)
+    mi_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+const char *HeapBackendName()
+{
+#if defined(ANALYSIS_ALLOCATOR_JEMALLOC)
+    return "jemalloc";
+#elif defined(ANALYSIS_ALLOCATOR_TCMALLOC)
+    return "tcmalloc";
+#elif defined(ANALYSIS_ALLOCATOR_MIMALLOC)
+    return "mimalloc";
+#else
+    return "malloc";
+#endif
+}
+
+void TrimHeap()
+{
+#if defined(ANALYSIS_ALLOCATOR_JEMALLOC)
+    static const std::string purgeCmd = "arena." + std::to_string(MALLCTL_ARENAS_ALL) + ".purge";
+    mallctl(purgeCmd.c_str(), nullptr, nullptr, nullptr, 0);
+#elif defined(ANALYSIS_ALLOCATOR_TCMALLOC)
+    MallocExtension_ReleaseFreeMemory();
+#elif defined(ANALYSIS_ALLOCATOR_MIMALLOC)
+    mi_collect(true);
+#elif defined(__GLIBC__)
+    malloc_trim(0);
+#endif
+}
+
+const size_t Arena::DEFAULT_CHUNK_SIZE;
+
+Arena::Arena(size_t chunkSize) : chunkSize_(std::max(chunkSize, MIN_CHUNK_SIZE)) {}
+
+Arena::~Arena()
+{
+    Release();
+}
+
+char *Arena::NewChunk(size_t size)
+{
+    auto chunk = static_cast<Chunk *>(HeapAllocate(size));
+    if (chunk == nullptr) {
+        ERROR("Allocate arena chunk of % bytes failed.", size);
+        return nullptr;
+    }
+    chunk->next = head_;
+    chunk->size = size;
+    head_ = chunk;
+    stats_.chunks++;
+    stats_.chunkBytes += size;
+    return reinterpret_cast<char *>(chunk) + sizeof(Chunk);
+}
+
+void *Arena::Allocate(size_t size, size_t align)
+{
+    if (align == 0 || (align & (align - 1)) != 0) {
+        ERROR("The arena alignment % is not a power of 2.", align);
+        return nullptr;
+    }
+    size = std::max(size, static_cast<size_t>(1));
+    char *ptr = nullptr;
+    if (size * LARGE_ALLOCATION_DIVISOR > chunkSize_) {
+        // 大对象单独一块，当前块的剩余空间继续使用
+        auto begin = NewChunk(sizeof(Chunk) + size + align);
+        if (begin == nullptr) {
+            return nullptr;
+        }
+        ptr = reinterpret_cast<char *>(AlignUp(reinterpret_cast<uintptr_t>(begin), align));
+    } else {
+        ptr = reinterpret_cast<char *>(AlignUp(reinterpret_cast<uintptr_t>(cur_), align));
+        if (cur_ == nullptr || ptr + size > end_) {
+            auto begin = NewChunk(chunkSize_);
+            if (begin == nullptr) {
+                return nullptr;
+            }
+            end_ = begin + chunkSize_ - sizeof(Chunk);
+            ptr = reinterpret_cast<char *>(AlignUp(reinterpret_cast<uintptr_t>(begin), align));
+        }
+        cur_ = ptr + size;
+    }
+    stats_.allocations++;
+    stats_.bytes += size;
+    return ptr;
+}
+
+void Arena::Release()
+{
+    while (head_ != nullptr) {
+        auto next = head_->next;
+        HeapFree(head_);
+        head_ = next;
+    }
+    cur_ = end_ = nullptr;
+}
+
+const ArenaStats &Arena::GetStats() const
+{
+    return stats_;
+}
+
+Arena &StageArena()
+{
+    thread_local Arena arena;
+    return arena;
+}
+
+ArenaStageScope::ArenaStageScope(const std::string &stage)
+    : stage_(stage), begin_(StageArena().GetStats()), heapBegin_(GetHeapInUse())
+{
+    ++g_stageDepth;
+}
+
+ArenaStageScope::~ArenaStageScope()
+{
+    auto &arena = StageArena();
+    const auto &end = arena.GetStats();
+    StageStats stats;
+    stats.count = 1;
+    stats.arena.allocations = end.allocations - begin_.allocations;
+    stats.arena.bytes = end.bytes - begin_.bytes;
+    stats.arena.chunks = end.chunks - begin_.chunks;
+    stats.arena.chunkBytes = end.chunkBytes - begin_.chunkBytes;
+    if (--g_stageDepth == 0) {
+        arena.Release();
+    }
+    stats.heapDelta = GetHeapInUse() - heapBegin_;
+    if (stats.arena.allocations != 0) {
+        INFO("Stage % arena allocations: %, bytes: %, chunk bytes: %, heap delta: %, heap backend: %.", stage_,
+             stats.arena.allocations, stats.arena.bytes, stats.arena.chunkBytes, stats.heapDelta, HeapBackendName());
+    }
+    std::lock_guard<std::mutex> lock(g_stageStatsMutex);
+    auto &total = g_stageStats[stage_];
+    total.count += stats.count;
+    total.arena.allocations += stats.arena.allocations;
+    total.arena.bytes += stats.arena.bytes;
+    total.arena.chunks += stats.arena.chunks;
+    total.arena.chunkBytes += stats.arena.chunkBytes;
+    total.heapDelta += stats.heapDelta;
+}
+
+std::map<std::string, ArenaStageScope::StageStats> ArenaStageScope::GetStageStats()
+{
+    std::lock_guard<std::mutex> lock(g_stageStatsMutex);
+    return g_stageStats;
+}
+
+void ArenaStageScope::ClearStageStats()
+{
+    std::lock_guard<std::mutex> lock(g_stageStatsMutex);
+    g_stageStats.clear();
+}
+}  // namespace Utils
+}  // namespace Analysis
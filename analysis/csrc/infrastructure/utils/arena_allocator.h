@@ -0,0 +1,159 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#ifndef ANALYSIS_UTILS_ARENA_ALLOCATOR_H
+#define ANALYSIS_UTILS_ARENA_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Analysis {
+namespace Utils {
+// 通用内存分配后端，编译选项MSPROF_ANALYSIS_ALLOCATOR为jemalloc/tcmalloc/mimalloc时使用对应分配器，
+// 否则使用glibc malloc。通过各分配器自有的接口调用，不替换进程的malloc，so被python加载时同样生效
+void *HeapAllocate(size_t size);
+void HeapFree(void *ptr);
+const char *HeapBackendName();
+// 将分配器缓存的空闲内存归还系统，用于阶段结束后降低RSS
+void TrimHeap();
+
+struct ArenaStats {
+    uint64_t allocations = 0;   // 分配次数
+    uint64_t bytes = 0;         // 申请的字节数
+    uint64_t chunks = 0;        // 向后端申请的块数
+    uint64_t chunkBytes = 0;    // 向后端申请的字节数
+};
+
+// 单线程使用的bump分配器
+// 从大块内存中顺序切分，单次释放为空操作，Release时整体归还，适合阶段内大量生命周期相同的小对象
+// 超过块大小1/4的分配单独申请一块，避免浪费块尾部空间
+class Arena {
+public:
+    static const size_t DEFAULT_CHUNK_SIZE = 1024 * 1024;
+
+    explicit Arena(size_t chunkSize = DEFAULT_CHUNK_SIZE);
+    ~Arena();
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+    // 失败返回nullptr，align需为2的幂
+    void *Allocate(size_t size, size_t align = alignof(std::max_align_t));
+    // 释放全部块，之前分配的内存全部失效
+    void Release();
+    const ArenaStats &GetStats() const;
+
+private:
+    struct Chunk {
+        Chunk *next;
+        size_t size;
+    };
+    // 申请size字节的块并挂到链表头，返回块头之后的可用地址
+    char *NewChunk(size_t size);
+
+private:
+    size_t chunkSize_;
+    Chunk *head_ = nullptr;
+    char *cur_ = nullptr;
+    char *end_ = nullptr;
+    ArenaStats stats_;
+};
+
+// 基于Arena的STL分配器，deallocate为空操作，容器需在Arena释放前析构
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(Arena &arena) : arena_(&arena) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U> &other) : arena_(other.arena_) {}
+
+    T *allocate(size_t n)
+    {
+        auto ptr = arena_->Allocate(n * sizeof(T), alignof(T));
+        if (ptr == nullptr) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T *>(ptr);
+    }
+    void deallocate(T *, size_t) {}
+
+    template <typename U>
+    struct rebind {
+        using other = ArenaAllocator<U>;
+    };
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U> &other) const
+    {
+        return arena_ == other.arena_;
+    }
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U> &other) const
+    {
+        return arena_ != other.arena_;
+    }
+
+private:
+    template <typename U>
+    friend class ArenaAllocator;
+    Arena *arena_;
+};
+
+template <typename K, typename V, typename Hash = std::hash<K>, typename Eq = std::equal_to<K>>
+using ArenaUnorderedMap = std::unordered_map<K, V, Hash, Eq, ArenaAllocator<std::pair<const K, V>>>;
+template <typename K, typename V, typename Cmp = std::less<K>>
+using ArenaMap = std::map<K, V, Cmp, ArenaAllocator<std::pair<const K, V>>>;
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+// 阶段作用域
+// processor等阶段开始时创建，阶段内通过StageArena()取得当前线程的Arena保存阶段内的临时数据，
+// 最外层作用域结束时统一释放当前线程的Arena，并记录阶段内的Arena分配次数与堆内存变化
+// 嵌套的作用域只统计不释放，Arena中的数据不能在阶段结束后继续使用
+class ArenaStageScope {
+public:
+    explicit ArenaStageScope(const std::string &stage);
+    ~ArenaStageScope();
+    ArenaStageScope(const ArenaStageScope &) = delete;
+    ArenaStageScope &operator=(const ArenaStageScope &) = delete;
+
+    struct StageStats {
+        uint64_t count = 0;          // 阶段执行次数
+        ArenaStats arena;
+        int64_t heapDelta = 0;       // 阶段前后堆上已分配字节数的变化，仅glibc后端有效
+    };
+    // 各阶段的累计统计
+    static std::map<std::string, StageStats> GetStageStats();
+    static void ClearStageStats();
+
+private:
+    std::string stage_;
+    ArenaStats begin_;
+    int64_t heapBegin_ = 0;
+};
+
+// 当前线程的阶段Arena
+Arena &StageArena();
+}  // namespace Utils
+}  // namespace Analysis
+
+#endif  // ANALYSIS_UTILS_ARENA_ALLOCATOR_H
@@ -0,0 +1,184 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+/* 估算对象占用的内存字节数：对象自身大小加上其持有的堆内存(字符串缓冲区、容器元素、智能指针指向的对象)。
+   持有堆内存的自定义结构体需要在结构体所在命名空间中提供 uint64_t OwnedBytes(const T &) 重载，
+   一般写成 return Utils::OwnedBytesOf(obj.member1, obj.member2, ...); 未提供重载的类型按不持有堆内存计算 */
+
+#ifndef ANALYSIS_UTILS_BYTE_SIZE_H
+#define ANALYSIS_UTILS_BYTE_SIZE_H
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace Analysis {
+namespace Utils {
+namespace ByteSizeDetail {
+// 容器节点中除元素外的额外开销(libstdc++实现)：红黑树节点含颜色与三个指针，哈希表节点含next指针与缓存的哈希值
+const uint64_t TREE_NODE_OVERHEAD = 4 * sizeof(void *);
+const uint64_t HASH_NODE_OVERHEAD = 2 * sizeof(void *);
+
+// 重载决议中排在最后的兜底：平凡拷贝类型及未提供OwnedBytes重载的类型不计堆内存
+struct NoHeap {
+    template <typename T>
+    NoHeap(const T &) {}
+};
+inline uint64_t OwnedBytes(NoHeap)
+{
+    return 0;
+}
+
+inline uint64_t OwnedBytes(const std::string &str)
+{
+    // 短字符串存放在对象内部，不占用堆内存
+    const char *self = reinterpret_cast<const char *>(&str);
+    bool inlined = str.data() >= self && str.data() < self + sizeof(str);
+    return inlined ? 0 : str.capacity() + 1;
+}
+
+template <typename T, typename A>
+uint64_t OwnedBytes(const std::vector<T, A> &vec);
+template <typename K, typename V, typename C, typename A>
+uint64_t OwnedBytes(const std::map<K, V, C, A> &map);
+template <typename K, typename C, typename A>
+uint64_t OwnedBytes(const std::set<K, C, A> &set);
+template <typename K, typename V, typename H, typename E, typename A>
+uint64_t OwnedBytes(const std::unordered_map<K, V, H, E, A> &map);
+template <typename K, typename H, typename E, typename A>
+uint64_t OwnedBytes(const std::unordered_set<K, H, E, A> &set);
+template <typename F, typename S>
+uint64_t OwnedBytes(const std::pair<F, S> &pair);
+template <typename T>
+uint64_t OwnedBytes(const std::shared_ptr<T> &ptr);
+template <typename T, typename D>
+uint64_t OwnedBytes(const std::unique_ptr<T, D> &ptr);
+
+// 统一入口：通过ADL同时查找自定义结构体所在命名空间中的OwnedBytes重载
+template <typename T>
+uint64_t Owned(const T &obj)
+{
+    return OwnedBytes(obj);
+}
+
+// 平凡拷贝的元素不持有堆内存，跳过逐个遍历
+template <typename It>
+uint64_t ElementsOwned(It begin, It end, std::true_type)
+{
+    (void)begin;
+    (void)end;
+    return 0;
+}
+
+template <typename It>
+uint64_t ElementsOwned(It begin, It end, std::false_type)
+{
+    uint64_t bytes = 0;
+    for (auto it = begin; it != end; ++it) {
+        bytes += Owned(*it);
+    }
+    return bytes;
+}
+
+template <typename C>
+uint64_t ElementsOwned(const C &container)
+{
+    using Value = typename C::value_type;
+    return ElementsOwned(container.begin(), container.end(),
+                         std::integral_constant<bool, std::is_trivially_copyable<Value>::value>());
+}
+
+template <typename T, typename A>
+uint64_t OwnedBytes(const std::vector<T, A> &vec)
+{
+    return vec.capacity() * sizeof(T) + ElementsOwned(vec);
+}
+
+template <typename K, typename V, typename C, typename A>
+uint64_t OwnedBytes(const std::map<K, V, C, A> &map)
+{
+    using Value = typename std::map<K, V, C, A>::value_type;
+    return map.size() * (sizeof(Value) + TREE_NODE_OVERHEAD) + ElementsOwned(map);
+}
+
+template <typename K, typename C, typename A>
+uint64_t OwnedBytes(const std::set<K, C, A> &set)
+{
+    return set.size() * (sizeof(K) + TREE_NODE_OVERHEAD) + ElementsOwned(set);
+}
+
+template <typename K, typename V, typename H, typename E, typename A>
+uint64_t OwnedBytes(const std::unordered_map<K, V, H, E, A> &map)
+{
+    using Value = typename std::unordered_map<K, V, H, E, A>::value_type;
+    return map.bucket_count() * sizeof(void *) + map.size() * (sizeof(Value) + HASH_NODE_OVERHEAD) +
+           ElementsOwned(map);
+}
+
+template <typename K, typename H, typename E, typename A>
+uint64_t OwnedBytes(const std::unordered_set<K, H, E, A> &set)
+{
+    return set.bucket_count() * sizeof(void *) + set.size() * (sizeof(K) + HASH_NODE_OVERHEAD) +
+           ElementsOwned(set);
+}
+
+template <typename F, typename S>
+uint64_t OwnedBytes(const std::pair<F, S> &pair)
+{
+    return Owned(pair.first) + Owned(pair.second);
+}
+
+// 共享指针指向的对象可能被多处持有，这里按独占计算，估算偏大
+template <typename T>
+uint64_t OwnedBytes(const std::shared_ptr<T> &ptr)
+{
+    return ptr == nullptr ? 0 : sizeof(T) + Owned(*ptr);
+}
+
+template <typename T, typename D>
+uint64_t OwnedBytes(const std::unique_ptr<T, D> &ptr)
+{
+    return ptr == nullptr ? 0 : sizeof(T) + Owned(*ptr);
+}
+}
+
+inline uint64_t OwnedBytesOf()
+{
+    return 0;
+}
+
+// 累加多个成员持有的堆内存，供自定义结构体的OwnedBytes重载使用
+template <typename T, typename... Args>
+uint64_t OwnedBytesOf(const T &first, const Args &...rest)
+{
+    return ByteSizeDetail::Owned(first) + OwnedBytesOf(rest...);
+}
+
+template <typename T>
+uint64_t ByteSizeOf(const T &obj)
+{
+    return sizeof(T) + ByteSizeDetail::Owned(obj);
+}
+}
+}
+
+#endif // ANALYSIS_UTILS_BYTE_SIZE_H
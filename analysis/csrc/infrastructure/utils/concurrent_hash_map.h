@@ -0,0 +1,261 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#ifndef ANALYSIS_UTILS_CONCURRENT_HASH_MAP_H
+#define ANALYSIS_UTILS_CONCURRENT_HASH_MAP_H
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Analysis {
+namespace Utils {
+
+// 分片加锁的并发哈希表，分为构建和只读两个阶段
+// 构建阶段：按key的hash分片，每个分片一把锁，不同分片的写入互不阻塞
+// 只读阶段：调用Freeze后拒绝一切写入，查找与遍历不再加锁
+// 用法：
+//   ConcurrentHashMap<uint32_t, Value> map;
+//   多线程 map.Update(key, [](Value &value) { ... });
+//   map.Freeze();                     // 所有写入线程结束后调用
+//   多线程 const Value *value = map.Get(key);
+template<typename K, typename V, typename Hash = std::hash<K>>
+class ConcurrentHashMap {
+public:
+    static const size_t DEFAULT_SHARD_NUM = 16;
+
+    explicit ConcurrentHashMap(size_t shardNum = DEFAULT_SHARD_NUM)
+    {
+        InitShards(shardNum);
+    }
+
+    ConcurrentHashMap(const ConcurrentHashMap &rhs)
+    {
+        CopyFrom(rhs);
+    }
+
+    ConcurrentHashMap &operator=(const ConcurrentHashMap &rhs)
+    {
+        if (&rhs != this) {
+            CopyFrom(rhs);
+        }
+        return *this;
+    }
+
+    // 移动时直接接管分片，调用方需保证rhs没有并发的读写
+    ConcurrentHashMap(ConcurrentHashMap &&rhs) : shards_(std::move(rhs.shards_)), frozen_(rhs.IsFrozen())
+    {
+        rhs.InitShards(shards_.size());
+        rhs.frozen_.store(false, std::memory_order_release);
+    }
+
+    ConcurrentHashMap &operator=(ConcurrentHashMap &&rhs)
+    {
+        if (&rhs != this) {
+            shards_.swap(rhs.shards_);
+            frozen_.store(rhs.IsFrozen(), std::memory_order_release);
+            rhs.InitShards(shards_.size());
+            rhs.frozen_.store(false, std::memory_order_release);
+        }
+        return *this;
+    }
+
+    // 插入key和value，key已存在或已冻结时返回false
+    bool Insert(const K &key, const V &value)
+    {
+        auto &shard = GetShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (IsFrozen()) {
+            return false;
+        }
+        return shard.map.emplace(key, value).second;
+    }
+
+    // 在分片锁内修改key对应的value，key不存在时先默认构造，已冻结时返回false
+    template<typename Func>
+    bool Update(const K &key, Func func)
+    {
+        auto &shard = GetShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (IsFrozen()) {
+            return false;
+        }
+        func(shard.map[key]);
+        return true;
+    }
+
+    // 删除key，已冻结时返回false
+    bool Erase(const K &key)
+    {
+        auto &shard = GetShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (IsFrozen()) {
+            return false;
+        }
+        return shard.map.erase(key) > 0;
+    }
+
+    // 查找key，存在时将值拷贝到value，只读阶段不加锁
+    bool Find(const K &key, V &value) const
+    {
+        auto &shard = GetShard(key);
+        std::unique_lock<std::mutex> lock(shard.mutex, std::defer_lock);
+        if (!IsFrozen()) {
+            lock.lock();
+        }
+        auto ptr = FindInShard(shard, key);
+        if (ptr == nullptr) {
+            return false;
+        }
+        value = *ptr;
+        return true;
+    }
+
+    bool Find(const K &key) const
+    {
+        auto &shard = GetShard(key);
+        std::unique_lock<std::mutex> lock(shard.mutex, std::defer_lock);
+        if (!IsFrozen()) {
+            lock.lock();
+        }
+        return FindInShard(shard, key) != nullptr;
+    }
+
+    // 只读阶段免锁获取value的地址，未冻结时返回nullptr，指针在map析构或Clear前有效
+    const V *Get(const K &key) const
+    {
+        if (!IsFrozen()) {
+            return nullptr;
+        }
+        return FindInShard(GetShard(key), key);
+    }
+
+    // 依次访问所有键值对，构建阶段逐个分片加锁，func中不能再写入本map
+    template<typename Func>
+    void ForEach(Func func) const
+    {
+        ForEachShard([&func](const Shard &shard) {
+            for (const auto &item : shard.map) {
+                func(item.first, item.second);
+            }
+        });
+    }
+
+    size_t Size() const
+    {
+        size_t size = 0;
+        ForEachShard([&size](const Shard &shard) { size += shard.map.size(); });
+        return size;
+    }
+
+    bool Empty() const
+    {
+        return Size() == 0;
+    }
+
+    // 结束构建阶段，持有全部分片锁切换为只读，进行中的写入完成后才会冻结，之后的写入均被拒绝
+    void Freeze()
+    {
+        std::vector<std::unique_lock<std::mutex>> locks;
+        locks.reserve(shards_.size());
+        for (auto &shard : shards_) {
+            locks.emplace_back(shard->mutex);
+        }
+        frozen_.store(true, std::memory_order_release);
+    }
+
+    bool IsFrozen() const
+    {
+        return frozen_.load(std::memory_order_acquire);
+    }
+
+    // 清空数据并回到构建阶段，调用方需保证没有并发的读写
+    void Clear()
+    {
+        for (auto &shard : shards_) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            shard->map.clear();
+        }
+        frozen_.store(false, std::memory_order_release);
+    }
+
+private:
+    struct Shard {
+        mutable std::mutex mutex;
+        std::unordered_map<K, V, Hash> map;
+    };
+
+    void InitShards(size_t shardNum)
+    {
+        shards_.clear();
+        shardNum = shardNum == 0 ? 1 : shardNum;
+        for (size_t i = 0; i < shardNum; ++i) {
+            shards_.emplace_back(new Shard());
+        }
+    }
+
+    void CopyFrom(const ConcurrentHashMap &rhs)
+    {
+        InitShards(rhs.shards_.size());
+        for (size_t i = 0; i < shards_.size(); ++i) {
+            std::lock_guard<std::mutex> lock(rhs.shards_[i]->mutex);
+            shards_[i]->map = rhs.shards_[i]->map;
+        }
+        frozen_.store(rhs.IsFrozen(), std::memory_order_release);
+    }
+
+    template<typename Func>
+    void ForEachShard(Func func) const
+    {
+        bool frozen = IsFrozen();
+        for (const auto &shard : shards_) {
+            if (frozen) {
+                func(*shard);
+                continue;
+            }
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            func(*shard);
+        }
+    }
+
+    Shard &GetShard(const K &key) const
+    {
+        size_t hash = Hash()(key);
+        // 整数key的std::hash为恒等映射，混合高位后再取模，避免连续key集中在少数分片
+        hash ^= hash >> 16;  // 16: 高低位混合
+        return *shards_[hash % shards_.size()];
+    }
+
+    static const V *FindInShard(const Shard &shard, const K &key)
+    {
+        auto it = shard.map.find(key);
+        return it == shard.map.end() ? nullptr : &it->second;
+    }
+
+private:
+    std::vector<std::unique_ptr<Shard>> shards_;
+    std::atomic<bool> frozen_{false};
+};
+
+template<typename K, typename V, typename Hash>
+const size_t ConcurrentHashMap<K, V, Hash>::DEFAULT_SHARD_NUM;
+}
+}
+#endif // ANALYSIS_UTILS_CONCURRENT_HASH_MAP_H
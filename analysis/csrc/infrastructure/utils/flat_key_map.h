@@ -0,0 +1,280 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#ifndef ANALYSIS_UTILS_FLAT_KEY_MAP_H
+#define ANALYSIS_UTILS_FLAT_KEY_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "analysis/csrc/infrastructure/utils/utils.h"
+
+namespace Analysis {
+namespace Utils {
+constexpr uint64_t FieldMask(unsigned width)
+{
+    return width >= 64 ? UINT64_MAX : (1ULL << width) - 1;  // 64: 键的位宽
+}
+
+// 按位宽依次将若干整数打包为64位复合键，前面的字段在高位，位宽之和不超过64
+// 例：using RuntimeOpKey = PackedKey<16, 32, 16>; RuntimeOpKey::Pack(deviceId, streamId, taskId)
+template <unsigned... Widths>
+struct PackedKey;
+
+template <>
+struct PackedKey<> {
+    static constexpr unsigned BITS = 0;
+    static uint64_t Pack()
+    {
+        return 0;
+    }
+};
+
+template <unsigned Width, unsigned... Rest>
+struct PackedKey<Width, Rest...> {
+    static constexpr unsigned BITS = Width + PackedKey<Rest...>::BITS;
+    static_assert(Width > 0 && BITS <= 64, "The total width of packed key should be in (0, 64].");
+
+    template <typename... Args>
+    static uint64_t Pack(uint64_t value, Args... rest)
+    {
+        static_assert(sizeof...(Args) == sizeof...(Rest), "The number of fields does not match the key layout.");
+        return ((value & FieldMask(Width)) << PackedKey<Rest...>::BITS) | PackedKey<Rest...>::Pack(rest...);
+    }
+};
+
+inline uint64_t MixKey(uint64_t key)
+{
+    // splitmix64的混合函数
+    key ^= key >> 30;
+    key *= 0xBF58476D1CE4E5B9ULL;
+    key ^= key >> 27;
+    key *= 0x94D049BB133111EBULL;
+    return key ^ (key >> 31);
+}
+
+// 以64位整数为键的开放寻址哈希表
+// 键值对按插入顺序连续存放，槽位表使用线性探测，只存放键与键值对下标，查找时不构造任何临时对象
+// 删除时用最后一个键值对填补空位并回移探测链，迭代顺序为插入顺序(删除会改变被移动元素的位置)
+template <typename V>
+class FlatKeyMap {
+public:
+    using Entry = std::pair<uint64_t, V>;
+    using iterator = typename std::vector<Entry>::iterator;
+    using const_iterator = typename std::vector<Entry>::const_iterator;
+
+    // 预留容纳num个键的空间，失败返回false
+    bool Reserve(size_t num)
+    {
+        if (!Utils::Reserve(entries_, num)) {
+            return false;
+        }
+        return Rehash(SlotNumFor(num));
+    }
+
+    V *Find(uint64_t key)
+    {
+        auto pos = FindSlot(key);
+        return pos == INVALID_POS ? nullptr : &entries_[slots_[pos].index - 1].second;
+    }
+
+    const V *Find(uint64_t key) const
+    {
+        auto pos = FindSlot(key);
+        return pos == INVALID_POS ? nullptr : &entries_[slots_[pos].index - 1].second;
+    }
+
+    // 不存在时返回defaultValue，返回引用不拷贝值
+    const V &Get(uint64_t key, const V &defaultValue) const
+    {
+        auto value = Find(key);
+        return value == nullptr ? defaultValue : *value;
+    }
+
+    bool Contains(uint64_t key) const
+    {
+        return FindSlot(key) != INVALID_POS;
+    }
+
+    // 键不存在时以args构造值并插入，返回值的指针与是否新插入，扩容失败时返回nullptr
+    template <typename... Args>
+    std::pair<V *, bool> Emplace(uint64_t key, Args &&...args)
+    {
+        auto pos = FindSlot(key);
+        if (pos != INVALID_POS) {
+            return {&entries_[slots_[pos].index - 1].second, false};
+        }
+        if (SlotNumFor(entries_.size() + 1) > slots_.size() && !Rehash(SlotNumFor(entries_.size() + 1))) {
+            return {nullptr, false};
+        }
+        entries_.emplace_back(std::piecewise_construct, std::forward_as_tuple(key),
+                              std::forward_as_tuple(std::forward<Args>(args)...));
+        InsertSlot(key, entries_.size());
+        return {&entries_.back().second, true};
+    }
+
+    // 与std::unordered_map::operator[]一致，键不存在时插入默认值
+    V &operator[](uint64_t key)
+    {
+        auto result = Emplace(key);
+        if (result.first == nullptr) {
+            throw std::bad_alloc();
+        }
+        return *result.first;
+    }
+
+    bool Erase(uint64_t key)
+    {
+        auto pos = FindSlot(key);
+        if (pos == INVALID_POS) {
+            return false;
+        }
+        auto index = slots_[pos].index - 1;
+        RemoveSlot(pos);
+        if (index + 1 != entries_.size()) {
+            entries_[index] = std::move(entries_.back());
+            slots_[FindSlot(entries_[index].first)].index = index + 1;
+        }
+        entries_.pop_back();
+        return true;
+    }
+
+    void Clear()
+    {
+        entries_.clear();
+        slots_.clear();
+        mask_ = 0;
+    }
+
+    size_t Size() const
+    {
+        return entries_.size();
+    }
+
+    bool Empty() const
+    {
+        return entries_.empty();
+    }
+
+    iterator begin()
+    {
+        return entries_.begin();
+    }
+    iterator end()
+    {
+        return entries_.end();
+    }
+    const_iterator begin() const
+    {
+        return entries_.begin();
+    }
+    const_iterator end() const
+    {
+        return entries_.end();
+    }
+
+private:
+    struct Slot {
+        uint64_t key = 0;
+        size_t index = 0;  // 键值对下标+1，0表示空槽
+    };
+    static const size_t INVALID_POS = SIZE_MAX;
+    static const size_t MIN_SLOT_NUM = 8;
+
+    // 负载因子不超过1/2
+    static size_t SlotNumFor(size_t num)
+    {
+        size_t slotNum = MIN_SLOT_NUM;
+        while (slotNum < num * 2) {  // 2: 负载因子的倒数
+            slotNum <<= 1;
+        }
+        return slotNum;
+    }
+
+    size_t FindSlot(uint64_t key) const
+    {
+        if (slots_.empty()) {
+            return INVALID_POS;
+        }
+        for (size_t pos = MixKey(key) & mask_;; pos = (pos + 1) & mask_) {
+            const auto &slot = slots_[pos];
+            if (slot.index == 0) {
+                return INVALID_POS;
+            }
+            if (slot.key == key) {
+                return pos;
+            }
+        }
+    }
+
+    void InsertSlot(uint64_t key, size_t index)
+    {
+        auto pos = MixKey(key) & mask_;
+        while (slots_[pos].index != 0) {
+            pos = (pos + 1) & mask_;
+        }
+        slots_[pos].key = key;
+        slots_[pos].index = index;
+    }
+
+    // 回移删除位置之后的探测链，保证线性探测的查找不被空槽截断
+    void RemoveSlot(size_t hole)
+    {
+        for (size_t next = (hole + 1) & mask_; slots_[next].index != 0; next = (next + 1) & mask_) {
+            auto home = MixKey(slots_[next].key) & mask_;
+            if (((next - home) & mask_) >= ((next - hole) & mask_)) {
+                slots_[hole] = slots_[next];
+                hole = next;
+            }
+        }
+        slots_[hole] = Slot();
+    }
+
+    bool Rehash(size_t slotNum)
+    {
+        if (slotNum <= slots_.size()) {
+            return true;
+        }
+        std::vector<Slot> slots;
+        if (!Utils::Resize(slots, slotNum)) {
+            return false;
+        }
+        slots_.swap(slots);
+        mask_ = slotNum - 1;
+        for (size_t i = 0; i < entries_.size(); ++i) {
+            InsertSlot(entries_[i].first, i + 1);
+        }
+        return true;
+    }
+
+private:
+    std::vector<Entry> entries_;
+    std::vector<Slot> slots_;
+    size_t mask_ = 0;
+};
+
+template <typename V>
+const size_t FlatKeyMap<V>::INVALID_POS;
+template <typename V>
+const size_t FlatKeyMap<V>::MIN_SLOT_NUM;
+}  // namespace Utils
+}  // namespace Analysis
+
+#endif  // ANALYSIS_UTILS_FLAT_KEY_MAP_H
@@ -0,0 +1,279 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#include "analysis/csrc/infrastructure/utils/ingest_cursor.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#include "analysis/csrc/infrastructure/dfx/error_code.h"
+#include "analysis/csrc/infrastructure/dfx/log.h"
+#include "analysis/csrc/infrastructure/utils/file.h"
+#include "analysis/csrc/infrastructure/utils/utils.h"
+
+namespace Analysis {
+namespace Utils {
+namespace {
+const std::string CURSOR_FILE = ".ingest_cursor";
+const std::string CARRY_FILE_PREFIX = ".ingest_carry.";
+const std::string FIELD_SEP = "\t";
+const size_t CURSOR_FIELDS = 2;
+}
+
+void IngestCursor::SetFollow(bool follow)
+{
+    follow_ = follow;
+    INFO("Follow mode is %.", follow ? "enabled" : "disabled");
+}
+
+bool IngestCursor::IsFollow() const
+{
+    return follow_;
+}
+
+std::string IngestCursor::GetCursorPath(const std::string &dataDir) const
+{
+    return File::PathJoin({dataDir, CURSOR_FILE});
+}
+
+std::string IngestCursor::GetCarryPath(const std::string &dataDir, const std::string &name) const
+{
+    return File::PathJoin({dataDir, CARRY_FILE_PREFIX + name});
+}
+
+IngestCursor::OffsetMap &IngestCursor::LoadCommitted(const std::string &dataDir)
+{
+    auto it = committed_.find(dataDir);
+    if (it != committed_.end()) {
+        return it->second;
+    }
+    auto &offsets = committed_[dataDir];
+    auto path = GetCursorPath(dataDir);
+    if (!File::Exist(path)) {
+        return offsets;
+    }
+    FileReader reader(path);
+    std::vector<std::string> lines;
+    if (reader.ReadText(lines) != ANALYSIS_OK) {
+        WARN("Read ingest cursor % failed, parse from the beginning.", path);
+        return offsets;
+    }
+    for (const auto &line : lines) {
+        auto fields = Split(line, FIELD_SEP);
+        uint64_t offset = 0;
+        if (fields.size() != CURSOR_FIELDS || StrToU64(offset, fields[1]) != ANALYSIS_OK) {
+            WARN("Invalid ingest cursor record: %, parse from the beginning.", line);
+            offsets.clear();
+            return offsets;
+        }
+        offsets[fields[0]] = offset;
+    }
+    return offsets;
+}
+
+std::vector<FileSegment> IngestCursor::Plan(const std::string &dataDir, const std::vector<std::string> &files,
+                                            uint64_t recordSize, bool skipPartialHead, uint64_t &bytes)
+{
+    std::vector<FileSegment> segments;
+    bytes = 0;
+    if (recordSize == 0) {
+        ERROR("The record size is invalid.");
+        return segments;
+    }
+    bool firstRead = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto &offsets = LoadCommitted(dataDir);
+        for (const auto &file : files) {
+            FileSegment segment;
+            segment.path = file;
+            auto fileSize = File::Size(file);
+            auto it = offsets.find(File::BaseName(file));
+            bool hasCursor = it != offsets.end();
+            if (hasCursor) {
+                segment.offset = it->second;
+            }
+            if (segment.offset > fileSize) {
+                WARN("The file % is shorter than its cursor %, parse from the beginning.", file, segment.offset);
+                segment.offset = 0;
+                hasCursor = false;
+            }
+            if (file == files.front()) {
+                firstRead = skipPartialHead && !hasCursor;
+            }
+            segment.length = fileSize - segment.offset;
+            if (segment.length > 0) {
+                bytes += segment.length;
+                segments.emplace_back(segment);
+            }
+        }
+    }
+    uint64_t remainder = bytes % recordSize;
+    bytes -= remainder;
+    if (firstRead) {
+        // 与全量解析一致：老化或回滚后的数据头部可能是半条记录，首次读取时从头部跳过余数，
+        // 跳过后长度为0的段保留在计划中，Advance后游标越过被跳过的字节
+        for (auto &segment : segments) {
+            auto skip = std::min(remainder, segment.length);
+            segment.offset += skip;
+            segment.length -= skip;
+            remainder -= skip;
+            if (remainder == 0) {
+                break;
+            }
+        }
+        return segments;
+    }
+    // 已读取过的数据从记录边界开始，末尾不足一条记录的字节是未写完的记录，留到下次读取
+    while (remainder > 0 && !segments.empty()) {
+        auto &last = segments.back();
+        auto cut = std::min(remainder, last.length);
+        last.length -= cut;
+        remainder -= cut;
+        if (last.length == 0) {
+            segments.pop_back();
+        }
+    }
+    return segments;
+}
+
+void IngestCursor::Advance(const std::string &dataDir, const std::vector<FileSegment> &segments)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto &offsets = pending_[dataDir];
+    for (const auto &segment : segments) {
+        offsets[File::BaseName(segment.path)] = segment.offset + segment.length;
+    }
+}
+
+bool IngestCursor::Commit(const std::string &dataDir)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto &offsets = LoadCommitted(dataDir);
+    auto it = pending_.find(dataDir);
+    if (it != pending_.end()) {
+        for (const auto &item : it->second) {
+            offsets[item.first] = item.second;
+        }
+        pending_.erase(it);
+    }
+    std::ostringstream oss;
+    for (const auto &item : offsets) {
+        oss << item.first << FIELD_SEP << item.second << "\n";
+    }
+    FileWriter writer(GetCursorPath(dataDir));
+    if (!writer.IsOpen()) {
+        ERROR("Save ingest cursor of % failed.", dataDir);
+        return false;
+    }
+    writer.WriteText(oss.str());
+    return CommitCarried(dataDir);
+}
+
+bool IngestCursor::CommitCarried(const std::string &dataDir)
+{
+    // 本次取回或重新保留过的记录以本次为准，本次保留为空的删除文件
+    std::set<std::string> names;
+    auto takenIt = takenCarry_.find(dataDir);
+    if (takenIt != takenCarry_.end()) {
+        names.swap(takenIt->second);
+        takenCarry_.erase(takenIt);
+    }
+    CarryMap carried;
+    auto pendingIt = pendingCarry_.find(dataDir);
+    if (pendingIt != pendingCarry_.end()) {
+        carried.swap(pendingIt->second);
+        pendingCarry_.erase(pendingIt);
+    }
+    for (const auto &item : carried) {
+        names.insert(item.first);
+    }
+    bool ret = true;
+    for (const auto &name : names) {
+        auto path = GetCarryPath(dataDir, name);
+        auto it = carried.find(name);
+        if (it == carried.end() || it->second.empty()) {
+            if (File::Exist(path) && !File::DeleteFile(path)) {
+                ERROR("Remove carried records % failed.", path);
+                ret = false;
+            }
+            continue;
+        }
+        std::ofstream out(path, std::ios::out | std::ios::trunc | std::ios::binary);
+        out.write(it->second.data(), static_cast<std::streamsize>(it->second.size()));
+        if (!out.good()) {
+            ERROR("Save carried records % failed.", path);
+            ret = false;
+        }
+    }
+    return ret;
+}
+
+void IngestCursor::Discard(const std::string &dataDir)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_.erase(dataDir);
+    pendingCarry_.erase(dataDir);
+    takenCarry_.erase(dataDir);
+}
+
+std::string IngestCursor::TakeCarried(const std::string &dataDir, const std::string &name)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    takenCarry_[dataDir].insert(name);
+    auto path = GetCarryPath(dataDir, name);
+    if (!File::Exist(path)) {
+        return "";
+    }
+    std::ifstream in(path, std::ios::in | std::ios::binary);
+    if (!in.is_open()) {
+        WARN("Open carried records % failed, they are dropped.", path);
+        return "";
+    }
+    std::ostringstream oss;
+    oss << in.rdbuf();
+    return oss.str();
+}
+
+void IngestCursor::Carry(const std::string &dataDir, const std::string &name, std::string records)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    pendingCarry_[dataDir][name] = std::move(records);
+}
+
+bool IngestCursor::ReadSegments(const std::vector<FileSegment> &segments, char *dst)
+{
+    uint64_t dstOffset = 0;
+    for (const auto &segment : segments) {
+        std::ifstream in(segment.path, std::ios::in | std::ios::binary);
+        if (!in.is_open()) {
+            ERROR("Open % failed.", segment.path);
+            return false;
+        }
+        in.seekg(static_cast<std::streamoff>(segment.offset), std::ios::beg);
+        in.read(dst + dstOffset, static_cast<std::streamsize>(segment.length));
+        if (static_cast<uint64_t>(in.gcount()) != segment.length) {
+            ERROR("Read % failed, expect % bytes from %, actual %.", segment.path, segment.length, segment.offset,
+                  in.gcount());
+            return false;
+        }
+        dstOffset += segment.length;
+    }
+    return true;
+}
+}  // namespace Utils
+}  // namespace Analysis
@@ -0,0 +1,110 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#ifndef ANALYSIS_UTILS_INGEST_CURSOR_H
+#define ANALYSIS_UTILS_INGEST_CURSOR_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "analysis/csrc/infrastructure/utils/singleton.h"
+
+namespace Analysis {
+namespace Utils {
+// 文件中待读取的一段数据
+struct FileSegment {
+    std::string path;
+    uint64_t offset = 0;
+    uint64_t length = 0;
+};
+
+// 增量(follow)解析的读取游标
+// 按数据目录记录每个slice文件已消费的字节数，持久化在数据目录下的隐藏文件中。
+// device数据老化后头部可能是半条记录，skipPartialHead为true时，首个文件没有游标即为首次读取，与全量解析相同，
+// 把总字节数对记录大小的余数当作头部的半条记录跳过；host数据总是从记录边界开始，不跳过头部。
+// 之后每次解析只读取各文件新增的字节，末尾不足一条记录的部分不消费，留到下次与后续数据拼接。
+// 游标分两级：Get读取已提交的偏移，Advance记录本次读取后的偏移，阶段成功后Commit落盘，
+// 失败时Discard丢弃，保证失败后重跑不会漏读数据。
+// 开始与结束记录分属两次增量解析时(如LogModeling中按streamId-taskId-contextId匹配的开始/结束日志、
+// host建树时晚于子记录落盘的api)，解析方通过Carry保存本次尚未匹配的记录，下次解析通过TakeCarried取回重放，
+// 保留记录与游标一起Commit/Discard，按名字持久化在数据目录下的隐藏文件中。
+class IngestCursor : public Singleton<IngestCursor> {
+public:
+    void SetFollow(bool follow);
+    bool IsFollow() const;
+    // 根据已提交游标生成本次读取计划，只包含recordSize整数倍的字节，bytes返回计划读取的总字节数
+    // skipPartialHead时首次读取跳过头部余数，其余情况截掉末尾余数
+    std::vector<FileSegment> Plan(const std::string &dataDir, const std::vector<std::string> &files,
+                                  uint64_t recordSize, bool skipPartialHead, uint64_t &bytes);
+    // 读取计划成功执行后推进游标
+    void Advance(const std::string &dataDir, const std::vector<FileSegment> &segments);
+    bool Commit(const std::string &dataDir);
+    void Discard(const std::string &dataDir);
+    std::string GetCursorPath(const std::string &dataDir) const;
+
+    // 读取上次提交的保留记录，调用后本次解析需要重新Carry仍未匹配的记录，否则Commit时清除
+    std::string TakeCarried(const std::string &dataDir, const std::string &name);
+    // 记录本次解析后仍未匹配、需要在下次解析重放的记录，Commit时替换上次的保留记录
+    void Carry(const std::string &dataDir, const std::string &name, std::string records);
+    std::string GetCarryPath(const std::string &dataDir, const std::string &name) const;
+
+    // 按顺序读取各段数据到dst，dst空间需不小于各段长度之和
+    static bool ReadSegments(const std::vector<FileSegment> &segments, char *dst);
+
+    // 定长记录与保留记录字节串之间的转换
+    template <typename T>
+    static void AppendRecord(std::string &records, const T &record)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "The carried record must be trivially copyable.");
+        records.append(reinterpret_cast<const char *>(&record), sizeof(T));
+    }
+
+    template <typename T>
+    static std::vector<T> UnpackRecords(const std::string &records)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "The carried record must be trivially copyable.");
+        std::vector<T> result(records.size() / sizeof(T));
+        if (!result.empty()) {
+            std::memcpy(static_cast<void *>(result.data()), records.data(), result.size() * sizeof(T));
+        }
+        return result;
+    }
+
+private:
+    using OffsetMap = std::map<std::string, uint64_t>;  // 文件名 -> 已消费字节数
+    using CarryMap = std::map<std::string, std::string>;  // 保留记录名 -> 记录字节
+    OffsetMap &LoadCommitted(const std::string &dataDir);
+    bool CommitCarried(const std::string &dataDir);
+
+private:
+    std::atomic<bool> follow_{false};
+    std::mutex mutex_;
+    std::map<std::string, OffsetMap> committed_;
+    std::map<std::string, OffsetMap> pending_;
+    std::map<std::string, CarryMap> pendingCarry_;
+    std::map<std::string, std::set<std::string>> takenCarry_;
+};
+}  // namespace Utils
+}  // namespace Analysis
+
+#endif  // ANALYSIS_UTILS_INGEST_CURSOR_H
@@ -0,0 +1,196 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#include "analysis/csrc/infrastructure/utils/interval_set.h"
+
+#include <algorithm>
+
+#include "analysis/csrc/infrastructure/dfx/log.h"
+#include "analysis/csrc/infrastructure/utils/radix_sort.h"
+#include "analysis/csrc/infrastructure/utils/utils.h"
+
+namespace Analysis {
+namespace Utils {
+bool IntervalSet::Reserve(size_t size)
+{
+    return Utils::Reserve(starts_, size) && Utils::Reserve(ends_, size);
+}
+
+void IntervalSet::Add(uint64_t start, uint64_t end)
+{
+    if (end < start) {
+        return;
+    }
+    starts_.push_back(start);
+    ends_.push_back(end);
+}
+
+void IntervalSet::Clear()
+{
+    starts_.clear();
+    ends_.clear();
+}
+
+bool IntervalSet::IsSorted() const
+{
+    const size_t size = starts_.size();
+    const uint64_t *starts = starts_.data();
+    // 不提前退出，循环无分支依赖，可被编译器向量化
+    size_t descents = 0;
+    for (size_t i = 1; i < size; ++i) {
+        descents += static_cast<size_t>(starts[i] < starts[i - 1]);
+    }
+    return descents == 0;
+}
+
+void IntervalSet::Normalize(uint32_t threadsNum)
+{
+    if (!IsSorted()) {
+        std::vector<size_t> order;
+        std::vector<uint64_t> starts;
+        std::vector<uint64_t> ends;
+        if (!RadixSort::ArgSort(starts_, [](uint64_t start) { return start; }, order, threadsNum) ||
+            !Utils::Resize(starts, order.size()) || !Utils::Resize(ends, order.size())) {
+            ERROR("Sort intervals failed, size is %.", starts_.size());
+            Clear();
+            return;
+        }
+        for (size_t i = 0; i < order.size(); ++i) {
+            starts[i] = starts_[order[i]];
+            ends[i] = ends_[order[i]];
+        }
+        starts_.swap(starts);
+        ends_.swap(ends);
+    }
+    // 原地合并，写指针不超过读指针
+    size_t count = 0;
+    for (size_t i = 0; i < starts_.size(); ++i) {
+        if (count > 0 && ends_[count - 1] >= starts_[i]) {
+            ends_[count - 1] = std::max(ends_[count - 1], ends_[i]);
+            continue;
+        }
+        starts_[count] = starts_[i];
+        ends_[count] = ends_[i];
+        ++count;
+    }
+    starts_.resize(count);
+    ends_.resize(count);
+}
+
+uint64_t IntervalSet::Coverage() const
+{
+    const size_t size = starts_.size();
+    const uint64_t *starts = starts_.data();
+    const uint64_t *ends = ends_.data();
+    uint64_t total = 0;
+    for (size_t i = 0; i < size; ++i) {
+        total += ends[i] - starts[i];
+    }
+    return total;
+}
+
+void IntervalSet::AppendMerged(uint64_t start, uint64_t end)
+{
+    if (!ends_.empty() && ends_.back() >= start) {
+        ends_.back() = std::max(ends_.back(), end);
+        return;
+    }
+    starts_.push_back(start);
+    ends_.push_back(end);
+}
+
+IntervalSet IntervalSet::Union(const IntervalSet &lhs, const IntervalSet &rhs)
+{
+    IntervalSet result;
+    if (!result.Reserve(lhs.Size() + rhs.Size())) {
+        ERROR("Reserve interval union failed.");
+        return result;
+    }
+    size_t i = 0;
+    size_t j = 0;
+    while (i < lhs.Size() || j < rhs.Size()) {
+        if (j == rhs.Size() || (i < lhs.Size() && lhs.starts_[i] <= rhs.starts_[j])) {
+            result.AppendMerged(lhs.starts_[i], lhs.ends_[i]);
+            ++i;
+        } else {
+            result.AppendMerged(rhs.starts_[j], rhs.ends_[j]);
+            ++j;
+        }
+    }
+    return result;
+}
+
+IntervalSet IntervalSet::Intersect(const IntervalSet &lhs, const IntervalSet &rhs)
+{
+    IntervalSet result;
+    if (!result.Reserve(std::min(lhs.Size(), rhs.Size()))) {
+        ERROR("Reserve interval intersection failed.");
+        return result;
+    }
+    size_t i = 0;
+    size_t j = 0;
+    while (i < lhs.Size() && j < rhs.Size()) {
+        uint64_t start = std::max(lhs.starts_[i], rhs.starts_[j]);
+        uint64_t end = std::min(lhs.ends_[i], rhs.ends_[j]);
+        if (start < end) {
+            result.starts_.push_back(start);
+            result.ends_.push_back(end);
+        }
+        // 先结束的区间不会再与另一侧后续区间相交
+        if (lhs.ends_[i] < rhs.ends_[j]) {
+            ++i;
+        } else {
+            ++j;
+        }
+    }
+    return result;
+}
+
+IntervalSet IntervalSet::Difference(const IntervalSet &lhs, const IntervalSet &rhs)
+{
+    if (lhs.Empty() || rhs.Empty()) {
+        return lhs;
+    }
+    IntervalSet result;
+    if (!result.Reserve(lhs.Size() + rhs.Size())) {
+        ERROR("Reserve interval difference failed.");
+        return result;
+    }
+    size_t j = 0;
+    for (size_t i = 0; i < lhs.Size(); ++i) {
+        uint64_t cursor = lhs.starts_[i];
+        const uint64_t end = lhs.ends_[i];
+        // rhs中结束于当前区间起点之前的区间不会再与lhs后续区间相交
+        while (j < rhs.Size() && rhs.ends_[j] <= cursor) {
+            ++j;
+        }
+        size_t k = j;
+        for (; k < rhs.Size() && rhs.starts_[k] < end; ++k) {
+            if (rhs.starts_[k] > cursor) {
+                result.starts_.push_back(cursor);
+                result.ends_.push_back(rhs.starts_[k]);
+            }
+            cursor = std::max(cursor, rhs.ends_[k]);
+        }
+        if (cursor < end) {
+            result.starts_.push_back(cursor);
+            result.ends_.push_back(end);
+        }
+    }
+    return result;
+}
+}  // namespace Utils
+}  // namespace Analysis
@@ -0,0 +1,86 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#ifndef ANALYSIS_UTILS_INTERVAL_SET_H
+#define ANALYSIS_UTILS_INTERVAL_SET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Analysis {
+namespace Utils {
+
+// 时间区间[start, end)的集合，起止时间按structure-of-arrays分别连续存放
+// Normalize后区间按start升序、互不重叠且互不相接(长度为0的区间会保留)，
+// 集合运算要求两侧均已Normalize，均为一次线性归并，结果同样满足上述性质
+// 用法：
+//   IntervalSet comp; comp.Add(start, end); ...; comp.Normalize();
+//   auto commOnly = IntervalSet::Difference(comm, comp);
+class IntervalSet {
+public:
+    bool Reserve(size_t size);
+    // 追加一个区间，end < start的区间忽略，追加后需要重新Normalize
+    void Add(uint64_t start, uint64_t end);
+    // 按start排序并合并重叠或首尾相接的区间，threadsNum为排序使用的线程数，0表示自动选择
+    void Normalize(uint32_t threadsNum = 0);
+    void Clear();
+
+    size_t Size() const
+    {
+        return starts_.size();
+    }
+    bool Empty() const
+    {
+        return starts_.empty();
+    }
+    uint64_t Start(size_t index) const
+    {
+        return starts_[index];
+    }
+    uint64_t End(size_t index) const
+    {
+        return ends_[index];
+    }
+    const std::vector<uint64_t> &Starts() const
+    {
+        return starts_;
+    }
+    const std::vector<uint64_t> &Ends() const
+    {
+        return ends_;
+    }
+    // 所有区间的长度之和
+    uint64_t Coverage() const;
+
+    static IntervalSet Union(const IntervalSet &lhs, const IntervalSet &rhs);
+    static IntervalSet Intersect(const IntervalSet &lhs, const IntervalSet &rhs);
+    // lhs中不被rhs覆盖的部分
+    static IntervalSet Difference(const IntervalSet &lhs, const IntervalSet &rhs);
+
+private:
+    bool IsSorted() const;
+    // 按start升序追加，与末尾区间重叠或相接时合并
+    void AppendMerged(uint64_t start, uint64_t end);
+
+private:
+    std::vector<uint64_t> starts_;
+    std::vector<uint64_t> ends_;
+};
+}  // namespace Utils
+}  // namespace Analysis
+
+#endif  // ANALYSIS_UTILS_INTERVAL_SET_H
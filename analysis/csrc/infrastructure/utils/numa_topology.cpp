@@ -0,0 +1,210 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#include "analysis/csrc/infrastructure/utils/numa_topology.h"
+
+#include <dirent.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+
+#include "analysis/csrc/infrastructure/dfx/error_code.h"
+#include "analysis/csrc/infrastructure/dfx/log.h"
+#include "analysis/csrc/infrastructure/utils/file.h"
+#include "analysis/csrc/infrastructure/utils/utils.h"
+
+namespace Analysis {
+namespace Utils {
+namespace {
+const std::string NODE_PREFIX = "node";
+const std::string CPU_LIST_FILE = "cpulist";
+const int MPOL_PREFERRED_MODE = 1;
+const size_t BITS_PER_WORD = sizeof(unsigned long) * 8;
+const uint64_t MAX_NODE_ID = 1024;
+
+bool ParseNodeId(const std::string &name, int &id)
+{
+    if (name.compare(0, NODE_PREFIX.size(), NODE_PREFIX) != 0 || name.size() == NODE_PREFIX.size() ||
+        !std::all_of(name.begin() + NODE_PREFIX.size(), name.end(), ::isdigit)) {
+        return false;
+    }
+    uint64_t value = 0;
+    if (StrToU64(value, name.substr(NODE_PREFIX.size())) != ANALYSIS_OK || value >= MAX_NODE_ID) {
+        return false;
+    }
+    id = static_cast<int>(value);
+    return true;
+}
+
+// 不依赖libnuma，直接通过系统调用读写当前线程的内存策略
+bool GetMemPolicy(int &mode, std::vector<unsigned long> &mask)
+{
+    mask.assign(MAX_NODE_ID / BITS_PER_WORD, 0);
+    return syscall(SYS_get_mempolicy, &mode, mask.data(), MAX_NODE_ID, nullptr, 0) == 0;
+}
+
+bool SetMemPolicy(int mode, const std::vector<unsigned long> &mask)
+{
+    // 内核只读取maxnode - 1位
+    unsigned long maxNode = mask.size() * BITS_PER_WORD + 1;
+    return syscall(SYS_set_mempolicy, mode, mask.empty() ? nullptr : mask.data(), maxNode) == 0;
+}
+
+std::vector<unsigned long> NodeMask(int nodeId)
+{
+    auto id = static_cast<size_t>(nodeId);
+    std::vector<unsigned long> mask(id / BITS_PER_WORD + 1, 0);
+    mask[id / BITS_PER_WORD] |= 1UL << (id % BITS_PER_WORD);
+    return mask;
+}
+}
+
+bool NumaTopology::ParseCpuList(const std::string &text, std::vector<int> &cpus)
+{
+    cpus.clear();
+    std::string list = text;
+    list.erase(std::remove_if(list.begin(), list.end(), ::isspace), list.end());
+    if (list.empty()) {
+        return true;
+    }
+    for (const auto &range : Split(list, ",")) {
+        auto bounds = Split(range, "-");
+        uint64_t first = 0;
+        uint64_t last = 0;
+        if (bounds.size() > 2 || StrToU64(first, bounds.front()) != ANALYSIS_OK ||
+            StrToU64(last, bounds.back()) != ANALYSIS_OK || first > last || last >= CPU_SETSIZE) {
+            ERROR("Invalid cpu list: %.", text);
+            cpus.clear();
+            return false;
+        }
+        for (auto cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(static_cast<int>(cpu));
+        }
+    }
+    return true;
+}
+
+bool NumaTopology::Detect()
+{
+    std::call_once(detectFlag_, [this]() { Load(NUMA_NODE_PATH); });
+    return !nodes_.empty();
+}
+
+bool NumaTopology::Load(const std::string &root)
+{
+    nodes_.clear();
+    DIR *dp = opendir(root.c_str());
+    if (dp == nullptr) {
+        INFO("No numa topology in %.", root);
+        return false;
+    }
+    const struct dirent *entry = nullptr;
+    while ((entry = readdir(dp)) != nullptr) {
+        Node node;
+        if (!ParseNodeId(entry->d_name, node.id)) {
+            continue;
+        }
+        std::ifstream in(File::PathJoin({root, entry->d_name, CPU_LIST_FILE}));
+        std::string text;
+        if (!in.is_open() || !std::getline(in, text) || !ParseCpuList(text, node.cpus) || node.cpus.empty()) {
+            continue;
+        }
+        nodes_.emplace_back(std::move(node));
+    }
+    closedir(dp);
+    std::sort(nodes_.begin(), nodes_.end(), [](const Node &lhs, const Node &rhs) { return lhs.id < rhs.id; });
+    INFO("Detect % numa nodes with cpus.", nodes_.size());
+    return !nodes_.empty();
+}
+
+bool NumaTopology::IsEnabled() const
+{
+    if (nodes_.size() <= 1) {
+        return false;
+    }
+    const char *flag = std::getenv(NUMA_BIND_ENV);
+    return flag == nullptr || std::string(flag) != "0";
+}
+
+size_t NumaTopology::NodeNum() const
+{
+    return nodes_.size();
+}
+
+int NumaTopology::GetNodeForDevice(size_t deviceIndex) const
+{
+    if (!IsEnabled()) {
+        return -1;
+    }
+    return static_cast<int>(deviceIndex % nodes_.size());
+}
+
+const NumaTopology::Node &NumaTopology::GetNode(size_t index) const
+{
+    return nodes_.at(index);
+}
+
+NumaBinding::NumaBinding(int nodeIndex)
+{
+    CPU_ZERO(&oldCpus_);
+    auto &topology = NumaTopology::GetInstance();
+    if (nodeIndex < 0 || static_cast<size_t>(nodeIndex) >= topology.NodeNum()) {
+        return;
+    }
+    const auto &node = topology.GetNode(static_cast<size_t>(nodeIndex));
+    if (sched_getaffinity(0, sizeof(oldCpus_), &oldCpus_) != 0) {
+        WARN("Get cpu affinity failed, skip numa binding.");
+        return;
+    }
+    // 只在当前允许的cpu范围内绑定(如容器的cpuset限制)，没有交集时不绑定
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    for (auto cpu : node.cpus) {
+        if (CPU_ISSET(cpu, &oldCpus_)) {
+            CPU_SET(cpu, &cpus);
+        }
+    }
+    if (CPU_COUNT(&cpus) == 0) {
+        WARN("No allowed cpu on numa node %, skip numa binding.", node.id);
+        return;
+    }
+    cpuBound_ = sched_setaffinity(0, sizeof(cpus), &cpus) == 0;
+    // 先保存原有内存策略，读取失败时不修改，避免析构时无法恢复
+    memBound_ = GetMemPolicy(oldMemMode_, oldMemMask_) && SetMemPolicy(MPOL_PREFERRED_MODE, NodeMask(node.id));
+    if (!cpuBound_ || !memBound_) {
+        WARN("Bind to numa node % partially failed, cpu: %, memory: %.", node.id, cpuBound_, memBound_);
+    }
+}
+
+NumaBinding::~NumaBinding()
+{
+    if (cpuBound_) {
+        sched_setaffinity(0, sizeof(oldCpus_), &oldCpus_);
+    }
+    if (memBound_) {
+        SetMemPolicy(oldMemMode_, oldMemMask_);
+    }
+}
+
+bool NumaBinding::IsBound() const
+{
+    return cpuBound_;
+}
+}  // namespace Utils
+}  // namespace Analysis
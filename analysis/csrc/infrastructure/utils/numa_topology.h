@@ -0,0 +1,84 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#ifndef ANALYSIS_UTILS_NUMA_TOPOLOGY_H
+#define ANALYSIS_UTILS_NUMA_TOPOLOGY_H
+
+#include <sched.h>
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "analysis/csrc/infrastructure/utils/singleton.h"
+
+namespace Analysis {
+namespace Utils {
+const char * const NUMA_NODE_PATH = "/sys/devices/system/node";
+// 设置该环境变量为"0"时关闭NUMA绑定
+const char * const NUMA_BIND_ENV = "MSPROF_ANALYSIS_NUMA_BIND";
+
+// 从/sys读取的NUMA拓扑
+// 多节点的host上，各device的解析流水线按序号轮转绑定到不同节点：线程只在该节点的cpu上运行，
+// 内存优先从该节点分配。流水线内部线程池创建的线程继承绑定，子任务与其数据保持在同一节点
+// Detect需在启动流水线线程前调用，之后只读
+class NumaTopology : public Singleton<NumaTopology> {
+public:
+    struct Node {
+        int id = 0;
+        std::vector<int> cpus;
+    };
+
+    // 进程内只解析一次NUMA_NODE_PATH，并发调用安全，返回是否有带cpu的节点
+    bool Detect();
+    // 解析root下node<N>/cpulist，没有cpu的节点(如纯内存节点)不参与绑定
+    bool Load(const std::string &root);
+    // 多于一个节点且未通过环境变量关闭
+    bool IsEnabled() const;
+    size_t NodeNum() const;
+    // 按序号轮转分配节点，返回节点在Detect结果中的下标，未开启时返回-1
+    int GetNodeForDevice(size_t deviceIndex) const;
+    const Node &GetNode(size_t index) const;
+    // 解析"0-3,8,10-11"格式的cpu列表
+    static bool ParseCpuList(const std::string &text, std::vector<int> &cpus);
+
+private:
+    std::once_flag detectFlag_;
+    std::vector<Node> nodes_;
+};
+
+// 作用域内将当前线程绑定到NUMA节点，析构时恢复原有的cpu亲和性和内存策略
+// nodeIndex为NumaTopology中的节点下标，小于0时不做任何事
+class NumaBinding {
+public:
+    explicit NumaBinding(int nodeIndex);
+    ~NumaBinding();
+    NumaBinding(const NumaBinding &) = delete;
+    NumaBinding &operator=(const NumaBinding &) = delete;
+    bool IsBound() const;
+
+private:
+    cpu_set_t oldCpus_;
+    int oldMemMode_ = 0;
+    std::vector<unsigned long> oldMemMask_;
+    bool cpuBound_ = false;
+    bool memBound_ = false;
+};
+}  // namespace Utils
+}  // namespace Analysis
+
+#endif  // ANALYSIS_UTILS_NUMA_TOPOLOGY_H
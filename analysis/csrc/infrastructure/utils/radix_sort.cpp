@@ -0,0 +1,130 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#include "analysis/csrc/infrastructure/utils/radix_sort.h"
+
+#include <array>
+#include <thread>
+
+namespace Analysis {
+namespace Utils {
+namespace {
+// 11位一趟，2048个桶的计数数组可放入L1/L2缓存，64位键最多6趟
+const int RADIX_BITS = 11;
+const size_t RADIX_BUCKETS = 1 << RADIX_BITS;
+const uint64_t RADIX_MASK = RADIX_BUCKETS - 1;
+const int KEY_BITS = 64;
+const uint32_t MAX_SORT_THREADS = 8;
+// 每个线程至少处理的元素数，低于该值时并行收益小于线程创建开销
+const size_t MIN_CHUNK_SIZE = 64 * 1024;
+// 元素数较少时直接使用比较排序
+const size_t SMALL_SORT_SIZE = 256;
+
+uint32_t GetThreadsNum(size_t total, uint32_t threadsNum)
+{
+    if (threadsNum == 0) {
+        threadsNum = std::min(std::max(std::thread::hardware_concurrency(), 1U), MAX_SORT_THREADS);
+    }
+    size_t maxThreads = std::max(total / MIN_CHUNK_SIZE, static_cast<size_t>(1));
+    return static_cast<uint32_t>(std::min(static_cast<size_t>(threadsNum), maxThreads));
+}
+}  // namespace
+
+void RadixSort::ForEachChunk(size_t total, uint32_t threadsNum, const ChunkFunc &func)
+{
+    uint32_t chunkNum = GetThreadsNum(total, threadsNum);
+    if (chunkNum <= 1) {
+        func(0, 0, total);
+        return;
+    }
+    std::vector<std::thread> threads;
+    threads.reserve(chunkNum - 1);
+    for (uint32_t chunk = 1; chunk < chunkNum; ++chunk) {
+        size_t begin = total * chunk / chunkNum;
+        size_t end = total * (chunk + 1) / chunkNum;
+        try {
+            threads.emplace_back(func, chunk, begin, end);
+        } catch (...) {
+            // 线程创建失败时在当前线程补做该块
+            func(chunk, begin, end);
+        }
+    }
+    func(0, 0, total / chunkNum);
+    for (auto &thread : threads) {
+        thread.join();
+    }
+}
+
+bool RadixSort::SortItems(std::vector<Item> &items, uint32_t threadsNum)
+{
+    const size_t total = items.size();
+    if (total <= SMALL_SORT_SIZE) {
+        std::stable_sort(items.begin(), items.end(), [](const Item &lhs, const Item &rhs) {
+            return lhs.key < rhs.key;
+        });
+        return true;
+    }
+    uint64_t orBits = 0;
+    uint64_t andBits = UINT64_MAX;
+    for (const auto &item : items) {
+        orBits |= item.key;
+        andBits &= item.key;
+    }
+    // 所有键在某趟的11位上取值相同时，该趟不改变顺序，可以跳过
+    const uint64_t diffBits = orBits ^ andBits;
+    if (diffBits == 0) {
+        return true;
+    }
+    std::vector<Item> buffer;
+    try {
+        buffer.resize(total);
+    } catch (...) {
+        return false;
+    }
+    const uint32_t chunkNum = GetThreadsNum(total, threadsNum);
+    std::vector<std::array<size_t, RADIX_BUCKETS>> offsets(chunkNum);
+    for (int shift = 0; shift < KEY_BITS; shift += RADIX_BITS) {
+        if (((diffBits >> shift) & RADIX_MASK) == 0) {
+            continue;
+        }
+        ForEachChunk(total, chunkNum, [&](uint32_t chunk, size_t begin, size_t end) {
+            auto &count = offsets[chunk];
+            count.fill(0);
+            for (size_t i = begin; i < end; ++i) {
+                ++count[(items[i].key >> shift) & RADIX_MASK];
+            }
+        });
+        // 按(桶, 块)的顺序分配输出位置，同一桶内前面块的元素排在前面，保证稳定
+        size_t position = 0;
+        for (size_t bucket = 0; bucket < RADIX_BUCKETS; ++bucket) {
+            for (uint32_t chunk = 0; chunk < chunkNum; ++chunk) {
+                size_t count = offsets[chunk][bucket];
+                offsets[chunk][bucket] = position;
+                position += count;
+            }
+        }
+        ForEachChunk(total, chunkNum, [&](uint32_t chunk, size_t begin, size_t end) {
+            auto &offset = offsets[chunk];
+            for (size_t i = begin; i < end; ++i) {
+                buffer[offset[(items[i].key >> shift) & RADIX_MASK]++] = items[i];
+            }
+        });
+        items.swap(buffer);
+    }
+    return true;
+}
+}  // namespace Utils
+}  // namespace Analysis
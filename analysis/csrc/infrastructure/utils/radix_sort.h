@@ -0,0 +1,195 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#ifndef ANALYSIS_UTILS_RADIX_SORT_H
+#define ANALYSIS_UTILS_RADIX_SORT_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+namespace Analysis {
+namespace Utils {
+// 将有符号整数、浮点数保序映射为无符号键，映射后按无符号比较的顺序与原值一致
+inline uint64_t RadixKeyOfSigned(int64_t value)
+{
+    return static_cast<uint64_t>(value) ^ (1ULL << 63);  // 63: 符号位
+}
+
+inline uint64_t RadixKeyOfDouble(double value)
+{
+    uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    // 负数取反使绝对值大的排在前面，非负数置符号位排在负数之后
+    return (bits >> 63) != 0 ? ~bits : (bits | (1ULL << 63));  // 63: 符号位
+}
+
+// 稳定的LSD基数排序，按64位无符号键升序
+// 先抽取(键, 下标)对完成排序，再按下标一次性搬移元素，大结构体在各趟中不会被反复拷贝；
+// 每趟处理11位，所有键在该段上相同的趟直接跳过，时间戳等高位相同的键通常只需3~4趟。
+// 数据量较大时，抽取键、直方图统计和分发均按线程切块并行，各块按顺序分配输出位置，保持稳定性。
+class RadixSort {
+public:
+    struct Item {
+        uint64_t key;
+        size_t index;
+    };
+
+    // 按keyOf(元素)升序稳定排序[first, last)，threadsNum为0时按CPU核数取默认值
+    template<typename RandomIt, typename KeyOf>
+    static void Sort(RandomIt first, RandomIt last, KeyOf keyOf, uint32_t threadsNum = 0)
+    {
+        std::vector<Item> items;
+        if (!MakeItems(first, last, keyOf, items, threadsNum) || !SortItems(items, threadsNum) ||
+            !Permute(first, items)) {
+            StableSortFallback(first, last, keyOf);
+        }
+    }
+
+    template<typename T, typename KeyOf>
+    static void Sort(std::vector<T> &data, KeyOf keyOf, uint32_t threadsNum = 0)
+    {
+        std::vector<Item> items;
+        std::vector<T> sorted;
+        if (MakeItems(data.begin(), data.end(), keyOf, items, threadsNum) && SortItems(items, threadsNum) &&
+            Gather(data.begin(), items, sorted)) {
+            data.swap(sorted);
+            return;
+        }
+        StableSortFallback(data.begin(), data.end(), keyOf);
+    }
+
+    // 按(primaryOf, secondaryOf)字典序升序稳定排序：先按次键排序，再按主键稳定排序
+    template<typename RandomIt, typename PrimaryOf, typename SecondaryOf>
+    static void SortByKeys(RandomIt first, RandomIt last, PrimaryOf primaryOf, SecondaryOf secondaryOf,
+                           uint32_t threadsNum = 0)
+    {
+        std::vector<Item> items;
+        if (MakeItems(first, last, secondaryOf, items, threadsNum) && SortItems(items, threadsNum)) {
+            ForEachChunk(items.size(), threadsNum,
+                [&items, &first, &primaryOf](uint32_t, size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; ++i) {
+                        items[i].key = primaryOf(first[static_cast<std::ptrdiff_t>(items[i].index)]);
+                    }
+                });
+            if (SortItems(items, threadsNum) && Permute(first, items)) {
+                return;
+            }
+        }
+        using ValueType = typename std::iterator_traits<RandomIt>::value_type;
+        std::stable_sort(first, last, [&primaryOf, &secondaryOf](const ValueType &lhs, const ValueType &rhs) {
+            auto lhsKey = primaryOf(lhs);
+            auto rhsKey = primaryOf(rhs);
+            return lhsKey < rhsKey || (lhsKey == rhsKey && secondaryOf(lhs) < secondaryOf(rhs));
+        });
+    }
+
+    template<typename T, typename PrimaryOf, typename SecondaryOf>
+    static void SortByKeys(std::vector<T> &data, PrimaryOf primaryOf, SecondaryOf secondaryOf,
+                           uint32_t threadsNum = 0)
+    {
+        SortByKeys(data.begin(), data.end(), primaryOf, secondaryOf, threadsNum);
+    }
+
+    // argsort：只计算排序后的下标，元素不移动，order[i]为排第i位的元素下标
+    template<typename T, typename KeyOf>
+    static bool ArgSort(const std::vector<T> &data, KeyOf keyOf, std::vector<size_t> &order,
+                        uint32_t threadsNum = 0)
+    {
+        std::vector<Item> items;
+        if (!MakeItems(data.begin(), data.end(), keyOf, items, threadsNum) || !SortItems(items, threadsNum)) {
+            return false;
+        }
+        try {
+            order.resize(items.size());
+        } catch (...) {
+            return false;
+        }
+        for (size_t i = 0; i < items.size(); ++i) {
+            order[i] = items[i].index;
+        }
+        return true;
+    }
+
+    // 对(键, 下标)对做稳定的基数排序
+    static bool SortItems(std::vector<Item> &items, uint32_t threadsNum);
+
+private:
+    // 将[0, total)切块后并行执行func(块号, begin, end)，数据量较小时只在当前线程执行
+    using ChunkFunc = std::function<void(uint32_t, size_t, size_t)>;
+    static void ForEachChunk(size_t total, uint32_t threadsNum, const ChunkFunc &func);
+
+    template<typename RandomIt, typename KeyOf>
+    static bool MakeItems(RandomIt first, RandomIt last, KeyOf &keyOf, std::vector<Item> &items,
+                          uint32_t threadsNum)
+    {
+        try {
+            items.resize(static_cast<size_t>(last - first));
+        } catch (...) {
+            return false;
+        }
+        ForEachChunk(items.size(), threadsNum, [&items, &first, &keyOf](uint32_t, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                items[i].key = keyOf(first[static_cast<std::ptrdiff_t>(i)]);
+                items[i].index = i;
+            }
+        });
+        return true;
+    }
+
+    // 按items中的下标顺序把元素移入sorted，内存不足时不改动原数据
+    template<typename RandomIt>
+    static bool Gather(RandomIt first, const std::vector<Item> &items,
+                       std::vector<typename std::iterator_traits<RandomIt>::value_type> &sorted)
+    {
+        try {
+            sorted.reserve(items.size());
+        } catch (...) {
+            return false;
+        }
+        for (const auto &item : items) {
+            sorted.emplace_back(std::move(first[static_cast<std::ptrdiff_t>(item.index)]));
+        }
+        return true;
+    }
+
+    template<typename RandomIt>
+    static bool Permute(RandomIt first, const std::vector<Item> &items)
+    {
+        std::vector<typename std::iterator_traits<RandomIt>::value_type> sorted;
+        if (!Gather(first, items, sorted)) {
+            return false;
+        }
+        std::move(sorted.begin(), sorted.end(), first);
+        return true;
+    }
+
+    template<typename RandomIt, typename KeyOf>
+    static void StableSortFallback(RandomIt first, RandomIt last, KeyOf &keyOf)
+    {
+        using ValueType = typename std::iterator_traits<RandomIt>::value_type;
+        std::stable_sort(first, last, [&keyOf](const ValueType &lhs, const ValueType &rhs) {
+            return keyOf(lhs) < keyOf(rhs);
+        });
+    }
+};
+}  // namespace Utils
+}  // namespace Analysis
+
+#endif  // ANALYSIS_UTILS_RADIX_SORT_H
@@ -0,0 +1,181 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#include "analysis/csrc/infrastructure/utils/run_control.h"
+
+#include <chrono>
+#include <cstdlib>
+
+#include "analysis/csrc/infrastructure/dfx/error_code.h"
+#include "analysis/csrc/infrastructure/dfx/log.h"
+#include "analysis/csrc/infrastructure/utils/utils.h"
+
+namespace Analysis {
+namespace Utils {
+namespace {
+const char *TIME_BUDGET_ENV = "MSPROF_ANALYSIS_TIME_BUDGET_S";
+const uint64_t NS_PER_MS = 1000 * 1000;
+const uint64_t NS_PER_S = 1000 * NS_PER_MS;
+
+uint64_t SteadyNowNs()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+uint64_t ReadEnvTimeBudget()
+{
+    const char *value = std::getenv(TIME_BUDGET_ENV);
+    uint64_t result = 0;
+    if (value == nullptr || *value == '\0' || StrToU64(result, value) != ANALYSIS_OK) {
+        return 0;
+    }
+    return result;
+}
+
+// 信号处理函数中只做无锁的原子写
+void CancelOnSignal(int)
+{
+    RunControl::GetInstance().Interrupt();
+}
+}  // namespace
+
+void RunControl::Begin()
+{
+    cancelled_ = false;
+    interrupted_ = false;
+    processesDone_ = 0;
+    recordsParsed_ = 0;
+    tablesWritten_ = 0;
+    assemblersDone_ = 0;
+    assemblersTotal_ = 0;
+    SetStage("");
+    auto budget = GetTimeBudget();
+    beginNs_ = SteadyNowNs();
+    deadlineNs_ = budget == 0 ? 0 : beginNs_ + budget * NS_PER_S;
+    if (budget != 0) {
+        INFO("The time budget of this run is % s.", budget);
+    }
+}
+
+void RunControl::Cancel()
+{
+    cancelled_ = true;
+}
+
+void RunControl::Interrupt()
+{
+    interrupted_ = true;
+    cancelled_ = true;
+}
+
+bool RunControl::IsCancelled()
+{
+    if (cancelled_) {
+        return true;
+    }
+    uint64_t deadline = deadlineNs_;
+    if (deadline != 0 && SteadyNowNs() > deadline) {
+        if (!cancelled_.exchange(true)) {
+            WARN("The time budget % s is exhausted, cancel the run.", GetTimeBudget());
+        }
+        return true;
+    }
+    return false;
+}
+
+bool RunControl::IsInterrupted() const
+{
+    return interrupted_;
+}
+
+void RunControl::SetTimeBudget(uint64_t seconds)
+{
+    timeBudget_ = seconds;
+    budgetSet_ = true;
+}
+
+uint64_t RunControl::GetTimeBudget() const
+{
+    return budgetSet_ ? timeBudget_.load() : ReadEnvTimeBudget();
+}
+
+void RunControl::SetStage(const std::string &stage)
+{
+    std::lock_guard<std::mutex> lock(stageMutex_);
+    stage_ = stage;
+}
+
+void RunControl::AddProcessDone()
+{
+    ++processesDone_;
+}
+
+void RunControl::AddRecords(uint64_t num)
+{
+    recordsParsed_ += num;
+}
+
+void RunControl::AddTableWritten()
+{
+    ++tablesWritten_;
+}
+
+void RunControl::AddAssemblersTotal(uint64_t num)
+{
+    assemblersTotal_ += num;
+}
+
+void RunControl::AddAssemblerDone()
+{
+    ++assemblersDone_;
+}
+
+RunProgress RunControl::GetProgress()
+{
+    RunProgress progress;
+    {
+        std::lock_guard<std::mutex> lock(stageMutex_);
+        progress.stage = stage_;
+    }
+    progress.processesDone = processesDone_;
+    progress.recordsParsed = recordsParsed_;
+    progress.tablesWritten = tablesWritten_;
+    progress.assemblersDone = assemblersDone_;
+    progress.assemblersTotal = assemblersTotal_;
+    uint64_t begin = beginNs_;
+    progress.elapsedMs = begin == 0 ? 0 : (SteadyNowNs() - begin) / NS_PER_MS;
+    progress.cancelled = IsCancelled();
+    progress.interrupted = IsInterrupted();
+    return progress;
+}
+
+CancelSignalGuard::CancelSignalGuard()
+{
+    struct sigaction action {};
+    action.sa_handler = CancelOnSignal;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGINT, &action, &oldInt_);
+    sigaction(SIGTERM, &action, &oldTerm_);
+}
+
+CancelSignalGuard::~CancelSignalGuard()
+{
+    sigaction(SIGINT, &oldInt_, nullptr);
+    sigaction(SIGTERM, &oldTerm_, nullptr);
+}
+}  // namespace Utils
+}  // namespace Analysis
@@ -0,0 +1,97 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#ifndef ANALYSIS_UTILS_RUN_CONTROL_H
+#define ANALYSIS_UTILS_RUN_CONTROL_H
+
+#include <atomic>
+#include <csignal>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+#include "analysis/csrc/infrastructure/utils/singleton.h"
+
+namespace Analysis {
+namespace Utils {
+// 一次运行的进度快照
+struct RunProgress {
+    std::string stage;
+    uint64_t processesDone = 0;    // 解析流程(ProcessControl)已完成的process数
+    uint64_t recordsParsed = 0;    // 导出前加载到DataInventory的记录数
+    uint64_t tablesWritten = 0;    // 已写入msprof db的表数
+    uint64_t assemblersDone = 0;   // 已完成的timeline/summary assembler数
+    uint64_t assemblersTotal = 0;
+    uint64_t elapsedMs = 0;
+    bool cancelled = false;
+    bool interrupted = false;      // 由SIGINT/SIGTERM取消
+};
+
+// 长耗时解析/导出的协作式取消、进度与时间预算
+// 取消由外部(Python接口或SIGINT/SIGTERM)发起，或在超出时间预算后自动生效。
+// 各阶段在任务边界检查IsCancelled：已开始的任务执行完毕，未开始的任务跳过，被取消的运行不发布产物。
+class RunControl : public Singleton<RunControl> {
+public:
+    // 开始一次运行，清空进度与取消标记，按时间预算设置截止时间
+    void Begin();
+    void Cancel();
+    // 收到SIGINT/SIGTERM时取消，调用方据此区分用户中断与超出时间预算
+    void Interrupt();
+    // 已取消或超出时间预算
+    bool IsCancelled();
+    bool IsInterrupted() const;
+    // 时间预算(秒)，0表示不限制，对下一次Begin生效；未设置时读取环境变量MSPROF_ANALYSIS_TIME_BUDGET_S
+    void SetTimeBudget(uint64_t seconds);
+    uint64_t GetTimeBudget() const;
+
+    void SetStage(const std::string &stage);
+    void AddProcessDone();
+    void AddRecords(uint64_t num);
+    void AddTableWritten();
+    void AddAssemblersTotal(uint64_t num);
+    void AddAssemblerDone();
+    RunProgress GetProgress();
+
+private:
+    std::atomic<bool> cancelled_{false};
+    std::atomic<bool> interrupted_{false};
+    std::atomic<bool> budgetSet_{false};
+    std::atomic<uint64_t> timeBudget_{0};
+    std::atomic<uint64_t> beginNs_{0};
+    std::atomic<uint64_t> deadlineNs_{0};
+    std::atomic<uint64_t> processesDone_{0};
+    std::atomic<uint64_t> recordsParsed_{0};
+    std::atomic<uint64_t> tablesWritten_{0};
+    std::atomic<uint64_t> assemblersDone_{0};
+    std::atomic<uint64_t> assemblersTotal_{0};
+    std::mutex stageMutex_;
+    std::string stage_;
+};
+
+// 作用域内收到SIGINT/SIGTERM时取消当前运行而不是直接退出进程，析构时恢复原有的信号处理
+class CancelSignalGuard {
+public:
+    CancelSignalGuard();
+    ~CancelSignalGuard();
+
+private:
+    struct sigaction oldInt_;
+    struct sigaction oldTerm_;
+};
+}  // namespace Utils
+}  // namespace Analysis
+
+#endif  // ANALYSIS_UTILS_RUN_CONTROL_H
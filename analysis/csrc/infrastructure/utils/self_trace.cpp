@@ -0,0 +1,303 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#include "analysis/csrc/infrastructure/utils/self_trace.h"
+
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include "analysis/csrc/infrastructure/dfx/log.h"
+#include "analysis/csrc/infrastructure/utils/file.h"
+
+namespace Analysis {
+namespace Utils {
+namespace {
+const uint64_t NS_PER_US = 1000;
+const uint64_t BYTES_PER_KB = 1024;
+const int TS_PRECISION = 3;
+
+struct ThreadBufferSlot {
+    SelfTraceBuffer *buffer = nullptr;
+    uint32_t generation = 0;
+};
+
+thread_local ThreadBufferSlot g_threadBuffer;
+
+void WriteEscaped(std::ostringstream &oss, const std::string &str)
+{
+    for (char c : str) {
+        switch (c) {
+            case '"':
+                oss << "\\\"";
+                break;
+            case '\\':
+                oss << "\\\\";
+                break;
+            case '\n':
+                oss << "\\n";
+                break;
+            case '\t':
+                oss << "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) >= 0x20) {
+                    oss << c;
+                }
+        }
+    }
+}
+
+uint64_t GetRssKb()
+{
+    std::ifstream statm("/proc/self/statm");
+    uint64_t size = 0;
+    uint64_t resident = 0;
+    if (!(statm >> size >> resident)) {
+        return 0;
+    }
+    return resident * static_cast<uint64_t>(sysconf(_SC_PAGESIZE)) / BYTES_PER_KB;
+}
+
+uint64_t GetPeakRssKb()
+{
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+    return static_cast<uint64_t>(usage.ru_maxrss);
+}
+}  // namespace
+
+const size_t SelfTraceBuffer::CHUNK_SIZE;
+const size_t SelfTraceBuffer::MAX_CHUNKS;
+std::atomic<bool> SelfTrace::enabled_{false};
+
+SelfTraceBuffer::SelfTraceBuffer(int tid) : tid_(tid) {}
+
+bool SelfTraceBuffer::Append(SelfTraceEvent &&event)
+{
+    auto size = size_.load(std::memory_order_relaxed);
+    auto chunkIndex = size / CHUNK_SIZE;
+    if (chunkIndex >= MAX_CHUNKS) {
+        return false;
+    }
+    if (chunks_[chunkIndex] == nullptr) {
+        chunks_[chunkIndex].reset(new(std::nothrow) SelfTraceEvent[CHUNK_SIZE]);
+        if (chunks_[chunkIndex] == nullptr) {
+            return false;
+        }
+    }
+    chunks_[chunkIndex][size % CHUNK_SIZE] = std::move(event);
+    size_.store(size + 1, std::memory_order_release);
+    return true;
+}
+
+size_t SelfTraceBuffer::Size() const
+{
+    return size_.load(std::memory_order_acquire);
+}
+
+const SelfTraceEvent &SelfTraceBuffer::At(size_t index) const
+{
+    return chunks_[index / CHUNK_SIZE][index % CHUNK_SIZE];
+}
+
+int SelfTraceBuffer::GetTid() const
+{
+    return tid_;
+}
+
+uint64_t SelfTrace::NowNs()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void SelfTrace::EnableFromEnv(const std::string &outputDir)
+{
+    const char *flag = std::getenv(SELF_TRACE_ENV);
+    if (flag == nullptr || *flag == '\0' || std::string(flag) == "0") {
+        return;
+    }
+    Enable(outputDir);
+}
+
+void SelfTrace::Enable(const std::string &outputDir)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    outputDir_ = outputDir;
+    if (baseNs_ == 0) {
+        baseNs_ = NowNs();
+    }
+    enabled_.store(true, std::memory_order_relaxed);
+    INFO("Self trace is enabled, the trace will be saved in %.", outputDir_);
+}
+
+void SelfTrace::Disable()
+{
+    enabled_.store(false, std::memory_order_relaxed);
+}
+
+SelfTraceBuffer *SelfTrace::GetThreadBuffer()
+{
+    auto generation = generation_.load(std::memory_order_acquire);
+    if (g_threadBuffer.buffer != nullptr && g_threadBuffer.generation == generation) {
+        return g_threadBuffer.buffer;
+    }
+    // 每个线程在每一代只注册一次，之后的记录无锁
+    std::unique_ptr<SelfTraceBuffer> buffer(new(std::nothrow) SelfTraceBuffer(
+        static_cast<int>(syscall(SYS_gettid))));
+    if (buffer == nullptr) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    g_threadBuffer.buffer = buffer.get();
+    g_threadBuffer.generation = generation_.load(std::memory_order_relaxed);
+    buffers_.emplace_back(std::move(buffer));
+    return g_threadBuffer.buffer;
+}
+
+void SelfTrace::Record(const char *category, std::string &&name, uint64_t startNs, uint64_t endNs)
+{
+    auto buffer = GetThreadBuffer();
+    SelfTraceEvent event;
+    event.name = std::move(name);
+    event.category = category;
+    event.startNs = startNs;
+    event.durNs = endNs > startNs ? endNs - startNs : 0;
+    if (buffer == nullptr || !buffer->Append(std::move(event))) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void SelfTrace::SampleMemory()
+{
+    auto buffer = GetThreadBuffer();
+    SelfTraceEvent event;
+    event.startNs = NowNs();
+    event.rssKb = GetRssKb();
+    event.peakRssKb = GetPeakRssKb();
+    event.isMemory = true;
+    if (buffer == nullptr || !buffer->Append(std::move(event))) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+std::string SelfTrace::Dump() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto pid = getpid();
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(TS_PRECISION);
+    oss << "{\"traceEvents\":[{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pid <<
+        ",\"tid\":0,\"args\":{\"name\":\"msprof_analysis\"}}";
+    for (const auto &buffer : buffers_) {
+        auto size = buffer->Size();
+        for (size_t i = 0; i < size; ++i) {
+            const auto &event = buffer->At(i);
+            double ts = event.startNs > baseNs_ ? static_cast<double>(event.startNs - baseNs_) / NS_PER_US : 0;
+            if (event.isMemory) {
+                oss << ",{\"name\":\"memory\",\"ph\":\"C\",\"ts\":" << ts << ",\"pid\":" << pid <<
+                    ",\"args\":{\"rss_kb\":" << event.rssKb << ",\"peak_rss_kb\":" << event.peakRssKb << "}}";
+                continue;
+            }
+            oss << ",{\"name\":\"";
+            WriteEscaped(oss, event.name);
+            oss << "\",\"cat\":\"" << event.category << "\",\"ph\":\"X\",\"ts\":" << ts << ",\"dur\":" <<
+                static_cast<double>(event.durNs) / NS_PER_US << ",\"pid\":" << pid << ",\"tid\":" <<
+                buffer->GetTid() << "}";
+        }
+    }
+    oss << "],\"otherData\":{\"dropped\":" << dropped_.load(std::memory_order_relaxed) << "}}";
+    return oss.str();
+}
+
+std::string SelfTrace::GetFilePath() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    // 每次Clear后的事件写入新的文件，避免覆盖之前已输出的trace
+    auto cleared = generation_.load(std::memory_order_acquire) - 1;
+    std::string suffix = cleared == 0 ? "" : "_" + std::to_string(cleared);
+    return File::PathJoin({outputDir_, "msprof_analysis_trace_" + std::to_string(getpid()) + suffix + ".json"});
+}
+
+bool SelfTrace::Flush() const
+{
+    if (!IsEnabled()) {
+        return true;
+    }
+    auto path = GetFilePath();
+    auto content = Dump();
+    FileWriter writer(path);
+    if (!writer.IsOpen()) {
+        ERROR("Open self trace file % failed.", path);
+        return false;
+    }
+    writer.WriteText(content);
+    INFO("Self trace is saved in %.", path);
+    return true;
+}
+
+void SelfTrace::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    // 其他线程可能仍持有旧缓冲区的指针，旧缓冲区保留到进程退出
+    for (auto &buffer : buffers_) {
+        retired_.emplace_back(std::move(buffer));
+    }
+    buffers_.clear();
+    dropped_.store(0, std::memory_order_relaxed);
+    generation_.fetch_add(1, std::memory_order_release);
+}
+
+TraceSpan::TraceSpan(const char *category, const std::string &name, bool sampleMemory)
+    : category_(category), active_(SelfTrace::IsEnabled()), sampleMemory_(sampleMemory)
+{
+    if (active_) {
+        name_ = name;
+        startNs_ = SelfTrace::NowNs();
+    }
+}
+
+TraceSpan::TraceSpan(const char *category, const char *prefix, const std::string &suffix, bool sampleMemory)
+    : category_(category), active_(SelfTrace::IsEnabled()), sampleMemory_(sampleMemory)
+{
+    if (active_) {
+        name_.append(prefix).append(suffix);
+        startNs_ = SelfTrace::NowNs();
+    }
+}
+
+TraceSpan::~TraceSpan()
+{
+    if (!active_) {
+        return;
+    }
+    auto &trace = SelfTrace::GetInstance();
+    trace.Record(category_, std::move(name_), startNs_, SelfTrace::NowNs());
+    if (sampleMemory_) {
+        trace.SampleMemory();
+    }
+}
+}  // namespace Utils
+}  // namespace Analysis
@@ -0,0 +1,131 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#ifndef ANALYSIS_UTILS_SELF_TRACE_H
+#define ANALYSIS_UTILS_SELF_TRACE_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "analysis/csrc/infrastructure/utils/singleton.h"
+
+namespace Analysis {
+namespace Utils {
+// 自身trace的事件类别，对应Chrome trace中的cat字段
+const char * const TRACE_CAT_PROCESS = "process";
+const char * const TRACE_CAT_PROCESSOR = "processor";
+const char * const TRACE_CAT_ASSEMBLER = "assembler";
+const char * const TRACE_CAT_SAVE = "save";
+const char * const TRACE_CAT_DB = "db";
+const char * const TRACE_CAT_TASK = "task";
+// 设置该环境变量(非空且不为"0")时开启自身trace
+const char * const SELF_TRACE_ENV = "MSPROF_ANALYSIS_SELF_TRACE";
+
+struct SelfTraceEvent {
+    std::string name;
+    const char *category = "";
+    uint64_t startNs = 0;
+    uint64_t durNs = 0;
+    uint64_t rssKb = 0;         // 仅内存采样事件有效
+    uint64_t peakRssKb = 0;
+    bool isMemory = false;
+};
+
+// 单个线程的事件缓冲区，只由所属线程追加，导出时其他线程可并发读取已发布的事件
+// 事件按块存储，块一旦分配不再移动，size_以release语义发布，读取方以acquire语义读取
+class SelfTraceBuffer {
+public:
+    explicit SelfTraceBuffer(int tid);
+    bool Append(SelfTraceEvent &&event);
+    size_t Size() const;
+    const SelfTraceEvent &At(size_t index) const;
+    int GetTid() const;
+
+    static const size_t CHUNK_SIZE = 1024;
+    static const size_t MAX_CHUNKS = 4096;  // 单线程最多记录4M个事件，超出后丢弃并计数
+
+private:
+    int tid_;
+    std::atomic<size_t> size_{0};
+    std::array<std::unique_ptr<SelfTraceEvent[]>, MAX_CHUNKS> chunks_;
+};
+
+// 解析工具自身执行过程的轻量trace
+// 开启后记录各流程、DataProcessor、Assembler、Save函数、db语句与线程池任务的耗时区间以及内存采样，
+// 最终输出为Chrome trace格式的json，可直接用chrome://tracing或Perfetto打开
+// 未开启时每个埋点只有一次原子变量读取的开销
+class SelfTrace : public Singleton<SelfTrace> {
+public:
+    static bool IsEnabled()
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+    static uint64_t NowNs();
+    // 环境变量开启时启用，trace文件写入outputDir
+    void EnableFromEnv(const std::string &outputDir);
+    void Enable(const std::string &outputDir);
+    void Disable();
+    void Record(const char *category, std::string &&name, uint64_t startNs, uint64_t endNs);
+    // 记录当前RSS与RSS峰值
+    void SampleMemory();
+    std::string Dump() const;
+    // 写入outputDir/msprof_analysis_trace_{pid}.json，Clear过的写入msprof_analysis_trace_{pid}_{n}.json，
+    // 未开启时直接返回true
+    bool Flush() const;
+    std::string GetFilePath() const;
+    // 丢弃已记录的事件，已注册的线程会在下次记录时重新注册
+    void Clear();
+
+private:
+    SelfTraceBuffer *GetThreadBuffer();
+
+private:
+    static std::atomic<bool> enabled_;
+    mutable std::mutex mutex_;
+    std::string outputDir_;
+    uint64_t baseNs_ = 0;
+    std::atomic<uint32_t> generation_{1};
+    std::atomic<uint64_t> dropped_{0};
+    std::vector<std::unique_ptr<SelfTraceBuffer>> buffers_;
+    std::vector<std::unique_ptr<SelfTraceBuffer>> retired_;
+};
+
+// 作用域内的耗时区间，析构时记录
+class TraceSpan {
+public:
+    TraceSpan(const char *category, const std::string &name, bool sampleMemory = false);
+    // name为prefix + suffix，仅在开启时拼接
+    TraceSpan(const char *category, const char *prefix, const std::string &suffix, bool sampleMemory = false);
+    ~TraceSpan();
+    TraceSpan(const TraceSpan &) = delete;
+    TraceSpan &operator=(const TraceSpan &) = delete;
+
+private:
+    const char *category_;
+    std::string name_;
+    uint64_t startNs_ = 0;
+    bool active_ = false;
+    bool sampleMemory_ = false;
+};
+}  // namespace Utils
+}  // namespace Analysis
+
+#endif  // ANALYSIS_UTILS_SELF_TRACE_H
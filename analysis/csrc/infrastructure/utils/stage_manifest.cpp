@@ -0,0 +1,376 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#include "analysis/csrc/infrastructure/utils/stage_manifest.h"
+
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include "analysis/csrc/infrastructure/dfx/error_code.h"
+#include "analysis/csrc/infrastructure/dfx/log.h"
+#include "analysis/csrc/infrastructure/utils/file.h"
+#include "analysis/csrc/infrastructure/utils/utils.h"
+
+namespace Analysis {
+namespace Utils {
+namespace {
+const std::string MANIFEST_VERSION = "1";
+const std::string MANIFEST_SUFFIX = "_manifest";
+const std::string TAG_VERSION = "version";
+const std::string TAG_PARAM = "param";
+const std::string TAG_INPUT = "input";
+const std::string TAG_OUTPUT = "output";
+const std::string FIELD_SEP = "\t";
+const size_t PARAM_FIELDS = 3;
+const size_t INPUT_FIELDS = 5;
+const size_t OUTPUT_FIELDS = 2;
+const size_t HASH_BUFFER_SIZE = 1024 * 1024;
+// 部分文件系统的修改时间精度为秒级，产物判定时放宽2s
+const uint64_t MTIME_MARGIN_NS = 2ULL * 1000 * 1000 * 1000;
+
+const uint64_t HASH_SEED = 0x9E3779B97F4A7C15ULL;
+const uint64_t HASH_PRIME1 = 0x87C37B91114253D5ULL;
+const uint64_t HASH_PRIME2 = 0x4CF5AD432745937FULL;
+const uint64_t HASH_FINAL = 0xFF51AFD7ED558CCDULL;
+const int ROTATE_BITS = 31;
+const int FINAL_SHIFT = 33;
+const size_t WORD_SIZE = sizeof(uint64_t);
+
+inline uint64_t Rotl(uint64_t value, int bits)
+{
+    return (value << bits) | (value >> (64 - bits));
+}
+
+inline uint64_t MixWord(uint64_t hash, uint64_t word)
+{
+    word *= HASH_PRIME1;
+    word = Rotl(word, ROTATE_BITS);
+    word *= HASH_PRIME2;
+    return Rotl(hash ^ word, ROTATE_BITS) * HASH_PRIME1;
+}
+
+// 按8字节整字处理，末尾不足8字节补0
+void MixBuffer(uint64_t &hash, const char *data, size_t len)
+{
+    for (size_t offset = 0; offset < len; offset += WORD_SIZE) {
+        uint64_t word = 0;
+        std::memcpy(&word, data + offset, std::min(WORD_SIZE, len - offset));
+        hash = MixWord(hash, word);
+    }
+}
+
+uint64_t Finalize(uint64_t hash, uint64_t total)
+{
+    hash ^= total;
+    hash ^= hash >> FINAL_SHIFT;
+    hash *= HASH_FINAL;
+    hash ^= hash >> FINAL_SHIFT;
+    return hash;
+}
+
+uint64_t NowNs()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+}
+
+bool EndsWithAny(const std::string &name, const std::vector<std::string> &suffixes)
+{
+    if (suffixes.empty()) {
+        return true;
+    }
+    for (const auto &suffix : suffixes) {
+        if (EndsWith(name, suffix)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// 遍历目录下的非隐藏普通文件
+std::vector<std::string> ListFiles(const std::string &dir)
+{
+    std::vector<std::string> files;
+    DIR *dp = opendir(dir.c_str());
+    if (dp == nullptr) {
+        return files;
+    }
+    const struct dirent *entry = nullptr;
+    while ((entry = readdir(dp)) != nullptr) {
+        if (entry->d_name[0] == '.') {
+            continue;
+        }
+        auto path = File::PathJoin({dir, entry->d_name});
+        struct stat st;
+        if (stat(path.c_str(), &st) == 0 && S_ISREG(st.st_mode)) {
+            files.emplace_back(path);
+        }
+    }
+    closedir(dp);
+    return files;
+}
+}  // namespace
+
+StageManifest::StageManifest(const std::string &manifestDir, const std::string &stage)
+    : manifestDir_(manifestDir), stage_(stage)
+{}
+
+std::string StageManifest::GetManifestPath() const
+{
+    return File::PathJoin({manifestDir_, "." + stage_ + MANIFEST_SUFFIX});
+}
+
+void StageManifest::AddInputFile(const std::string &path)
+{
+    struct stat st;
+    if (stat(path.c_str(), &st) == 0 && S_ISREG(st.st_mode)) {
+        inputs_.insert(path);
+    }
+}
+
+void StageManifest::AddInputDir(const std::string &dir)
+{
+    for (const auto &file : ListFiles(dir)) {
+        inputs_.insert(file);
+    }
+}
+
+void StageManifest::AddParam(const std::string &key, const std::string &value)
+{
+    params_[key] = value;
+}
+
+void StageManifest::AddOutputFile(const std::string &path)
+{
+    outputs_.insert(path);
+}
+
+void StageManifest::AddOutputsModifiedSinceBegin(const std::string &dir, const std::vector<std::string> &suffixes)
+{
+    for (const auto &file : ListFiles(dir)) {
+        FileFingerprint fingerprint;
+        if (!EndsWithAny(file, suffixes) || !GetFingerprint(file, fingerprint, false)) {
+            continue;
+        }
+        if (fingerprint.mtime >= beginTime_) {
+            outputs_.insert(file);
+        }
+    }
+}
+
+bool StageManifest::GetFingerprint(const std::string &path, FileFingerprint &fingerprint, bool withHash)
+{
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0) {
+        return false;
+    }
+    fingerprint.size = static_cast<uint64_t>(st.st_size);
+    fingerprint.mtime = static_cast<uint64_t>(st.st_mtim.tv_sec) * NANO_SECOND +
+                        static_cast<uint64_t>(st.st_mtim.tv_nsec);
+    return !withHash || HashFile(path, fingerprint.hash);
+}
+
+bool StageManifest::HashFile(const std::string &path, uint64_t &hash)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open()) {
+        ERROR("Open % for hash failed.", path);
+        return false;
+    }
+    std::vector<char> buffer;
+    if (!Resize(buffer, HASH_BUFFER_SIZE)) {
+        return false;
+    }
+    uint64_t result = HASH_SEED;
+    uint64_t total = 0;
+    while (in) {
+        in.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        auto len = static_cast<size_t>(in.gcount());
+        // 只有文件末尾的读取不足整块，整块长度为8字节的整数倍
+        MixBuffer(result, buffer.data(), len);
+        total += len;
+    }
+    hash = Finalize(result, total);
+    return true;
+}
+
+uint64_t StageManifest::HashString(const std::string &content)
+{
+    uint64_t result = HASH_SEED;
+    MixBuffer(result, content.data(), content.size());
+    return Finalize(result, content.size());
+}
+
+bool StageManifest::Load()
+{
+    if (loaded_) {
+        return true;
+    }
+    auto path = GetManifestPath();
+    if (!File::Exist(path)) {
+        return false;
+    }
+    FileReader reader(path);
+    std::vector<std::string> lines;
+    if (reader.ReadText(lines) != ANALYSIS_OK || lines.empty() ||
+        lines.front() != TAG_VERSION + FIELD_SEP + MANIFEST_VERSION) {
+        WARN("Invalid % manifest: %.", stage_, path);
+        return false;
+    }
+    for (size_t i = 1; i < lines.size(); ++i) {
+        auto fields = Split(lines[i], FIELD_SEP);
+        if (fields.size() == PARAM_FIELDS && fields[0] == TAG_PARAM) {
+            prevParams_[fields[1]] = fields[2];  // 2: value
+        } else if (fields.size() == INPUT_FIELDS && fields[0] == TAG_INPUT) {
+            FileFingerprint fingerprint;
+            // 2: size, 3: mtime, 4: hash
+            if (StrToU64(fingerprint.size, fields[2]) != ANALYSIS_OK ||
+                StrToU64(fingerprint.mtime, fields[3]) != ANALYSIS_OK ||
+                StrToU64(fingerprint.hash, fields[4]) != ANALYSIS_OK) {
+                WARN("Invalid input record in % manifest.", stage_);
+                prevInputs_.clear();
+                return false;
+            }
+            prevInputs_[fields[1]] = fingerprint;
+        } else if (fields.size() == OUTPUT_FIELDS && fields[0] == TAG_OUTPUT) {
+            prevOutputs_.emplace_back(fields[1]);
+        } else {
+            WARN("Invalid record in % manifest, line %.", stage_, i);
+            return false;
+        }
+    }
+    loaded_ = true;
+    return true;
+}
+
+bool StageManifest::InputsMatch()
+{
+    if (prevInputs_.size() != inputs_.size()) {
+        return false;
+    }
+    for (const auto &input : inputs_) {
+        auto it = prevInputs_.find(input);
+        if (it == prevInputs_.end()) {
+            return false;
+        }
+        FileFingerprint fingerprint;
+        if (!GetFingerprint(input, fingerprint, false) || fingerprint.size != it->second.size) {
+            return false;
+        }
+        if (fingerprint.mtime == it->second.mtime) {
+            // 大小和修改时间未变化时信任上次的记录
+            fingerprint.hash = it->second.hash;
+            fingerprints_[input] = fingerprint;
+            continue;
+        }
+        // 大小不变而修改时间变化时计算内容hash，结果留给Commit复用，上次未记录hash时无法判定内容相同
+        if (!HashFile(input, fingerprint.hash)) {
+            return false;
+        }
+        fingerprints_[input] = fingerprint;
+        if (it->second.hash == UNKNOWN_HASH || fingerprint.hash != it->second.hash) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool StageManifest::IsUpToDate()
+{
+    if (!Load()) {
+        return false;
+    }
+    if (prevParams_ != params_) {
+        INFO("The parameters of % changed.", stage_);
+        return false;
+    }
+    if (!InputsMatch()) {
+        INFO("The inputs of % changed.", stage_);
+        return false;
+    }
+    for (const auto &output : prevOutputs_) {
+        if (!File::Exist(output)) {
+            INFO("The output % of % is missing.", output, stage_);
+            return false;
+        }
+    }
+    INFO("The inputs of % are unchanged, reuse % previous outputs.", stage_, prevOutputs_.size());
+    return true;
+}
+
+void StageManifest::Begin()
+{
+    beginTime_ = NowNs() - MTIME_MARGIN_NS;
+    auto path = GetManifestPath();
+    if (File::Exist(path) && !File::DeleteFile(path)) {
+        WARN("Delete % manifest failed: %.", stage_, path);
+    }
+}
+
+bool StageManifest::Commit()
+{
+    std::ostringstream oss;
+    oss << TAG_VERSION << FIELD_SEP << MANIFEST_VERSION << "\n";
+    for (const auto &param : params_) {
+        oss << TAG_PARAM << FIELD_SEP << param.first << FIELD_SEP << param.second << "\n";
+    }
+    for (const auto &input : inputs_) {
+        // 只复用检查阶段算过的hash，不再整读输入；未计算过的记录为UNKNOWN_HASH
+        auto it = fingerprints_.find(input);
+        FileFingerprint fingerprint;
+        if (it != fingerprints_.end()) {
+            fingerprint = it->second;
+        } else if (!GetFingerprint(input, fingerprint, false)) {
+            ERROR("Get fingerprint of % failed, % manifest is not saved.", input, stage_);
+            return false;
+        }
+        oss << TAG_INPUT << FIELD_SEP << input << FIELD_SEP << fingerprint.size << FIELD_SEP <<
+            fingerprint.mtime << FIELD_SEP << fingerprint.hash << "\n";
+    }
+    for (const auto &output : outputs_) {
+        oss << TAG_OUTPUT << FIELD_SEP << output << "\n";
+    }
+    FileWriter writer(GetManifestPath());
+    if (!writer.IsOpen()) {
+        ERROR("Save % manifest failed.", stage_);
+        return false;
+    }
+    writer.WriteText(oss.str());
+    return true;
+}
+
+void StageManifest::RemovePreviousOutputs()
+{
+    Load();
+    for (const auto &output : prevOutputs_) {
+        if (File::Exist(output) && !File::DeleteFile(output)) {
+            WARN("Delete previous output % failed.", output);
+        }
+    }
+}
+
+const std::vector<std::string> &StageManifest::GetPreviousOutputs() const
+{
+    return prevOutputs_;
+}
+}  // namespace Utils
+}  // namespace Analysis
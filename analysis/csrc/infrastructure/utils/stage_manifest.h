@@ -0,0 +1,95 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#ifndef ANALYSIS_UTILS_STAGE_MANIFEST_H
+#define ANALYSIS_UTILS_STAGE_MANIFEST_H
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace Analysis {
+namespace Utils {
+
+// 未计算内容hash时的取值
+const uint64_t UNKNOWN_HASH = 0;
+
+struct FileFingerprint {
+    uint64_t size = 0;
+    uint64_t mtime = 0;  // ns
+    uint64_t hash = UNKNOWN_HASH;
+};
+
+// 解析/导出阶段的增量缓存清单
+// 记录阶段的输入文件指纹(大小、修改时间、内容hash)、参数以及产物文件列表，
+// 输入与参数均未变化且产物齐全时，阶段可以跳过并复用上次的产物
+// 输入以大小+修改时间为准，只有大小不变而修改时间变化的文件才会在检查时计算内容hash，Commit不再读取输入
+// 用法：
+//   StageManifest manifest(dir, "device_parse");
+//   manifest.AddInputDir(dataDir); manifest.AddParam("stop_at", stopAt);
+//   if (manifest.IsUpToDate()) { return; }
+//   manifest.Begin();                 // 删除旧清单，阶段中途退出不会留下有效清单
+//   ... run stage ...
+//   manifest.AddOutputsModifiedSinceBegin(outputDir); manifest.Commit();
+class StageManifest {
+public:
+    StageManifest(const std::string &manifestDir, const std::string &stage);
+    // 输入文件，仅记录普通文件
+    void AddInputFile(const std::string &path);
+    // 目录下的所有普通文件(不递归)，跳过以'.'开头的隐藏文件
+    void AddInputDir(const std::string &dir);
+    void AddParam(const std::string &key, const std::string &value);
+    void AddOutputFile(const std::string &path);
+    // 将dir下在Begin之后修改过且以suffixes之一结尾的文件记为产物，suffixes为空时不过滤
+    void AddOutputsModifiedSinceBegin(const std::string &dir, const std::vector<std::string> &suffixes = {});
+    // 输入、参数与上次清单一致且上次产物均存在
+    bool IsUpToDate();
+    // 阶段开始，删除旧清单并记录开始时间
+    void Begin();
+    // 阶段成功结束，写入新清单
+    bool Commit();
+    // 删除上次清单记录的产物，用于输入变化后避免旧产物被误用
+    void RemovePreviousOutputs();
+    const std::vector<std::string> &GetPreviousOutputs() const;
+    std::string GetManifestPath() const;
+
+    static bool GetFingerprint(const std::string &path, FileFingerprint &fingerprint, bool withHash);
+    static bool HashFile(const std::string &path, uint64_t &hash);
+    static uint64_t HashString(const std::string &content);
+
+private:
+    bool Load();
+    bool InputsMatch();
+
+private:
+    std::string manifestDir_;
+    std::string stage_;
+    uint64_t beginTime_ = 0;
+    bool loaded_ = false;
+    std::set<std::string> inputs_;
+    std::map<std::string, std::string> params_;
+    std::set<std::string> outputs_;
+    std::map<std::string, FileFingerprint> fingerprints_;
+    std::map<std::string, FileFingerprint> prevInputs_;
+    std::map<std::string, std::string> prevParams_;
+    std::vector<std::string> prevOutputs_;
+};
+}  // namespace Utils
+}  // namespace Analysis
+
+#endif  // ANALYSIS_UTILS_STAGE_MANIFEST_H
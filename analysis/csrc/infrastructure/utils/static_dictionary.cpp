@@ -0,0 +1,416 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#include "analysis/csrc/infrastructure/utils/static_dictionary.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "analysis/csrc/infrastructure/dfx/log.h"
+#include "analysis/csrc/infrastructure/utils/common_constant.h"
+#include "analysis/csrc/infrastructure/utils/file.h"
+#include "analysis/csrc/infrastructure/utils/utils.h"
+
+namespace Analysis {
+namespace Utils {
+namespace {
+const char MAGIC[] = {'M', 'S', 'P', 'R', 'O', 'F', 'S', 'D'};
+const uint32_t VERSION = 1;
+// 文件头：magic(8) + version(4) + seed(4) + key数(8) + 桶数(8) + 字符串区字节数(8)
+const size_t HEADER_SIZE = 40;
+const size_t VERSION_OFFSET = 8;
+const size_t SEED_OFFSET = 12;
+const size_t COUNT_OFFSET = 16;
+const size_t BUCKET_NUM_OFFSET = 24;
+const size_t ARENA_SIZE_OFFSET = 32;
+const size_t WORD_SIZE = sizeof(uint64_t);
+// 平均每个桶2个key，位移表每个key约占2字节，且单key桶足够多，能填满大桶放置后剩余的空槽
+const uint64_t BUCKET_LOAD = 2;
+// 位移最高位置1表示单key桶，低31位直接为槽位号
+const uint32_t DIRECT_FLAG = 0x80000000U;
+const uint32_t MAX_DISPLACEMENT = 1U << 20;
+const uint32_t MAX_SEED_NUM = 8;
+const uint64_t GOLDEN = 0x9E3779B97F4A7C15ULL;
+const uint64_t MIX_PRIME1 = 0xBF58476D1CE4E5B9ULL;
+const uint64_t MIX_PRIME2 = 0x94D049BB133111EBULL;
+const int MIX_SHIFT1 = 30;
+const int MIX_SHIFT2 = 27;
+const int MIX_SHIFT3 = 31;
+const int BUCKET_SHIFT = 32;
+
+inline uint64_t Mix(uint64_t value)
+{
+    value = (value ^ (value >> MIX_SHIFT1)) * MIX_PRIME1;
+    value = (value ^ (value >> MIX_SHIFT2)) * MIX_PRIME2;
+    return value ^ (value >> MIX_SHIFT3);
+}
+
+inline uint64_t HashKey(uint64_t key, uint32_t seed)
+{
+    return Mix(key ^ (seed * GOLDEN));
+}
+
+inline uint64_t BucketOf(uint64_t hash, uint64_t bucketNum)
+{
+    return (hash >> BUCKET_SHIFT) % bucketNum;
+}
+
+inline uint64_t SlotOfHash(uint64_t hash, uint32_t displacement, uint64_t count)
+{
+    return Mix(hash + displacement * GOLDEN) % count;
+}
+
+inline uint64_t AlignUp(uint64_t value)
+{
+    return (value + WORD_SIZE - 1) / WORD_SIZE * WORD_SIZE;
+}
+
+inline uint64_t LayoutSize(uint64_t count, uint64_t bucketNum, uint64_t arenaSize)
+{
+    return HEADER_SIZE + AlignUp(bucketNum * sizeof(uint32_t)) + count * WORD_SIZE + (count + 1) * WORD_SIZE +
+           AlignUp(arenaSize);
+}
+
+template<typename T>
+T LoadValue(const char *src)
+{
+    T value;
+    std::memcpy(&value, src, sizeof(value));
+    return value;
+}
+}  // namespace
+
+StaticDictionary::~StaticDictionary()
+{
+    Clear();
+}
+
+void StaticDictionary::Clear()
+{
+    if (mapped_) {
+        munmap(const_cast<char *>(base_), size_);
+    }
+    std::vector<uint64_t>().swap(storage_);
+    base_ = nullptr;
+    size_ = 0;
+    mapped_ = false;
+    seed_ = 0;
+    count_ = 0;
+    bucketNum_ = 0;
+    displacements_ = nullptr;
+    keys_ = nullptr;
+    offsets_ = nullptr;
+    arena_ = nullptr;
+}
+
+bool StaticDictionary::Build(const std::unordered_map<uint64_t, std::string> &data)
+{
+    Clear();
+    if (data.size() >= DIRECT_FLAG) {
+        ERROR("Too many keys for static dictionary: %.", data.size());
+        return false;
+    }
+    std::vector<std::pair<uint64_t, const std::string *>> entries;
+    if (!Reserve(entries, data.size())) {
+        return false;
+    }
+    for (const auto &item : data) {
+        entries.emplace_back(item.first, &item.second);
+    }
+    // 按key排序，相同内容构建出的字典逐字节一致
+    std::sort(entries.begin(), entries.end(),
+              [](const std::pair<uint64_t, const std::string *> &lhs,
+                 const std::pair<uint64_t, const std::string *> &rhs) { return lhs.first < rhs.first; });
+    for (uint32_t seed = 0; seed < MAX_SEED_NUM; ++seed) {
+        if (BuildWithSeed(entries, seed)) {
+            return true;
+        }
+    }
+    ERROR("Build static dictionary failed, key num is %.", data.size());
+    Clear();
+    return false;
+}
+
+bool StaticDictionary::Build(std::unordered_map<uint64_t, std::string> &&data)
+{
+    if (!Build(static_cast<const std::unordered_map<uint64_t, std::string> &>(data))) {
+        return false;
+    }
+    std::unordered_map<uint64_t, std::string>().swap(data);
+    return true;
+}
+
+bool StaticDictionary::BuildWithSeed(const std::vector<std::pair<uint64_t, const std::string *>> &entries,
+                                     uint32_t seed)
+{
+    uint64_t count = entries.size();
+    uint64_t bucketNum = count / BUCKET_LOAD + 1;
+    std::vector<uint64_t> hashes;
+    std::vector<uint32_t> bucketBegin;
+    std::vector<uint32_t> order;
+    if (!Resize(hashes, count) || !Resize(bucketBegin, bucketNum + 1) || !Resize(order, count)) {
+        return false;
+    }
+    // 按桶号计数排序，order[bucketBegin[b], bucketBegin[b + 1])为桶b内的key下标
+    for (uint64_t i = 0; i < count; ++i) {
+        hashes[i] = HashKey(entries[i].first, seed);
+        ++bucketBegin[BucketOf(hashes[i], bucketNum) + 1];
+    }
+    std::partial_sum(bucketBegin.begin(), bucketBegin.end(), bucketBegin.begin());
+    std::vector<uint32_t> cursor(bucketBegin.begin(), bucketBegin.end() - 1);
+    for (uint64_t i = 0; i < count; ++i) {
+        order[cursor[BucketOf(hashes[i], bucketNum)]++] = static_cast<uint32_t>(i);
+    }
+    // 大桶先放置，空槽越少越难放下，单key桶最后直接填入剩余空槽
+    std::vector<uint32_t> buckets(bucketNum);
+    std::iota(buckets.begin(), buckets.end(), 0);
+    std::stable_sort(buckets.begin(), buckets.end(), [&bucketBegin](uint32_t lhs, uint32_t rhs) {
+        return bucketBegin[lhs + 1] - bucketBegin[lhs] > bucketBegin[rhs + 1] - bucketBegin[rhs];
+    });
+    std::vector<uint32_t> displacements(bucketNum, 0);
+    std::vector<uint32_t> slotOf(count, 0);
+    std::vector<char> taken(count, 0);
+    std::vector<uint64_t> slots;
+    uint64_t freeSlot = 0;
+    for (auto bucket : buckets) {
+        uint32_t begin = bucketBegin[bucket];
+        uint32_t end = bucketBegin[bucket + 1];
+        if (end - begin == 0) {
+            break;
+        }
+        if (end - begin == 1) {
+            while (taken[freeSlot]) {
+                ++freeSlot;
+            }
+            taken[freeSlot] = 1;
+            slotOf[order[begin]] = static_cast<uint32_t>(freeSlot);
+            displacements[bucket] = DIRECT_FLAG | static_cast<uint32_t>(freeSlot);
+            continue;
+        }
+        bool placed = false;
+        for (uint32_t displacement = 0; displacement < MAX_DISPLACEMENT && !placed; ++displacement) {
+            slots.clear();
+            for (auto i = begin; i < end; ++i) {
+                auto slot = SlotOfHash(hashes[order[i]], displacement, count);
+                if (taken[slot] || std::find(slots.begin(), slots.end(), slot) != slots.end()) {
+                    break;
+                }
+                slots.emplace_back(slot);
+            }
+            if (slots.size() != end - begin) {
+                continue;
+            }
+            for (auto i = begin; i < end; ++i) {
+                taken[slots[i - begin]] = 1;
+                slotOf[order[i]] = static_cast<uint32_t>(slots[i - begin]);
+            }
+            displacements[bucket] = displacement;
+            placed = true;
+        }
+        if (!placed) {
+            WARN("Place bucket of size % failed with seed %, retry with another seed.", end - begin, seed);
+            return false;
+        }
+    }
+
+    std::vector<uint64_t> lengths(count + 1, 0);
+    for (uint64_t i = 0; i < count; ++i) {
+        lengths[slotOf[i] + 1] = entries[i].second->size();
+    }
+    std::partial_sum(lengths.begin(), lengths.end(), lengths.begin());
+    uint64_t arenaSize = lengths[count];
+    if (!Resize(storage_, LayoutSize(count, bucketNum, arenaSize) / WORD_SIZE)) {
+        return false;
+    }
+    auto base = reinterpret_cast<char *>(storage_.data());
+    std::memcpy(base, MAGIC, sizeof(MAGIC));
+    std::memcpy(base + VERSION_OFFSET, &VERSION, sizeof(VERSION));
+    std::memcpy(base + SEED_OFFSET, &seed, sizeof(seed));
+    std::memcpy(base + COUNT_OFFSET, &count, sizeof(count));
+    std::memcpy(base + BUCKET_NUM_OFFSET, &bucketNum, sizeof(bucketNum));
+    std::memcpy(base + ARENA_SIZE_OFFSET, &arenaSize, sizeof(arenaSize));
+    auto cursorPtr = base + HEADER_SIZE;
+    std::memcpy(cursorPtr, displacements.data(), bucketNum * sizeof(uint32_t));
+    cursorPtr += AlignUp(bucketNum * sizeof(uint32_t));
+    auto keys = reinterpret_cast<uint64_t *>(cursorPtr);
+    cursorPtr += count * WORD_SIZE;
+    std::memcpy(cursorPtr, lengths.data(), (count + 1) * WORD_SIZE);
+    cursorPtr += (count + 1) * WORD_SIZE;
+    for (uint64_t i = 0; i < count; ++i) {
+        keys[slotOf[i]] = entries[i].first;
+        std::memcpy(cursorPtr + lengths[slotOf[i]], entries[i].second->data(), entries[i].second->size());
+    }
+    return Attach(base, storage_.size() * WORD_SIZE);
+}
+
+bool StaticDictionary::Attach(const char *base, size_t size)
+{
+    if (size < HEADER_SIZE || std::memcmp(base, MAGIC, sizeof(MAGIC)) != 0 ||
+        LoadValue<uint32_t>(base + VERSION_OFFSET) != VERSION) {
+        return false;
+    }
+    auto count = LoadValue<uint64_t>(base + COUNT_OFFSET);
+    auto bucketNum = LoadValue<uint64_t>(base + BUCKET_NUM_OFFSET);
+    auto arenaSize = LoadValue<uint64_t>(base + ARENA_SIZE_OFFSET);
+    // 各段长度均不超过文件大小，先逐项校验避免计算总长度时溢出
+    if (count >= DIRECT_FLAG || bucketNum == 0 || bucketNum > size || arenaSize > size ||
+        LayoutSize(count, bucketNum, arenaSize) != size) {
+        return false;
+    }
+    auto cursor = base + HEADER_SIZE;
+    auto displacements = reinterpret_cast<const uint32_t *>(cursor);
+    cursor += AlignUp(bucketNum * sizeof(uint32_t));
+    auto keys = reinterpret_cast<const uint64_t *>(cursor);
+    cursor += count * WORD_SIZE;
+    auto offsets = reinterpret_cast<const uint64_t *>(cursor);
+    cursor += (count + 1) * WORD_SIZE;
+    if (offsets[0] != 0 || offsets[count] != arenaSize) {
+        return false;
+    }
+    for (uint64_t i = 0; i < count; ++i) {
+        if (offsets[i] > offsets[i + 1]) {
+            return false;
+        }
+    }
+    base_ = base;
+    size_ = size;
+    seed_ = LoadValue<uint32_t>(base + SEED_OFFSET);
+    count_ = count;
+    bucketNum_ = bucketNum;
+    displacements_ = displacements;
+    keys_ = keys;
+    offsets_ = offsets;
+    arena_ = cursor;
+    return true;
+}
+
+uint64_t StaticDictionary::SlotOf(uint64_t key) const
+{
+    auto hash = HashKey(key, seed_);
+    auto displacement = displacements_[BucketOf(hash, bucketNum_)];
+    if ((displacement & DIRECT_FLAG) != 0) {
+        return displacement & ~DIRECT_FLAG;
+    }
+    return SlotOfHash(hash, displacement, count_);
+}
+
+bool StaticDictionary::Find(uint64_t key, const char *&value, size_t &len) const
+{
+    if (count_ == 0) {
+        return false;
+    }
+    auto slot = SlotOf(key);
+    if (slot >= count_ || keys_[slot] != key) {
+        return false;
+    }
+    value = arena_ + offsets_[slot];
+    len = static_cast<size_t>(offsets_[slot + 1] - offsets_[slot]);
+    return true;
+}
+
+bool StaticDictionary::Find(uint64_t key, std::string &value) const
+{
+    const char *data = nullptr;
+    size_t len = 0;
+    if (!Find(key, data, len)) {
+        return false;
+    }
+    value.assign(data, len);
+    return true;
+}
+
+bool StaticDictionary::Find(uint64_t key, StringRef &value) const
+{
+    const char *data = nullptr;
+    size_t len = 0;
+    if (!Find(key, data, len)) {
+        return false;
+    }
+    value = StringRef(data, len);
+    return true;
+}
+
+size_t StaticDictionary::Size() const
+{
+    return static_cast<size_t>(count_);
+}
+
+bool StaticDictionary::Empty() const
+{
+    return count_ == 0;
+}
+
+size_t StaticDictionary::GetMemorySize() const
+{
+    return size_;
+}
+
+bool StaticDictionary::Save(const std::string &path) const
+{
+    if (base_ == nullptr) {
+        ERROR("The static dictionary is not built, can't save to %.", path);
+        return false;
+    }
+    FileWriter writer(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!writer.IsOpen()) {
+        ERROR("Open static dictionary file % failed.", path);
+        return false;
+    }
+    writer.WriteText(base_, size_);
+    return true;
+}
+
+bool StaticDictionary::Load(const std::string &path)
+{
+    Clear();
+    if (!FileReader::Check(path, Common::MAX_DB_BYTES)) {
+        ERROR("Check static dictionary file % failed.", path);
+        return false;
+    }
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        ERROR("Open static dictionary file % failed.", path);
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(HEADER_SIZE)) {
+        ERROR("Invalid static dictionary file %.", path);
+        close(fd);
+        return false;
+    }
+    auto size = static_cast<size_t>(st.st_size);
+    void *addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        ERROR("Mmap static dictionary file % failed.", path);
+        return false;
+    }
+    if (!Attach(static_cast<const char *>(addr), size)) {
+        ERROR("Invalid static dictionary file %.", path);
+        munmap(addr, size);
+        return false;
+    }
+    mapped_ = true;
+    return true;
+}
+}  // namespace Utils
+}  // namespace Analysis
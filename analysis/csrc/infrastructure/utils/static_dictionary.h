@@ -0,0 +1,108 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#ifndef ANALYSIS_UTILS_STATIC_DICTIONARY_H
+#define ANALYSIS_UTILS_STATIC_DICTIONARY_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Analysis {
+namespace Utils {
+// 指向字典内部内存的只读字符串视图(C++11无std::string_view)，不持有内存，有效期同其指向的字典
+class StringRef {
+public:
+    StringRef() = default;
+    StringRef(const char *data, size_t len) : data_(data), len_(len) {}
+    StringRef(const char *str) : data_(str), len_(std::strlen(str)) {}
+    StringRef(const std::string &str) : data_(str.data()), len_(str.size()) {}
+
+    const char *Data() const { return data_; }
+    size_t Size() const { return len_; }
+    bool Empty() const { return len_ == 0; }
+    bool StartsWith(StringRef prefix) const
+    {
+        return len_ >= prefix.len_ && std::memcmp(data_, prefix.data_, prefix.len_) == 0;
+    }
+    std::string ToString() const { return std::string(data_, len_); }
+
+    friend bool operator==(StringRef lhs, StringRef rhs)
+    {
+        return lhs.len_ == rhs.len_ && std::memcmp(lhs.data_, rhs.data_, lhs.len_) == 0;
+    }
+    friend bool operator!=(StringRef lhs, StringRef rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    const char *data_ = "";
+    size_t len_ = 0;
+};
+
+// 只读的uint64到字符串字典，用于hash_dic、type_info_dic等加载后不再修改的字典
+// 1. 最小完美hash(hash and displace)：key先分桶，每个桶搜索一个位移使桶内key落到互不冲突的槽位，
+//    槽位数等于key数，查找只需一次分桶和一次取槽，无链表和二次探测
+// 2. 所有字符串按槽位顺序存放在一块连续内存中，查找返回指向该内存的指针和长度，不产生拷贝
+// 3. 内存布局与文件布局一致，Save后可通过Load直接mmap复用，无需重新解析和构建
+class StaticDictionary {
+public:
+    StaticDictionary() = default;
+    ~StaticDictionary();
+    StaticDictionary(const StaticDictionary &) = delete;
+    StaticDictionary &operator=(const StaticDictionary &) = delete;
+
+    bool Build(const std::unordered_map<uint64_t, std::string> &data);
+    // 构建成功后释放data，字符串只保留字典内的一份
+    bool Build(std::unordered_map<uint64_t, std::string> &&data);
+    // 命中时value指向字典内部内存，在字典Clear/Build/Load前有效
+    bool Find(uint64_t key, const char *&value, size_t &len) const;
+    bool Find(uint64_t key, StringRef &value) const;
+    bool Find(uint64_t key, std::string &value) const;
+    size_t Size() const;
+    bool Empty() const;
+    // 字典占用的字节数，mmap加载时为映射的文件大小
+    size_t GetMemorySize() const;
+    void Clear();
+    bool Save(const std::string &path) const;
+    bool Load(const std::string &path);
+
+private:
+    bool BuildWithSeed(const std::vector<std::pair<uint64_t, const std::string *>> &entries, uint32_t seed);
+    bool Attach(const char *base, size_t size);
+    uint64_t SlotOf(uint64_t key) const;
+
+private:
+    std::vector<uint64_t> storage_;
+    const char *base_ = nullptr;
+    size_t size_ = 0;
+    bool mapped_ = false;
+    uint32_t seed_ = 0;
+    uint64_t count_ = 0;
+    uint64_t bucketNum_ = 0;
+    const uint32_t *displacements_ = nullptr;
+    const uint64_t *keys_ = nullptr;
+    const uint64_t *offsets_ = nullptr;
+    const char *arena_ = nullptr;
+};
+}  // namespace Utils
+}  // namespace Analysis
+
+#endif  // ANALYSIS_UTILS_STATIC_DICTIONARY_H
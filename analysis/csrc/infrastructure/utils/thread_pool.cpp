@@ -19,6 +19,7 @@
 #include <thread>
 
 #include "analysis/csrc/infrastructure/dfx/log.h"
+#include "analysis/csrc/infrastructure/utils/self_trace.h"
 #include "utils.h"
 
 namespace Analysis {
@@ -139,6 +140,7 @@ void ThreadPool::Loop()
     Task task;
     while (running_) {
         if (FetchTask(task)) {
+            TraceSpan span(TRACE_CAT_TASK, "ThreadPool task");
             task();
         }
     }
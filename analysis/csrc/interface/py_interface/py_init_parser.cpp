@@ -17,7 +17,13 @@
 #include "analysis/csrc/interface/py_interface/py_init_parser.h"
 #include "analysis/csrc/domain/services/device_context/device_context.h"
 #include "analysis/csrc/domain/services/host_worker/kernel_parser_worker.h"
+#include "analysis/csrc/domain/services/persistence/device/persistence_utils.h"
 #include "analysis/csrc/infrastructure/dfx/error_code.h"
+#include "analysis/csrc/infrastructure/dump_tools/include/compressed_file_writer.h"
+#include "analysis/csrc/infrastructure/utils/ingest_cursor.h"
+#include "analysis/csrc/infrastructure/utils/run_control.h"
+#include "analysis/csrc/infrastructure/utils/self_trace.h"
+#include "analysis/csrc/application/include/batch_export_scheduler.h"
 #include "analysis/csrc/application/include/export_manager.h"
 #include "analysis/csrc/application/include/export_mode_enum.h"
 
@@ -26,12 +32,100 @@ namespace Interface {
 using KernelParserWorker = Analysis::Domain::KernelParserWorker;
 using namespace Analysis::Utils;
 using namespace Analysis::Domain;
+using Analysis::Infra::CompressedSink;
+using Analysis::Infra::DataInventory;
+namespace {
+const std::string INVENTORY_SPILL_DIR = ".inventory_spill";
+const std::string LOG_DIR = "mindstudio_profiler_log";
+
+// 设置MSPROF_ANALYSIS_SELF_TRACE时开启自身trace，接口返回前将trace写入日志目录
+// Python进程会多次调用接口，返回前清空本次的事件，并关闭由本次调用开启的trace
+class SelfTraceGuard {
+public:
+    explicit SelfTraceGuard(const std::string &logDir)
+    {
+        bool wasEnabled = SelfTrace::IsEnabled();
+        SelfTrace::GetInstance().EnableFromEnv(logDir);
+        enabledHere_ = !wasEnabled && SelfTrace::IsEnabled();
+    }
+    ~SelfTraceGuard()
+    {
+        auto &trace = SelfTrace::GetInstance();
+        trace.Flush();
+        trace.Clear();
+        if (enabledHere_) {
+            trace.Disable();
+        }
+    }
+
+private:
+    bool enabledHere_ = false;
+};
+
+// 一次解析/导出的运行范围：重置进度与取消标记，运行期间SIGINT/SIGTERM转为协作式取消
+class RunScopeGuard {
+public:
+    RunScopeGuard()
+    {
+        RunControl::GetInstance().Begin();
+    }
+    ~RunScopeGuard()
+    {
+        RunControl::GetInstance().SetStage("done");
+    }
+    // 运行失败时区分被取消与执行出错
+    static int FailedCode()
+    {
+        return RunControl::GetInstance().IsCancelled() ? ANALYSIS_CANCELLED : ANALYSIS_ERROR;
+    }
+
+private:
+    CancelSignalGuard signalGuard_;
+};
+
+const std::map<std::string, Analysis::Application::ExportMode> EXPORT_MODE_NAME = {
+    {"db", Analysis::Application::ExportMode::DB},
+    {"timeline", Analysis::Application::ExportMode::TIMELINE},
+    {"summary", Analysis::Application::ExportMode::SUMMARY},
+};
+
+bool ParseExportModes(const std::string &modes, std::set<Analysis::Application::ExportMode> &exportModes)
+{
+    for (const auto &mode : Split(modes, ",")) {
+        auto it = EXPORT_MODE_NAME.find(mode);
+        if (it == EXPORT_MODE_NAME.end()) {
+            return false;
+        }
+        exportModes.insert(it->second);
+    }
+    return !exportModes.empty();
+}
+
+bool ParseProfPaths(PyObject *pathList, std::vector<std::string> &profPaths)
+{
+    if (!PyList_Check(pathList)) {
+        return false;
+    }
+    for (Py_ssize_t i = 0; i < PyList_Size(pathList); ++i) {
+        const char *path = PyUnicode_AsUTF8(PyList_GetItem(pathList, i));
+        if (path == NULL || !File::CheckDir(path)) {
+            return false;
+        }
+        profPaths.emplace_back(path);
+    }
+    return !profPaths.empty();
+}
+}
 PyMethodDef g_methodTestSchedule[] = {
     {"dump_cann_trace", WrapDumpCANNTrace, METH_VARARGS, ""},
     {"dump_device_data", WrapDumpDeviceData, METH_VARARGS, ""},
     {"export_unified_db", WrapExportUnifiedDB, METH_VARARGS, ""},
     {"export_timeline", WrapExportTimeline, METH_VARARGS, ""},
     {"export_summary", WrapExportSummary, METH_VARARGS, ""},
+    {"export_batch", WrapExportBatch, METH_VARARGS, ""},
+    {"cancel_export", WrapCancelExport, METH_NOARGS, ""},
+    {"get_export_progress", WrapGetExportProgress, METH_NOARGS, ""},
+    {"set_export_time_budget", WrapSetExportTimeBudget, METH_VARARGS, ""},
     {NULL, NULL, METH_VARARGS, ""}
 };
 
@@ -44,7 +138,8 @@ PyObject *WrapDumpCANNTrace(PyObject *self, PyObject *args)
 {
     // parseFilePath为PROF*目录下面的host目录
     const char *parseFilePath = NULL;
-    if (!PyArg_ParseTuple(args, "s", &parseFilePath)) {
+    int follow = 0;
+    if (!PyArg_ParseTuple(args, "s|i", &parseFilePath, &follow)) {
         PyErr_SetString(PyExc_TypeError, "parser.dump_cann_trace args parse failed!");
         return NULL;
     }
@@ -52,9 +147,16 @@ PyObject *WrapDumpCANNTrace(PyObject *self, PyObject *args)
         PyErr_SetString(PyExc_TypeError, "parser.dump_cann_trace path is invalid!");
         return NULL;
     }
-    Log::GetInstance().Init(Utils::File::PathJoin({parseFilePath, "..", "mindstudio_profiler_log"}));
+    auto logDir = Utils::File::PathJoin({parseFilePath, "..", LOG_DIR});
+    Log::GetInstance().Init(logDir);
+    SelfTraceGuard traceGuard(logDir);
+    IngestCursor::GetInstance().SetFollow(follow != 0);
+    RunScopeGuard runGuard;
     KernelParserWorker parserWorker(parseFilePath);
-    auto res = parserWorker.Run();
+    int res = ANALYSIS_OK;
+    Py_BEGIN_ALLOW_THREADS
+    res = parserWorker.Run();
+    Py_END_ALLOW_THREADS
     return Py_BuildValue("i", res);
 }
 
@@ -62,7 +164,10 @@ PyObject *WrapDumpDeviceData(PyObject *self, PyObject *args)
 {
     // parseFilePath为PROF*目录
     const char *parseFilePath = NULL;
-    if (!PyArg_ParseTuple(args, "s", &parseFilePath)) {
+    int follow = 0;
+    unsigned int memoryBudgetMB = 0;  // DataInventory内存预算，0表示不限制
+    int sqliteView = -1;  // 列式表是否额外生成sqlite供python侧导出读取，-1表示按环境变量
+    if (!PyArg_ParseTuple(args, "s|iIi", &parseFilePath, &follow, &memoryBudgetMB, &sqliteView)) {
         PyErr_SetString(PyExc_TypeError, "parser.dump_device_data args parse failed!");
         return NULL;
     }
@@ -70,10 +175,21 @@ PyObject *WrapDumpDeviceData(PyObject *self, PyObject *args)
         PyErr_SetString(PyExc_TypeError, "parser.dump_device_data path is invalid!");
         return NULL;
     }
-    Log::GetInstance().Init(Utils::File::PathJoin({parseFilePath, "mindstudio_profiler_log"}));
+    auto logDir = Utils::File::PathJoin({parseFilePath, LOG_DIR});
+    Log::GetInstance().Init(logDir);
+    SelfTraceGuard traceGuard(logDir);
+    IngestCursor::GetInstance().SetFollow(follow != 0);
+    if (sqliteView >= 0) {
+        SetSqliteViewEnabled(sqliteView != 0);
+    }
+    DataInventory::SetMemoryBudget(static_cast<uint64_t>(memoryBudgetMB) * BYTE_SIZE * BYTE_SIZE,
+                                   File::PathJoin({parseFilePath, INVENTORY_SPILL_DIR}));
     const char *stopAt = "";
+    RunScopeGuard runGuard;
+    Py_BEGIN_ALLOW_THREADS
     DeviceContextEntry(parseFilePath, stopAt);
-    return Py_BuildValue("i", ANALYSIS_OK);
+    Py_END_ALLOW_THREADS
+    return Py_BuildValue("i", RunControl::GetInstance().IsCancelled() ? ANALYSIS_CANCELLED : ANALYSIS_OK);
 }
 
 PyObject *WrapExportUnifiedDB(PyObject *self, PyObject *args)
@@ -88,11 +204,18 @@ PyObject *WrapExportUnifiedDB(PyObject *self, PyObject *args)
         PyErr_SetString(PyExc_TypeError, "parser.export_unified_db path is invalid!");
         return NULL;
     }
-    Log::GetInstance().Init(Utils::File::PathJoin({parseFilePath, "mindstudio_profiler_log"}));
+    auto logDir = Utils::File::PathJoin({parseFilePath, LOG_DIR});
+    Log::GetInstance().Init(logDir);
+    SelfTraceGuard traceGuard(logDir);
+    RunScopeGuard runGuard;
     auto exportManager = Analysis::Application::ExportManager(parseFilePath);
-    if (!exportManager.Run({Analysis::Application::ExportMode::DB})) {
+    bool ret = false;
+    Py_BEGIN_ALLOW_THREADS
+    ret = exportManager.Run({Analysis::Application::ExportMode::DB});
+    Py_END_ALLOW_THREADS
+    if (!ret) {
         ERROR("UnifiedDB run failed.");
-        return Py_BuildValue("i", ANALYSIS_ERROR);
+        return Py_BuildValue("i", RunScopeGuard::FailedCode());
     }
     return Py_BuildValue("i", ANALYSIS_OK);
 }
@@ -102,10 +225,15 @@ PyObject *WrapExportTimeline(PyObject *self, PyObject *args)
     // parseFilePath为PROF*目录
     const char *parseFilePath = NULL;
     const char *reportJsonPath = NULL;
-    if (!PyArg_ParseTuple(args, "ss", &parseFilePath, &reportJsonPath)) {
+    const char *codec = "";
+    if (!PyArg_ParseTuple(args, "ss|s", &parseFilePath, &reportJsonPath, &codec)) {
         PyErr_SetString(PyExc_TypeError, "parser.export_timeline args parse failed!");
         return NULL;
     }
+    if (!CompressedSink::GetInstance().SetCodec(codec)) {
+        PyErr_SetString(PyExc_TypeError, "parser.export_timeline compress codec is not supported!");
+        return NULL;
+    }
     if (!File::CheckDir(parseFilePath)) {
         PyErr_SetString(PyExc_TypeError, "parser.export_timeline path is invalid!");
         return NULL;
@@ -114,12 +242,19 @@ PyObject *WrapExportTimeline(PyObject *self, PyObject *args)
         PyErr_SetString(PyExc_TypeError, "parser.export_timeline reports json path is invalid!");
         return NULL;
     }
-    Log::GetInstance().Init(Utils::File::PathJoin({parseFilePath, "mindstudio_profiler_log"}));
+    auto logDir = Utils::File::PathJoin({parseFilePath, LOG_DIR});
+    Log::GetInstance().Init(logDir);
+    SelfTraceGuard traceGuard(logDir);
+    RunScopeGuard runGuard;
     auto exportManager = Analysis::Application::ExportManager(parseFilePath, reportJsonPath);
-    if (!exportManager.Run({Analysis::Application::ExportMode::TIMELINE,
-                            Analysis::Application::ExportMode::DB})) {
+    bool ret = false;
+    Py_BEGIN_ALLOW_THREADS
+    ret = exportManager.Run({Analysis::Application::ExportMode::TIMELINE,
+                             Analysis::Application::ExportMode::DB});
+    Py_END_ALLOW_THREADS
+    if (!ret) {
         ERROR("Timeline run failed.");
-        return Py_BuildValue("i", ANALYSIS_ERROR);
+        return Py_BuildValue("i", RunScopeGuard::FailedCode());
     }
     return Py_BuildValue("i", ANALYSIS_OK);
 }
@@ -128,22 +263,132 @@ PyObject *WrapExportSummary(PyObject *self, PyObject *args)
 {
     // parseFilePath为PROF*目录
     const char *parseFilePath = NULL;
-    if (!PyArg_ParseTuple(args, "s", &parseFilePath)) {
+    const char *codec = "";
+    if (!PyArg_ParseTuple(args, "s|s", &parseFilePath, &codec)) {
         PyErr_SetString(PyExc_TypeError, "parser.export_summary args parse failed!");
         return NULL;
     }
+    if (!CompressedSink::GetInstance().SetCodec(codec)) {
+        PyErr_SetString(PyExc_TypeError, "parser.export_summary compress codec is not supported!");
+        return NULL;
+    }
     if (!File::CheckDir(parseFilePath)) {
         PyErr_SetString(PyExc_TypeError, "parser.export_summary path is invalid!");
         return NULL;
     }
-    Log::GetInstance().Init(Utils::File::PathJoin({parseFilePath, "mindstudio_profiler_log"}));
+    auto logDir = Utils::File::PathJoin({parseFilePath, LOG_DIR});
+    Log::GetInstance().Init(logDir);
+    SelfTraceGuard traceGuard(logDir);
+    RunScopeGuard runGuard;
     auto exportManager = Analysis::Application::ExportManager(parseFilePath, "");
-    if (!exportManager.Run({Analysis::Application::ExportMode::SUMMARY,
-                            Analysis::Application::ExportMode::DB})) {
+    bool ret = false;
+    Py_BEGIN_ALLOW_THREADS
+    ret = exportManager.Run({Analysis::Application::ExportMode::SUMMARY,
+                             Analysis::Application::ExportMode::DB});
+    Py_END_ALLOW_THREADS
+    if (!ret) {
         ERROR("Summary run failed.");
-        return Py_BuildValue("i", ANALYSIS_ERROR);
+        return Py_BuildValue("i", RunScopeGuard::FailedCode());
     }
     return Py_BuildValue("i", ANALYSIS_OK);
 }
+
+PyObject *WrapExportBatch(PyObject *self, PyObject *args)
+{
+    // pathList为PROF*目录列表，exportModes为逗号分隔的导出模式，如"db,timeline"
+    PyObject *pathList = NULL;
+    const char *exportModes = NULL;
+    const char *reportJsonPath = "";
+    unsigned int cpuBudget = 0;  // 0表示使用全部CPU核
+    int parseDevice = 0;
+    const char *mergedOutputPath = "";
+    const char *codec = "";
+    if (!PyArg_ParseTuple(args, "Os|sIiss", &pathList, &exportModes, &reportJsonPath, &cpuBudget, &parseDevice,
+                          &mergedOutputPath, &codec)) {
+        PyErr_SetString(PyExc_TypeError, "parser.export_batch args parse failed!");
+        return NULL;
+    }
+    Analysis::Application::BatchExportOptions options;
+    std::vector<std::string> profPaths;
+    if (!ParseProfPaths(pathList, profPaths)) {
+        PyErr_SetString(PyExc_TypeError, "parser.export_batch path is invalid!");
+        return NULL;
+    }
+    if (!ParseExportModes(exportModes, options.exportModes)) {
+        PyErr_SetString(PyExc_TypeError, "parser.export_batch export mode is not supported!");
+        return NULL;
+    }
+    if (*reportJsonPath != '\0' && !File::Check(reportJsonPath)) {
+        PyErr_SetString(PyExc_TypeError, "parser.export_batch reports json path is invalid!");
+        return NULL;
+    }
+    if (*mergedOutputPath != '\0' && !File::CheckDir(mergedOutputPath)) {
+        PyErr_SetString(PyExc_TypeError, "parser.export_batch merged output path is invalid!");
+        return NULL;
+    }
+    if (!CompressedSink::GetInstance().SetCodec(codec)) {
+        PyErr_SetString(PyExc_TypeError, "parser.export_batch compress codec is not supported!");
+        return NULL;
+    }
+    // 各PROF在子进程中导出，日志统一写入PROF父目录
+    auto logDir = Utils::File::PathJoin({profPaths.front(), "..", LOG_DIR});
+    Log::GetInstance().Init(logDir);
+    SelfTraceGuard traceGuard(logDir);
+    options.reportJsonPath = reportJsonPath;
+    options.cpuBudget = cpuBudget;
+    options.mergedOutputPath = mergedOutputPath;
+    if (parseDevice != 0) {
+        options.parseStage = [](const std::string &profPath) {
+            const char *stopAt = "";
+            bool isSuccess = false;
+            DeviceContextEntry(profPath.c_str(), stopAt, isSuccess);
+            return isSuccess && !RunControl::GetInstance().IsCancelled();
+        };
+    }
+    RunScopeGuard runGuard;
+    Analysis::Application::BatchExportScheduler scheduler(profPaths, options);
+    bool ret = false;
+    Py_BEGIN_ALLOW_THREADS
+    ret = scheduler.Run();
+    Py_END_ALLOW_THREADS
+    if (!ret) {
+        ERROR("Batch export run failed.");
+        return Py_BuildValue("i", RunScopeGuard::FailedCode());
+    }
+    return Py_BuildValue("i", ANALYSIS_OK);
+}
+
+PyObject *WrapCancelExport(PyObject *self, PyObject *args)
+{
+    RunControl::GetInstance().Cancel();
+    Py_RETURN_NONE;
+}
+
+PyObject *WrapGetExportProgress(PyObject *self, PyObject *args)
+{
+    auto progress = RunControl::GetInstance().GetProgress();
+    return Py_BuildValue("{s:s,s:K,s:K,s:K,s:K,s:K,s:K,s:O,s:O}",
+                         "stage", progress.stage.c_str(),
+                         "processes_done", static_cast<unsigned long long>(progress.processesDone),
+                         "records_parsed", static_cast<unsigned long long>(progress.recordsParsed),
+                         "tables_written", static_cast<unsigned long long>(progress.tablesWritten),
+                         "assemblers_done", static_cast<unsigned long long>(progress.assemblersDone),
+                         "assemblers_total", static_cast<unsigned long long>(progress.assemblersTotal),
+                         "elapsed_ms", static_cast<unsigned long long>(progress.elapsedMs),
+                         "cancelled", progress.cancelled ? Py_True : Py_False,
+                         "interrupted", progress.interrupted ? Py_True : Py_False);
+}
+
+PyObject *WrapSetExportTimeBudget(PyObject *self, PyObject *args)
+{
+    // seconds为单次解析/导出的时间预算，0表示不限制
+    unsigned long long seconds = 0;
+    if (!PyArg_ParseTuple(args, "K", &seconds)) {
+        PyErr_SetString(PyExc_TypeError, "parser.set_export_time_budget args parse failed!");
+        return NULL;
+    }
+    RunControl::GetInstance().SetTimeBudget(static_cast<uint64_t>(seconds));
+    Py_RETURN_NONE;
+}
+}
 }
-}
\ No newline at end of file
@@ -34,6 +34,15 @@ PyObject *WrapExportUnifiedDB(PyObject *self, PyObject *args);
 PyObject *WrapExportTimeline(PyObject *self, PyObject *args);
 // op_summary导出入口的外层包装，解析Python侧传入路径后调用exportSummary启动导出流程，获取返回状态码后返回Python侧
 PyObject *WrapExportSummary(PyObject *self, PyObject *args);
+// 集群批量导出入口的外层包装，解析Python侧传入的PROF列表后调用BatchExportScheduler按CPU预算并发导出，获取返回状态码后返回Python侧
+PyObject *WrapExportBatch(PyObject *self, PyObject *args);
+// 取消当前的解析/导出，各阶段在任务边界退出且不发布未完成的产物，接口返回ANALYSIS_CANCELLED
+PyObject *WrapCancelExport(PyObject *self, PyObject *args);
+// 查询当前解析/导出的进度，返回dict：stage、processes_done、records_parsed、tables_written、
+// assemblers_done、assemblers_total、elapsed_ms、cancelled
+PyObject *WrapGetExportProgress(PyObject *self, PyObject *args);
+// 设置单次解析/导出的时间预算(秒)，超出后自动取消，0表示不限制
+PyObject *WrapSetExportTimeBudget(PyObject *self, PyObject *args);
 } // Interface
 } // Analyzer
 
@@ -18,6 +18,7 @@ import importlib
 import logging
 import os
 import sys
+import threading
 
 from common_func.config_mgr import ConfigMgr
 from common_func.info_conf_reader import InfoConfReader
@@ -28,41 +29,102 @@ from common_func.cpp_enable_scene import DeviceParseScene, ExportDBScene
 from common_func.file_manager import check_so_valid
 
 SO_DIR = os.path.join(os.path.dirname(__file__), "..", "lib64")
+PROGRESS_INTERVAL_S = 30
+ANALYSIS_CANCELLED = 2
 
 
-def _dump_cann_trace(project_path: str):
+class _ExportProgressReporter:
+    """
+    C化解析/导出期间周期打印进度，运行被取消或超出时间预算时给出提示
+    """
+
+    def __init__(self, parser_module, name: str):
+        self._parser = parser_module
+        self._name = name
+        self._stop_event = threading.Event()
+        self._thread = threading.Thread(target=self._report, daemon=True)
+
+    def __enter__(self):
+        if hasattr(self._parser, "get_export_progress"):
+            self._thread.start()
+        return self
+
+    def __exit__(self, exc_type, exc_val, exc_tb):
+        self._stop_event.set()
+        if self._thread.is_alive():
+            self._thread.join()
+
+    def _report(self):
+        while not self._stop_event.wait(PROGRESS_INTERVAL_S):
+            progress = self._parser.get_export_progress()
+            logging.info("%s is running, stage: %s, processes done: %d, records parsed: %d, tables written: %d, "
+                         "assemblers done: %d/%d, elapsed: %d ms.", self._name, progress.get("stage"),
+                         progress.get("processes_done"), progress.get("records_parsed"),
+                         progress.get("tables_written"), progress.get("assemblers_done"),
+                         progress.get("assemblers_total"), progress.get("elapsed_ms"))
+
+
+def _run_with_progress(parser_module, name: str, func, *args):
+    with _ExportProgressReporter(parser_module, name):
+        ret = func(*args)
+    if ret == ANALYSIS_CANCELLED:
+        # 运行期间SIGINT/SIGTERM被so转为协作式取消，取消完成后按中断继续向上抛出，其余情况为超出时间预算
+        if parser_module.get_export_progress().get("interrupted"):
+            logging.warning("%s is interrupted, the unfinished outputs are discarded.", name)
+            raise KeyboardInterrupt
+        logging.warning("%s is cancelled or exceeds the time budget, the unfinished outputs are discarded.", name)
+    return ret
+
+
+def _dump_cann_trace(project_path: str, follow: bool = False):
     sys.path.append(os.path.realpath(SO_DIR))
     logging.info("Data will be parsed by msprof_analysis.so!")
     msprof_analysis_module = importlib.import_module("msprof_analysis")
-    msprof_analysis_module.parser.dump_cann_trace(project_path)
+    parser = msprof_analysis_module.parser
+    _run_with_progress(parser, "Host data parsing", parser.dump_cann_trace, project_path, int(follow))
 
 
-def _dump_device_data(device_path: str):
+def _dump_device_data(device_path: str, follow: bool = False, memory_budget_mb: int = 0, sqlite_view: bool = True):
     sys.path.append(os.path.realpath(SO_DIR))
     logging.info("Device Data will be parsed by msprof_analysis.so!")
     msprof_analysis_module = importlib.import_module("msprof_analysis")
-    msprof_analysis_module.parser.dump_device_data(os.path.dirname(device_path))
+    parser = msprof_analysis_module.parser
+    _run_with_progress(parser, "Device data parsing", parser.dump_device_data, os.path.dirname(device_path),
+                       int(follow), memory_budget_mb, int(sqlite_view))
 
 
 def _export_unified_db(project_path: str):
     sys.path.append(os.path.realpath(SO_DIR))
     logging.info("Data will be parsed by msprof_analysis.so!")
     msprof_analysis_module = importlib.import_module("msprof_analysis")
-    msprof_analysis_module.parser.export_unified_db(project_path)
+    parser = msprof_analysis_module.parser
+    _run_with_progress(parser, "Unified db export", parser.export_unified_db, project_path)
 
 
-def _export_timeline(project_path: str, report_json_path: str):
+def _export_timeline(project_path: str, report_json_path: str, codec: str = ""):
     sys.path.append(os.path.realpath(SO_DIR))
     logging.info("Data will be export by msprof_analysis.so!")
     msprof_analysis_module = importlib.import_module("msprof_analysis")
-    msprof_analysis_module.parser.export_timeline(project_path, report_json_path)
+    parser = msprof_analysis_module.parser
+    _run_with_progress(parser, "Timeline export", parser.export_timeline, project_path, report_json_path, codec)
 
 
-def _export_summary(project_path: str):
+def _export_summary(project_path: str, codec: str = ""):
     sys.path.append(os.path.realpath(SO_DIR))
     logging.info("Summary will be export by msprof_analysis.so!")
     msprof_analysis_module = importlib.import_module("msprof_analysis")
-    msprof_analysis_module.parser.export_summary(project_path)
+    parser = msprof_analysis_module.parser
+    _run_with_progress(parser, "Summary export", parser.export_summary, project_path, codec)
+
+
+def _export_batch(project_paths: list, export_modes: str, report_json_path: str = "", cpu_budget: int = 0,
+                  parse_device: bool = False, merged_output_path: str = "", codec: str = ""):
+    sys.path.append(os.path.realpath(SO_DIR))
+    logging.info("Batch data will be export by msprof_analysis.so!")
+    msprof_analysis_module = importlib.import_module("msprof_analysis")
+    parser = msprof_analysis_module.parser
+    _run_with_progress(parser, "Batch export", parser.export_batch, project_paths, export_modes, report_json_path,
+                       cpu_budget, int(parse_device), merged_output_path, codec)
 
 def _export_platform(platform_uncore_trace: str, output_path: str):
     if not check_so_valid(os.path.join(SO_DIR, "platform_analysis.so")):
@@ -74,27 +136,45 @@ def _export_platform(platform_uncore_trace: str, output_path: str):
     platform_analysis_module.process_platform_data(platform_uncore_trace, output_path)
 
 
-def dump_cann_trace(project_path: str):
+def dump_cann_trace(project_path: str, follow: bool = False):
     """
     调用host c化
+    follow: 增量解析，只解析上次解析之后新增的数据并追加到已有的表中
     """
-    run_in_subprocess(_dump_cann_trace, project_path)
+    run_in_subprocess(_dump_cann_trace, project_path, follow)
 
 
-def export_timeline(project_path: str, report_json_path: str):
+def export_timeline(project_path: str, report_json_path: str, codec: str = ""):
     """
     调用viewer C化导出
+    codec: 压缩落盘算法，如"gzip"，为空时不压缩
     """
-    run_in_subprocess(_export_timeline, project_path, report_json_path)
+    run_in_subprocess(_export_timeline, project_path, report_json_path, codec)
+
+
+def export_summary(project_path: str, codec: str = ""):
+    run_in_subprocess(_export_summary, project_path, codec)
 
 
-def export_summary(project_path: str):
-    run_in_subprocess(_export_summary, project_path)
+def export_batch(project_paths: list, export_modes: str, report_json_path: str = "", cpu_budget: int = 0,
+                 parse_device: bool = False, merged_output_path: str = "", codec: str = ""):
+    """
+    集群场景批量导出多个PROF目录
+    export_modes: 逗号分隔的导出模式，如"db,timeline"
+    cpu_budget: 所有PROF共享的CPU核数预算，0表示使用全部CPU核
+    merged_output_path: 跨rank通信视图cluster_communication.db的输出目录，为空时不合并
+    """
+    run_in_subprocess(_export_batch, project_paths, export_modes, report_json_path, cpu_budget, parse_device,
+                      merged_output_path, codec)
 
 
-def dump_device_data(device_path: str) -> None:
+def dump_device_data(device_path: str, follow: bool = False, memory_budget_mb: int = 0,
+                     sqlite_view: bool = True) -> None:
     """
     调用device c化
+    follow: 增量解析，只解析上次解析之后新增的数据并追加到已有的表中
+    memory_budget_mb: 中间数据的内存预算(MB)，超出时换出到磁盘，0表示不限制
+    sqlite_view: 列式表是否额外生成sqlite，python侧导出读取sqlite，全部由so导出时可关闭以减少一次写入
     """
     if not ChipManager().is_chip_v4():
         logging.info("Do not support parsing by msprof_analysis.so!")
@@ -107,7 +187,7 @@ def dump_device_data(device_path: str) -> None:
         return
     all_export_flag = ProfilingScene().is_all_export() and InfoConfReader().is_all_export_version()
     if DeviceParseScene().is_cpp_enable() and all_export_flag:
-        run_in_subprocess(_dump_device_data, device_path)
+        run_in_subprocess(_dump_device_data, device_path, follow, memory_budget_mb, sqlite_view)
     else:
         logging.warning("Device Data will not be parsed by msprof_analysis.so!")
     return
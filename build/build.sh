@@ -9,6 +9,7 @@ VERSION="none"
 WHL_VERSION="0.0.1"
 BUILD_TYPE="Release"
 BUILD_MODE="analysis"
+ALLOCATOR=""
 
 # input param check
 while [[ $# -gt 0 ]]; do
@@ -38,6 +39,14 @@ while [[ $# -gt 0 ]]; do
             WHL_VERSION="${1#*=}"
             shift
             ;;
+        --allocator=*)
+            ALLOCATOR="${1#*=}"
+            if [[ "$ALLOCATOR" != "jemalloc" && "$ALLOCATOR" != "tcmalloc" && "$ALLOCATOR" != "mimalloc" ]]; then
+                echo "[ERROR] Invalid allocator. Valid options are: jemalloc, tcmalloc, mimalloc"
+                exit 1
+            fi
+            shift
+            ;;
         *)
             echo "[ERROR] Unknown parameter: $1"
             exit 1
@@ -84,7 +93,7 @@ function build_oam_tools() {
 
 function build_analysis() {
     rm -rf ${TOP_DIR}/build/analysis
-    cmake -S ${TOP_DIR}/cmake/superbuild/ -B ${TOP_DIR}/build/analysis -DCMAKE_BUILD_TYPE=${BUILD_TYPE} -DCMAKE_INSTALL_PREFIX=${TOP_DIR}/prefix -DSECUREC_LIB_DIR=${TOP_DIR}/prefix/securec_shared
+    cmake -S ${TOP_DIR}/cmake/superbuild/ -B ${TOP_DIR}/build/analysis -DCMAKE_BUILD_TYPE=${BUILD_TYPE} -DCMAKE_INSTALL_PREFIX=${TOP_DIR}/prefix -DSECUREC_LIB_DIR=${TOP_DIR}/prefix/securec_shared -DMSPROF_ANALYSIS_ALLOCATOR=${ALLOCATOR}
     cd ${TOP_DIR}/build/analysis; make -j$(nproc)
 }
 
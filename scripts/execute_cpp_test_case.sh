@@ -28,6 +28,8 @@ mkdir -p ${TOP_DIR}/test/build_llt
 cd ${TOP_DIR}/test/build_llt
 if [[ -n "$1" && "$1" == "analysis" ]]; then
     cmake ../ -DPACKAGE=ut -DMODE=analysis
+elif [[ -n "$1" && "$1" == "bench" ]]; then
+    cmake ../ -DMODE=bench
 elif [[ -n "$1" && "$1" == "all" ]]; then
     cmake ../ -DPACKAGE=ut -DMODE=all
 else
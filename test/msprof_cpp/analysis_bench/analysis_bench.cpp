@@ -0,0 +1,428 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+// 解析流程压测工具
+// 按配置生成确定性的合成PROF目录，逐个阶段单独执行并记录吞吐、RSS峰值与线程利用率，最后执行端到端流程，结果以json输出
+// 用法: analysis_bench --output=./bench --device_num=2 --stream_num=8 --task_num=100000 --pmu=1 --host_api_depth=3
+//                      --seed=1 --stages=stars_soc_parser,log_modeling --report=./bench_report.json
+//                      --self_trace=./trace_dir (可选，输出解析工具自身的Chrome trace)
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "analysis/csrc/application/database/db_assembler.h"
+#include "analysis/csrc/application/include/export_manager.h"
+#include "analysis/csrc/application/timeline/ascend_hardware_assembler.h"
+#include "analysis/csrc/domain/entities/hal/include/device_task.h"
+#include "analysis/csrc/domain/entities/hal/include/hal_log.h"
+#include "analysis/csrc/domain/entities/hal/include/hal_pmu.h"
+#include "analysis/csrc/domain/entities/hal/include/hal_track.h"
+#include "analysis/csrc/domain/services/association/cann/include/tree_builder.h"
+#include "analysis/csrc/domain/services/device_context/device_context.h"
+#include "analysis/csrc/domain/services/environment/context.h"
+#include "analysis/csrc/domain/services/modeling/include/log_modeling.h"
+#include "analysis/csrc/domain/services/parser/log/include/stars_soc_parser.h"
+#include "analysis/csrc/domain/services/parser/pmu/include/ffts_profile_parser.h"
+#include "analysis/csrc/infrastructure/dfx/error_code.h"
+#include "analysis/csrc/infrastructure/dfx/log.h"
+#include "analysis/csrc/infrastructure/utils/file.h"
+#include "analysis/csrc/infrastructure/utils/self_trace.h"
+#include "analysis/csrc/infrastructure/utils/stage_manifest.h"
+#include "analysis/csrc/infrastructure/utils/utils.h"
+#include "test/msprof_cpp/analysis_bench/stage_recorder.h"
+#include "test/msprof_cpp/analysis_bench/synthetic_prof_generator.h"
+
+namespace Analysis {
+namespace Bench {
+using namespace Analysis::Domain;
+using namespace Analysis::Infra;
+using namespace Analysis::Utils;
+using Analysis::Application::AscendHardwareAssembler;
+using Analysis::Application::DBAssembler;
+using Analysis::Application::ExportManager;
+using Analysis::Application::ExportMode;
+namespace {
+const std::string STAGE_GENERATE = "generate";
+const std::string STAGE_STARS_SOC_PARSER = "stars_soc_parser";
+const std::string STAGE_FFTS_PROFILE_PARSER = "ffts_profile_parser";
+const std::string STAGE_LOG_MODELING = "log_modeling";
+const std::string STAGE_TREE_BUILDER = "tree_builder";
+const std::string STAGE_DB_ASSEMBLER = "db_assembler";
+const std::string STAGE_TIMELINE = "timeline";
+const std::string STAGE_END_TO_END = "end_to_end";
+const std::vector<std::string> ALL_STAGES = {
+    STAGE_STARS_SOC_PARSER, STAGE_FFTS_PROFILE_PARSER, STAGE_LOG_MODELING, STAGE_TREE_BUILDER,
+    STAGE_DB_ASSEMBLER, STAGE_TIMELINE, STAGE_END_TO_END
+};
+const std::string DEVICE_PARSE_STAGE = "device_parse";
+const std::string BENCH_DB_DIR = "bench_db";
+const std::string MSPROF_PREFIX = "msprof";
+
+uint64_t FilesBytes(const std::string &dir, const std::string &prefix)
+{
+    uint64_t bytes = 0;
+    for (const auto &file : File::GetFilesWithPrefix(dir, prefix)) {
+        bytes += File::Size(file);
+    }
+    return bytes;
+}
+}  // namespace
+
+class BenchRunner {
+public:
+    BenchRunner(const SyntheticProfConfig &config, const std::set<std::string> &stages)
+        : config_(config), stages_(stages), generator_(config)
+    {}
+
+    bool Run()
+    {
+        if (!recorder_.Run(STAGE_GENERATE, [this](StageCounter &counter) {
+                bool ret = generator_.Generate(prof_);
+                counter.records = static_cast<uint64_t>(config_.taskNum) * config_.deviceNum;
+                counter.bytes = prof_.dataBytes;
+                return ret;
+            }).success) {
+            return false;
+        }
+        inventories_.clear();
+        inventories_.resize(prof_.deviceDirs.size());
+        RunIfSelected(STAGE_STARS_SOC_PARSER, [this](StageCounter &counter) { return RunStarsSocParser(counter); });
+        if (config_.pmu) {
+            RunIfSelected(STAGE_FFTS_PROFILE_PARSER,
+                          [this](StageCounter &counter) { return RunFftsProfileParser(counter); });
+        }
+        RunIfSelected(STAGE_LOG_MODELING, [this](StageCounter &counter) { return RunLogModeling(counter); });
+        RunIfSelected(STAGE_TREE_BUILDER, [this](StageCounter &counter) { return RunTreeBuilder(counter); });
+        RunIfSelected(STAGE_DB_ASSEMBLER, [this](StageCounter &counter) { return RunDBAssembler(counter); });
+        RunIfSelected(STAGE_TIMELINE, [this](StageCounter &counter) { return RunTimeline(counter); });
+        inventories_.clear();
+        RunIfSelected(STAGE_END_TO_END, [this](StageCounter &counter) { return RunEndToEnd(counter); });
+        return true;
+    }
+
+    const StageRecorder &GetRecorder() const
+    {
+        return recorder_;
+    }
+
+private:
+    void RunIfSelected(const std::string &name, const std::function<bool(StageCounter &)> &stage)
+    {
+        if (stages_.count(name) != 0) {
+            recorder_.Run(name, stage);
+        }
+    }
+
+    // 每个device一个线程执行，DeviceContext为线程级单例，需在执行线程内初始化
+    bool RunPerDevice(StageCounter &counter,
+                      const std::function<bool(const DeviceContext &, DataInventory &, StageCounter &)> &func)
+    {
+        std::vector<StageCounter> counters(prof_.deviceDirs.size());
+        std::vector<char> results(prof_.deviceDirs.size(), 0);
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < prof_.deviceDirs.size(); ++i) {
+            threads.emplace_back([this, i, &counters, &results, &func]() {
+                auto &context = DeviceContext::Instance();
+                if (!context.Init(prof_.deviceDirs[i])) {
+                    ERROR("Init device context of % failed.", prof_.deviceDirs[i]);
+                    return;
+                }
+                results[i] = func(context, inventories_[i], counters[i]);
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        bool ret = true;
+        for (size_t i = 0; i < counters.size(); ++i) {
+            counter.records += counters[i].records;
+            counter.bytes += counters[i].bytes;
+            ret = ret && results[i] != 0;
+        }
+        return ret;
+    }
+
+    bool RunStarsSocParser(StageCounter &counter)
+    {
+        return RunPerDevice(counter, [](const DeviceContext &context, DataInventory &inventory, StageCounter &cnt) {
+            StarsSocParser parser;
+            auto ret = parser.Run(inventory, context);
+            auto logData = inventory.GetPtr<std::vector<HalLogData>>();
+            cnt.records = logData == nullptr ? 0 : logData->size();
+            cnt.bytes = FilesBytes(File::PathJoin({context.GetDeviceFilePath(), "data"}), "stars_soc");
+            return ret == ANALYSIS_OK;
+        });
+    }
+
+    bool RunFftsProfileParser(StageCounter &counter)
+    {
+        return RunPerDevice(counter, [](const DeviceContext &context, DataInventory &inventory, StageCounter &cnt) {
+            FftsProfileParser parser;
+            auto ret = parser.Run(inventory, context);
+            auto pmuData = inventory.GetPtr<std::vector<HalPmuData>>();
+            cnt.records = pmuData == nullptr ? 0 : pmuData->size();
+            cnt.bytes = FilesBytes(File::PathJoin({context.GetDeviceFilePath(), "data"}), "ffts_profile");
+            return ret == ANALYSIS_OK;
+        });
+    }
+
+    bool RunLogModeling(StageCounter &counter)
+    {
+        return RunPerDevice(counter, [](const DeviceContext &context, DataInventory &inventory, StageCounter &cnt) {
+            auto logData = inventory.GetPtr<std::vector<HalLogData>>();
+            if (logData == nullptr) {
+                ERROR("No log data to model, run % first.", STAGE_STARS_SOC_PARSER);
+                return false;
+            }
+            cnt.records = logData->size();
+            cnt.bytes = logData->size() * sizeof(HalLogData);
+            inventory.Inject(std::make_shared<std::map<TaskId, std::vector<DeviceTask>>>());
+            inventory.Inject(std::make_shared<std::vector<HalTrackData>>());
+            LogModeling modeling;
+            return modeling.Run(inventory, context) == ANALYSIS_OK;
+        });
+    }
+
+    // 每个stream模拟一个host线程，各线程独立建树
+    bool RunTreeBuilder(StageCounter &counter)
+    {
+        std::vector<std::shared_ptr<CANNWarehouse>> warehouses;
+        for (uint32_t threadId = 0; threadId < config_.streamNum; ++threadId) {
+            warehouses.emplace_back(generator_.GenerateCannWarehouse(threadId));
+            counter.records += warehouses.back()->kernelEvents->GetSize() +
+                warehouses.back()->taskTrackEvents->GetSize();
+        }
+        counter.bytes = counter.records * sizeof(MsprofApi);
+        std::vector<char> results(warehouses.size(), 0);
+        ThreadPool pool(std::min<uint32_t>(config_.streamNum, std::thread::hardware_concurrency() + 1));
+        pool.Start();
+        for (uint32_t threadId = 0; threadId < warehouses.size(); ++threadId) {
+            pool.AddTask([threadId, &warehouses, &results]() {
+                Cann::TreeBuilder builder(warehouses[threadId], threadId);
+                results[threadId] = builder.Build() != nullptr;
+            });
+        }
+        pool.WaitAllTasks();
+        pool.Stop();
+        return std::all_of(results.begin(), results.end(), [](char ret) { return ret != 0; });
+    }
+
+    void InjectAscendTasks(DataInventory &inventory, uint64_t &records) const
+    {
+        auto tasks = std::make_shared<std::vector<AscendTaskData>>();
+        auto infos = std::make_shared<std::vector<TaskInfoData>>();
+        auto apis = std::make_shared<std::vector<ApiData>>();
+        for (uint16_t deviceId = 0; deviceId < config_.deviceNum; ++deviceId) {
+            std::vector<AscendTaskData> deviceTasks;
+            std::vector<TaskInfoData> deviceInfos;
+            std::vector<ApiData> deviceApis;
+            generator_.GenerateAscendTasks(deviceId, deviceTasks, deviceInfos, deviceApis);
+            tasks->insert(tasks->end(), deviceTasks.begin(), deviceTasks.end());
+            infos->insert(infos->end(), deviceInfos.begin(), deviceInfos.end());
+            apis->insert(apis->end(), deviceApis.begin(), deviceApis.end());
+        }
+        records = tasks->size() + apis->size();
+        inventory.Inject(tasks);
+        inventory.Inject(infos);
+        inventory.Inject(apis);
+    }
+
+    // 导出阶段依赖全局Context中的平台、时间等信息
+    bool LoadContext() const
+    {
+        if (!Environment::Context::GetInstance().Load({prof_.profPath})) {
+            ERROR("Load context of % failed.", prof_.profPath);
+            return false;
+        }
+        return true;
+    }
+
+    bool RunDBAssembler(StageCounter &counter)
+    {
+        auto outputDir = File::PathJoin({prof_.profPath, BENCH_DB_DIR});
+        if (File::Exist(outputDir)) {
+            File::RemoveDir(outputDir, 0);
+        }
+        if (!File::CreateDir(outputDir)) {
+            return false;
+        }
+        if (!LoadContext()) {
+            return false;
+        }
+        DataInventory inventory;
+        InjectAscendTasks(inventory, counter.records);
+        DBAssembler assembler(prof_.profPath, outputDir);
+        bool ret = assembler.Run(inventory);
+        counter.bytes = FilesBytes(outputDir, MSPROF_PREFIX);
+        return ret;
+    }
+
+    bool RunTimeline(StageCounter &counter)
+    {
+        if (!LoadContext()) {
+            return false;
+        }
+        auto outputDir = File::PathJoin({prof_.profPath, OUTPUT_PATH});
+        if (File::Exist(outputDir)) {
+            File::RemoveDir(outputDir, 0);
+        }
+        if (!File::CreateDir(outputDir)) {
+            return false;
+        }
+        DataInventory inventory;
+        InjectAscendTasks(inventory, counter.records);
+        AscendHardwareAssembler assembler;
+        bool ret = assembler.Run(inventory, prof_.profPath);
+        counter.bytes = FilesBytes(outputDir, MSPROF_PREFIX);
+        return ret;
+    }
+
+    // device侧解析落盘 + 导出timeline与db，清理增量清单保证每次都完整执行
+    bool RunEndToEnd(StageCounter &counter)
+    {
+        for (const auto &deviceDir : prof_.deviceDirs) {
+            StageManifest manifest(deviceDir, DEVICE_PARSE_STAGE);
+            if (File::Exist(manifest.GetManifestPath())) {
+                File::DeleteFile(manifest.GetManifestPath());
+            }
+            auto sqliteDir = File::PathJoin({deviceDir, SQLITE});
+            if (File::Exist(sqliteDir)) {
+                File::RemoveDir(sqliteDir, 0);
+            }
+        }
+        counter.records = static_cast<uint64_t>(config_.taskNum) * config_.deviceNum;
+        counter.bytes = prof_.dataBytes;
+        auto inventories = DeviceContextEntry(prof_.profPath.c_str(), "");
+        if (inventories.size() != prof_.deviceDirs.size()) {
+            return false;
+        }
+        ExportManager manager(prof_.profPath);
+        return manager.Run({ExportMode::TIMELINE, ExportMode::DB});
+    }
+
+private:
+    SyntheticProfConfig config_;
+    std::set<std::string> stages_;
+    SyntheticProfGenerator generator_;
+    SyntheticProf prof_;
+    StageRecorder recorder_;
+    std::vector<DataInventory> inventories_;
+};
+
+bool ParseArgs(int argc, char *argv[], std::map<std::string, std::string> &args)
+{
+    const std::string prefix = "--";
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto pos = arg.find('=');
+        if (arg.compare(0, prefix.size(), prefix) != 0 || pos == std::string::npos) {
+            std::cerr << "Invalid argument: " << arg << ", expect --key=value." << std::endl;
+            return false;
+        }
+        args[arg.substr(prefix.size(), pos - prefix.size())] = arg.substr(pos + 1);
+    }
+    return true;
+}
+
+bool GetU32Arg(const std::map<std::string, std::string> &args, const std::string &key, uint32_t &value)
+{
+    auto it = args.find(key);
+    if (it == args.end()) {
+        return true;
+    }
+    if (StrToU32(value, it->second) != ANALYSIS_OK) {
+        std::cerr << "Invalid value of " << key << ": " << it->second << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool BuildConfig(std::map<std::string, std::string> &args, SyntheticProfConfig &config,
+                 std::set<std::string> &stages)
+{
+    config.outputDir = args.count("output") != 0 ? args["output"] : "./analysis_bench_output";
+    uint32_t pmu = config.pmu ? 1 : 0;
+    uint32_t depth = config.hostApiDepth;
+    if (!GetU32Arg(args, "device_num", config.deviceNum) || !GetU32Arg(args, "stream_num", config.streamNum) ||
+        !GetU32Arg(args, "task_num", config.taskNum) || !GetU32Arg(args, "pmu", pmu) ||
+        !GetU32Arg(args, "host_api_depth", depth) || !GetU32Arg(args, "seed", config.seed)) {
+        return false;
+    }
+    config.pmu = pmu != 0;
+    config.hostApiDepth = static_cast<uint16_t>(depth);
+    auto selected = args.count("stages") != 0 ? Split(args["stages"], ",") : ALL_STAGES;
+    for (const auto &stage : selected) {
+        if (std::find(ALL_STAGES.begin(), ALL_STAGES.end(), stage) == ALL_STAGES.end()) {
+            std::cerr << "Unknown stage: " << stage << std::endl;
+            return false;
+        }
+        stages.insert(stage);
+    }
+    // 回填生效的配置，写入报告
+    args["output"] = config.outputDir;
+    args["device_num"] = std::to_string(config.deviceNum);
+    args["stream_num"] = std::to_string(config.streamNum);
+    args["task_num"] = std::to_string(config.taskNum);
+    args["pmu"] = std::to_string(pmu);
+    args["host_api_depth"] = std::to_string(config.hostApiDepth);
+    args["seed"] = std::to_string(config.seed);
+    return true;
+}
+}  // namespace Bench
+}  // namespace Analysis
+
+int main(int argc, char *argv[])
+{
+    using namespace Analysis::Bench;
+    std::map<std::string, std::string> args;
+    SyntheticProfConfig config;
+    std::set<std::string> stages;
+    if (!ParseArgs(argc, argv, args) || !BuildConfig(args, config, stages)) {
+        return EXIT_FAILURE;
+    }
+    if (!Analysis::Utils::File::Exist(config.outputDir) && !Analysis::Utils::File::CreateDir(config.outputDir)) {
+        std::cerr << "Create output dir " << config.outputDir << " failed." << std::endl;
+        return EXIT_FAILURE;
+    }
+    Analysis::Log::GetInstance().Init(config.outputDir);
+    auto traceDir = args.count("self_trace") != 0 ? args["self_trace"] : "";
+    args.erase("self_trace");
+    if (!traceDir.empty()) {
+        Analysis::Utils::SelfTrace::GetInstance().Enable(traceDir);
+    }
+    BenchRunner runner(config, stages);
+    bool ret = runner.Run();
+    if (!traceDir.empty() && !Analysis::Utils::SelfTrace::GetInstance().Flush()) {
+        std::cerr << "Save self trace to " << traceDir << " failed." << std::endl;
+    }
+    auto reportPath = args.count("report") != 0 ? args["report"] : "";
+    args.erase("report");
+    auto report = runner.GetRecorder().Report(args);
+    if (reportPath.empty()) {
+        std::cout << report << std::endl;
+    } else {
+        Analysis::Utils::FileWriter writer(reportPath);
+        writer.WriteText(report);
+    }
+    return ret ? EXIT_SUCCESS : EXIT_FAILURE;
+}
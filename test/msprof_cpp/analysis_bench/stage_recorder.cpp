@@ -0,0 +1,227 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#include "test/msprof_cpp/analysis_bench/stage_recorder.h"
+
+#include <dirent.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <thread>
+
+#include "analysis/csrc/infrastructure/dfx/log.h"
+#include "analysis/csrc/infrastructure/dump_tools/json_tool/include/json_writer.h"
+
+namespace Analysis {
+namespace Bench {
+namespace {
+const std::string TASK_DIR = "/proc/self/task";
+const std::string STATUS_FILE = "/proc/self/status";
+const std::string CLEAR_REFS_FILE = "/proc/self/clear_refs";
+const std::string VM_HWM = "VmHWM:";
+const std::string VM_RSS = "VmRSS:";
+const std::string RESET_PEAK_RSS = "5";
+const double NS_PER_SECOND = 1e9;
+
+uint64_t NowNs()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+bool ReadThreadCpu(int tid, ThreadUsage &usage)
+{
+    auto taskDir = TASK_DIR + "/" + std::to_string(tid);
+    // schedstat首个字段为线程在cpu上运行的纳秒数，精度高于stat中以时钟节拍计的utime/stime
+    std::ifstream schedstat(taskDir + "/schedstat");
+    uint64_t runNs = 0;
+    if (!(schedstat >> runNs)) {
+        return false;
+    }
+    std::ifstream comm(taskDir + "/comm");
+    std::getline(comm, usage.name);
+    usage.tid = tid;
+    usage.cpuNs = runNs;
+    return true;
+}
+
+std::vector<int> ListThreads()
+{
+    std::vector<int> tids;
+    DIR *dir = opendir(TASK_DIR.c_str());
+    if (dir == nullptr) {
+        return tids;
+    }
+    const struct dirent *entry = nullptr;
+    while ((entry = readdir(dir)) != nullptr) {
+        if (entry->d_name[0] != '.') {
+            tids.emplace_back(std::atoi(entry->d_name));
+        }
+    }
+    closedir(dir);
+    return tids;
+}
+
+uint64_t ReadStatusKb(const std::string &key)
+{
+    std::ifstream status(STATUS_FILE);
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, key.size(), key) == 0) {
+            return std::stoull(line.substr(key.size()));
+        }
+    }
+    return 0;
+}
+
+// 重置进程的RSS峰值(VmHWM)，内核不支持或无权限时返回false
+bool ResetPeakRss()
+{
+    std::ofstream clearRefs(CLEAR_REFS_FILE);
+    if (!clearRefs.is_open()) {
+        return false;
+    }
+    clearRefs << RESET_PEAK_RSS;
+    clearRefs.flush();
+    return clearRefs.good();
+}
+}  // namespace
+
+const uint32_t StageRecorder::DEFAULT_SAMPLE_INTERVAL_MS;
+
+double StageResult::RecordsPerSecond() const
+{
+    return wallNs == 0 ? 0.0 : static_cast<double>(records) * NS_PER_SECOND / static_cast<double>(wallNs);
+}
+
+double StageResult::BytesPerSecond() const
+{
+    return wallNs == 0 ? 0.0 : static_cast<double>(bytes) * NS_PER_SECOND / static_cast<double>(wallNs);
+}
+
+StageRecorder::StageRecorder(uint32_t sampleIntervalMs) : sampleIntervalMs_(std::max(sampleIntervalMs, 1U))
+{}
+
+void StageRecorder::Sample()
+{
+    for (int tid : ListThreads()) {
+        ThreadUsage usage;
+        if (ReadThreadCpu(tid, usage)) {
+            latest_[tid] = usage;
+        }
+    }
+    peakRssKb_ = std::max(peakRssKb_, ReadStatusKb(VM_RSS));
+}
+
+void StageRecorder::SamplerLoop()
+{
+    samplerTid_ = static_cast<int>(syscall(SYS_gettid));
+    while (sampling_) {
+        Sample();
+        std::this_thread::sleep_for(std::chrono::milliseconds(sampleIntervalMs_));
+    }
+}
+
+StageResult StageRecorder::Run(const std::string &name, const std::function<bool(StageCounter &)> &stage)
+{
+    StageResult result;
+    result.name = name;
+    latest_.clear();
+    peakRssKb_ = 0;
+    bool peakReset = ResetPeakRss();
+    Sample();
+    baseline_ = latest_;
+    sampling_ = true;
+    std::thread sampler(&StageRecorder::SamplerLoop, this);
+    StageCounter counter;
+    auto begin = NowNs();
+    result.success = stage(counter);
+    result.wallNs = NowNs() - begin;
+    sampling_ = false;
+    sampler.join();
+    Sample();
+    result.records = counter.records;
+    result.bytes = counter.bytes;
+    result.peakRssKb = peakReset ? std::max(peakRssKb_, ReadStatusKb(VM_HWM)) : peakRssKb_;
+    for (const auto &item : latest_) {
+        auto usage = item.second;
+        auto it = baseline_.find(item.first);
+        if (it != baseline_.end()) {
+            usage.cpuNs = usage.cpuNs >= it->second.cpuNs ? usage.cpuNs - it->second.cpuNs : 0;
+        }
+        // 采样线程自身以及阶段内未消耗cpu的线程不计入
+        if (usage.cpuNs == 0 || usage.tid == samplerTid_) {
+            continue;
+        }
+        usage.utilization = result.wallNs == 0 ? 0.0 :
+            static_cast<double>(usage.cpuNs) / static_cast<double>(result.wallNs);
+        result.threads.emplace_back(usage);
+    }
+    INFO("Bench stage % %, wall: %ns, records: %, bytes: %, peak rss: %KB.", name,
+         result.success ? "succeeded" : "failed", result.wallNs, result.records, result.bytes, result.peakRssKb);
+    results_.emplace_back(result);
+    return result;
+}
+
+const std::vector<StageResult> &StageRecorder::GetResults() const
+{
+    return results_;
+}
+
+std::string StageRecorder::Report(const std::map<std::string, std::string> &config) const
+{
+    Infra::JsonWriter writer;
+    writer.StartObject();
+    writer["config"];
+    writer.StartObject();
+    for (const auto &item : config) {
+        writer[item.first.c_str()] << item.second;
+    }
+    writer.EndObject();
+    writer["stages"];
+    writer.StartArray();
+    for (const auto &result : results_) {
+        writer.StartObject();
+        writer["name"] << result.name;
+        writer["success"] << result.success;
+        writer["wall_ns"] << result.wallNs;
+        writer["records"] << result.records;
+        writer["bytes"] << result.bytes;
+        writer["records_per_second"] << result.RecordsPerSecond();
+        writer["bytes_per_second"] << result.BytesPerSecond();
+        writer["peak_rss_kb"] << result.peakRssKb;
+        writer["threads"];
+        writer.StartArray();
+        for (const auto &thread : result.threads) {
+            writer.StartObject();
+            writer["tid"] << thread.tid;
+            writer["name"] << thread.name;
+            writer["cpu_ns"] << thread.cpuNs;
+            writer["utilization"] << thread.utilization;
+            writer.EndObject();
+        }
+        writer.EndArray();
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+    return std::string(writer.GetString(), writer.GetSize());
+}
+}  // namespace Bench
+}  // namespace Analysis
@@ -0,0 +1,84 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#ifndef TEST_MSPROF_CPP_ANALYSIS_BENCH_STAGE_RECORDER_H
+#define TEST_MSPROF_CPP_ANALYSIS_BENCH_STAGE_RECORDER_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Analysis {
+namespace Bench {
+
+struct ThreadUsage {
+    int tid = 0;
+    std::string name;
+    uint64_t cpuNs = 0;         // 阶段内消耗的cpu时间(用户态+内核态)
+    double utilization = 0.0;   // cpuNs / 阶段墙钟时间
+};
+
+struct StageResult {
+    std::string name;
+    bool success = false;
+    uint64_t wallNs = 0;
+    uint64_t records = 0;
+    uint64_t bytes = 0;
+    uint64_t peakRssKb = 0;
+    std::vector<ThreadUsage> threads;
+
+    double RecordsPerSecond() const;
+    double BytesPerSecond() const;
+};
+
+// 阶段统计量由阶段函数填写：处理的记录数与字节数
+struct StageCounter {
+    uint64_t records = 0;
+    uint64_t bytes = 0;
+};
+
+// 阶段执行期间后台周期采样/proc/self/task下各线程的cpu时间与进程RSS，
+// 阶段内创建又退出的线程(如ThreadPool)以最后一次采样值计
+class StageRecorder {
+public:
+    explicit StageRecorder(uint32_t sampleIntervalMs = DEFAULT_SAMPLE_INTERVAL_MS);
+    StageResult Run(const std::string &name, const std::function<bool(StageCounter &)> &stage);
+    const std::vector<StageResult> &GetResults() const;
+    // 以json格式输出所有阶段结果，config为原样写入的生成参数
+    std::string Report(const std::map<std::string, std::string> &config) const;
+
+    static const uint32_t DEFAULT_SAMPLE_INTERVAL_MS = 5;
+
+private:
+    void Sample();
+    void SamplerLoop();
+
+private:
+    uint32_t sampleIntervalMs_;
+    std::atomic<bool> sampling_{false};
+    std::atomic<int> samplerTid_{0};
+    std::map<int, ThreadUsage> baseline_;
+    std::map<int, ThreadUsage> latest_;
+    uint64_t peakRssKb_ = 0;
+    std::vector<StageResult> results_;
+};
+}  // namespace Bench
+}  // namespace Analysis
+
+#endif  // TEST_MSPROF_CPP_ANALYSIS_BENCH_STAGE_RECORDER_H
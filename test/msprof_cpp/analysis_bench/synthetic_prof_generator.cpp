@@ -0,0 +1,381 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#include "test/msprof_cpp/analysis_bench/synthetic_prof_generator.h"
+
+#include <algorithm>
+#include <fstream>
+
+#include "nlohmann/json.hpp"
+#include "analysis/csrc/domain/entities/tree/include/event.h"
+#include "analysis/csrc/domain/services/parser/parser_item/acsq_log_parser_item.h"
+#include "analysis/csrc/domain/services/parser/parser_item/chip4_pmu_parser_item.h"
+#include "analysis/csrc/infrastructure/dfx/log.h"
+#include "analysis/csrc/infrastructure/utils/common_constant.h"
+#include "analysis/csrc/infrastructure/utils/file.h"
+#include "analysis/csrc/infrastructure/utils/prof_common.h"
+
+namespace Analysis {
+namespace Bench {
+using namespace Analysis::Domain;
+using namespace Analysis::Utils;
+namespace {
+const std::string PROF_NAME = "PROF_000001_20260101000000000_BENCH";
+const std::string DATA_DIR = "data";
+const std::string PLATFORM_VERSION = "5";  // CHIP_V4_1_0
+const uint64_t HWTS_FREQ_MHZ = 1000;       // 1000MHz，syscnt与ns一一对应，便于核对
+const uint64_t BASE_SYSCNT = 1000000000000ULL;
+const uint64_t BASE_HOST_NS = 1700000000000000000ULL;
+const uint64_t TASK_SLOT = 10000;          // 每个stream上相邻task的间隔，大于最大耗时保证不重叠
+const uint64_t MIN_DURATION = 1000;
+const uint64_t DURATION_RANGE = 6000;
+const uint64_t JITTER_RANGE = 1000;
+const uint64_t API_NEST_GAP = 50;          // 相邻两层api的首尾间隔
+const uint16_t ACSQ_LOG_MAGIC = 0x6bd3;
+const uint16_t MAX_TASK_ID = 65535;
+const uint16_t CNT_MOD = 16;
+const uint16_t CONTEXT_PMU_FUNC_TYPE = 40;
+const uint16_t CONTEXT_PMU_SUB_TASK_TYPE = 6;
+const uint16_t CONTEXT_PMU_FFTS_TYPE = 4;
+const size_t WRITE_BATCH = 4096;
+const uint16_t MAX_API_DEPTH = 4;
+const uint16_t API_LEVELS[MAX_API_DEPTH] = {MSPROF_REPORT_ACL_LEVEL, MSPROF_REPORT_MODEL_LEVEL,
+                                            MSPROF_REPORT_NODE_LEVEL, MSPROF_REPORT_HCCL_NODE_LEVEL};
+
+// splitmix64，用于由seed和序号生成确定的伪随机数
+uint64_t Mix(uint64_t value)
+{
+    value += 0x9E3779B97F4A7C15ULL;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+template<typename T>
+class BinaryBatchWriter {
+public:
+    explicit BinaryBatchWriter(const std::string &path) : out_(path, std::ios::out | std::ios::binary | std::ios::trunc)
+    {
+        batch_.reserve(WRITE_BATCH);
+    }
+    bool IsOpen() const { return out_.is_open(); }
+    void Push(const T &record)
+    {
+        batch_.push_back(record);
+        if (batch_.size() >= WRITE_BATCH) {
+            Flush();
+        }
+    }
+    uint64_t Close()
+    {
+        Flush();
+        out_.close();
+        return bytes_;
+    }
+
+private:
+    void Flush()
+    {
+        out_.write(reinterpret_cast<const char *>(batch_.data()), batch_.size() * sizeof(T));
+        bytes_ += batch_.size() * sizeof(T);
+        batch_.clear();
+    }
+
+private:
+    std::ofstream out_;
+    std::vector<T> batch_;
+    uint64_t bytes_ = 0;
+};
+
+bool WriteJson(const std::string &path, const nlohmann::json &content)
+{
+    FileWriter writer(path);
+    if (!writer.IsOpen()) {
+        ERROR("Open % failed.", path);
+        return false;
+    }
+    writer.WriteText(content.dump());
+    return true;
+}
+}  // namespace
+
+SyntheticProfGenerator::SyntheticProfGenerator(const SyntheticProfConfig &config) : config_(config)
+{
+    config_.streamNum = std::max(config_.streamNum, 1U);
+    config_.hostApiDepth = std::min(std::max(config_.hostApiDepth, static_cast<uint16_t>(1)), MAX_API_DEPTH);
+}
+
+void SyntheticProfGenerator::GetTaskTime(uint64_t taskIndex, uint64_t &start, uint64_t &duration) const
+{
+    uint64_t seq = taskIndex / config_.streamNum;
+    uint64_t random = Mix((static_cast<uint64_t>(config_.seed) << 32) ^ taskIndex);
+    start = seq * TASK_SLOT + random % JITTER_RANGE;
+    duration = MIN_DURATION + (random >> 16) % DURATION_RANGE;
+}
+
+bool SyntheticProfGenerator::Generate(SyntheticProf &prof)
+{
+    prof.profPath = File::PathJoin({config_.outputDir, PROF_NAME});
+    prof.deviceDirs.clear();
+    prof.dataBytes = 0;
+    if (File::Exist(prof.profPath) && !File::RemoveDir(prof.profPath, 0)) {
+        ERROR("Remove old synthetic prof % failed.", prof.profPath);
+        return false;
+    }
+    auto hostDir = File::PathJoin({prof.profPath, HOST});
+    if (!File::CreateDir(prof.profPath) || !File::CreateDir(hostDir) || !WriteMetaFiles(hostDir, 0, true)) {
+        return false;
+    }
+    for (uint16_t deviceId = 0; deviceId < config_.deviceNum; ++deviceId) {
+        auto deviceDir = File::PathJoin({prof.profPath, DEVICE_PREFIX + std::to_string(deviceId)});
+        auto dataDir = File::PathJoin({deviceDir, DATA_DIR});
+        if (!File::CreateDir(deviceDir) || !File::CreateDir(dataDir) || !WriteMetaFiles(deviceDir, deviceId, false) ||
+            !WriteStarsSocData(dataDir, deviceId, prof.dataBytes)) {
+            return false;
+        }
+        if (config_.pmu && !WriteFftsProfileData(dataDir, deviceId, prof.dataBytes)) {
+            return false;
+        }
+        prof.deviceDirs.emplace_back(deviceDir);
+    }
+    INFO("Generate synthetic prof %, data bytes: %.", prof.profPath, prof.dataBytes);
+    return true;
+}
+
+bool SyntheticProfGenerator::WriteMetaFiles(const std::string &dir, uint16_t deviceId, bool isHost) const
+{
+    std::string suffix = isHost ? ".0" : "." + std::to_string(deviceId);
+    nlohmann::json info = {
+        {"platform_version", PLATFORM_VERSION},
+        {"devices", isHost ? "" : std::to_string(deviceId)},
+        {"pid", "10086"},
+        {"hostname", "bench"},
+        {"memoryTotal", 0},
+        {"netCard", nlohmann::json::array()},
+        {"llc_profiling", ""},
+        {"ai_core_profiling_mode", "task-based"},
+        {"DeviceInfo", {{{"hwts_frequency", std::to_string(HWTS_FREQ_MHZ)},
+                         {"aic_frequency", "1850"},
+                         {"aiv_frequency", "1850"},
+                         {"ai_core_num", 25},
+                         {"aiv_num", 50}}}},
+        {"CPU", {{{"Frequency", "100.000000"}}}},
+    };
+    nlohmann::json sample = {
+        {"ai_core_profiling", config_.pmu ? "on" : "off"},
+        {"ai_core_metrics", "PipeUtilization"},
+        {"ai_core_profiling_events", "0x416,0x417,0x9,0x302,0xc,0x303,0x54,0x55"},
+        {"ai_core_profiling_mode", "task-based"},
+        {"aicore_sampling_interval", 10},
+        {"aiv_profiling", "off"},
+        {"aiv_metrics", "PipeUtilization"},
+        {"aiv_profiling_events", ""},
+        {"aiv_profiling_mode", "task-based"},
+        {"aiv_sampling_interval", 10},
+    };
+    nlohmann::json startInfo = {
+        {"collectionTimeBegin", std::to_string(BASE_HOST_NS / MILLI_SECOND)},
+        {"clockMonotonicRaw", std::to_string(BASE_HOST_NS)},
+    };
+    // 采集结束时间覆盖最后一轮task
+    uint64_t endNs = BASE_HOST_NS + (config_.taskNum / config_.streamNum + 1) * TASK_SLOT + JITTER_RANGE +
+        MIN_DURATION + DURATION_RANGE;
+    nlohmann::json endInfo = {
+        {"collectionTimeEnd", std::to_string(endNs / MILLI_SECOND)},
+        {"clockMonotonicRaw", std::to_string(endNs)},
+    };
+    // 墙上时间与monotonic一致，device的syscnt起点为BASE_SYSCNT
+    std::string startLog = "[Host]\nclock_monotonic_raw: " + std::to_string(BASE_HOST_NS) +
+        "\ncntvct: " + std::to_string(BASE_SYSCNT) + "\ncntvct_diff: 0\n";
+    if (!WriteJson(File::PathJoin({dir, "info.json" + suffix}), info) ||
+        !WriteJson(File::PathJoin({dir, "sample.json"}), sample) ||
+        !WriteJson(File::PathJoin({dir, "start_info" + suffix}), startInfo) ||
+        !WriteJson(File::PathJoin({dir, "end_info" + suffix}), endInfo)) {
+        return false;
+    }
+    FileWriter hostStart(File::PathJoin({dir, "host_start.log" + suffix}));
+    hostStart.WriteText(startLog);
+    if (!isHost) {
+        FileWriter devStart(File::PathJoin({dir, "dev_start.log" + suffix}));
+        devStart.WriteText(startLog);
+    }
+    return true;
+}
+
+bool SyntheticProfGenerator::WriteStarsSocData(const std::string &dataDir, uint16_t deviceId, uint64_t &bytes) const
+{
+    auto path = File::PathJoin({dataDir, "stars_soc.data." + std::to_string(deviceId) + ".slice_0"});
+    BinaryBatchWriter<AcsqLog> writer(path);
+    if (!writer.IsOpen()) {
+        ERROR("Open % failed.", path);
+        return false;
+    }
+    uint16_t cnt = 0;
+    uint64_t start = 0;
+    uint64_t duration = 0;
+    // 每一轮先写各stream的开始日志，再写各stream的结束日志，与硬件上报的交织顺序一致
+    for (uint64_t base = 0; base < config_.taskNum; base += config_.streamNum) {
+        uint64_t end = std::min<uint64_t>(base + config_.streamNum, config_.taskNum);
+        for (int funcType : {PARSER_ITEM_ACSQ_LOG_START, PARSER_ITEM_ACSQ_LOG_END}) {
+            for (uint64_t i = base; i < end; ++i) {
+                GetTaskTime(i, start, duration);
+                AcsqLog log{};
+                log.funcType = funcType;
+                log.cnt = cnt++ % CNT_MOD;
+                log.resv2 = ACSQ_LOG_MAGIC;
+                log.streamId = static_cast<uint16_t>(i % config_.streamNum);
+                log.taskId = static_cast<uint16_t>((i / config_.streamNum) % MAX_TASK_ID);
+                log.timestamp = BASE_SYSCNT + start + (funcType == PARSER_ITEM_ACSQ_LOG_START ? 0 : duration);
+                writer.Push(log);
+            }
+        }
+    }
+    bytes += writer.Close();
+    return true;
+}
+
+bool SyntheticProfGenerator::WriteFftsProfileData(const std::string &dataDir, uint16_t deviceId,
+                                                  uint64_t &bytes) const
+{
+    auto path = File::PathJoin({dataDir, "ffts_profile.data." + std::to_string(deviceId) + ".slice_0"});
+    BinaryBatchWriter<ContextPmu> writer(path);
+    if (!writer.IsOpen()) {
+        ERROR("Open % failed.", path);
+        return false;
+    }
+    uint64_t start = 0;
+    uint64_t duration = 0;
+    for (uint64_t i = 0; i < config_.taskNum; ++i) {
+        GetTaskTime(i, start, duration);
+        ContextPmu pmu{};
+        pmu.funcType = CONTEXT_PMU_FUNC_TYPE;
+        pmu.cnt = i % CNT_MOD;
+        pmu.streamId = static_cast<uint16_t>(i % config_.streamNum);
+        pmu.taskId = static_cast<uint16_t>((i / config_.streamNum) % MAX_TASK_ID);
+        pmu.subTaskType = CONTEXT_PMU_SUB_TASK_TYPE;
+        pmu.fftsType = CONTEXT_PMU_FFTS_TYPE;
+        pmu.subTaskId = 0;
+        pmu.totalCycle = duration;
+        for (size_t j = 0; j < sizeof(pmu.pmuList) / sizeof(pmu.pmuList[0]); ++j) {
+            pmu.pmuList[j] = (Mix(i + j) % duration) + 1;
+        }
+        pmu.timeList[0] = BASE_SYSCNT + start;
+        pmu.timeList[1] = BASE_SYSCNT + start + duration;
+        writer.Push(pmu);
+    }
+    bytes += writer.Close();
+    return true;
+}
+
+std::shared_ptr<CANNWarehouse> SyntheticProfGenerator::GenerateCannWarehouse(uint32_t threadId) const
+{
+    auto warehouse = std::make_shared<CANNWarehouse>();
+    uint64_t taskNum = config_.taskNum / config_.streamNum;
+    warehouse->kernelEvents = std::make_shared<EventQueue>(threadId, taskNum * config_.hostApiDepth);
+    warehouse->taskTrackEvents = std::make_shared<EventQueue>(threadId, taskNum);
+    uint64_t start = 0;
+    uint64_t duration = 0;
+    for (uint64_t seq = 0; seq < taskNum; ++seq) {
+        GetTaskTime(seq * config_.streamNum + threadId % config_.streamNum, start, duration);
+        uint64_t begin = BASE_HOST_NS + start;
+        uint64_t end = begin + duration + API_NEST_GAP * MAX_API_DEPTH * 2;
+        for (uint16_t depth = 0; depth < config_.hostApiDepth; ++depth) {
+            auto api = std::make_shared<MsprofApi>();
+            api->level = API_LEVELS[depth];
+            api->type = static_cast<uint32_t>(EventType::EVENT_TYPE_API);
+            api->threadId = threadId;
+            api->reserve = 0;
+            api->beginTime = begin + depth * API_NEST_GAP;
+            api->endTime = end - depth * API_NEST_GAP;
+            api->itemId = seq;
+            EventInfo info{EventType::EVENT_TYPE_API, api->level, api->beginTime, api->endTime};
+            warehouse->kernelEvents->Push(std::make_shared<Event>(api, info));
+        }
+        // task track位于最内层api内部
+        uint64_t dot = begin + config_.hostApiDepth * API_NEST_GAP;
+        auto track = std::make_shared<MsprofCompactInfo>();
+        track->level = MSPROF_REPORT_RUNTIME_LEVEL;
+        track->type = static_cast<uint32_t>(EventType::EVENT_TYPE_TASK_TRACK);
+        track->threadId = threadId;
+        track->dataLen = sizeof(MsprofRuntimeTrack);
+        track->timeStamp = dot;
+        track->data.runtimeTrack.taskType = 0;
+        EventInfo trackInfo{EventType::EVENT_TYPE_TASK_TRACK, MSPROF_REPORT_RUNTIME_LEVEL, dot, dot};
+        warehouse->taskTrackEvents->Push(std::make_shared<Event>(track, trackInfo));
+    }
+    warehouse->kernelEvents->Sort();
+    warehouse->taskTrackEvents->Sort();
+    return warehouse;
+}
+
+void SyntheticProfGenerator::GenerateAscendTasks(uint16_t deviceId, std::vector<AscendTaskData> &tasks,
+                                                 std::vector<TaskInfoData> &infos, std::vector<ApiData> &apis) const
+{
+    const uint32_t opTypeNum = 64;
+    tasks.clear();
+    infos.clear();
+    apis.clear();
+    tasks.reserve(config_.taskNum);
+    infos.reserve(config_.taskNum);
+    apis.reserve(config_.taskNum);
+    uint64_t start = 0;
+    uint64_t duration = 0;
+    // connectionId在所有device间唯一，与CANN_API主键保持一致
+    uint64_t connectionBase = static_cast<uint64_t>(deviceId) * config_.taskNum;
+    for (uint64_t i = 0; i < config_.taskNum; ++i) {
+        GetTaskTime(i, start, duration);
+        AscendTaskData task;
+        task.deviceId = deviceId;
+        task.modelId = 0;
+        task.indexId = -1;
+        task.streamId = static_cast<uint32_t>(i % config_.streamNum);
+        task.taskId = static_cast<uint32_t>((i / config_.streamNum) % MAX_TASK_ID);
+        task.batchId = static_cast<uint32_t>(i / config_.streamNum / MAX_TASK_ID);
+        task.connectionId = connectionBase + i;
+        task.timestamp = BASE_HOST_NS + start;
+        task.end = task.timestamp + duration;
+        task.duration = static_cast<double>(duration);
+        task.hostType = "KERNEL_AICORE";
+        task.deviceType = "AI_CORE";
+        task.taskType = "KERNEL_AICORE";
+        tasks.emplace_back(task);
+
+        TaskInfoData info;
+        info.deviceId = deviceId;
+        info.modelId = 0;
+        info.streamId = task.streamId;
+        info.taskId = task.taskId;
+        info.batchId = task.batchId;
+        info.opName = "Op_" + std::to_string(i % opTypeNum);
+        info.opType = "OpType_" + std::to_string(i % opTypeNum);
+        info.taskType = "AI_CORE";
+        infos.emplace_back(info);
+
+        ApiData api;
+        api.timestamp = task.timestamp - API_NEST_GAP;
+        api.end = task.timestamp;
+        api.level = MSPROF_REPORT_NODE_LEVEL;
+        api.threadId = task.streamId;
+        api.connectionId = connectionBase + i;
+        api.apiName = "launch";
+        api.structType = "launch";
+        api.id = "launch";
+        api.itemId = info.opName;
+        apis.emplace_back(api);
+    }
+}
+}  // namespace Bench
+}  // namespace Analysis
@@ -0,0 +1,79 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#ifndef TEST_MSPROF_CPP_ANALYSIS_BENCH_SYNTHETIC_PROF_GENERATOR_H
+#define TEST_MSPROF_CPP_ANALYSIS_BENCH_SYNTHETIC_PROF_GENERATOR_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "analysis/csrc/domain/entities/viewer_data/ai_task/include/api_data.h"
+#include "analysis/csrc/domain/entities/viewer_data/ai_task/include/ascend_task_data.h"
+#include "analysis/csrc/domain/entities/viewer_data/ai_task/include/task_info_data.h"
+#include "analysis/csrc/domain/services/parser/host/cann/cann_warehouse.h"
+
+namespace Analysis {
+namespace Bench {
+using CANNWarehouse = Analysis::Domain::Host::Cann::CANNWarehouse;
+
+// 合成数据规模配置，相同配置(含seed)生成的数据逐字节一致
+struct SyntheticProfConfig {
+    std::string outputDir;
+    uint32_t deviceNum = 1;
+    uint32_t streamNum = 8;
+    uint32_t taskNum = 100000;   // 每个device的task数
+    bool pmu = false;            // 是否生成ffts_profile(context级PMU)数据
+    uint16_t hostApiDepth = 3;   // host侧api嵌套层数，1~4依次为Acl/Model/Node/Hccl
+    uint32_t seed = 1;
+};
+
+// 生成的PROF目录信息
+struct SyntheticProf {
+    std::string profPath;
+    std::vector<std::string> deviceDirs;
+    uint64_t dataBytes = 0;      // 生成的二进制数据总字节数
+};
+
+// 确定性的合成PROF目录生成器
+// 目录结构与采集结果一致：PROF_xxx/host 与 PROF_xxx/device_N，device_N/data 下为stars_soc与ffts_profile二进制数据，
+// host侧CANN数据直接以内存中的EventQueue形式生成，供TreeBuilder等阶段单独压测
+class SyntheticProfGenerator {
+public:
+    explicit SyntheticProfGenerator(const SyntheticProfConfig &config);
+    // 生成PROF目录，已存在时先删除
+    bool Generate(SyntheticProf &prof);
+    // 生成一个线程的CANN数据，每个task对应一组hostApiDepth层嵌套的api以及一个task track
+    std::shared_ptr<CANNWarehouse> GenerateCannWarehouse(uint32_t threadId) const;
+    // 生成device的ascend task数据以及对应的api数据，供DBAssembler与timeline单独压测
+    void GenerateAscendTasks(uint16_t deviceId, std::vector<Domain::AscendTaskData> &tasks,
+                             std::vector<Domain::TaskInfoData> &infos, std::vector<Domain::ApiData> &apis) const;
+
+private:
+    bool WriteMetaFiles(const std::string &dir, uint16_t deviceId, bool isHost) const;
+    bool WriteStarsSocData(const std::string &dataDir, uint16_t deviceId, uint64_t &bytes) const;
+    bool WriteFftsProfileData(const std::string &dataDir, uint16_t deviceId, uint64_t &bytes) const;
+    // 第taskIndex个task的开始时间与耗时，由seed确定
+    void GetTaskTime(uint64_t taskIndex, uint64_t &start, uint64_t &duration) const;
+
+private:
+    SyntheticProfConfig config_;
+};
+}  // namespace Bench
+}  // namespace Analysis
+
+#endif  // TEST_MSPROF_CPP_ANALYSIS_BENCH_SYNTHETIC_PROF_GENERATOR_H
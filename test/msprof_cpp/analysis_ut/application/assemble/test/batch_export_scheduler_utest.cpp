@@ -0,0 +1,188 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+#include <sys/wait.h>
+#include <unistd.h>
+#include <fstream>
+
+#include "gtest/gtest.h"
+#include "analysis/csrc/application/include/batch_export_scheduler.h"
+#include "analysis/csrc/application/database/db_constant.h"
+#include "analysis/csrc/application/database/msprof_db.h"
+#include "analysis/csrc/infrastructure/db/include/db_runner.h"
+#include "analysis/csrc/infrastructure/utils/file.h"
+
+using namespace Analysis::Application;
+using namespace Analysis::Infra;
+using namespace Analysis::Utils;
+
+namespace {
+const int DEPTH = 0;
+const std::string BASE_PATH = "./batch_export_test";
+const std::string MSPROF_DB_NAME = "msprof_20260101000000.db";
+using StringIdsFormat = std::vector<std::tuple<uint64_t, std::string>>;
+using CommOpFormat = std::vector<std::tuple<uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, int32_t,
+    int32_t, uint64_t, uint64_t, double, uint64_t, uint32_t, uint32_t>>;
+using MergedFormat = std::vector<std::tuple<uint32_t, std::string, std::string, uint64_t, std::string, uint32_t>>;
+
+void WriteFile(const std::string &path, size_t size)
+{
+    std::ofstream out(path);
+    out << std::string(size, 'a');
+}
+
+// 创建PROF目录，host与各device的data目录下写入指定大小的数据
+std::string CreateProf(const std::string &name, uint32_t deviceNum, size_t dataSize)
+{
+    std::string profPath = File::PathJoin({BASE_PATH, name});
+    EXPECT_TRUE(File::CreateDir(profPath));
+    EXPECT_TRUE(File::CreateDir(File::PathJoin({profPath, "host"})));
+    EXPECT_TRUE(File::CreateDir(File::PathJoin({profPath, "host", "data"})));
+    WriteFile(File::PathJoin({profPath, "host", "data", "host.data"}), dataSize);
+    for (uint32_t i = 0; i < deviceNum; ++i) {
+        std::string devicePath = File::PathJoin({profPath, "device_" + std::to_string(i)});
+        EXPECT_TRUE(File::CreateDir(devicePath));
+        EXPECT_TRUE(File::CreateDir(File::PathJoin({devicePath, "data"})));
+        WriteFile(File::PathJoin({devicePath, "data", "device.data"}), dataSize);
+    }
+    return profPath;
+}
+
+void CreateMsprofDB(const std::string &profPath, const StringIdsFormat &stringIds, const CommOpFormat &opData)
+{
+    MsprofDB database;
+    DBRunner runner(File::PathJoin({profPath, MSPROF_DB_NAME}));
+    EXPECT_TRUE(runner.CreateTable(TABLE_NAME_STRING_IDS, database.GetTableCols(TABLE_NAME_STRING_IDS)));
+    EXPECT_TRUE(runner.CreateTable(TABLE_NAME_COMMUNICATION_OP, database.GetTableCols(TABLE_NAME_COMMUNICATION_OP)));
+    EXPECT_TRUE(runner.InsertData(TABLE_NAME_STRING_IDS, stringIds));
+    EXPECT_TRUE(runner.InsertData(TABLE_NAME_COMMUNICATION_OP, opData));
+}
+}
+
+class BatchExportSchedulerUTest : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        if (File::Check(BASE_PATH)) {
+            File::RemoveDir(BASE_PATH, DEPTH);
+        }
+        EXPECT_TRUE(File::CreateDir(BASE_PATH));
+    }
+    virtual void TearDown()
+    {
+        EXPECT_TRUE(File::RemoveDir(BASE_PATH, DEPTH));
+    }
+};
+
+TEST_F(BatchExportSchedulerUTest, ShouldPlanLargestProfFirstAndClampWeightByBudget)
+{
+    auto small = CreateProf("PROF_0", 1, 10);
+    auto large = CreateProf("PROF_1", 4, 1000);
+    auto medium = CreateProf("PROF_2", 2, 100);
+    BatchExportOptions options;
+    options.cpuBudget = 3;
+    BatchExportScheduler scheduler({small, large, medium}, options);
+    EXPECT_TRUE(scheduler.PlanJobs());
+    const auto &jobs = scheduler.GetJobs();
+    ASSERT_EQ(3ul, jobs.size());
+    EXPECT_EQ(large, jobs[0].profPath);
+    EXPECT_EQ(1ul, jobs[0].rankIndex);
+    EXPECT_EQ(5000ul, jobs[0].dataSize);
+    EXPECT_EQ(3u, jobs[0].weight);
+    EXPECT_EQ(medium, jobs[1].profPath);
+    EXPECT_EQ(2u, jobs[1].weight);
+    EXPECT_EQ(small, jobs[2].profPath);
+    EXPECT_EQ(1u, jobs[2].weight);
+}
+
+TEST_F(BatchExportSchedulerUTest, ShouldReturnFalseWhenProfPathInvalid)
+{
+    BatchExportOptions options;
+    BatchExportScheduler scheduler({File::PathJoin({BASE_PATH, "PROF_NOT_EXIST"})}, options);
+    EXPECT_FALSE(scheduler.Run());
+    EXPECT_TRUE(scheduler.GetJobs().empty());
+}
+
+TEST_F(BatchExportSchedulerUTest, ShouldRunEveryProfInSubprocessAndReportFailedOnes)
+{
+    std::vector<std::string> profPaths;
+    for (size_t i = 0; i < 5; ++i) {
+        profPaths.emplace_back(CreateProf("PROF_" + std::to_string(i), 1, (i + 1) * 10));
+    }
+    BatchExportOptions options;
+    options.cpuBudget = 2;
+    options.parseStage = [](const std::string &profPath) {
+        WriteFile(File::PathJoin({profPath, "parsed"}), 1);
+        return true;
+    };
+    // 子进程中的导出结果通过文件返回，PROF_3导出失败
+    options.exportStage = [](const std::string &profPath) {
+        WriteFile(File::PathJoin({profPath, "exported"}), 1);
+        return File::BaseName(profPath) != "PROF_3";
+    };
+    BatchExportScheduler scheduler(profPaths, options);
+    EXPECT_FALSE(scheduler.Run());
+    for (const auto &job : scheduler.GetJobs()) {
+        EXPECT_TRUE(File::Exist(File::PathJoin({job.profPath, "parsed"})));
+        EXPECT_TRUE(File::Exist(File::PathJoin({job.profPath, "exported"})));
+        EXPECT_EQ(job.rankIndex != 3, job.success);
+    }
+}
+
+TEST_F(BatchExportSchedulerUTest, ShouldNotReapChildProcessStartedByCaller)
+{
+    const int foreignExitCode = 7;
+    pid_t foreign = fork();
+    if (foreign == 0) {
+        _exit(foreignExitCode);
+    }
+    ASSERT_GT(foreign, 0);
+    BatchExportOptions options;
+    options.parseStage = [](const std::string &) { return true; };
+    options.exportStage = [](const std::string &) { return true; };
+    BatchExportScheduler scheduler({CreateProf("PROF_0", 1, 10)}, options);
+    EXPECT_TRUE(scheduler.Run());
+    // 调用方自己的子进程仍由调用方回收
+    int status = 0;
+    ASSERT_EQ(foreign, waitpid(foreign, &status, 0));
+    EXPECT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(foreignExitCode, WEXITSTATUS(status));
+}
+
+TEST_F(BatchExportSchedulerUTest, ShouldMergeCommunicationOpOfAllRanksWithStringValues)
+{
+    auto rank0 = CreateProf("PROF_0", 1, 10);
+    auto rank1 = CreateProf("PROF_1", 1, 20);
+    // 两个rank的STRING_IDS编号不同，合并后均还原为字符串
+    CreateMsprofDB(rank0, {{0, "hcom_allReduce__1"}, {1, "group_a"}, {2, "RING"}, {3, "hcom_allReduce_"}},
+                   {{0, 100, 200, 1, 1, 0, 0, 0, 1, 2, 8.0, 3, 0, 2}});
+    CreateMsprofDB(rank1, {{7, "group_a"}, {8, "hcom_allReduce__1"}, {9, "RING"}, {10, "hcom_allReduce_"}},
+                   {{8, 110, 210, 2, 7, 0, 0, 0, 1, 9, 8.0, 10, 1, 2},
+                    {8, 300, 400, 3, 7, 1, 0, 0, 1, 9, 8.0, 10, 1, 2}});
+    BatchExportOptions options;
+    options.exportStage = [](const std::string &) { return true; };
+    options.mergedOutputPath = BASE_PATH;
+    BatchExportScheduler scheduler({rank0, rank1}, options);
+    EXPECT_TRUE(scheduler.Run());
+    ASSERT_TRUE(File::Exist(scheduler.GetMergedDBPath()));
+    DBRunner runner(scheduler.GetMergedDBPath());
+    MergedFormat result;
+    EXPECT_TRUE(runner.QueryData("SELECT rankIndex, profPath, opName, startNs, groupName, deviceId FROM "
+                                 "CLUSTER_COMMUNICATION_OP ORDER BY rankIndex, startNs", result));
+    MergedFormat expect{{0, rank0, "hcom_allReduce__1", 100, "group_a", 0},
+                        {1, rank1, "hcom_allReduce__1", 110, "group_a", 1},
+                        {1, rank1, "hcom_allReduce__1", 300, "group_a", 1}};
+    EXPECT_EQ(expect, result);
+}
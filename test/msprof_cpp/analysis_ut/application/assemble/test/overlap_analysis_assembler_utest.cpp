@@ -142,3 +142,14 @@ TEST_F(OverlapAnalysisAssemblerUTest, RunShouldNotDumpFileWhenOverlapDataIsEmpty
     auto files = File::GetOriginData(RESULT_PATH, {"msprof"}, {});
     EXPECT_TRUE(files.empty());
 }
+
+TEST_F(OverlapAnalysisAssemblerUTest, RunShouldNotDumpFileWhenOverlapDataNotExist)
+{
+    DataInventory dataInventory;
+
+    OverlapAnalysisAssembler assembler;
+    EXPECT_TRUE(assembler.Run(dataInventory, PROF_PATH));
+
+    auto files = File::GetOriginData(RESULT_PATH, {"msprof"}, {});
+    EXPECT_TRUE(files.empty());
+}
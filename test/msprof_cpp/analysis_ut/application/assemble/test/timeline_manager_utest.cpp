@@ -17,6 +17,7 @@
 #include "gtest/gtest.h"
 #include "mockcpp/mockcpp.hpp"
 #include "analysis/csrc/application/timeline/timeline_manager.h"
+#include "analysis/csrc/application/database/db_constant.h"
 #include "analysis/csrc/application/timeline/json_constant.h"
 #include "analysis/csrc/domain/entities/viewer_data/ai_task/include/step_trace_data.h"
 #include "analysis/csrc/domain/entities/viewer_data/ai_task/include/msprof_tx_host_data.h"
@@ -126,3 +127,26 @@ TEST_F(TimelineManagerUTest, ShouldReturnFalseWhenProcessTimeLineGetAssemblerByN
     EXPECT_FALSE(manager.Run(dataInventory_, jsonProcess));
     MOCKER_CPP(&TimelineFactory::GetAssemblerByName).reset();
 }
+
+TEST_F(TimelineManagerUTest, ShouldOnlyReturnDependentProcessorsWhenGetProcessList)
+{
+    std::vector<JsonProcess> jsonProcess = {JsonProcess::HBM, JsonProcess::CANN};
+    std::set<std::string> expect = {PROCESSOR_NAME_HBM, PROCESSOR_NAME_API, PROCESSOR_NAME_TASK,
+                                    PROCESSOR_NAME_STEP_TRACE, PROCESSOR_NAME_MSTX};
+    EXPECT_EQ(expect, TimelineManager::GetProcessList(jsonProcess));
+    // 全部json进程也不会计算timeline不读取的数据
+    auto processList = TimelineManager::GetProcessList(allProcesses);
+    EXPECT_EQ(1ul, processList.count(PROCESSOR_NAME_NIC_TIMELINE));
+    EXPECT_EQ(0ul, processList.count(PROCESSOR_NAME_NIC));
+    EXPECT_EQ(0ul, processList.count(PROCESSOR_NAME_NPU_OP_MEM));
+}
+
+TEST_F(TimelineManagerUTest, ShouldReturnOverlapProcessorAndItsInputsWhenGetProcessListWithOverlap)
+{
+    std::vector<JsonProcess> jsonProcess = {JsonProcess::OVERLAP_ANALYSE};
+    auto processList = TimelineManager::GetProcessList(jsonProcess);
+    for (const auto &name : {PROCESSOR_NAME_OVERLAP_ANALYSIS, PROCESSOR_NAME_TASK, PROCESSOR_NAME_COMPUTE_TASK_INFO,
+                             PROCESSOR_NAME_COMMUNICATION, PROCESSOR_NAME_KFC_COMM, PROCESSOR_MC2_COMM_INFO}) {
+        EXPECT_EQ(1ul, processList.count(name));
+    }
+}
@@ -17,6 +17,7 @@
 #include "gtest/gtest.h"
 #include "mockcpp/mockcpp.hpp"
 #include "analysis/csrc/application/summary/summary_manager.h"
+#include "analysis/csrc/application/database/db_constant.h"
 #include "analysis/csrc/application/summary/summary_factory.h"
 
 using namespace Analysis::Application;
@@ -65,4 +66,12 @@ TEST_F(SummaryManagerUTest, ShouldReturnFalseWhenGetAssemblerFailed)
     MOCKER_CPP(&SummaryFactory::GetAssemblerByName).stubs().will(returnValue(assembler));
     EXPECT_FALSE(manager.Run(dataInventory_));
     MOCKER_CPP(&SummaryFactory::GetAssemblerByName).reset();
-}
\ No newline at end of file
+}
+TEST_F(SummaryManagerUTest, ShouldOnlyReturnDependentProcessorsWhenGetProcessList)
+{
+    auto processList = SummaryManager::GetProcessList();
+    EXPECT_EQ(1ul, processList.count(PROCESSOR_PMU));
+    EXPECT_EQ(1ul, processList.count(PROCESSOR_HOST_TASK));
+    EXPECT_EQ(0ul, processList.count(PROCESSOR_NAME_HBM));
+    EXPECT_EQ(0ul, processList.count(PROCESSOR_NAME_MSTX));
+}
@@ -167,5 +167,39 @@ TEST_F(AscendTaskAssociationUTest, TestProcessEntrySetStreamIdSuccessWhenStreamI
     auto result = dataInventory_.GetPtr<std::vector<TopDownTask>>();
     ASSERT_EQ(deviceDataS->begin()->first.streamId, 100);
 }
+
+TEST_F(AscendTaskAssociationUTest, ShouldOutputInTaskIdOrderWhenFilledStreamIdBreaksDeviceKeyOrder)
+{
+    AscendTaskAssociation association;
+    DeviceContext context;
+    context.deviceContextInfo.deviceInfo.chipID = 15;  // 15: 需要回填streamId的芯片
+    const uint16_t filledStreamId = 7;
+    auto hostDataS = dataInventory_.GetPtr<std::map<TaskId, std::vector<HostTask>>>();
+    auto deviceDataS = dataInventory_.GetPtr<std::map<TaskId, std::vector<DeviceTask>>>();
+    // 回填前device键按streamId有序，回填后streamId相同，contextId 5排在3之前；taskId 0只有device侧
+    (*deviceDataS)[{1, 0, 1, 5}].emplace_back();
+    (*deviceDataS)[{2, 0, 1, 3}].emplace_back();
+    (*deviceDataS)[{3, 0, 0, 0}].emplace_back();
+    dataInventory_.GetPtr<StreamIdInfo>()->streamIdMap.emplace(1, filledStreamId);
+    for (uint32_t contextId : {5u, 3u}) {
+        auto &hosts = (*hostDataS)[{filledStreamId, 0, 1, contextId}];
+        hosts.emplace_back();
+        hosts.back().taskId = 1;
+        hosts.back().contextId = contextId;
+        hosts.back().connection_id = contextId;
+    }
+    (*hostDataS)[{filledStreamId, 0, 2, 0}].emplace_back();
+    (*hostDataS)[{filledStreamId, 0, 2, 0}].back().taskId = 2;  // 2: 只有host侧的taskId
+    ASSERT_EQ(ANALYSIS_OK, association.Run(dataInventory_, context));
+    auto result = dataInventory_.GetPtr<std::vector<TopDownTask>>();
+    ASSERT_EQ(4ul, result->size());
+    std::vector<std::pair<uint32_t, uint32_t>> expectIds{{0, 0}, {1, 3}, {1, 5}, {2, 0}};
+    for (size_t i = 0; i < expectIds.size(); ++i) {
+        EXPECT_EQ(expectIds[i].first, result->at(i).taskId);
+        EXPECT_EQ(expectIds[i].second, result->at(i).contextId);
+    }
+    EXPECT_EQ(3, result->at(1).connectionId);
+    EXPECT_EQ(5, result->at(2).connectionId);
+}
 }
 }
\ No newline at end of file
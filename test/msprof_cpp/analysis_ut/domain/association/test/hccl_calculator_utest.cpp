@@ -13,6 +13,7 @@
  * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
  * See the Mulan PSL v2 for more details.
  * -------------------------------------------------------------------------*/
+#include <map>
 #include <gtest/gtest.h>
 #include "analysis/csrc/domain/services/association/calculator/hccl/include/hccl_calculator.h"
 #include "analysis/csrc/infrastructure/dfx/error_code.h"
@@ -344,4 +345,48 @@ TEST_F(HcclCalculatorUTest, TestGetHcclStatisticsDataShouldBeFilteredWhenProcess
     auto hcclStatisticsData = dataInventory_.GetPtr<std::vector<HcclStatistics>>();
     size_t expectStatisticsDataNum = 5;
     EXPECT_EQ(expectStatisticsDataNum, hcclStatisticsData->size());
-}
\ No newline at end of file
+}
+TEST_F(HcclCalculatorUTest, TestUpdateHcclBandwidthShouldEqualSerialResultWhenManyPlanes)
+{
+    const size_t opNum = 200;
+    const int32_t planeNum = 4;
+    const size_t taskNumPerPlane = 12;
+    // payload、notify交替出现，覆盖连续payload和缺少闭合task的场景
+    const std::vector<std::string> rdmaTypes = {
+        "RDMA_SEND_NOTIFY", "RDMA_SEND_PAYLOAD", "RDMA_SEND_PAYLOAD", "RDMA_SEND_NOTIFY", "INVALID_TYPE",
+        "RDMA_SEND_NOTIFY", "RDMA_SEND_PAYLOAD", "INVALID_TYPE", "RDMA_SEND_NOTIFY", "RDMA_SEND_NOTIFY",
+        "INVALID_TYPE", "RDMA_SEND_PAYLOAD",
+    };
+    HcclCalculator calculator;
+    double timestamp = 0;
+    for (size_t i = 0; i < taskNumPerPlane; ++i) {
+        for (size_t op = 0; op < opNum; ++op) {
+            for (int32_t plane = 0; plane < planeNum; ++plane) {
+                DeviceHcclTask task;
+                task.opName = (op % 2 == 0 ? "hcom_send_" : "hcom_allReduce_") + std::to_string(op);
+                task.planeId = plane;
+                task.rdmaType = rdmaTypes[i];
+                task.timestamp = ++timestamp;
+                task.duration = static_cast<double>(i + plane + 1);
+                task.size = static_cast<double>(op + i * 10);
+                calculator.taskData_.emplace_back(task);
+            }
+        }
+    }
+    // 串行基准：逐个(opName, planeId)按时间顺序计算
+    std::vector<DeviceHcclTask> expectTasks = calculator.taskData_;
+    std::map<std::pair<std::string, int32_t>, std::vector<DeviceHcclTask*>> planes;
+    for (auto& task : expectTasks) {
+        planes[std::make_pair(task.opName, task.planeId)].push_back(&task);
+    }
+    for (auto& plane : planes) {
+        calculator.CalculateTaskBandwidth(plane.second, 0, plane.second.size());
+    }
+
+    calculator.UpdateHcclBandwidth();
+    ASSERT_EQ(expectTasks.size(), calculator.taskData_.size());
+    for (size_t i = 0; i < expectTasks.size(); ++i) {
+        EXPECT_EQ(expectTasks[i].opName, calculator.taskData_[i].opName);
+        EXPECT_DOUBLE_EQ(expectTasks[i].bandwidth, calculator.taskData_[i].bandwidth);
+    }
+}
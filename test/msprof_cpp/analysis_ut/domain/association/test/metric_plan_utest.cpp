@@ -0,0 +1,106 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#include <gtest/gtest.h>
+#include "analysis/csrc/domain/services/association/calculator/metric/metric_plan.h"
+
+using namespace Analysis::Domain;
+
+namespace {
+const std::vector<uint32_t> EVENTS{0x8, 0x9, 0x54, 0x55};
+const uint64_t FREQ = 1000000000;
+
+// 3行数据：正常、taskCyc为0、0x54计数为0
+PmuColumns GenerateColumns()
+{
+    PmuColumns columns;
+    columns.rows = 3;
+    columns.counters = {{100, 100, 100}, {300, 300, 300}, {20, 20, 0}, {5, 5, 5}};
+    columns.taskCyc = {1000, 0, 1000};
+    columns.totalTime = {10.0, 10.0, 10.0};
+    columns.bwFreq = FREQ;
+    return columns;
+}
+}
+
+TEST(MetricPlanUTest, ShouldCalculateByColumnsWithZeroMasks)
+{
+    MetricCoefficients coefs{{1.0, 1.0, 0.5, 1.0, 1.0}, {}, {}, {}, {}};
+    MetricPlan plan;
+    EXPECT_TRUE(plan.AddMetric(MetricKernel::ADDITIONS, {0x8, 0x9}, EVENTS, coefs, 0));
+    EXPECT_TRUE(plan.AddMetric(MetricKernel::TIME_BY_MULTIPLICATION, {0x8}, EVENTS, coefs, 1));
+    EXPECT_TRUE(plan.AddMetric(MetricKernel::WITHOUT_CYC_BY_SUB, {0x9, 0x8}, EVENTS, coefs, 2));
+    EXPECT_TRUE(plan.AddMetric(MetricKernel::DIVISION, {0x55, 0x54}, EVENTS, coefs, 3));
+    EXPECT_TRUE(plan.AddMetric(MetricKernel::NOTHING, {0x8, 0x9}, EVENTS, coefs, 4));
+    EXPECT_EQ(5ul, plan.MetricNum());
+
+    std::vector<std::vector<double>> res;
+    ASSERT_TRUE(plan.Evaluate(GenerateColumns(), res));
+    ASSERT_EQ(5ul, res.size());
+    EXPECT_EQ(std::vector<double>({0.4, 0.0, 0.4}), res[0]);
+    EXPECT_EQ(std::vector<double>({1.0, 0.0, 1.0}), res[1]);
+    // 不依赖taskCyc的指标不受掩码影响
+    EXPECT_EQ(std::vector<double>({100.0, 100.0, 100.0}), res[2]);
+    // 任一寄存器为0时结果为0
+    EXPECT_EQ(std::vector<double>({0.25, 0.0, 0.0}), res[3]);
+    EXPECT_EQ(std::vector<double>({400.0, 400.0, 400.0}), res[4]);
+}
+
+TEST(MetricPlanUTest, ShouldCalculateBandwidthAndFops)
+{
+    MetricCoefficients coefs{{1.0, 1.0}, {256.0}, {4.0}, {8192}, {}};
+    MetricPlan plan;
+    EXPECT_TRUE(plan.AddMetric(MetricKernel::ADDITIONS_WITH_FREQ, {0x8}, EVENTS, coefs, 0));
+    EXPECT_TRUE(plan.AddMetric(MetricKernel::CUBE_FOPS, {0x8}, EVENTS, coefs, 1));
+    auto columns = GenerateColumns();
+    std::vector<std::vector<double>> res;
+    ASSERT_TRUE(plan.Evaluate(columns, res));
+    double bw = 1.0 * 100 * 256.0 * 4.0 / (1000 / static_cast<double>(FREQ)) / OFFSET;
+    EXPECT_EQ(std::vector<double>({bw, 0.0, bw}), res[0]);
+    EXPECT_EQ(std::vector<double>({819200.0, 0.0, 819200.0}), res[1]);
+
+    // 频率为0时带宽为0
+    columns.bwFreq = 0;
+    ASSERT_TRUE(plan.Evaluate(columns, res));
+    EXPECT_EQ(std::vector<double>({0.0, 0.0, 0.0}), res[0]);
+}
+
+TEST(MetricPlanUTest, ShouldTreatMissingRegisterAsZero)
+{
+    MetricCoefficients coefs{{1.0, 1.0}, {}, {}, {}, {}};
+    MetricPlan plan;
+    EXPECT_TRUE(plan.AddMetric(MetricKernel::ADDITIONS, {0x8, 0x100}, EVENTS, coefs, 0));
+    EXPECT_TRUE(plan.AddMetric(MetricKernel::DIVISION, {0x8, 0x100}, EVENTS, coefs, 1));
+    std::vector<std::vector<double>> res;
+    ASSERT_TRUE(plan.Evaluate(GenerateColumns(), res));
+    EXPECT_EQ(std::vector<double>({0.1, 0.0, 0.1}), res[0]);
+    EXPECT_EQ(std::vector<double>({0.0, 0.0, 0.0}), res[1]);
+}
+
+TEST(MetricPlanUTest, ShouldReturnFalseWhenCoefficientsInvalid)
+{
+    MetricCoefficients coefs{{1.0}, {}, {}, {8192}, {}};
+    MetricPlan plan;
+    EXPECT_FALSE(plan.AddMetric(MetricKernel::ADDITIONS, {0x8}, EVENTS, coefs, 1));
+    EXPECT_FALSE(plan.AddMetric(MetricKernel::ADDITIONS_WITH_FREQ, {0x8}, EVENTS, coefs, 0));
+    // 系数个数小于寄存器个数时该指标为0
+    EXPECT_TRUE(plan.AddMetric(MetricKernel::CUBE_FOPS, {0x8, 0x9}, EVENTS, coefs, 0));
+    std::vector<std::vector<double>> res;
+    ASSERT_TRUE(plan.Evaluate(GenerateColumns(), res));
+    EXPECT_EQ(std::vector<double>({0.0, 0.0, 0.0}), res[0]);
+    plan.Clear();
+    EXPECT_EQ(0ul, plan.MetricNum());
+}
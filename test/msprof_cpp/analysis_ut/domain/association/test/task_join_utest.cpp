@@ -0,0 +1,181 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+#include <map>
+#include <random>
+#include <gtest/gtest.h>
+#include "analysis/csrc/domain/valueobject/include/task_join.h"
+
+using namespace Analysis::Domain;
+
+namespace {
+struct Row {
+    Row() = default;
+    Row(const TaskId &_id, uint64_t _time = 0) : id(_id), time(_time) {}
+    TaskId id;
+    uint64_t time = 0;
+};
+
+TaskKey KeyOf(const Row &row)
+{
+    return PackTaskKey(row.id);
+}
+
+// 以std::map为参照的全外连接结果：键 -> (left行号, right行号)
+using JoinResult = std::map<TaskId, std::pair<std::vector<size_t>, std::vector<size_t>>>;
+
+JoinResult ReferenceJoin(const std::vector<Row> &left, const std::vector<Row> &right)
+{
+    JoinResult result;
+    for (size_t i = 0; i < left.size(); ++i) {
+        result[left[i].id].first.push_back(i);
+    }
+    for (size_t i = 0; i < right.size(); ++i) {
+        result[right[i].id].second.push_back(i);
+    }
+    return result;
+}
+
+JoinResult RunJoin(const std::vector<Row> &left, const std::vector<Row> &right, std::vector<TaskId> &order)
+{
+    JoinResult result;
+    EXPECT_TRUE(TaskJoin::Join(left, right, KeyOf, KeyOf,
+        [&result, &order](const TaskKey &key, const JoinRows &leftRows, const JoinRows &rightRows) {
+            auto id = UnpackTaskKey(key);
+            EXPECT_TRUE(result.find(id) == result.end());
+            result[id].first.assign(leftRows.begin, leftRows.end);
+            result[id].second.assign(rightRows.begin, rightRows.end);
+            order.push_back(id);
+        }));
+    return result;
+}
+
+std::vector<Row> RandomRows(size_t num, uint32_t keyRange, std::mt19937 &gen)
+{
+    std::uniform_int_distribution<uint32_t> dist(0, keyRange);
+    std::vector<Row> rows(num);
+    for (auto &row : rows) {
+        uint32_t value = dist(gen);
+        row.id = TaskId(static_cast<uint16_t>(value % 7), static_cast<uint16_t>(value % 3), value / 3,
+                        (value % 5 == 0) ? INVALID_CONTEXT_ID : value % 5, static_cast<uint16_t>(value % 2));
+    }
+    return rows;
+}
+}
+
+class TaskJoinUTest : public testing::Test {};
+
+TEST_F(TaskJoinUTest, PackTaskKeyShouldKeepTaskIdOrderAndRoundTrip)
+{
+    std::vector<TaskId> ids = {
+        {1, 0, 10, INVALID_CONTEXT_ID, 0}, {0, 0, 11, 0, 0}, {1, 1, 10, 0, 0}, {1, 0, 10, 0, 0},
+        {65535, 65535, UINT32_MAX, UINT32_MAX, 65535}, {2, 0, 10, 0, 1}, {0, 0, 0, 0, 0}
+    };
+    for (const auto &lhs : ids) {
+        EXPECT_TRUE(UnpackTaskKey(PackTaskKey(lhs)) == lhs);
+        for (const auto &rhs : ids) {
+            EXPECT_EQ(lhs < rhs, PackTaskKey(lhs) < PackTaskKey(rhs));
+            EXPECT_EQ(lhs == rhs, PackTaskKey(lhs) == PackTaskKey(rhs));
+        }
+    }
+}
+
+TEST_F(TaskJoinUTest, JoinShouldMergeInKeyOrderWhenInputsSorted)
+{
+    std::vector<Row> left = {{{1, 0, 1, 0}}, {{1, 0, 2, 0}}, {{1, 0, 2, 0}}, {{1, 0, 4, 0}}};
+    std::vector<Row> right = {{{1, 0, 2, 0}}, {{1, 0, 3, 0}}, {{1, 0, 4, 0}}, {{1, 0, 4, 0}}, {{1, 0, 5, 0}}};
+    std::vector<TaskId> order;
+    auto result = RunJoin(left, right, order);
+    EXPECT_EQ(ReferenceJoin(left, right), result);
+    ASSERT_EQ(5ul, order.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        EXPECT_EQ(i + 1, order[i].taskId);
+    }
+}
+
+TEST_F(TaskJoinUTest, JoinShouldVisitLeftFirstAppearanceThenRightOnlyWhenInputsUnsorted)
+{
+    std::vector<Row> left = {{{1, 0, 9, 0}}, {{1, 0, 2, 0}}, {{1, 0, 9, 0}}};
+    std::vector<Row> right = {{{1, 0, 7, 0}}, {{1, 0, 2, 0}}, {{1, 0, 6, 0}}, {{1, 0, 7, 0}}};
+    std::vector<TaskId> order;
+    auto result = RunJoin(left, right, order);
+    EXPECT_EQ(ReferenceJoin(left, right), result);
+    std::vector<uint32_t> expectOrder = {9, 2, 7, 6};
+    ASSERT_EQ(expectOrder.size(), order.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        EXPECT_EQ(expectOrder[i], order[i].taskId);
+    }
+}
+
+TEST_F(TaskJoinUTest, JoinShouldMatchMapResultWhenDataIsLargeAndPartitioned)
+{
+    std::mt19937 gen(1);
+    auto left = RandomRows(50000, 30000, gen);
+    auto right = RandomRows(40000, 30000, gen);
+    std::vector<TaskId> order;
+    EXPECT_EQ(ReferenceJoin(left, right), RunJoin(left, right, order));
+    std::sort(left.begin(), left.end(), [](const Row &lhs, const Row &rhs) { return lhs.id < rhs.id; });
+    std::sort(right.begin(), right.end(), [](const Row &lhs, const Row &rhs) { return lhs.id < rhs.id; });
+    order.clear();
+    EXPECT_EQ(ReferenceJoin(left, right), RunJoin(left, right, order));
+    EXPECT_TRUE(std::is_sorted(order.begin(), order.end()));
+}
+
+TEST_F(TaskJoinUTest, JoinShouldVisitNothingWhenBothSidesEmpty)
+{
+    std::vector<Row> empty;
+    std::vector<TaskId> order;
+    EXPECT_TRUE(RunJoin(empty, empty, order).empty());
+    TaskKeyIndex index;
+    EXPECT_TRUE(index.Find(PackTaskKey(TaskId())).Empty());
+    EXPECT_TRUE(index.Build({}));
+    EXPECT_EQ(INVALID_JOIN_ROW, index.FindGroup(PackTaskKey(TaskId())));
+}
+
+TEST_F(TaskJoinUTest, MergeJoinShouldWorkOnOrderedMap)
+{
+    std::map<TaskId, int> host = {{{1, 0, 1, 0}, 1}, {{1, 0, 3, 0}, 3}};
+    std::map<TaskId, int> device = {{{1, 0, 2, 0}, 2}, {{1, 0, 3, 0}, 30}};
+    using It = std::map<TaskId, int>::const_iterator;
+    std::vector<std::pair<int, int>> result;
+    auto keyOf = [](const std::pair<const TaskId, int> &entry) { return PackTaskKey(entry.first); };
+    TaskJoin::MergeJoin(host.cbegin(), host.cend(), device.cbegin(), device.cend(), keyOf, keyOf,
+        [&result](const TaskKey &, It hostBegin, It hostEnd, It deviceBegin, It deviceEnd) {
+            result.emplace_back(hostBegin == hostEnd ? -1 : hostBegin->second,
+                                deviceBegin == deviceEnd ? -1 : deviceBegin->second);
+        });
+    std::vector<std::pair<int, int>> expect = {{1, -1}, {-1, 2}, {3, 30}};
+    EXPECT_EQ(expect, result);
+}
+
+TEST_F(TaskJoinUTest, AsOfJoinShouldMatchLatestRowWithinWindow)
+{
+    std::vector<Row> right = {
+        {{1, 0, 1, 0}, 100}, {{1, 0, 1, 0}, 50}, {{1, 0, 1, 0}, 200}, {{1, 0, 2, 0}, 100}
+    };
+    std::vector<Row> left = {
+        {{1, 0, 1, 0}, 120},  // 匹配time=100
+        {{1, 0, 1, 0}, 40},   // 早于所有同键行
+        {{1, 0, 1, 0}, 200},  // 时间相等也匹配
+        {{1, 0, 2, 0}, 200},  // 超出窗口
+        {{1, 0, 3, 0}, 200},  // 无同键行
+    };
+    std::vector<size_t> matched;
+    auto timeOf = [](const Row &row) { return row.time; };
+    EXPECT_TRUE(TaskJoin::AsOfJoin(left, right, KeyOf, KeyOf, timeOf, timeOf, static_cast<uint64_t>(50),
+        [&matched](size_t, size_t rightRow) { matched.push_back(rightRow); }));
+    std::vector<size_t> expect = {0, INVALID_JOIN_ROW, 2, INVALID_JOIN_ROW, INVALID_JOIN_ROW};
+    EXPECT_EQ(expect, matched);
+}
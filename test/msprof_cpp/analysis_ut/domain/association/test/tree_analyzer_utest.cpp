@@ -952,7 +952,7 @@ std::shared_ptr<TreeAnalyzer> GetAnalyzerForScenarioEmptyPath()
 TEST_F(TreeAnalyzerUTest, TestTreeAnalyzerGenComputeHostTasks)
 {
     auto ana = GetAnalyzerForScenarioEmptyPath();
-    std::unordered_map<std::string, std::shared_ptr<Operator>> ops{};
+    ComputeOpDescs ops{};
     
     HostTasks ht = ana -> GenComputeHostTasks(ops, nullptr, 0);
     EXPECT_EQ(ht, HostTasks{});
@@ -18,6 +18,7 @@
 #include "analysis/csrc/domain/data_process/system/acc_pmu_processor.h"
 #include "analysis/csrc/domain/services/environment/context.h"
 #include "analysis/csrc/application/database/db_constant.h"
+#include "analysis/csrc/infrastructure/db/include/column_file.h"
 #include "reserve_mock_utils.h"
 
 using namespace Analysis::Utils;
@@ -25,6 +26,7 @@ using namespace Analysis::Domain;
 using namespace Analysis::Application;
 using namespace Analysis::Domain::Environment;
 using namespace Analysis::Test;
+using namespace Analysis::Infra;
 namespace {
 const int DEPTH = 0;
 const std::string BASE_PATH = "./acc_path";
@@ -33,6 +35,9 @@ const std::string DB_NAME = "acc_pmu.db";
 const std::string PROF_PATH_A = File::PathJoin({BASE_PATH, "./PROF_0"});
 const std::string TABLE_NAME = "AccPmu";
 OriAccPmuData ACC_PMU_DATA{{1, 0, 0, 0, 0, 236368325745670}, {5, 0, 0, 0, 0, 236368325747550}};
+// 写入顺序与timestamp、acc_id升序不一致
+OriAccPmuData UNSORTED_ACC_PMU_DATA{{3, 30, 0, 0, 0, 236368325747550}, {2, 20, 0, 0, 0, 236368325745670},
+                                    {1, 10, 0, 0, 0, 236368325747550}, {4, 40, 0, 0, 0, 236368325745670.5}};
 }
 
 class AccPmuProcessorUTest : public testing::Test {
@@ -140,3 +145,49 @@ TEST_F(AccPmuProcessorUTest, ShouldReturnFalseWhenReserveException)
     EXPECT_FALSE(processor.Run(dataInventory, PROCESSOR_NAME_ACC_PMU));
     ResetReserveFailureForVector<std::vector<AccPmuData>>();
 }
+
+TEST_F(AccPmuProcessorUTest, ShouldKeepSameOrderWhenLoadFromColumnFile)
+{
+    nlohmann::json record = {
+        {"startCollectionTimeBegin", "1701069324370978"},
+        {"endCollectionTimeEnd", "1701069338159976"},
+        {"startClockMonotonicRaw", "36471129942580"},
+        {"pid", "10"},
+        {"hostCntvct", "65177261204177"},
+        {"CPU", {{{"Frequency", "100.000000"}}}},
+        {"hostMonotonic", "651599377155020"},
+    };
+    MOCKER_CPP(&Analysis::Domain::Environment::Context::GetInfoByDeviceId).stubs().will(returnValue(record));
+    const std::string profPath = File::PathJoin({BASE_PATH, "PROF_COLUMN"});
+    const std::string sqlitePath = File::PathJoin({profPath, DEVICE, SQLITE});
+    const std::string dbPath = File::PathJoin({sqlitePath, DB_NAME});
+    EXPECT_TRUE(File::CreateDir(profPath));
+    EXPECT_TRUE(File::CreateDir(File::PathJoin({profPath, DEVICE})));
+    EXPECT_TRUE(File::CreateDir(sqlitePath));
+    CreateAccPmuMetricData(dbPath, UNSORTED_ACC_PMU_DATA);
+    DataInventory sqliteInventory;
+    EXPECT_TRUE(AccPmuProcessor(profPath).Run(sqliteInventory, PROCESSOR_NAME_ACC_PMU));
+    auto sqliteRes = sqliteInventory.GetPtr<std::vector<AccPmuData>>();
+
+    // 只保留列式文件，读取失败时会回退到不存在的sqlite而得不到数据
+    std::vector<std::string> colNames;
+    for (const auto &col : AccPmuDB().GetTableCols(TABLE_NAME)) {
+        colNames.emplace_back(col.name);
+    }
+    ColumnFileWriter writer(GetColumnFilePath(dbPath, TABLE_NAME));
+    EXPECT_TRUE(writer.Append(colNames, UNSORTED_ACC_PMU_DATA));
+    EXPECT_TRUE(File::DeleteFile(dbPath));
+    DataInventory columnInventory;
+    EXPECT_TRUE(AccPmuProcessor(profPath).Run(columnInventory, PROCESSOR_NAME_ACC_PMU));
+    auto columnRes = columnInventory.GetPtr<std::vector<AccPmuData>>();
+
+    ASSERT_EQ(UNSORTED_ACC_PMU_DATA.size(), sqliteRes->size());
+    ASSERT_EQ(sqliteRes->size(), columnRes->size());
+    const std::vector<uint16_t> expectAccIds{2, 4, 1, 3};
+    for (size_t i = 0; i < sqliteRes->size(); ++i) {
+        EXPECT_EQ(expectAccIds[i], sqliteRes->at(i).accId);
+        EXPECT_EQ(sqliteRes->at(i).accId, columnRes->at(i).accId);
+        EXPECT_EQ(sqliteRes->at(i).timestamp, columnRes->at(i).timestamp);
+        EXPECT_EQ(sqliteRes->at(i).readBwLevel, columnRes->at(i).readBwLevel);
+    }
+}
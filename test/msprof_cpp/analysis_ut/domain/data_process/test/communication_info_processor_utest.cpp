@@ -24,6 +24,7 @@
 #include "analysis/csrc/application/database/db_constant.h"
 #include "analysis/csrc/domain/services/environment/context.h"
 #include "analysis/csrc/infrastructure/data_inventory/include/data_inventory.h"
+#include "analysis/csrc/infrastructure/db/include/column_file.h"
 #include "reserve_mock_utils.h"
 
 using namespace Analysis::Domain;
@@ -31,6 +32,7 @@ using namespace Analysis::Application::Credential;
 using namespace Analysis::Utils;
 using namespace Domain::Environment;
 using namespace Analysis::Test;
+using namespace Analysis::Infra;
 namespace {
 const int DEPTH = 0;
 const uint16_t OP_NUM = 4;
@@ -269,6 +271,61 @@ TEST_F(CommunicationInfoProcessorUTest, TestRunShouldReturnTrueWhenProcessorRunS
     CheckStringId(taskRes);
 }
 
+TEST_F(CommunicationInfoProcessorUTest, TestRunShouldKeepSameResultWhenLoadFromColumnFile)
+{
+    std::string processorName = "COMMUNICATION_TASK_INFO";
+    GeHashMap geHashMap = {{"key1", "value1"}};
+    std::shared_ptr<GeHashMap> geHashMapPtr;
+    MAKE_SHARED0_NO_OPERATION(geHashMapPtr, GeHashMap, std::move(geHashMap));
+    DataInventory sqliteInventory;
+    sqliteInventory.Inject(geHashMapPtr);
+    EXPECT_TRUE(CommunicationInfoProcessor(PROF_PATH_B).Run(sqliteInventory, processorName));
+    auto sqliteTask = sqliteInventory.GetPtr<std::vector<CommunicationTaskData>>();
+    auto sqliteOp = sqliteInventory.GetPtr<std::vector<CommunicationOpData>>();
+
+    // 只保留列式文件，读取失败时会回退到不存在的sqlite而得不到数据
+    auto dbPath = File::PathJoin({PROF_PATH_B, DEVICE_SUFFIX, SQLITE, DB_SUFFIX});
+    HCCLSingleDeviceDB database;
+    std::vector<std::string> taskCols;
+    for (const auto &col : database.GetTableCols(TASK_TABLE_NAME)) {
+        taskCols.emplace_back(col.name);
+    }
+    std::vector<std::string> opCols;
+    for (const auto &col : database.GetTableCols(OP_TABLE_NAME)) {
+        opCols.emplace_back(col.name);
+    }
+    ColumnFileWriter taskWriter(GetColumnFilePath(dbPath, TASK_TABLE_NAME));
+    EXPECT_TRUE(taskWriter.Append(taskCols, DATA_B));
+    ColumnFileWriter opWriter(GetColumnFilePath(dbPath, OP_TABLE_NAME));
+    EXPECT_TRUE(opWriter.Append(opCols, DATA_OP_B));
+    EXPECT_TRUE(File::DeleteFile(dbPath));
+    DataInventory columnInventory;
+    columnInventory.Inject(geHashMapPtr);
+    EXPECT_TRUE(CommunicationInfoProcessor(PROF_PATH_B).Run(columnInventory, processorName));
+    auto columnTask = columnInventory.GetPtr<std::vector<CommunicationTaskData>>();
+    auto columnOp = columnInventory.GetPtr<std::vector<CommunicationOpData>>();
+
+    ASSERT_FALSE(sqliteTask->empty());
+    ASSERT_EQ(sqliteTask->size(), columnTask->size());
+    for (size_t i = 0; i < sqliteTask->size(); ++i) {
+        EXPECT_EQ(sqliteTask->at(i).opName, columnTask->at(i).opName);
+        EXPECT_EQ(sqliteTask->at(i).taskType, columnTask->at(i).taskType);
+        EXPECT_EQ(sqliteTask->at(i).timestamp, columnTask->at(i).timestamp);
+        EXPECT_EQ(sqliteTask->at(i).srcRank, columnTask->at(i).srcRank);
+        EXPECT_EQ(sqliteTask->at(i).dstRank, columnTask->at(i).dstRank);
+        EXPECT_EQ(sqliteTask->at(i).dataType, columnTask->at(i).dataType);
+    }
+    ASSERT_FALSE(sqliteOp->empty());
+    ASSERT_EQ(sqliteOp->size(), columnOp->size());
+    for (size_t i = 0; i < sqliteOp->size(); ++i) {
+        EXPECT_EQ(sqliteOp->at(i).opName, columnOp->at(i).opName);
+        EXPECT_EQ(sqliteOp->at(i).connectionId, columnOp->at(i).connectionId);
+        EXPECT_EQ(sqliteOp->at(i).timestamp, columnOp->at(i).timestamp);
+        EXPECT_EQ(sqliteOp->at(i).end, columnOp->at(i).end);
+        EXPECT_EQ(sqliteOp->at(i).algType, columnOp->at(i).algType);
+    }
+}
+
 TEST_F(CommunicationInfoProcessorUTest, TestRunShouldReturnTrueWhenSourceTableNotExist)
 {
     auto dbPath = File::PathJoin({PROF_PATH_A, DEVICE_SUFFIX, SQLITE, DB_SUFFIX});
@@ -135,4 +135,25 @@ TEST_F(HashInitProcessorUTest, ShouldReturnFalseWhenConstructDBRunnerFailed)
     EXPECT_FALSE(processor.ProcessLogicStream(dataInventory));
     EXPECT_FALSE(processor.ProcessHashMap(dataInventory));
     MOCKER_CPP(&DBInfo::ConstructDBRunner).reset();
-}
\ No newline at end of file
+}
+TEST_F(HashInitProcessorUTest, ShouldShareHashMapWhenHashDbContentIsSame)
+{
+    const std::string secondPath = File::PathJoin({HASH_PATH, "PROF_1"});
+    EXPECT_TRUE(File::CreateDir(secondPath));
+    EXPECT_TRUE(File::CreateDir(File::PathJoin({secondPath, HOST})));
+    EXPECT_TRUE(File::CreateDir(File::PathJoin({secondPath, HOST, SQLITE})));
+    CreateHashData(File::PathJoin({secondPath, HOST, SQLITE, DB_SUFFIX}), DATA);
+    // 两份内容相同的ge_hash.db只加载一次
+    EXPECT_EQ(1ul, HashInitProcessor::ShareHashMaps({PROF_PATH, secondPath}));
+    DataInventory firstInventory;
+    DataInventory secondInventory;
+    EXPECT_TRUE(HashInitProcessor(PROF_PATH).Run(firstInventory, PROCESS_HASH));
+    HashInitProcessor(secondPath).Run(secondInventory, PROCESS_HASH);
+    ASSERT_NE(nullptr, firstInventory.GetPtr<GeHashMap>());
+    EXPECT_EQ(3ul, firstInventory.GetPtr<GeHashMap>()->size());
+    EXPECT_EQ(firstInventory.GetPtr<GeHashMap>(), secondInventory.GetPtr<GeHashMap>());
+    HashInitProcessor::ClearSharedHashMaps();
+    DataInventory thirdInventory;
+    EXPECT_TRUE(HashInitProcessor(PROF_PATH).Run(thirdInventory, PROCESS_HASH));
+    EXPECT_NE(firstInventory.GetPtr<GeHashMap>(), thirdInventory.GetPtr<GeHashMap>());
+}
@@ -498,7 +498,7 @@ TEST_F(MetricProcessorUTest, TestFormatTaskBasedDataShouldReturnFalseWhenDataIsE
 {
     DataInventory dataInventory;
     auto processor = MetricProcessor(PROF_PATH_A2);
-    std::vector<std::vector<std::string>> oriData;
+    Analysis::Infra::ColumnTable oriData;
     std::map<TaskId, std::vector<std::vector<std::string>>> processedData;
     uint16_t deviceId;
     EXPECT_FALSE(processor.FormatTaskBasedData(oriData, processedData, deviceId));
@@ -22,11 +22,13 @@
 #include "analysis/csrc/domain/services/environment/context.h"
 #include "analysis/csrc/application/database/db_constant.h"
 #include "analysis/csrc/domain/entities/viewer_data/ai_task/include/kfc_turn_data.h"
+#include "analysis/csrc/infrastructure/db/include/column_file.h"
 #include "reserve_mock_utils.h"
 
 using namespace Analysis::Application;
 using namespace Analysis::Domain;
 using namespace Analysis::Utils;
+using namespace Analysis::Infra;
 namespace {
 const int DEPTH = 0;
 const std::string TASK_PATH = "./task_path";
@@ -44,6 +46,11 @@ DbDataType DATA_A{{4294967295, -1, 37, 1, 3, 0, 8719911184665.1, 680.013671875,
                   {4294967295, -1, 37, 3, 5, 0, 8719911182265.1, 680.013671875, "UNKNOWN", "11", 3},
                   {4294967295, -1, 37, 4, 5, 0, 8719911184665.1, 680.013671875, "UNKNOWN", "88", 4},
                   {4294967295, -1, 37, 5, 7, 0, 8719911184965.1, 680.013671875, "KERNEL_AICORE", "AI_CORE", 5}};
+// device_task_type为UNKNOWN的行需被过滤，其余行保持写入顺序
+DbDataType DATA_COLUMN{{4294967295, -1, 37, 9, 0, 0, 36471129990000.5, 680.013671875, "KERNEL_AICORE", "AI_CORE", 9},
+                       {4294967295, -1, 37, 6, 0, 0, 36471129960000.5, 680.013671875, "KERNEL_AICORE", "UNKNOWN", 6},
+                       {4294967295, -1, 37, 7, 0, 0, 36471129950000.5, 680.013671875, "KERNEL_AICPU", "AI_CPU", 7},
+                       {4294967295, -1, 37, 8, 0, 0, 36471129970000.5, 680.013671875, "FFTS_PLUS", "UNKNOWN", 8}};
 }
 
 class TaskProcessorUTest : public testing::Test {
@@ -157,3 +164,51 @@ TEST_F(TaskProcessorUTest, TestRunShouldReturnFalseWhenSaveToDataInventoryFailed
     EXPECT_FALSE(processor.Run(dataInventory, PROCESSOR_NAME_TASK));
     MOCKER_CPP(&DataProcessor::SaveToDataInventory<KfcTurnData>).reset();
 }
+
+TEST_F(TaskProcessorUTest, TestRunShouldKeepSameFilterAndOrderWhenLoadFromColumnFile)
+{
+    nlohmann::json record = {
+        {"startCollectionTimeBegin", "1701069324370978"},
+        {"endCollectionTimeEnd", "1701069338159976"},
+        {"startClockMonotonicRaw", "36471129942580"},
+        {"pid", "10"},
+        {"hostCntvct", "65177261204177"},
+        {"CPU", {{{"Frequency", "100.000000"}}}},
+        {"hostMonotonic", "651599377155020"},
+    };
+    MOCKER_CPP(&Analysis::Domain::Environment::Context::GetInfoByDeviceId).stubs().will(returnValue(record));
+    const std::string profPath = File::PathJoin({TASK_PATH, "PROF_COLUMN"});
+    const std::string sqlitePath = File::PathJoin({profPath, DEVICE_SUFFIX, SQLITE_SUFFIX});
+    const std::string dbPath = File::PathJoin({sqlitePath, DB_SUFFIX});
+    EXPECT_TRUE(File::CreateDir(profPath));
+    EXPECT_TRUE(File::CreateDir(File::PathJoin({profPath, DEVICE_SUFFIX})));
+    EXPECT_TRUE(File::CreateDir(sqlitePath));
+    CreateAscendTask(dbPath, DATA_COLUMN);
+    DataInventory sqliteInventory;
+    EXPECT_TRUE(TaskProcessor(profPath).Run(sqliteInventory, PROCESSOR_NAME_TASK));
+    auto sqliteRes = sqliteInventory.GetPtr<std::vector<AscendTaskData>>();
+
+    // 只保留列式文件，读取失败时会回退到不存在的sqlite而得不到数据
+    std::vector<std::string> colNames;
+    for (const auto &col : AscendTaskDB().GetTableCols(TABLE_NAME)) {
+        colNames.emplace_back(col.name);
+    }
+    ColumnFileWriter writer(GetColumnFilePath(dbPath, TABLE_NAME));
+    EXPECT_TRUE(writer.Append(colNames, DATA_COLUMN));
+    EXPECT_TRUE(File::DeleteFile(dbPath));
+    DataInventory columnInventory;
+    EXPECT_TRUE(TaskProcessor(profPath).Run(columnInventory, PROCESSOR_NAME_TASK));
+    auto columnRes = columnInventory.GetPtr<std::vector<AscendTaskData>>();
+
+    ASSERT_EQ(2ul, sqliteRes->size());
+    ASSERT_EQ(sqliteRes->size(), columnRes->size());
+    for (size_t i = 0; i < sqliteRes->size(); ++i) {
+        EXPECT_EQ(sqliteRes->at(i).taskId, columnRes->at(i).taskId);
+        EXPECT_EQ(sqliteRes->at(i).timestamp, columnRes->at(i).timestamp);
+        EXPECT_EQ(sqliteRes->at(i).end, columnRes->at(i).end);
+        EXPECT_EQ(sqliteRes->at(i).deviceType, columnRes->at(i).deviceType);
+        EXPECT_EQ(sqliteRes->at(i).taskType, columnRes->at(i).taskType);
+    }
+    EXPECT_EQ(9, columnRes->at(0).taskId);
+    EXPECT_EQ(7, columnRes->at(1).taskId);
+}
@@ -31,9 +31,6 @@ using OSTFormat = std::vector<std::tuple<uint64_t, std::string, uint32_t>>;
 // Original Sample Summary Format:aicore/ai_vector_core中的MetricSummary
 // metric, value, coreid
 using OSSFormat = std::vector<std::tuple<std::string, double, uint32_t>>;
-// Original Task Format: 只取id + 对应字段的value
-// stream_id, task_id, subtask_id, batch_id, value
-using OTFormat = std::vector<std::tuple<uint32_t, uint32_t, uint32_t, uint32_t, double>>;
 // 手动设置task-based pmu表Format
 // aic_total_time, aic_total_cycles, aic_mac_time, aic_mac_ratio_extra,
 // aiv_total_time, aiv_total_cycles, aiv_vec_time, aiv_vec_ratio, task_id, stream_id, subtask_id,
@@ -207,11 +204,11 @@ TEST_F(UnifiedPmuProcessorUTest, TestTaskRunShouldReturnFalseWhenFormatDataFaile
 
     MOCKER_CPP(&Context::GetInfoByDeviceId).stubs().will(returnValue(record));
     // dataFormat empty
-    MOCKER_CPP(&OTFormat::empty).stubs().will(returnValue(true));
+    MOCKER_CPP(&Analysis::Infra::ColumnTable::Empty).stubs().will(returnValue(true));
     DataInventory dataInventory1;
     auto processor1 = UnifiedPmuProcessor(PROF_PATH);
     EXPECT_FALSE(processor1.Run(dataInventory1, PROCESSOR_NAME_UNIFIED_PMU));
-    MOCKER_CPP(&OTFormat::empty).reset();
+    MOCKER_CPP(&Analysis::Infra::ColumnTable::Empty).reset();
 
     // Reserve failed
     Analysis::Test::StubReserveFailureForVector<std::vector<UnifiedTaskPmu>>();
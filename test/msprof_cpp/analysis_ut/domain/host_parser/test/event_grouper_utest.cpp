@@ -27,6 +27,7 @@
 #include "analysis/csrc/domain/services/parser/host/cann/event_grouper.h"
 #include "analysis/csrc/infrastructure/utils/utils.h"
 #include "analysis/csrc/infrastructure/utils/file.h"
+#include "analysis/csrc/infrastructure/utils/ingest_cursor.h"
 #include "analysis/csrc/infrastructure/utils/prof_common.h"
 #include "test/msprof_cpp/analysis_ut/fake/fake_trace_generator.h"
 #include "analysis/csrc/domain/services/parser/host/cann/type_data.h"
@@ -162,26 +163,30 @@ uint64_t g_getCannEventsNum(std::set<uint32_t> &tids, CANNWarehouses &cwhs, cons
 {
     uint64_t cnt = 0;
     for (auto tid: tids) {
-        if (eventName == "kernelEvents" && cwhs[tid].kernelEvents != nullptr) {
-            cnt += cwhs[tid].kernelEvents->GetSize();
-        } else if (eventName == "graphIdMapEvents" && cwhs[tid].graphIdMapEvents != nullptr) {
-            cnt += cwhs[tid].graphIdMapEvents->GetSize();
-        } else if (eventName == "fusionOpInfoEvents" && cwhs[tid].fusionOpInfoEvents != nullptr) {
-            cnt += cwhs[tid].fusionOpInfoEvents->GetSize();
-        } else if (eventName == "nodeBasicInfoEvents" && cwhs[tid].nodeBasicInfoEvents != nullptr) {
-            cnt += cwhs[tid].nodeBasicInfoEvents->GetSize();
-        } else if (eventName == "nodeAttrInfoEvents" && cwhs[tid].nodeAttrInfoEvents != nullptr) {
-            cnt += cwhs[tid].nodeAttrInfoEvents->GetSize();
-        } else if (eventName == "tensorInfoEvents" && cwhs[tid].tensorInfoEvents != nullptr) {
-            cnt += cwhs[tid].tensorInfoEvents->GetSize();
-        } else if (eventName == "contextIdEvents" && cwhs[tid].contextIdEvents != nullptr) {
-            cnt += cwhs[tid].contextIdEvents->GetSize();
-        } else if (eventName == "hcclInfoEvents" && cwhs[tid].hcclInfoEvents != nullptr) {
-            cnt += cwhs[tid].hcclInfoEvents->GetSize();
-        } else if (eventName == "taskTrackEvents" && cwhs[tid].taskTrackEvents != nullptr) {
-            cnt += cwhs[tid].taskTrackEvents->GetSize();
-        } else if (eventName == "hcclOpInfoEvents" && cwhs[tid].hcclOpInfoEvents != nullptr) {
-            cnt += cwhs[tid].hcclOpInfoEvents->GetSize();
+        CANNWarehouse cwh;
+        if (!cwhs.Find(tid, cwh)) {
+            continue;
+        }
+        if (eventName == "kernelEvents" && cwh.kernelEvents != nullptr) {
+            cnt += cwh.kernelEvents->GetSize();
+        } else if (eventName == "graphIdMapEvents" && cwh.graphIdMapEvents != nullptr) {
+            cnt += cwh.graphIdMapEvents->GetSize();
+        } else if (eventName == "fusionOpInfoEvents" && cwh.fusionOpInfoEvents != nullptr) {
+            cnt += cwh.fusionOpInfoEvents->GetSize();
+        } else if (eventName == "nodeBasicInfoEvents" && cwh.nodeBasicInfoEvents != nullptr) {
+            cnt += cwh.nodeBasicInfoEvents->GetSize();
+        } else if (eventName == "nodeAttrInfoEvents" && cwh.nodeAttrInfoEvents != nullptr) {
+            cnt += cwh.nodeAttrInfoEvents->GetSize();
+        } else if (eventName == "tensorInfoEvents" && cwh.tensorInfoEvents != nullptr) {
+            cnt += cwh.tensorInfoEvents->GetSize();
+        } else if (eventName == "contextIdEvents" && cwh.contextIdEvents != nullptr) {
+            cnt += cwh.contextIdEvents->GetSize();
+        } else if (eventName == "hcclInfoEvents" && cwh.hcclInfoEvents != nullptr) {
+            cnt += cwh.hcclInfoEvents->GetSize();
+        } else if (eventName == "taskTrackEvents" && cwh.taskTrackEvents != nullptr) {
+            cnt += cwh.taskTrackEvents->GetSize();
+        } else if (eventName == "hcclOpInfoEvents" && cwh.hcclOpInfoEvents != nullptr) {
+            cnt += cwh.hcclOpInfoEvents->GetSize();
         }
     }
     return cnt;
@@ -268,3 +273,178 @@ TEST_F(EventGrouperUTest, TestGroupShouldGroupCorrespondingEventsWhenDataDirHasA
 
     EXPECT_EQ(true, File::RemoveDir(fakeDataDir, 0));
 }
+
+// 测试单一threadId数据量较大、切分范围并行分组时，各threadId的Event与全量api保持时间顺序
+TEST_F(EventGrouperUTest, TestGroupShouldKeepTimeOrderWhenGroupByRanges)
+{
+    const std::string fakeDataDir = "./fakeDataRanges";
+    File::RemoveDir(fakeDataDir, 0);
+    const std::string hostDataDir = fakeDataDir + "/host/data";
+    const uint32_t mainThread = 1;
+    const uint32_t subThread = 2;
+    const int maxNum = 50000;
+    const int timeStep = 10;
+    std::vector<MsprofApi> apiTrace;
+    std::vector<MsprofCompactInfo> nodeTrace;
+    // 时间戳倒序写入，主线程占绝大多数
+    for (int i = maxNum; i > 0; --i) {
+        auto api = MsprofApi{};
+        api.magicNumber = MSPROF_DATA_HEAD_MAGIC_NUM;
+        api.level = MSPROF_REPORT_NODE_LEVEL;
+        api.threadId = (i % timeStep == 0) ? subThread : mainThread;
+        api.beginTime = static_cast<uint64_t>(i * timeStep);
+        api.endTime = static_cast<uint64_t>(i * timeStep + 1);
+        apiTrace.emplace_back(api);
+        auto node = MsprofCompactInfo{};
+        node.magicNumber = MSPROF_DATA_HEAD_MAGIC_NUM;
+        node.level = MSPROF_REPORT_NODE_LEVEL;
+        node.threadId = api.threadId;
+        node.timeStamp = api.beginTime;
+        nodeTrace.emplace_back(node);
+    }
+    auto fakeGen = std::make_shared<FakeTraceGenerator>(fakeDataDir);
+    fakeGen->WriteBin<MsprofApi>(apiTrace, EventType::EVENT_TYPE_API, true, 0);
+    fakeGen->WriteBin<MsprofCompactInfo>(nodeTrace, EventType::EVENT_TYPE_NODE_BASIC_INFO, true, 0);
+
+    auto grouper = std::make_shared<EventGrouper>(hostDataDir);
+    grouper->Group();
+    auto tids = grouper->GetThreadIdSet();
+    auto res = grouper->GetGroupEvents();
+    EXPECT_EQ(2ul, tids.size());
+    EXPECT_EQ(maxNum, g_getCannEventsNum(tids, res, "kernelEvents"));
+    EXPECT_EQ(maxNum, g_getCannEventsNum(tids, res, "nodeBasicInfoEvents"));
+    auto &apiTraces = grouper->GetApiTraces();
+    ASSERT_EQ(maxNum, apiTraces.size());
+    for (size_t i = 1; i < apiTraces.size(); ++i) {
+        EXPECT_LT(apiTraces[i - 1]->info.start, apiTraces[i]->info.start);
+    }
+    for (auto tid : tids) {
+        CANNWarehouse cwh;
+        ASSERT_TRUE(res.Find(tid, cwh));
+        auto que = cwh.nodeBasicInfoEvents;
+        ASSERT_NE(nullptr, que);
+        uint64_t last = 0;
+        while (!que->Empty()) {
+            auto event = que->Pop();
+            EXPECT_EQ(tid, event->compactPtr->threadId);
+            EXPECT_LE(last, event->info.start);
+            last = event->info.start;
+        }
+    }
+    EXPECT_EQ(true, File::RemoveDir(fakeDataDir, 0));
+}
+
+// 测试记录分布在多个分片文件中时，按文件范围并行解析后各线程的Event不丢失且按时间有序
+TEST_F(EventGrouperUTest, TestGroupShouldKeepAllEventsWhenParseByFileRanges)
+{
+    const std::string fakeDataDir = "./fakeDataFileRanges";
+    File::RemoveDir(fakeDataDir, 0);
+    const std::string hostDataDir = fakeDataDir + "/host/data";
+    const uint32_t threadNum = 3;
+    const int maxNum = 50000;
+    const int timeStep = 10;
+    const uint32_t sliceSize = 64 * 1024;
+    std::vector<MsprofCompactInfo> attrTrace;
+    // 时间戳倒序写入，同一线程的记录分散在不同的分片文件中
+    for (int i = maxNum; i > 0; --i) {
+        auto attr = MsprofCompactInfo{};
+        attr.magicNumber = MSPROF_DATA_HEAD_MAGIC_NUM;
+        attr.level = MSPROF_REPORT_NODE_LEVEL;
+        attr.threadId = static_cast<uint32_t>(i) % threadNum;
+        attr.timeStamp = static_cast<uint64_t>(i * timeStep);
+        attrTrace.emplace_back(attr);
+    }
+    auto fakeGen = std::make_shared<FakeTraceGenerator>(fakeDataDir, sliceSize);
+    fakeGen->WriteBin<MsprofCompactInfo>(attrTrace, EventType::EVENT_TYPE_NODE_ATTR_INFO, true, 0);
+    ASSERT_LT(1ul, File::GetOriginData(hostDataDir, {"aging.compact.node_attr_info.slice"}, {}).size());
+
+    auto grouper = std::make_shared<EventGrouper>(hostDataDir);
+    grouper->Group();
+    auto tids = grouper->GetThreadIdSet();
+    auto res = grouper->GetGroupEvents();
+    EXPECT_EQ(threadNum, tids.size());
+    EXPECT_EQ(maxNum, g_getCannEventsNum(tids, res, "nodeAttrInfoEvents"));
+    for (auto tid : tids) {
+        CANNWarehouse cwh;
+        ASSERT_TRUE(res.Find(tid, cwh));
+        auto que = cwh.nodeAttrInfoEvents;
+        ASSERT_NE(nullptr, que);
+        uint64_t last = 0;
+        while (!que->Empty()) {
+            auto event = que->Pop();
+            EXPECT_EQ(tid, event->compactPtr->threadId);
+            EXPECT_LT(last, event->info.start);
+            last = event->info.start;
+        }
+    }
+    EXPECT_EQ(true, File::RemoveDir(fakeDataDir, 0));
+}
+
+static MsprofApi MakeApi(uint16_t level, uint64_t beginTime, uint64_t endTime)
+{
+    auto api = MsprofApi{};
+    api.magicNumber = MSPROF_DATA_HEAD_MAGIC_NUM;
+    api.level = level;
+    api.threadId = 1;
+    api.beginTime = beginTime;
+    api.endTime = endTime;
+    return api;
+}
+
+static MsprofCompactInfo MakeCompactInfo(uint16_t level, uint64_t timeStamp)
+{
+    auto info = MsprofCompactInfo{};
+    info.magicNumber = MSPROF_DATA_HEAD_MAGIC_NUM;
+    info.level = level;
+    info.threadId = 1;
+    info.timeStamp = timeStamp;
+    return info;
+}
+
+// 测试follow模式下子记录早于所属Node api落盘时，本次保留这些记录，下次解析与api一起重放
+TEST_F(EventGrouperUTest, TestGroupShouldHoldBackEventsAfterLastClosedNodeInFollowMode)
+{
+    const std::string fakeDataDir = "./fakeDataFollow";
+    File::RemoveDir(fakeDataDir, 0);
+    const std::string hostDataDir = fakeDataDir + "/host/data";
+    auto &cursor = IngestCursor::GetInstance();
+    cursor.SetFollow(true);
+    // 第一次解析: Node[100, 200]已结束，HCCL[260, 280]及300时刻的记录属于尚未落盘的Node[250, 400]
+    std::vector<MsprofApi> apiTrace{MakeApi(MSPROF_REPORT_NODE_LEVEL, 100, 200),
+                                    MakeApi(MSPROF_REPORT_HCCL_NODE_LEVEL, 260, 280)};
+    std::vector<MsprofCompactInfo> taskTrace{MakeCompactInfo(MSPROF_REPORT_RUNTIME_LEVEL, 150),
+                                             MakeCompactInfo(MSPROF_REPORT_RUNTIME_LEVEL, 300)};
+    std::vector<MsprofCompactInfo> nodeTrace{MakeCompactInfo(MSPROF_REPORT_NODE_LEVEL, 300)};
+    auto fakeGen = std::make_shared<FakeTraceGenerator>(fakeDataDir);
+    fakeGen->WriteBin<MsprofApi>(apiTrace, EventType::EVENT_TYPE_API, true, 0);
+    fakeGen->WriteBin<MsprofCompactInfo>(taskTrace, EventType::EVENT_TYPE_TASK_TRACK, true, 0);
+    fakeGen->WriteBin<MsprofCompactInfo>(nodeTrace, EventType::EVENT_TYPE_NODE_BASIC_INFO, true, 0);
+
+    auto grouper = std::make_shared<EventGrouper>(hostDataDir);
+    ASSERT_TRUE(grouper->Group());
+    auto tids = grouper->GetThreadIdSet();
+    auto &res = grouper->GetGroupEvents();
+    EXPECT_EQ(1, g_getCannEventsNum(tids, res, "kernelEvents"));
+    EXPECT_EQ(1, g_getCannEventsNum(tids, res, "taskTrackEvents"));
+    EXPECT_EQ(0, g_getCannEventsNum(tids, res, "nodeBasicInfoEvents"));
+    EXPECT_EQ(1ul, grouper->GetApiTraces().size());
+    EXPECT_TRUE(cursor.Commit(hostDataDir));
+
+    // 第二次解析: Node[250, 400]落盘，保留的记录重放后关联到该api
+    apiTrace.emplace_back(MakeApi(MSPROF_REPORT_NODE_LEVEL, 250, 400));
+    fakeGen->WriteBin<MsprofApi>(apiTrace, EventType::EVENT_TYPE_API, true, 0);
+    grouper = std::make_shared<EventGrouper>(hostDataDir);
+    ASSERT_TRUE(grouper->Group());
+    tids = grouper->GetThreadIdSet();
+    auto &next = grouper->GetGroupEvents();
+    EXPECT_EQ(2, g_getCannEventsNum(tids, next, "kernelEvents"));
+    EXPECT_EQ(1, g_getCannEventsNum(tids, next, "taskTrackEvents"));
+    EXPECT_EQ(1, g_getCannEventsNum(tids, next, "nodeBasicInfoEvents"));
+    EXPECT_EQ(2ul, grouper->GetApiTraces().size());
+    EXPECT_TRUE(cursor.Commit(hostDataDir));
+    EXPECT_FALSE(File::Exist(cursor.GetCarryPath(hostDataDir, "cann_event_0")));
+
+    cursor.SetFollow(false);
+    cursor.committed_.clear();
+    EXPECT_EQ(true, File::RemoveDir(fakeDataDir, 0));
+}
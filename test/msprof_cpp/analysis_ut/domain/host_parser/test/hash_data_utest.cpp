@@ -95,3 +95,15 @@ TEST_F(HashDataUTest, GetAllShouldReturn2ValidResInFile)
     HashData::GetInstance().Clear();
 }
 
+
+TEST_F(HashDataUTest, GetRefShouldReturnStrAfterSealAndReleaseRawData)
+{
+    HashData::GetInstance().Load("./");
+    HashData::GetInstance().Seal();
+    EXPECT_TRUE(HashData::GetInstance().GetAll().empty());
+    EXPECT_EQ("AssignAdd:t1", HashData::GetInstance().GetRef(836640106292564867).ToString());
+    EXPECT_EQ("AssignAdd:t1", HashData::GetInstance().Get(836640106292564867));
+    EXPECT_TRUE(HashData::GetInstance().GetRef(10).Empty());
+    EXPECT_EQ("10", HashData::GetInstance().Get(10));
+    HashData::GetInstance().Clear();
+}
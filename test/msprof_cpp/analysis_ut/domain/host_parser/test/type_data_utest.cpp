@@ -100,4 +100,17 @@ TEST_F(TypeDataUTest, GetAllShouldReturn3ValidResInFile)
     EXPECT_EQ(expect5000ResSize, TypeData::GetInstance().GetAll()[hcclLevel].size());
     EXPECT_EQ(expect20000ResSize, TypeData::GetInstance().GetAll()[aclLevel].size());
     TypeData::GetInstance().Clear();
-}
\ No newline at end of file
+}
+TEST_F(TypeDataUTest, GetRefShouldReturnStrAfterSealAndReleaseRawData)
+{
+    TypeData::GetInstance().Load(BASE_PATH);
+    TypeData::GetInstance().Seal();
+    EXPECT_TRUE(TypeData::GetInstance().GetAll().empty());
+    EXPECT_EQ("MemCopy2DAsync", TypeData::GetInstance().GetRef(5000, 1077).ToString());
+    EXPECT_EQ("CpuKernelLaunchExWithArgs_Big", TypeData::GetInstance().Get(5000, 1125));
+    // 27为白名单中的type
+    EXPECT_EQ("DYNAMIC_ENABLE", TypeData::GetInstance().GetRef(5000, 27).ToString());
+    EXPECT_TRUE(TypeData::GetInstance().GetRef(5000, 10).Empty());
+    EXPECT_EQ("10", TypeData::GetInstance().Get(100, 10));
+    TypeData::GetInstance().Clear();
+}
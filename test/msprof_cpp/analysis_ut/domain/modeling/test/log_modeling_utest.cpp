@@ -26,6 +26,8 @@
 #include "analysis/csrc/domain/entities/hal/include/hal_track.h"
 #include "analysis/csrc/domain/entities/hal/include/device_task.h"
 #include "analysis/csrc/infrastructure/dfx/error_code.h"
+#include "analysis/csrc/infrastructure/utils/file.h"
+#include "analysis/csrc/infrastructure/utils/ingest_cursor.h"
 
 using namespace testing;
 
@@ -478,6 +480,52 @@ TEST_F(LogModelingUTest, ShouldGetDeviceTaskTheSameAsStartTaskWhenStartTaskLessT
     }
 }
 
+/*
+ * follow模式下开始日志与结束日志分属两次增量解析时，第一次解析保留未匹配的开始日志，
+ * 游标提交后第二次解析重放开始日志，与新的结束日志匹配出该任务
+ */
+TEST_F(LogModelingUTest, ShouldRecoverTaskWhenStartAndEndSplitAcrossIncrementalRuns)
+{
+    const std::string devicePath = "./log_modeling_follow_utest";
+    const std::string dataDir = Utils::File::PathJoin({devicePath, "data"});
+    ASSERT_TRUE(Utils::File::CreateDir(devicePath));
+    ASSERT_TRUE(Utils::File::CreateDir(dataDir));
+    auto &cursor = Utils::IngestCursor::GetInstance();
+    cursor.SetFollow(true);
+    HalLogData logIns{};
+    logIns.hd.taskId.streamId = 1;
+    logIns.hd.taskId.taskId = 1;
+    logIns.hd.taskId.contextId = 1;
+    logIns.type = ACSQ_LOG;
+    logIns.acsq.taskType = 3; // 测试任务类型为3
+    const std::vector<uint64_t> timestamps{100, 200};  // 第一次解析只有开始日志，第二次只有结束日志
+    const std::vector<size_t> expectTaskNum{0, 1};
+    for (size_t i = 0; i < timestamps.size(); ++i) {
+        logIns.hd.timestamp = timestamps[i];
+        logIns.acsq.timestamp = timestamps[i];
+        logIns.acsq.isEndTimestamp = i != 0;
+        auto logDataS = dataInventory_.GetPtr<std::vector<HalLogData>>();
+        logDataS->assign(1, logIns);
+        auto deviceTask = dataInventory_.GetPtr<std::map<TaskId, std::vector<DeviceTask>>>();
+        deviceTask->clear();
+        Domain::LogModeling modeling;
+        DeviceContext context;
+        context.deviceContextInfo.deviceFilePath = devicePath;
+        ASSERT_EQ(modeling.Run(dataInventory_, context), Analysis::ANALYSIS_OK);
+        EXPECT_TRUE(cursor.Commit(dataDir));
+        ASSERT_EQ(expectTaskNum[i], deviceTask->size());
+    }
+    auto deviceTask = dataInventory_.GetPtr<std::map<TaskId, std::vector<DeviceTask>>>();
+    const auto &task = deviceTask->begin()->second.front();
+    EXPECT_EQ(100ULL, task.taskStart);
+    EXPECT_EQ(200ULL, task.taskEnd);
+    // 匹配后不再保留开始日志
+    EXPECT_FALSE(Utils::File::Exist(cursor.GetCarryPath(dataDir, "log_modeling_start")));
+    cursor.SetFollow(false);
+    cursor.committed_.clear();
+    EXPECT_TRUE(Utils::File::RemoveDir(devicePath, 0));
+}
+
 }
 
 }
\ No newline at end of file
@@ -16,6 +16,7 @@
 #include <gtest/gtest.h>
 #include "mockcpp/mockcpp.hpp"
 #include "analysis/csrc/domain/services/persistence/device/device_hccl_persistence.h"
+#include "analysis/csrc/domain/services/persistence/device/persistence_utils.h"
 #include "analysis/csrc/domain/services/association/calculator/hccl/include/hccl_calculator.h"
 #include "analysis/csrc/infrastructure/utils/utils.h"
 #include "analysis/csrc/domain/entities/hal/include/top_down_task.h"
@@ -86,10 +87,13 @@ protected:
         EXPECT_TRUE(File::CreateDir(LOCAL_DIR));
         EXPECT_TRUE(File::CreateDir(DEVICE_DIR));
         EXPECT_TRUE(File::CreateDir(SQLITE_DIR));
+        // 用例从sqlite中校验落盘结果，开启列式表的sqlite视图
+        Analysis::Domain::SetSqliteViewEnabled(true);
     }
 
     static void TearDownTestCase()
     {
+        Analysis::Domain::SetSqliteViewEnabled(false);
         EXPECT_TRUE(File::RemoveDir(LOCAL_DIR, 0));
     }
 
@@ -17,6 +17,7 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include "analysis/csrc/domain/services/persistence/device/freq_persistence.h"
+#include "analysis/csrc/domain/services/persistence/device/persistence_utils.h"
 #include "analysis/csrc/domain/services/device_context/device_context.h"
 #include "analysis/csrc/domain/entities/hal/include/hal_freq.h"
 #include "analysis/csrc/infrastructure/dfx/error_code.h"
@@ -72,6 +73,45 @@ TEST_F(FreqPersistenceUTest, ShouldSaveFreqDataSuccess)
     ASSERT_EQ(ANALYSIS_OK, persistence.Run(dataInventory_, context));
 }
 
+TEST_F(FreqPersistenceUTest, ShouldOnlySaveColumnFileByDefault)
+{
+    FreqPersistence persistence;
+    DeviceContext context;
+    context.deviceContextInfo.deviceFilePath = DEVICE_PATH;
+    auto freqDataS = dataInventory_.GetPtr<std::vector<HalFreqLpmData>>();
+    auto freqData = CreateFreqData(1000, 1800);
+    freqDataS->swap(freqData);
+    ASSERT_FALSE(IsSqliteViewEnabled());
+    ASSERT_EQ(ANALYSIS_OK, persistence.Run(dataInventory_, context));
+
+    auto dbPath = File::PathJoin({DEVICE_PATH, "sqlite", "freq.db"});
+    EXPECT_FALSE(File::Exist(dbPath));
+    ColumnFileReader reader;
+    ASSERT_TRUE(reader.Open(GetColumnFilePath(dbPath, "FreqParse")));
+    std::vector<std::tuple<uint64_t, uint32_t>> data;
+    ASSERT_TRUE(reader.Read({"syscnt", "freq"}, data));
+    std::vector<std::tuple<uint64_t, uint32_t>> expect(2, std::make_tuple(1000, 1800));
+    EXPECT_EQ(expect, data);
+}
+
+TEST_F(FreqPersistenceUTest, ShouldAlsoSaveSqliteWhenSqliteViewRequested)
+{
+    FreqPersistence persistence;
+    DeviceContext context;
+    context.deviceContextInfo.deviceFilePath = DEVICE_PATH;
+    auto freqDataS = dataInventory_.GetPtr<std::vector<HalFreqLpmData>>();
+    auto freqData = CreateFreqData(1000, 1800);
+    freqDataS->swap(freqData);
+    SetSqliteViewEnabled(true);
+    auto ret = persistence.Run(dataInventory_, context);
+    SetSqliteViewEnabled(false);
+    ASSERT_EQ(ANALYSIS_OK, ret);
+
+    auto dbPath = File::PathJoin({DEVICE_PATH, "sqlite", "freq.db"});
+    EXPECT_TRUE(File::Exist(dbPath));
+    EXPECT_TRUE(File::Exist(GetColumnFilePath(dbPath, "FreqParse")));
+}
+
 TEST_F(FreqPersistenceUTest, ShouldReturnErrorWhenDataIsNullPtr)
 {
     FreqPersistence persistence;
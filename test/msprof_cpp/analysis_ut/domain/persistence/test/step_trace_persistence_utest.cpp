@@ -18,6 +18,7 @@
 #include <gmock/gmock.h>
 #include "analysis/csrc/domain/services/device_context/device_context.h"
 #include "analysis/csrc/domain/services/modeling/step_trace/include/step_trace_process.h"
+#include "analysis/csrc/domain/services/persistence/device/persistence_utils.h"
 #include "analysis/csrc/domain/services/persistence/device/step_trace_persistence.h"
 #include "analysis/csrc/infrastructure/dfx/error_code.h"
 
@@ -171,4 +172,27 @@ TEST_F(StepTracePersistenceUtest, ShouldRunSuccessWhenStepDataIsEmpty)
     ASSERT_EQ(ANALYSIS_OK, stepTraceProcess.Run(dataInventory_, context));
 }
 
+TEST_F(StepTracePersistenceUtest, ShouldStillSaveSqliteByDefaultWhenTableHasNoColumnReader)
+{
+    DataInventory dataInventory_;
+    auto data = std::make_shared<std::vector<HalTrackData>>();
+    data->emplace_back(CreateHalTrackData(1, 0, 10)); // 1, 0, 10
+    data->emplace_back(CreateHalTrackData(1, 1, 25)); // 1, 1, 25
+    dataInventory_.Inject(data);
+    DeviceContext context;
+    context.deviceContextInfo.deviceFilePath = DEVICE_PATH;
+
+    auto process = StepTraceProcess();
+    ASSERT_EQ(ANALYSIS_OK, process.Run(dataInventory_, context));
+    ASSERT_FALSE(IsSqliteViewEnabled());
+    auto stepTraceProcess = StepTracePersistence();
+    ASSERT_EQ(ANALYSIS_OK, stepTraceProcess.Run(dataInventory_, context));
+
+    // step trace表没有列式读取，仍写入sqlite且不写列式文件
+    EXPECT_FALSE(HasColumnReader("step_trace_data"));
+    auto dbPath = File::PathJoin({DEVICE_PATH, "sqlite", "step_trace.db"});
+    EXPECT_TRUE(File::Exist(dbPath));
+    EXPECT_FALSE(File::Exist(GetColumnFilePath(dbPath, "step_trace_data")));
+}
+
 }
@@ -91,6 +91,13 @@ TEST_F(DeviceContextUTest, TestDeviceContextEntryShouldReturn1DataInventoryWhenI
     EXPECT_EQ(1, DeviceContextEntry(PROF_DIR, "").size());
 }
 
+TEST_F(DeviceContextUTest, TestDeviceContextEntryShouldReportFailureWhenInfoJsonInvalid)
+{
+    bool isSuccess = true;
+    EXPECT_EQ(1, DeviceContextEntry(PROF_DIR, "", isSuccess).size());
+    EXPECT_FALSE(isSuccess);
+}
+
 TEST_F(DeviceContextUTest, TestGetDeviceDirectoriesShouldPrintErrorLogWhenOpenDirectoryFailed)
 {
     MOCKER_CPP(opendir).stubs().will(returnValue((DIR*)nullptr));
@@ -122,6 +129,18 @@ TEST_F(DeviceContextUTest, TestDeviceContextEntryShouldReturnEmptyVectorWhenNoPr
     GlobalMockObject::verify();
 }
 
+TEST_F(DeviceContextUTest, TestGetDeviceFootprintInputShouldSumFootprintData)
+{
+    const auto dataDir = File::PathJoin({PROF_DIR, DEVICE_DIR, "data"});
+    EXPECT_EQ(0, GetDeviceFootprintInput(File::PathJoin({PROF_DIR, DEVICE_DIR})));
+    EXPECT_TRUE(File::CreateDir(dataDir));
+    FileWriter(File::PathJoin({dataDir, "stars_soc.data.0.slice_0"})).WriteText(std::string(100, 'a'));
+    FileWriter(File::PathJoin({dataDir, "ffts_profile.data.0.slice_0"})).WriteText(std::string(20, 'a'));
+    FileWriter(File::PathJoin({dataDir, "ts_track.data.0.slice_0"})).WriteText(std::string(3, 'a'));
+    FileWriter(File::PathJoin({dataDir, "hwts.data.0.slice_0"})).WriteText(std::string(1000, 'a'));
+    EXPECT_EQ(123, GetDeviceFootprintInput(File::PathJoin({PROF_DIR, DEVICE_DIR})));
+    EXPECT_TRUE(File::RemoveDir(dataDir, 0));
+}
 }  // Domain
 }  // Analysis
 
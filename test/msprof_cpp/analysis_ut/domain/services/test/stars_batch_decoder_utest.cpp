@@ -0,0 +1,114 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+#include <cstring>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+#include "analysis/csrc/domain/services/parser/parser_item/acsq_log_parser_item.h"
+#include "analysis/csrc/domain/services/parser/parser_item/stars_batch_decoder.h"
+#include "analysis/csrc/domain/services/parser/parser_item/stars_common.h"
+
+using namespace testing;
+
+namespace Analysis {
+namespace Domain {
+namespace {
+const size_t RECORD_NUM = 1000 + 5;  // 5: 覆盖不足一个SIMD批次的尾部
+const uint32_t SEED = 2026;
+
+std::vector<uint8_t> GenerateRecords(size_t count, size_t stride)
+{
+    std::mt19937 gen(SEED);
+    std::vector<uint8_t> records(count * stride);
+    for (auto &byte : records) {
+        byte = static_cast<uint8_t>(gen());
+    }
+    // 部分记录使用placeholder/event record的sqeType，覆盖expand场景下的特殊分支
+    for (size_t i = 0; i < count; i += 3) {  // 3: 每3条记录修改1条
+        uint16_t head;
+        std::memcpy(&head, records.data() + i * stride, sizeof(head));
+        head = static_cast<uint16_t>((head & 0x3FF) | ((i % 2 == 0 ? PLACE_HOLDER_SQE : EVENT_RECORD_SQE) << 10));
+        std::memcpy(records.data() + i * stride, &head, sizeof(head));
+    }
+    return records;
+}
+}
+
+class StarsBatchDecoderUTest : public Test {};
+
+TEST_F(StarsBatchDecoderUTest, ShouldMatchPerRecordDecodeForAllIdRules)
+{
+    const size_t stride = 64;
+    auto records = GenerateRecords(RECORD_NUM, stride);
+    for (uint16_t expandStatus : {0, 1}) {
+        for (auto idRule : {STARS_ID_RAW, STARS_ID_COMMON, STARS_ID_WITH_SQE_TYPE}) {
+            StarsHeaderColumns columns;
+            ASSERT_TRUE(StarsBatchDecoder::Decode(records.data(), RECORD_NUM, stride, expandStatus, idRule, columns));
+            ASSERT_EQ(RECORD_NUM, columns.Size());
+            for (size_t i = 0; i < RECORD_NUM; ++i) {
+                AcsqLog log;
+                std::memcpy(&log, records.data() + i * stride, sizeof(log));
+                uint16_t magic;
+                std::memcpy(&magic, records.data() + i * stride + 2, sizeof(magic));  // 2: magicNum偏移
+                EXPECT_EQ(log.funcType, columns.funcType[i]);
+                EXPECT_EQ(log.cnt, columns.cnt[i]);
+                EXPECT_EQ(log.taskType, columns.highBits[i]);
+                EXPECT_EQ(magic, columns.magicNum[i]);
+                EXPECT_EQ(log.timestamp, columns.timestamp[i]);
+                uint16_t streamId = log.streamId;
+                uint16_t taskId = log.taskId;
+                if (idRule != STARS_ID_RAW) {
+                    uint16_t sqeType = idRule == STARS_ID_WITH_SQE_TYPE ? log.taskType : 0;
+                    streamId = StarsCommon::GetStreamId(log.streamId, log.taskId, expandStatus, sqeType);
+                    taskId = StarsCommon::GetTaskId(log.streamId, log.taskId, expandStatus, sqeType);
+                }
+                ASSERT_EQ(streamId, columns.streamId[i]) << "index " << i << ", rule " << idRule;
+                ASSERT_EQ(taskId, columns.taskId[i]) << "index " << i << ", rule " << idRule;
+            }
+        }
+    }
+}
+
+TEST_F(StarsBatchDecoderUTest, ShouldFillAcsqLogSameAsParseItem)
+{
+    const size_t stride = sizeof(AcsqLogV6);
+    auto records = GenerateRecords(RECORD_NUM, stride);
+    StarsHeaderColumns columns;
+    ASSERT_TRUE(StarsBatchDecoder::Decode(records.data(), RECORD_NUM, stride, 0, STARS_ID_RAW, columns));
+    for (size_t i = 0; i < RECORD_NUM; ++i) {
+        HalLogData expect;
+        HalLogData actual;
+        auto expectCnt = AcsqLogParseItem_V6(records.data() + i * stride, stride,
+                                             reinterpret_cast<uint8_t *>(&expect), 0);
+        EXPECT_EQ(expectCnt, AcsqLogParseColumns_V6(columns, i, reinterpret_cast<uint8_t *>(&actual)));
+        EXPECT_EQ(expect.hd.taskId, actual.hd.taskId);
+        EXPECT_EQ(expect.hd.timestamp, actual.hd.timestamp);
+        EXPECT_EQ(expect.acsq.isEndTimestamp, actual.acsq.isEndTimestamp);
+        EXPECT_EQ(expect.acsq.taskType, actual.acsq.taskType);
+    }
+}
+
+TEST_F(StarsBatchDecoderUTest, ShouldReturnFalseWhenStrideTooSmall)
+{
+    std::vector<uint8_t> records(StarsBatchDecoder::HEADER_SIZE);
+    StarsHeaderColumns columns;
+    EXPECT_FALSE(StarsBatchDecoder::Decode(records.data(), 1, StarsBatchDecoder::HEADER_SIZE - 1, 0,
+                                           STARS_ID_RAW, columns));
+    EXPECT_TRUE(StarsBatchDecoder::Decode(nullptr, 0, StarsBatchDecoder::HEADER_SIZE, 0, STARS_ID_RAW, columns));
+    EXPECT_EQ(0ul, columns.Size());
+}
+}
+}
@@ -23,6 +23,8 @@
 #include "analysis/csrc/domain/services/parser/host/cann/hash_data.h"
 #include "analysis/csrc/domain/services/parser/host/cann/type_data.h"
 #include "analysis/csrc/domain/services/host_worker/host_trace_worker.h"
+#include "analysis/csrc/infrastructure/dfx/error_code.h"
+#include "analysis/csrc/infrastructure/utils/run_control.h"
 
 
 using namespace Analysis::Domain;
@@ -93,4 +95,14 @@ TEST_F(KernelParserWorkerUtest, TestKernelParserWorkerShouldReturnErrorWhenConte
     MOCKER_CPP(&Analysis::Domain::Environment::Context::Load).stubs().will(returnValue(false));
     auto res = kernelParserWorker.Run();
     EXPECT_EQ(res, 1);
-}
\ No newline at end of file
+}
+
+TEST_F(KernelParserWorkerUtest, TestKernelParserWorkerShouldReturnCancelledWhenRunCancelled)
+{
+    KernelParserWorker kernelParserWorker(TEST_HOST_FILE_PATH);
+    RunControl::GetInstance().Begin();
+    RunControl::GetInstance().Cancel();
+    auto res = kernelParserWorker.Run();
+    RunControl::GetInstance().Begin();
+    EXPECT_EQ(Analysis::ANALYSIS_CANCELLED, res);
+}
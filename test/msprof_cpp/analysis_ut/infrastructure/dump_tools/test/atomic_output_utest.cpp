@@ -0,0 +1,99 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+#include <string>
+
+#include "gtest/gtest.h"
+#include "analysis/csrc/infrastructure/dump_tools/include/atomic_output.h"
+#include "analysis/csrc/infrastructure/utils/file.h"
+
+using namespace Analysis::Utils;
+using namespace Analysis::Infra;
+
+namespace {
+const int DEPTH = 0;
+const std::string BASE_PATH = "./dump_tools_atomic_output_utest";
+
+void WriteFile(const std::string &path, const std::string &content)
+{
+    FileWriter writer(path);
+    writer.WriteText(content);
+}
+}
+
+class AtomicOutputUTest : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        if (File::Check(BASE_PATH)) {
+            File::RemoveDir(BASE_PATH, DEPTH);
+        }
+        EXPECT_TRUE(File::CreateDir(BASE_PATH));
+    }
+    virtual void TearDown()
+    {
+        EXPECT_TRUE(File::RemoveDir(BASE_PATH, DEPTH));
+    }
+};
+
+TEST_F(AtomicOutputUTest, ShouldRenameTempFileToTargetWhenPublish)
+{
+    auto &output = AtomicOutput::GetInstance();
+    std::string target = File::PathJoin({BASE_PATH, "msprof_1.json"});
+    auto temp = output.Stage(target);
+    EXPECT_EQ(File::PathJoin({BASE_PATH, ".msprof_1.json.tmp"}), temp);
+    EXPECT_EQ(temp, output.Resolve(target));
+    WriteFile(temp, "[]");
+    EXPECT_FALSE(File::Exist(target));
+    EXPECT_TRUE(output.Publish(target));
+    EXPECT_TRUE(File::Exist(target));
+    EXPECT_FALSE(File::Exist(temp));
+    // 发布后不再映射到临时文件
+    EXPECT_EQ(target, output.Resolve(target));
+}
+
+TEST_F(AtomicOutputUTest, ShouldPublishWithSuffixAndDiscardWhenCancelled)
+{
+    auto &output = AtomicOutput::GetInstance();
+    std::string target = File::PathJoin({BASE_PATH, "msprof_2.json"});
+    auto temp = output.Stage(target);
+    WriteFile(temp + ".gz", "data");
+    EXPECT_TRUE(output.Publish(target, ".gz"));
+    EXPECT_TRUE(File::Exist(target + ".gz"));
+
+    std::string cancelled = File::PathJoin({BASE_PATH, "msprof_3.json"});
+    temp = output.Stage(cancelled);
+    WriteFile(temp, "[");
+    output.Discard(cancelled);
+    EXPECT_FALSE(File::Exist(temp));
+    EXPECT_FALSE(File::Exist(cancelled));
+}
+
+TEST_F(AtomicOutputUTest, ShouldRemoveStaleTempFilesExceptStaged)
+{
+    auto &output = AtomicOutput::GetInstance();
+    std::string stale = File::PathJoin({BASE_PATH, ".msprof_4.db.tmp"});
+    std::string manifest = File::PathJoin({BASE_PATH, ".export_manifest"});
+    WriteFile(stale, "stale");
+    WriteFile(manifest, "version");
+    std::string target = File::PathJoin({BASE_PATH, "msprof_5.db"});
+    auto temp = output.Stage(target);
+    WriteFile(temp, "running");
+    output.RemoveStale(BASE_PATH);
+    EXPECT_FALSE(File::Exist(stale));
+    EXPECT_TRUE(File::Exist(manifest));
+    EXPECT_TRUE(File::Exist(temp));
+    output.Discard(target);
+}
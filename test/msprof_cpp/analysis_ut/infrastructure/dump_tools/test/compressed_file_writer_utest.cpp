@@ -0,0 +1,197 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <zlib.h>
+
+#include "gtest/gtest.h"
+#include "analysis/csrc/infrastructure/dump_tools/include/compressed_file_writer.h"
+#include "analysis/csrc/infrastructure/utils/file.h"
+
+using namespace Analysis::Utils;
+using namespace Analysis::Infra;
+
+namespace {
+const int DEPTH = 0;
+const std::string BASE_PATH = "./dump_tools_compressed_writer_utest";
+const size_t INFLATE_CHUNK = 64 * 1024;
+
+// 解压gzip文件，支持多个gzip成员拼接
+bool GunzipFile(const std::string &path, std::string &out)
+{
+    std::ifstream in(path, std::ios::binary);
+    std::stringstream ss;
+    ss << in.rdbuf();
+    std::string data = ss.str();
+    z_stream stream{};
+    if (inflateInit2(&stream, 15 + 32) != Z_OK) {
+        return false;
+    }
+    stream.next_in = reinterpret_cast<Bytef *>(&data[0]);
+    stream.avail_in = static_cast<uInt>(data.size());
+    std::string buffer(INFLATE_CHUNK, '\0');
+    int ret = Z_OK;
+    while (stream.avail_in > 0) {
+        stream.next_out = reinterpret_cast<Bytef *>(&buffer[0]);
+        stream.avail_out = static_cast<uInt>(buffer.size());
+        ret = inflate(&stream, Z_NO_FLUSH);
+        if (ret != Z_OK && ret != Z_STREAM_END) {
+            break;
+        }
+        out.append(buffer.data(), buffer.size() - stream.avail_out);
+        if (ret == Z_STREAM_END && stream.avail_in > 0) {
+            inflateReset(&stream);
+        }
+    }
+    inflateEnd(&stream);
+    return ret == Z_STREAM_END;
+}
+
+std::string MakeContent(size_t len)
+{
+    std::string content;
+    for (size_t i = 0; content.size() < len; ++i) {
+        content.append("{\"name\":\"task_").append(std::to_string(i)).append("\",\"ts\":\"123.456\"},");
+    }
+    content.resize(len);
+    return content;
+}
+}
+
+class CompressedFileWriterUTest : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        if (File::Check(BASE_PATH)) {
+            File::RemoveDir(BASE_PATH, DEPTH);
+        }
+        EXPECT_TRUE(File::CreateDir(BASE_PATH));
+    }
+    static void TearDownTestCase()
+    {
+        EXPECT_TRUE(File::RemoveDir(BASE_PATH, DEPTH));
+    }
+    virtual void TearDown()
+    {
+        CompressedSink::GetInstance().SetCodec(CODEC_NONE);
+    }
+};
+
+TEST_F(CompressedFileWriterUTest, ShouldRoundTripWhenWriteMultiBlocksByMultiThreads)
+{
+    const size_t blockSize = 4096;
+    const uint32_t threadsNum = 4;
+    auto codec = CompressCodecFactory::GetCodec(CODEC_GZIP);
+    ASSERT_NE(nullptr, codec);
+    CompressedFileWriter writer(codec, threadsNum, blockSize);
+    std::string path = File::PathJoin({BASE_PATH, "multi_block.json.gz"});
+    ASSERT_TRUE(writer.Open(path));
+    std::string expect;
+    // 写入大小不一的内容，覆盖跨块的场景
+    for (size_t len : {1UL, 100UL, 5000UL, 40000UL, 3UL, 123457UL}) {
+        auto content = MakeContent(len);
+        EXPECT_TRUE(writer.Write(content.data(), content.size()));
+        expect.append(content);
+    }
+    EXPECT_TRUE(writer.Close());
+    std::string actual;
+    EXPECT_TRUE(GunzipFile(path, actual));
+    EXPECT_EQ(expect, actual);
+}
+
+TEST_F(CompressedFileWriterUTest, ShouldReplaceTailWhenWriteBack)
+{
+    const size_t blockSize = 1024;
+    auto codec = CompressCodecFactory::GetCodec(CODEC_GZIP);
+    CompressedFileWriter writer(codec, 2, blockSize);
+    std::string path = File::PathJoin({BASE_PATH, "write_back.json.gz"});
+    ASSERT_TRUE(writer.Open(path));
+    std::string head = "[";
+    std::string body = MakeContent(blockSize * 10);
+    body.back() = ',';
+    EXPECT_TRUE(writer.Write(head.data(), head.size()));
+    EXPECT_TRUE(writer.Write(body.data(), body.size()));
+    EXPECT_TRUE(writer.WriteBack("]", -1));
+    // 超出未压缩尾部范围的回退失败
+    EXPECT_FALSE(writer.WriteBack("]", -static_cast<int>(blockSize * 2)));
+    EXPECT_TRUE(writer.Close());
+    std::string actual;
+    EXPECT_TRUE(GunzipFile(path, actual));
+    body.back() = ']';
+    EXPECT_EQ(head + body, actual);
+}
+
+TEST_F(CompressedFileWriterUTest, MemoryBoundShouldNotDependOnFileSize)
+{
+    const size_t blockSize = 1024;
+    const uint32_t threadsNum = 2;
+    auto codec = CompressCodecFactory::GetCodec(CODEC_GZIP);
+    CompressedFileWriter writer(codec, threadsNum, blockSize);
+    size_t expect = threadsNum * 2 * (blockSize + codec->Bound(blockSize)) + blockSize +
+        CompressedFileWriter::TAIL_RESERVE_SIZE;
+    EXPECT_EQ(expect, writer.GetMemoryBound());
+}
+
+TEST_F(CompressedFileWriterUTest, ShouldReturnFalseWhenOpenWithoutCodecOrTwice)
+{
+    CompressedFileWriter nullWriter(nullptr);
+    EXPECT_FALSE(nullWriter.Open(File::PathJoin({BASE_PATH, "null.gz"})));
+    CompressedFileWriter writer(CompressCodecFactory::GetCodec(CODEC_GZIP));
+    std::string path = File::PathJoin({BASE_PATH, "twice.gz"});
+    EXPECT_TRUE(writer.Open(path));
+    EXPECT_FALSE(writer.Open(path));
+    EXPECT_TRUE(writer.Close());
+    EXPECT_FALSE(writer.Write("a", 1));
+}
+
+TEST_F(CompressedFileWriterUTest, CodecFactoryShouldSupportRegister)
+{
+    EXPECT_EQ(nullptr, CompressCodecFactory::GetCodec("unknown_codec"));
+    EXPECT_FALSE(CompressCodecFactory::Register(CODEC_GZIP, []() { return std::make_shared<GzipCodec>(); }));
+    EXPECT_FALSE(CompressCodecFactory::Register(CODEC_NONE, []() { return std::make_shared<GzipCodec>(); }));
+    EXPECT_TRUE(CompressCodecFactory::Register("gzip_fast", []() { return std::make_shared<GzipCodec>(1); }));
+    EXPECT_NE(nullptr, CompressCodecFactory::GetCodec("gzip_fast"));
+}
+
+TEST_F(CompressedFileWriterUTest, SinkShouldAppendAndFinishFileWhenEnabled)
+{
+    auto &sink = CompressedSink::GetInstance();
+    EXPECT_FALSE(sink.SetCodec("unknown_codec"));
+    EXPECT_FALSE(sink.IsEnabled());
+    std::string fileName = File::PathJoin({BASE_PATH, "msprof.json"});
+    EXPECT_EQ(fileName, sink.GetFilePath(fileName));
+    EXPECT_FALSE(sink.Append(fileName, "[", 1));
+
+    EXPECT_TRUE(sink.SetCodec(CODEC_GZIP));
+    EXPECT_TRUE(sink.IsEnabled());
+    EXPECT_EQ(fileName + ".gz", sink.GetFilePath(fileName));
+    std::string content = "{\"ph\":\"X\"},";
+    EXPECT_TRUE(sink.Append(fileName, "[", 1));
+    EXPECT_TRUE(sink.Append(fileName, content.data(), content.size()));
+    EXPECT_TRUE(sink.WriteBack(fileName, "]", -1));
+    EXPECT_TRUE(sink.Close(fileName));
+    EXPECT_FALSE(sink.WriteBack(fileName, "]", -1));
+    std::string actual;
+    EXPECT_TRUE(GunzipFile(fileName + ".gz", actual));
+    EXPECT_EQ("[{\"ph\":\"X\"}]", actual);
+
+    std::string csvName = File::PathJoin({BASE_PATH, "op_summary.csv"});
+    EXPECT_TRUE(sink.WriteFile(csvName, "a,b\n1,2\n"));
+    actual.clear();
+    EXPECT_TRUE(GunzipFile(csvName + ".gz", actual));
+    EXPECT_EQ("a,b\n1,2\n", actual);
+}
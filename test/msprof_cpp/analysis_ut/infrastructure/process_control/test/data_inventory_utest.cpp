@@ -13,11 +13,13 @@
  * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
  * See the Mulan PSL v2 for more details.
  * -------------------------------------------------------------------------*/
+#include <map>
 #include <memory>
 #include <vector>
 #include <string>
 #include <gtest/gtest.h>
 #include "analysis/csrc/infrastructure/data_inventory/include/data_inventory.h"
+#include "analysis/csrc/infrastructure/utils/file.h"
 
 using namespace std;
 using namespace testing;
@@ -121,4 +123,148 @@ TEST_F(DataInventoryUTest, ShouldGetDataInventoryFromFunctionReturnByMove)
     }
     ASSERT_TRUE(intPtr);
     EXPECT_EQ(*intPtr, 300);  // 测试数据300
-}
\ No newline at end of file
+}
+TEST_F(DataInventoryUTest, ShouldRejectInjectAndKeepDataWhenFrozen)
+{
+    DataInventory dataInventory;
+    ASSERT_TRUE(dataInventory.Inject(std::make_shared<int>(100)));  // 测试数据100
+    dataInventory.Freeze();
+    EXPECT_FALSE(dataInventory.Inject(std::make_shared<string>("late")));
+    EXPECT_TRUE(dataInventory.RemoveRestData({}).empty());
+    auto intPtr = dataInventory.GetPtr<int>();
+    ASSERT_TRUE(intPtr);
+    EXPECT_EQ(100, *intPtr);  // 测试数据100
+    EXPECT_FALSE(dataInventory.GetPtr<string>());
+
+    // 移动后仍为冻结状态
+    DataInventory moved(std::move(dataInventory));
+    EXPECT_FALSE(moved.Inject(std::make_shared<string>("late")));
+    ASSERT_TRUE(moved.GetPtr<int>());
+}
+
+struct SpillRecord {
+    uint64_t timestamp;
+    uint32_t taskId;
+    uint16_t streamId;
+};
+
+class DataInventoryBudgetUTest : public Test {
+protected:
+    void SetUp() override
+    {
+        DataInventory::SetMemoryBudget(BUDGET_BYTES, SPILL_DIR);
+    }
+    void TearDown() override
+    {
+        DataInventory::SetMemoryBudget(0, "");
+        if (Utils::File::Exist(SPILL_DIR)) {
+            EXPECT_TRUE(Utils::File::RemoveDir(SPILL_DIR, 0));
+        }
+    }
+    static std::shared_ptr<vector<SpillRecord>> MakeRecords(size_t num)
+    {
+        auto records = std::make_shared<vector<SpillRecord>>();
+        for (size_t i = 0; i < num; ++i) {
+            records->push_back({i * 10, static_cast<uint32_t>(i), static_cast<uint16_t>(i % 4)});  // 10: 时间间隔
+        }
+        return records;
+    }
+    const uint64_t BUDGET_BYTES = 1024;
+    const std::string SPILL_DIR = "./data_inventory_spill_utest";
+};
+
+TEST_F(DataInventoryBudgetUTest, ShouldSpillColdVectorAndRestoreWhenGetPtr)
+{
+    const size_t recordNum = 100;  // 100条数据超出预算
+    DataInventory dataInventory;
+    ASSERT_TRUE(dataInventory.Inject(MakeRecords(recordNum)));
+    auto before = DataInventory::GetResidentBytes();
+    // 注入第二份数据后超出预算，最久未访问的数据被换出
+    ASSERT_TRUE(dataInventory.Inject(std::make_shared<vector<uint64_t>>(recordNum, 1)));
+    EXPECT_LT(DataInventory::GetResidentBytes(), before + recordNum * sizeof(uint64_t));
+    EXPECT_GE(DataInventory::GetPeakResidentBytes(), before);
+
+    auto records = dataInventory.GetPtr<vector<SpillRecord>>();
+    ASSERT_TRUE(records);
+    ASSERT_EQ(recordNum, records->size());
+    for (size_t i = 0; i < recordNum; ++i) {
+        EXPECT_EQ(i * 10, records->at(i).timestamp);  // 10: 时间间隔
+        EXPECT_EQ(i, records->at(i).taskId);
+    }
+    auto values = dataInventory.GetPtr<vector<uint64_t>>();
+    ASSERT_TRUE(values);
+    EXPECT_EQ(recordNum, values->size());
+}
+
+TEST_F(DataInventoryBudgetUTest, ShouldRemoveSpillDirWhenInventoryDestroyed)
+{
+    const size_t recordNum = 100;  // 100条数据超出预算
+    {
+        DataInventory dataInventory;
+        ASSERT_TRUE(dataInventory.Inject(MakeRecords(recordNum)));
+        ASSERT_TRUE(dataInventory.Inject(std::make_shared<vector<uint64_t>>(recordNum, 1)));
+        EXPECT_TRUE(Utils::File::Exist(SPILL_DIR));
+    }
+    EXPECT_FALSE(Utils::File::Exist(SPILL_DIR));
+}
+
+TEST_F(DataInventoryBudgetUTest, ShouldNotSpillDataHeldByCaller)
+{
+    const size_t recordNum = 100;  // 100条数据超出预算
+    DataInventory dataInventory;
+    ASSERT_TRUE(dataInventory.Inject(MakeRecords(recordNum)));
+    auto held = dataInventory.GetPtr<vector<SpillRecord>>();
+    ASSERT_TRUE(dataInventory.Inject(std::make_shared<string>("cold")));
+    ASSERT_TRUE(dataInventory.Inject(std::make_shared<vector<uint64_t>>(recordNum, 1)));
+    // 调用方持有的数据不会被换出，修改对后续GetPtr可见
+    held->at(0).taskId = 12345;  // 12345: 修改后的taskId
+    EXPECT_EQ(12345u, dataInventory.GetPtr<vector<SpillRecord>>()->at(0).taskId);
+}
+
+TEST_F(DataInventoryBudgetUTest, ShouldReleaseResidentBytesWhenRemoveData)
+{
+    const size_t recordNum = 10;
+    auto base = DataInventory::GetResidentBytes();
+    {
+        DataInventory dataInventory;
+        ASSERT_TRUE(dataInventory.Inject(MakeRecords(recordNum)));
+        EXPECT_GT(DataInventory::GetResidentBytes(), base);
+        dataInventory.RemoveRestData({});
+        EXPECT_EQ(base, DataInventory::GetResidentBytes());
+        ASSERT_TRUE(dataInventory.Inject(MakeRecords(recordNum)));
+    }
+    EXPECT_EQ(base, DataInventory::GetResidentBytes());
+}
+
+struct NamedRecord {
+    uint64_t timestamp = 0;
+    std::string name;
+};
+
+uint64_t OwnedBytes(const NamedRecord &record)
+{
+    return Utils::OwnedBytesOf(record.name);
+}
+
+TEST_F(DataInventoryBudgetUTest, ShouldAccountOwnedStringsAndContainerNodes)
+{
+    const size_t recordNum = 10;
+    const size_t nameLen = 200;  // 200: 超出短字符串优化长度
+    auto base = DataInventory::GetResidentBytes();
+    DataInventory dataInventory;
+    auto records = std::make_shared<vector<NamedRecord>>(recordNum);
+    for (auto &record : *records) {
+        record.name.assign(nameLen, 'a');
+    }
+    ASSERT_TRUE(dataInventory.Inject(records));
+    records.reset();
+    EXPECT_GE(DataInventory::GetResidentBytes() - base, recordNum * (sizeof(NamedRecord) + nameLen));
+
+    auto before = DataInventory::GetResidentBytes();
+    auto table = std::make_shared<std::map<uint32_t, vector<uint64_t>>>();
+    for (uint32_t i = 0; i < recordNum; ++i) {
+        (*table)[i].assign(recordNum, i);
+    }
+    ASSERT_TRUE(dataInventory.Inject(table));
+    EXPECT_GE(DataInventory::GetResidentBytes() - before, recordNum * recordNum * sizeof(uint64_t));
+}
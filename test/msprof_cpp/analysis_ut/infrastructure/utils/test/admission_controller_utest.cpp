@@ -0,0 +1,166 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+#include <atomic>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "analysis/csrc/infrastructure/utils/admission_controller.h"
+
+using namespace Analysis::Utils;
+
+namespace {
+const uint64_t MB = 1024 * 1024;
+}
+
+class AdmissionControllerUTest : public testing::Test {
+protected:
+    virtual void TearDown()
+    {
+        unsetenv(ADMISSION_MEMORY_ENV);
+        unsetenv(ADMISSION_CPU_ENV);
+    }
+};
+
+TEST_F(AdmissionControllerUTest, ShouldPlanBiggestFirstAndKeepOrderWhenEqual)
+{
+    AdmissionController controller(1024 * MB, 8);
+    controller.SetFootprintRatio(2.0);  // 2.0: 每字节输入占用2字节
+    controller.AddJob(100 * MB);
+    controller.AddJob(300 * MB);
+    controller.AddJob(100 * MB);
+    controller.AddJob(200 * MB);
+    EXPECT_EQ(std::vector<size_t>({1, 3, 0, 2}), controller.Plan());
+    EXPECT_EQ(200 * MB, controller.Estimate(100 * MB));
+    // 估计占用有下限
+    EXPECT_EQ(64 * MB, controller.Estimate(1));
+}
+
+TEST_F(AdmissionControllerUTest, ShouldLimitConcurrencyByMemoryBudget)
+{
+    // 输入较小，每个job按下限估计占用64MB，预算只允许两个同时运行
+    const size_t jobNum = 6;
+    AdmissionController controller(150 * MB, 16);
+    for (size_t i = 0; i < jobNum; ++i) {
+        controller.AddJob(5 * MB);
+    }
+    std::atomic<int> running{0};
+    std::atomic<int> maxRunning{0};
+    std::vector<std::thread> threads;
+    for (auto job : controller.Plan()) {
+        threads.emplace_back([&controller, &running, &maxRunning, job]() {
+            AdmissionGuard guard(controller, job);
+            auto now = ++running;
+            int expect = maxRunning.load();
+            while (now > expect && !maxRunning.compare_exchange_weak(expect, now)) {}
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));  // 20: 模拟job运行
+            --running;
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(2, maxRunning.load());
+}
+
+TEST_F(AdmissionControllerUTest, ShouldLimitConcurrencyByCpuBudget)
+{
+    AdmissionController controller(0, 2);
+    controller.AddJob(MB, 1);
+    controller.AddJob(MB, 2);
+    controller.AddJob(MB, 1);
+    auto order = controller.Plan();
+    EXPECT_TRUE(controller.Acquire(order[0]));
+    EXPECT_EQ(2U, controller.GetCpuBudget());
+    std::atomic<bool> admitted{false};
+    std::thread second([&controller, &admitted, &order]() {
+        controller.Acquire(order[1]);
+        admitted = true;
+        controller.Release(order[1]);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));  // 50: 等待第二个job尝试准入
+    EXPECT_FALSE(admitted.load());
+    controller.Release(order[0]);
+    second.join();
+    EXPECT_TRUE(admitted.load());
+    // 重复准入或未规划的job直接返回失败
+    EXPECT_FALSE(controller.Acquire(order[0]));
+    EXPECT_FALSE(controller.Acquire(10));  // 10: 不存在的job
+}
+
+TEST_F(AdmissionControllerUTest, ShouldAdmitOversizedJobWhenNothingRunning)
+{
+    AdmissionController controller(100 * MB, 4);
+    controller.AddJob(1024 * MB);
+    auto order = controller.Plan();
+    EXPECT_TRUE(controller.Acquire(order[0]));
+    controller.Release(order[0]);
+}
+
+TEST_F(AdmissionControllerUTest, ShouldUpdateFootprintRatioByFeedback)
+{
+    AdmissionController controller(1024 * MB, 8);
+    controller.SetFootprintRatio(2.0);  // 2.0: 每字节输入占用2字节
+    // 输入过小时不修正
+    controller.Feedback(100 * MB, MB);
+    EXPECT_DOUBLE_EQ(2.0, controller.GetFootprintRatio());
+    controller.Feedback(300 * MB, 100 * MB);
+    EXPECT_DOUBLE_EQ(3.0, controller.GetFootprintRatio());
+    // 观测值偏小时只下调一半
+    controller.Feedback(200 * MB, 100 * MB);
+    EXPECT_DOUBLE_EQ(2.5, controller.GetFootprintRatio());
+    // 比例限制在[1, 64]
+    controller.SetFootprintRatio(1.5);
+    controller.Feedback(10 * MB, 100 * MB);
+    EXPECT_DOUBLE_EQ(1.0, controller.GetFootprintRatio());
+    controller.Feedback(100000 * MB, 100 * MB);
+    EXPECT_DOUBLE_EQ(64.0, controller.GetFootprintRatio());
+    // 比例只在本轮内有效，新的控制器从默认比例开始
+    AdmissionController next(1024 * MB, 8);
+    EXPECT_DOUBLE_EQ(4.0, next.GetFootprintRatio());  // 4.0: 默认比例
+}
+
+TEST_F(AdmissionControllerUTest, ShouldNotCountRetainedOutputOfFinishedJobs)
+{
+    // 每个job输入16MB，结束后保留64MB输出；扣除已结束job的输出后，比例稳定在4左右，不随job数累加
+    const uint64_t retainedPerJob = 64 * MB;
+    std::vector<std::vector<char>> outputs;
+    AdmissionController controller(0, 1);
+    controller.SetRetainedBytesProbe([&outputs]() { return outputs.size() * retainedPerJob; });
+    const size_t jobNum = 3;
+    for (size_t i = 0; i < jobNum; ++i) {
+        controller.AddJob(16 * MB);
+    }
+    for (auto job : controller.Plan()) {
+        ASSERT_TRUE(controller.Acquire(job));
+        outputs.emplace_back(retainedPerJob, 1);
+        controller.Release(job);
+    }
+    EXPECT_LT(controller.GetFootprintRatio(), 6.0);  // 6.0: 不扣除时第3个job后比例约为12
+}
+
+TEST_F(AdmissionControllerUTest, ShouldReadBudgetFromEnvWhenNotSpecified)
+{
+    setenv(ADMISSION_MEMORY_ENV, "512", 1);
+    setenv(ADMISSION_CPU_ENV, "3", 1);
+    AdmissionController controller;
+    EXPECT_EQ(512 * MB, controller.GetMemoryBudget());
+    EXPECT_EQ(3U, controller.GetCpuBudget());
+    AdmissionController specified(MB, 1);
+    EXPECT_EQ(MB, specified.GetMemoryBudget());
+    EXPECT_EQ(1U, specified.GetCpuBudget());
+}
@@ -0,0 +1,113 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+#include <cstdint>
+#include <string>
+#include <thread>
+#include "gtest/gtest.h"
+
+#include "analysis/csrc/infrastructure/utils/arena_allocator.h"
+
+using namespace Analysis::Utils;
+
+class ArenaAllocatorUTest : public testing::Test {
+protected:
+    virtual void TearDown()
+    {
+        ArenaStageScope::ClearStageStats();
+    }
+};
+
+TEST_F(ArenaAllocatorUTest, ShouldAllocateAlignedMemoryFromChunks)
+{
+    const size_t chunkSize = 4096;
+    Arena arena(chunkSize);
+    auto a = static_cast<char *>(arena.Allocate(3, 1));
+    auto b = arena.Allocate(8, 8);
+    auto c = arena.Allocate(16, 64);  // 64: 缓存行对齐
+    ASSERT_NE(nullptr, a);
+    ASSERT_NE(nullptr, b);
+    ASSERT_NE(nullptr, c);
+    EXPECT_EQ(0U, reinterpret_cast<uintptr_t>(b) % 8);
+    EXPECT_EQ(0U, reinterpret_cast<uintptr_t>(c) % 64);
+    EXPECT_GE(static_cast<char *>(b), a + 3);
+    EXPECT_EQ(1U, arena.GetStats().chunks);
+    // 大对象单独申请一块，不影响当前块继续使用
+    EXPECT_NE(nullptr, arena.Allocate(chunkSize * 2));
+    EXPECT_EQ(2U, arena.GetStats().chunks);
+    auto d = static_cast<char *>(arena.Allocate(8, 8));
+    EXPECT_LT(d - static_cast<char *>(c), static_cast<ptrdiff_t>(chunkSize));
+    // 当前块用尽后申请新块
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_NE(nullptr, arena.Allocate(100));
+    }
+    EXPECT_GT(arena.GetStats().chunks, 2U);
+    EXPECT_EQ(1005U, arena.GetStats().allocations);
+    EXPECT_EQ(nullptr, arena.Allocate(8, 3));
+    arena.Release();
+    EXPECT_NE(nullptr, arena.Allocate(8));
+}
+
+TEST_F(ArenaAllocatorUTest, ContainersShouldWorkWithArenaAllocator)
+{
+    Arena arena;
+    {
+        ArenaUnorderedMap<std::string, int> counts(ArenaAllocator<char>{arena});
+        ArenaMap<uint32_t, std::string> names(ArenaAllocator<char>{arena});
+        ArenaVector<uint64_t> values(ArenaAllocator<char>{arena});
+        for (uint32_t i = 0; i < 1000; ++i) {
+            counts[std::to_string(i % 10)]++;
+            names.emplace(i, std::to_string(i));
+            values.push_back(i);
+        }
+        EXPECT_EQ(10U, counts.size());
+        EXPECT_EQ(100, counts["3"]);
+        EXPECT_EQ("999", names.rbegin()->second);
+        EXPECT_EQ(999U, values.back());
+    }
+    EXPECT_GT(arena.GetStats().allocations, 1000U);
+    EXPECT_NE(nullptr, HeapBackendName());
+    TrimHeap();
+}
+
+TEST_F(ArenaAllocatorUTest, StageScopeShouldRecordStatsAndReleaseAtOutermost)
+{
+    {
+        ArenaStageScope outer("outer");
+        StageArena().Allocate(100);
+        {
+            ArenaStageScope inner("inner");
+            StageArena().Allocate(200);
+            StageArena().Allocate(300);
+        }
+        // 嵌套作用域结束时不释放
+        EXPECT_GT(StageArena().GetStats().chunks, 0U);
+    }
+    auto stats = ArenaStageScope::GetStageStats();
+    ASSERT_EQ(2U, stats.size());
+    EXPECT_EQ(3U, stats["outer"].arena.allocations);
+    EXPECT_EQ(600U, stats["outer"].arena.bytes);
+    EXPECT_EQ(2U, stats["inner"].arena.allocations);
+    EXPECT_EQ(1U, stats["inner"].count);
+    // 其他线程的阶段使用各自的Arena
+    std::thread worker([]() {
+        ArenaStageScope scope("outer");
+        StageArena().Allocate(10);
+    });
+    worker.join();
+    stats = ArenaStageScope::GetStageStats();
+    EXPECT_EQ(2U, stats["outer"].count);
+    EXPECT_EQ(4U, stats["outer"].arena.allocations);
+}
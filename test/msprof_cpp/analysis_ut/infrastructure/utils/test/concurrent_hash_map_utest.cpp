@@ -0,0 +1,142 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+#include <string>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "analysis/csrc/infrastructure/utils/concurrent_hash_map.h"
+
+using namespace Analysis::Utils;
+
+class ConcurrentHashMapUTest : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+    }
+    virtual void TearDown()
+    {
+    }
+};
+
+/* 单线程验证 ConcurrentHashMap 增删查改 */
+TEST_F(ConcurrentHashMapUTest, SingleThreadTestCUID)
+{
+    ConcurrentHashMap<std::string, int> testMap(4);
+    EXPECT_TRUE(testMap.Empty());
+    EXPECT_TRUE(testMap.Insert("a", 1));
+    EXPECT_FALSE(testMap.Insert("a", 2));
+    EXPECT_TRUE(testMap.Update("b", [](int &value) { value += 2; }));
+    EXPECT_TRUE(testMap.Update("b", [](int &value) { value += 2; }));
+    int value = 0;
+    EXPECT_TRUE(testMap.Find("b", value));
+    EXPECT_EQ(4, value);
+    EXPECT_FALSE(testMap.Find("c"));
+    EXPECT_EQ(2ul, testMap.Size());
+    EXPECT_TRUE(testMap.Erase("a"));
+    EXPECT_FALSE(testMap.Erase("a"));
+    EXPECT_EQ(1ul, testMap.Size());
+    // 未冻结时不支持免锁获取
+    EXPECT_EQ(nullptr, testMap.Get("b"));
+    testMap.Clear();
+    EXPECT_TRUE(testMap.Empty());
+}
+
+/* 冻结后拒绝写入，查找免锁，拷贝保留冻结状态 */
+TEST_F(ConcurrentHashMapUTest, ShouldRejectWriteAndReadWithoutLockWhenFrozen)
+{
+    ConcurrentHashMap<uint32_t, std::string> testMap;
+    EXPECT_TRUE(testMap.Insert(1, "one"));
+    testMap.Freeze();
+    EXPECT_TRUE(testMap.IsFrozen());
+    EXPECT_FALSE(testMap.Insert(2, "two"));
+    EXPECT_FALSE(testMap.Update(1, [](std::string &value) { value = "uno"; }));
+    EXPECT_FALSE(testMap.Erase(1));
+    auto ptr = testMap.Get(1);
+    ASSERT_NE(nullptr, ptr);
+    EXPECT_EQ("one", *ptr);
+    EXPECT_EQ(nullptr, testMap.Get(2));
+
+    auto copyMap = testMap;
+    EXPECT_TRUE(copyMap.IsFrozen());
+    EXPECT_EQ(1ul, copyMap.Size());
+    copyMap.Clear();
+    EXPECT_FALSE(copyMap.IsFrozen());
+    EXPECT_TRUE(copyMap.Insert(2, "two"));
+    EXPECT_EQ(1ul, testMap.Size());
+}
+
+/* 多线程并发写入不同和相同的key，冻结后多线程读取结果完整 */
+TEST_F(ConcurrentHashMapUTest, MultiThreadUpdateThenFreezeShouldKeepAllData)
+{
+    const uint32_t threadsNum = 8;
+    const uint32_t keyNum = 1000;
+    ConcurrentHashMap<uint32_t, uint32_t> testMap;
+    std::vector<std::thread> writers;
+    for (uint32_t t = 0; t < threadsNum; ++t) {
+        writers.emplace_back([&testMap, keyNum]() {
+            for (uint32_t key = 0; key < keyNum; ++key) {
+                testMap.Update(key, [](uint32_t &value) { ++value; });
+            }
+        });
+    }
+    for (auto &writer : writers) {
+        writer.join();
+    }
+    testMap.Freeze();
+    EXPECT_EQ(keyNum, testMap.Size());
+
+    std::vector<std::thread> readers;
+    std::vector<uint32_t> sums(threadsNum, 0);
+    for (uint32_t t = 0; t < threadsNum; ++t) {
+        readers.emplace_back([&testMap, &sums, t, keyNum]() {
+            for (uint32_t key = 0; key < keyNum; ++key) {
+                auto ptr = testMap.Get(key);
+                sums[t] += ptr == nullptr ? 0 : *ptr;
+            }
+        });
+    }
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    for (auto sum : sums) {
+        EXPECT_EQ(threadsNum * keyNum, sum);
+    }
+    uint32_t total = 0;
+    testMap.ForEach([&total](const uint32_t &, const uint32_t &value) { total += value; });
+    EXPECT_EQ(threadsNum * keyNum, total);
+}
+
+/* 移动后接管数据与冻结状态，被移动的map回到空的构建阶段 */
+TEST_F(ConcurrentHashMapUTest, ShouldTakeOverDataAndFrozenStateWhenMove)
+{
+    ConcurrentHashMap<uint32_t, std::string> testMap;
+    EXPECT_TRUE(testMap.Insert(1, "one"));
+    testMap.Freeze();
+    ConcurrentHashMap<uint32_t, std::string> movedMap(std::move(testMap));
+    EXPECT_TRUE(movedMap.IsFrozen());
+    ASSERT_NE(nullptr, movedMap.Get(1));
+    EXPECT_EQ("one", *movedMap.Get(1));
+    EXPECT_FALSE(testMap.IsFrozen());
+    EXPECT_TRUE(testMap.Empty());
+    EXPECT_TRUE(testMap.Insert(2, "two"));
+
+    ConcurrentHashMap<uint32_t, std::string> assignedMap;
+    assignedMap = std::move(movedMap);
+    EXPECT_TRUE(assignedMap.IsFrozen());
+    EXPECT_EQ(1ul, assignedMap.Size());
+    EXPECT_TRUE(movedMap.Empty());
+}
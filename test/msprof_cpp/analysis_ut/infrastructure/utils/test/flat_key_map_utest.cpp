@@ -0,0 +1,91 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+#include <random>
+#include <string>
+#include <unordered_map>
+#include "gtest/gtest.h"
+
+#include "analysis/csrc/infrastructure/utils/flat_key_map.h"
+
+using namespace Analysis::Utils;
+
+class FlatKeyMapUTest : public testing::Test {};
+
+TEST_F(FlatKeyMapUTest, PackedKeyShouldKeepFieldsSeparated)
+{
+    using Key = PackedKey<16, 32, 16>;
+    EXPECT_EQ(0x0001000000020003ULL, Key::Pack(1, 2, 3));
+    EXPECT_NE(Key::Pack(1, 2, 3), Key::Pack(1, 3, 2));
+    // 超出位宽的高位被截断，不会串入相邻字段
+    EXPECT_EQ(Key::Pack(0, 0, 0xFFFF), Key::Pack(0, 0, 0x1FFFF));
+    EXPECT_EQ(UINT64_MAX, PackedKey<64>::Pack(UINT64_MAX));
+}
+
+TEST_F(FlatKeyMapUTest, ShouldFindInsertedValuesAndKeepInsertionOrder)
+{
+    FlatKeyMap<std::string> map;
+    EXPECT_TRUE(map.Empty());
+    EXPECT_EQ(nullptr, map.Find(1));
+    EXPECT_TRUE(map.Emplace(3, "c").second);
+    EXPECT_TRUE(map.Emplace(1, "a").second);
+    EXPECT_FALSE(map.Emplace(3, "x").second);
+    map[2] += "b";
+    ASSERT_NE(nullptr, map.Find(3));
+    EXPECT_EQ("c", *map.Find(3));
+    const std::string defaultValue;
+    EXPECT_EQ("b", map.Get(2, defaultValue));
+    EXPECT_EQ(&defaultValue, &map.Get(4, defaultValue));
+    std::vector<uint64_t> keys;
+    for (const auto &pair : map) {
+        keys.push_back(pair.first);
+    }
+    EXPECT_EQ(std::vector<uint64_t>({3, 1, 2}), keys);
+}
+
+TEST_F(FlatKeyMapUTest, ShouldMatchUnorderedMapWhenRandomInsertAndErase)
+{
+    const size_t opNum = 100000;
+    const uint64_t keyRange = 5000;
+    FlatKeyMap<uint64_t> map;
+    ASSERT_TRUE(map.Reserve(16));
+    std::unordered_map<uint64_t, uint64_t> expect;
+    std::mt19937_64 gen(opNum);
+    std::uniform_int_distribution<uint64_t> dist(0, keyRange);
+    for (size_t i = 0; i < opNum; ++i) {
+        // 键集中在低位和高位，覆盖探测链的回移
+        auto key = dist(gen) << (i % 2 == 0 ? 0 : 48);
+        if (gen() % 3 == 0) {
+            EXPECT_EQ(expect.erase(key) > 0, map.Erase(key));
+        } else {
+            map[key] = i;
+            expect[key] = i;
+        }
+    }
+    ASSERT_EQ(expect.size(), map.Size());
+    for (const auto &pair : expect) {
+        ASSERT_NE(nullptr, map.Find(pair.first));
+        EXPECT_EQ(pair.second, *map.Find(pair.first));
+    }
+    size_t count = 0;
+    for (const auto &pair : map) {
+        EXPECT_EQ(expect[pair.first], pair.second);
+        ++count;
+    }
+    EXPECT_EQ(expect.size(), count);
+    map.Clear();
+    EXPECT_TRUE(map.Empty());
+    EXPECT_FALSE(map.Contains(0));
+}
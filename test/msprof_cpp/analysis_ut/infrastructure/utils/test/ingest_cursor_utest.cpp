@@ -0,0 +1,198 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#include <fstream>
+#include "gtest/gtest.h"
+
+#include "analysis/csrc/infrastructure/utils/file.h"
+#include "analysis/csrc/infrastructure/utils/ingest_cursor.h"
+
+using namespace Analysis::Utils;
+
+namespace {
+const int DEPTH = 0;
+const uint64_t RECORD_SIZE = 4;
+const std::string DATA_PATH = "./ingest_cursor_utest";
+
+void AppendFile(const std::string &path, const std::string &content)
+{
+    std::ofstream out(path, std::ios::app | std::ios::binary);
+    out << content;
+}
+
+// 按游标读取一次新增数据并推进游标
+std::string ReadNew(const std::vector<std::string> &files, bool skipPartialHead = false)
+{
+    auto &cursor = IngestCursor::GetInstance();
+    uint64_t bytes = 0;
+    auto segments = cursor.Plan(DATA_PATH, files, RECORD_SIZE, skipPartialHead, bytes);
+    std::string data(bytes, '\0');
+    EXPECT_TRUE(IngestCursor::ReadSegments(segments, &data[0]));
+    cursor.Advance(DATA_PATH, segments);
+    return data;
+}
+}
+
+class IngestCursorUTest : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        if (File::Check(DATA_PATH)) {
+            File::RemoveDir(DATA_PATH, DEPTH);
+        }
+        EXPECT_TRUE(File::CreateDir(DATA_PATH));
+        file0_ = File::PathJoin({DATA_PATH, "ts_track.data.0.slice_0"});
+        file1_ = File::PathJoin({DATA_PATH, "ts_track.data.0.slice_1"});
+    }
+    virtual void TearDown()
+    {
+        IngestCursor::GetInstance().Discard(DATA_PATH);
+        // 清理单例中已加载的游标
+        IngestCursor::GetInstance().committed_.clear();
+        EXPECT_TRUE(File::RemoveDir(DATA_PATH, DEPTH));
+    }
+
+protected:
+    std::string file0_;
+    std::string file1_;
+};
+
+TEST_F(IngestCursorUTest, ShouldOnlyReadNewCompleteRecordsWhenFilesGrow)
+{
+    AppendFile(file0_, "aaaabb");
+    EXPECT_EQ("aaaa", ReadNew({file0_}));
+    EXPECT_TRUE(IngestCursor::GetInstance().Commit(DATA_PATH));
+    // 不完整记录跨文件拼接
+    AppendFile(file0_, "bb");
+    AppendFile(file1_, "cccc");
+    EXPECT_EQ("bbbbcccc", ReadNew({file0_, file1_}));
+    EXPECT_TRUE(IngestCursor::GetInstance().Commit(DATA_PATH));
+    EXPECT_EQ("", ReadNew({file0_, file1_}));
+}
+
+TEST_F(IngestCursorUTest, ShouldKeepTailAcrossFilesWhenRecordIsSplit)
+{
+    AppendFile(file0_, "aaaab");
+    AppendFile(file1_, "bb");
+    EXPECT_EQ("aaaa", ReadNew({file0_, file1_}));
+    EXPECT_TRUE(IngestCursor::GetInstance().Commit(DATA_PATH));
+    AppendFile(file1_, "b");
+    EXPECT_EQ("bbbb", ReadNew({file0_, file1_}));
+}
+
+TEST_F(IngestCursorUTest, ShouldSkipPartialHeadOnFirstReadAndTrimTailAfterwards)
+{
+    // 老化后首个文件头部为半条记录，与全量解析一致从头部跳过
+    AppendFile(file0_, "xaaa");
+    AppendFile(file1_, "abbbb");
+    EXPECT_EQ("aaaabbbb", ReadNew({file0_, file1_}, true));
+    EXPECT_TRUE(IngestCursor::GetInstance().Commit(DATA_PATH));
+    // 已有游标后余数来自未写完的末尾记录
+    AppendFile(file1_, "cc");
+    EXPECT_EQ("", ReadNew({file0_, file1_}, true));
+    AppendFile(file1_, "cc");
+    EXPECT_EQ("cccc", ReadNew({file0_, file1_}, true));
+}
+
+TEST_F(IngestCursorUTest, ShouldAdvancePastSkippedHeadWhenWholeFirstFileIsPartial)
+{
+    AppendFile(file0_, "xx");
+    AppendFile(file1_, "aaaa");
+    EXPECT_EQ("aaaa", ReadNew({file0_, file1_}, true));
+    EXPECT_TRUE(IngestCursor::GetInstance().Commit(DATA_PATH));
+    AppendFile(file1_, "bbbb");
+    EXPECT_EQ("bbbb", ReadNew({file0_, file1_}, true));
+}
+
+TEST_F(IngestCursorUTest, ShouldRereadWhenDiscardOrCursorNotCommitted)
+{
+    AppendFile(file0_, "aaaa");
+    EXPECT_EQ("aaaa", ReadNew({file0_}));
+    // 未提交时再次读取仍从已提交位置开始
+    EXPECT_EQ("aaaa", ReadNew({file0_}));
+    IngestCursor::GetInstance().Discard(DATA_PATH);
+    EXPECT_TRUE(IngestCursor::GetInstance().Commit(DATA_PATH));
+    EXPECT_EQ("aaaa", ReadNew({file0_}));
+}
+
+TEST_F(IngestCursorUTest, ShouldLoadCommittedCursorFromFile)
+{
+    AppendFile(file0_, "aaaa");
+    ReadNew({file0_});
+    EXPECT_TRUE(IngestCursor::GetInstance().Commit(DATA_PATH));
+    EXPECT_TRUE(File::Exist(IngestCursor::GetInstance().GetCursorPath(DATA_PATH)));
+    IngestCursor::GetInstance().committed_.clear();
+    AppendFile(file0_, "bbbb");
+    EXPECT_EQ("bbbb", ReadNew({file0_}));
+}
+
+TEST_F(IngestCursorUTest, ShouldReadFromBeginningWhenFileShrink)
+{
+    AppendFile(file0_, "aaaabbbb");
+    ReadNew({file0_});
+    EXPECT_TRUE(IngestCursor::GetInstance().Commit(DATA_PATH));
+    EXPECT_TRUE(File::DeleteFile(file0_));
+    AppendFile(file0_, "cccc");
+    EXPECT_EQ("cccc", ReadNew({file0_}));
+}
+
+TEST_F(IngestCursorUTest, ShouldReturnEmptyPlanWhenRecordSizeIsZero)
+{
+    AppendFile(file0_, "aaaa");
+    uint64_t bytes = 1;
+    EXPECT_TRUE(IngestCursor::GetInstance().Plan(DATA_PATH, {file0_}, 0, false, bytes).empty());
+    EXPECT_EQ(0UL, bytes);
+}
+
+TEST_F(IngestCursorUTest, ShouldReplayCarriedRecordsAfterCommit)
+{
+    auto &cursor = IngestCursor::GetInstance();
+    EXPECT_EQ("", cursor.TakeCarried(DATA_PATH, "start"));
+    cursor.Carry(DATA_PATH, "start", "aaaa");
+    // 未提交时保留记录不生效
+    EXPECT_EQ("", cursor.TakeCarried(DATA_PATH, "start"));
+    EXPECT_TRUE(cursor.Commit(DATA_PATH));
+    EXPECT_EQ("aaaa", cursor.TakeCarried(DATA_PATH, "start"));
+    // 失败丢弃后仍重放上次提交的记录
+    cursor.Carry(DATA_PATH, "start", "bbbb");
+    cursor.Discard(DATA_PATH);
+    EXPECT_EQ("aaaa", cursor.TakeCarried(DATA_PATH, "start"));
+    cursor.Carry(DATA_PATH, "start", "bbbb");
+    EXPECT_TRUE(cursor.Commit(DATA_PATH));
+    EXPECT_EQ("bbbb", cursor.TakeCarried(DATA_PATH, "start"));
+}
+
+TEST_F(IngestCursorUTest, ShouldClearCarriedRecordsWhenTakenAndNotCarriedAgain)
+{
+    auto &cursor = IngestCursor::GetInstance();
+    cursor.Carry(DATA_PATH, "start", "aaaa");
+    cursor.Carry(DATA_PATH, "other", "cccc");
+    EXPECT_TRUE(cursor.Commit(DATA_PATH));
+    EXPECT_EQ("aaaa", cursor.TakeCarried(DATA_PATH, "start"));
+    EXPECT_TRUE(cursor.Commit(DATA_PATH));
+    EXPECT_FALSE(File::Exist(cursor.GetCarryPath(DATA_PATH, "start")));
+    EXPECT_EQ("", cursor.TakeCarried(DATA_PATH, "start"));
+    // 本次未取回的记录保持不变
+    EXPECT_EQ("cccc", cursor.TakeCarried(DATA_PATH, "other"));
+}
+
+TEST_F(IngestCursorUTest, ShouldPackAndUnpackFixedSizeRecords)
+{
+    std::string records;
+    IngestCursor::AppendRecord(records, uint32_t{1});
+    IngestCursor::AppendRecord(records, uint32_t{2});
+    EXPECT_EQ((std::vector<uint32_t>{1, 2}), IngestCursor::UnpackRecords<uint32_t>(records));
+}
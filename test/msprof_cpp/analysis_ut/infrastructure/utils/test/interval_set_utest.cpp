@@ -0,0 +1,124 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+#include <random>
+#include <utility>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "analysis/csrc/infrastructure/utils/interval_set.h"
+
+using namespace Analysis::Utils;
+
+namespace {
+using Sections = std::vector<std::pair<uint64_t, uint64_t>>;
+
+IntervalSet MakeSet(const Sections &sections)
+{
+    IntervalSet set;
+    for (const auto &section : sections) {
+        set.Add(section.first, section.second);
+    }
+    set.Normalize();
+    return set;
+}
+
+Sections ToSections(const IntervalSet &set)
+{
+    Sections sections;
+    for (size_t i = 0; i < set.Size(); ++i) {
+        sections.emplace_back(set.Start(i), set.End(i));
+    }
+    return sections;
+}
+
+// 按单位时间逐点标记覆盖情况
+std::vector<bool> Cover(const IntervalSet &set, uint64_t range)
+{
+    std::vector<bool> cover(range, false);
+    for (size_t i = 0; i < set.Size(); ++i) {
+        for (uint64_t t = set.Start(i); t < set.End(i); ++t) {
+            cover[t] = true;
+        }
+    }
+    return cover;
+}
+}
+
+class IntervalSetUTest : public testing::Test {
+};
+
+TEST_F(IntervalSetUTest, NormalizeShouldSortAndMergeOverlappedAndAdjacentSections)
+{
+    IntervalSet set;
+    set.Add(30, 40);
+    set.Add(10, 20);
+    set.Add(20, 25);
+    set.Add(35, 50);
+    set.Add(60, 60);
+    set.Add(5, 1);  // 非法区间忽略
+    set.Normalize();
+    Sections expect{{10, 25}, {30, 50}, {60, 60}};
+    EXPECT_EQ(expect, ToSections(set));
+    EXPECT_EQ(35ULL, set.Coverage());
+}
+
+TEST_F(IntervalSetUTest, DifferenceShouldRemoveSectionsCoveredBySpanningSection)
+{
+    auto comm = MakeSet({{0, 6}, {7, 10}, {15, 20}});
+    auto comp = MakeSet({{3, 19}});
+    Sections expect{{0, 3}, {19, 20}};
+    EXPECT_EQ(expect, ToSections(IntervalSet::Difference(comm, comp)));
+    EXPECT_EQ(ToSections(comm), ToSections(IntervalSet::Difference(comm, IntervalSet())));
+    EXPECT_TRUE(IntervalSet::Difference(IntervalSet(), comp).Empty());
+}
+
+TEST_F(IntervalSetUTest, UnionAndIntersectShouldMergeBothSides)
+{
+    auto lhs = MakeSet({{0, 5}, {10, 15}, {20, 30}});
+    auto rhs = MakeSet({{5, 8}, {12, 22}, {40, 41}});
+    Sections unionExpect{{0, 8}, {10, 30}, {40, 41}};
+    Sections intersectExpect{{12, 15}, {20, 22}};
+    EXPECT_EQ(unionExpect, ToSections(IntervalSet::Union(lhs, rhs)));
+    EXPECT_EQ(intersectExpect, ToSections(IntervalSet::Intersect(lhs, rhs)));
+}
+
+TEST_F(IntervalSetUTest, SetOperationsShouldMatchPointwiseResultWhenSectionsAreRandom)
+{
+    const uint64_t range = 64;
+    std::mt19937_64 gen(1);
+    for (int round = 0; round < 2000; ++round) {
+        IntervalSet lhs;
+        IntervalSet rhs;
+        for (int i = 0; i < 8; ++i) {  // 8: 每侧区间数
+            uint64_t start = gen() % 48;
+            lhs.Add(start, start + gen() % 12);
+            start = gen() % 48;
+            rhs.Add(start, start + gen() % 12);
+        }
+        lhs.Normalize();
+        rhs.Normalize();
+        auto lhsCover = Cover(lhs, range);
+        auto rhsCover = Cover(rhs, range);
+        auto unionCover = Cover(IntervalSet::Union(lhs, rhs), range);
+        auto intersectCover = Cover(IntervalSet::Intersect(lhs, rhs), range);
+        auto diffCover = Cover(IntervalSet::Difference(lhs, rhs), range);
+        for (uint64_t t = 0; t < range; ++t) {
+            ASSERT_EQ(lhsCover[t] || rhsCover[t], unionCover[t]);
+            ASSERT_EQ(lhsCover[t] && rhsCover[t], intersectCover[t]);
+            ASSERT_EQ(lhsCover[t] && !rhsCover[t], diffCover[t]);
+        }
+    }
+}
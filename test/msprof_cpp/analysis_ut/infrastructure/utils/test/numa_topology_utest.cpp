@@ -0,0 +1,191 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <fstream>
+#include "gtest/gtest.h"
+
+#include "analysis/csrc/infrastructure/utils/file.h"
+#include "analysis/csrc/infrastructure/utils/numa_topology.h"
+
+using namespace Analysis::Utils;
+
+namespace {
+const int DEPTH = 0;
+const std::string BASE_PATH = "./numa_topology_utest";
+const int MPOL_DEFAULT_MODE = 0;
+const int MPOL_INTERLEAVE_MODE = 3;
+const unsigned long MAX_NODE = 1024;
+
+void WriteNode(const std::string &name, const std::string &cpuList)
+{
+    auto dir = File::PathJoin({BASE_PATH, name});
+    EXPECT_TRUE(File::CreateDir(dir));
+    std::ofstream out(File::PathJoin({dir, "cpulist"}), std::ios::trunc);
+    out << cpuList;
+}
+
+int GetMemMode(std::vector<unsigned long> &mask)
+{
+    int mode = -1;
+    mask.assign(MAX_NODE / (sizeof(unsigned long) * 8), 0);  // 8: 每字节位数
+    syscall(SYS_get_mempolicy, &mode, mask.data(), MAX_NODE, nullptr, 0);
+    return mode;
+}
+
+int GetFirstAllowedCpu()
+{
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    sched_getaffinity(0, sizeof(cpus), &cpus);
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &cpus)) {
+            return cpu;
+        }
+    }
+    return 0;
+}
+}
+
+class NumaTopologyUTest : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        if (File::Check(BASE_PATH)) {
+            File::RemoveDir(BASE_PATH, DEPTH);
+        }
+        EXPECT_TRUE(File::CreateDir(BASE_PATH));
+    }
+    virtual void TearDown()
+    {
+        unsetenv(NUMA_BIND_ENV);
+        NumaTopology::GetInstance().Load(BASE_PATH + "_not_exist");
+        EXPECT_TRUE(File::RemoveDir(BASE_PATH, DEPTH));
+    }
+};
+
+TEST_F(NumaTopologyUTest, ShouldParseCpuList)
+{
+    std::vector<int> cpus;
+    EXPECT_TRUE(NumaTopology::ParseCpuList("0-3,8,10-11\n", cpus));
+    EXPECT_EQ(std::vector<int>({0, 1, 2, 3, 8, 10, 11}), cpus);
+    EXPECT_TRUE(NumaTopology::ParseCpuList("\n", cpus));
+    EXPECT_TRUE(cpus.empty());
+    EXPECT_FALSE(NumaTopology::ParseCpuList("3-1", cpus));
+    EXPECT_FALSE(NumaTopology::ParseCpuList("1-2-3", cpus));
+    EXPECT_FALSE(NumaTopology::ParseCpuList("a", cpus));
+    EXPECT_TRUE(cpus.empty());
+}
+
+TEST_F(NumaTopologyUTest, ShouldAssignDevicesRoundRobinWhenMultiNodes)
+{
+    WriteNode("node1", "4-7");
+    WriteNode("node0", "0-3");
+    WriteNode("node2", "\n");  // 纯内存节点不参与绑定
+    WriteNode("power", "0");
+    auto &topology = NumaTopology::GetInstance();
+    EXPECT_TRUE(topology.Load(BASE_PATH));
+    ASSERT_EQ(2ul, topology.NodeNum());
+    EXPECT_EQ(0, topology.GetNode(0).id);
+    EXPECT_EQ(std::vector<int>({4, 5, 6, 7}), topology.GetNode(1).cpus);
+    EXPECT_TRUE(topology.IsEnabled());
+    EXPECT_EQ(0, topology.GetNodeForDevice(0));
+    EXPECT_EQ(1, topology.GetNodeForDevice(1));
+    EXPECT_EQ(0, topology.GetNodeForDevice(2));
+
+    setenv(NUMA_BIND_ENV, "0", 1);
+    EXPECT_FALSE(topology.IsEnabled());
+    EXPECT_EQ(-1, topology.GetNodeForDevice(1));
+}
+
+TEST_F(NumaTopologyUTest, ShouldNotEnableWhenSingleNode)
+{
+    WriteNode("node0", "0-3");
+    auto &topology = NumaTopology::GetInstance();
+    EXPECT_TRUE(topology.Load(BASE_PATH));
+    EXPECT_FALSE(topology.IsEnabled());
+    EXPECT_EQ(-1, topology.GetNodeForDevice(0));
+    EXPECT_FALSE(topology.Load(BASE_PATH + "_not_exist"));
+    EXPECT_EQ(0ul, topology.NodeNum());
+}
+
+TEST_F(NumaTopologyUTest, ShouldBindAndRestoreCpuAffinity)
+{
+    cpu_set_t before;
+    CPU_ZERO(&before);
+    sched_getaffinity(0, sizeof(before), &before);
+    auto cpu = GetFirstAllowedCpu();
+    WriteNode("node0", std::to_string(cpu));
+    WriteNode("node1", std::to_string(CPU_SETSIZE - 1));
+    auto &topology = NumaTopology::GetInstance();
+    EXPECT_TRUE(topology.Load(BASE_PATH));
+    {
+        NumaBinding binding(0);
+        EXPECT_TRUE(binding.IsBound());
+        cpu_set_t current;
+        sched_getaffinity(0, sizeof(current), &current);
+        EXPECT_EQ(1, CPU_COUNT(&current));
+        EXPECT_TRUE(CPU_ISSET(cpu, &current));
+    }
+    cpu_set_t after;
+    sched_getaffinity(0, sizeof(after), &after);
+    EXPECT_TRUE(CPU_EQUAL(&before, &after));
+    // 节点cpu不在允许范围内或下标无效时不绑定
+    NumaBinding noAllowedCpu(1);
+    EXPECT_FALSE(noAllowedCpu.IsBound());
+    NumaBinding unbound(-1);
+    EXPECT_FALSE(unbound.IsBound());
+    NumaBinding outOfRange(2);
+    EXPECT_FALSE(outOfRange.IsBound());
+}
+
+TEST_F(NumaTopologyUTest, ShouldRestorePreviousMemPolicy)
+{
+    WriteNode("node0", std::to_string(GetFirstAllowedCpu()));
+    WriteNode("node1", std::to_string(CPU_SETSIZE - 1));
+    ASSERT_TRUE(NumaTopology::GetInstance().Load(BASE_PATH));
+    // 绑定前设置非默认策略，解绑后应恢复该策略而不是默认策略
+    unsigned long node0 = 1;
+    if (syscall(SYS_set_mempolicy, MPOL_INTERLEAVE_MODE, &node0, sizeof(node0) * 8 + 1) != 0) {  // 8: 每字节位数
+        return;  // 环境不支持设置内存策略
+    }
+    std::vector<unsigned long> before;
+    ASSERT_EQ(MPOL_INTERLEAVE_MODE, GetMemMode(before));
+    {
+        NumaBinding binding(0);
+        std::vector<unsigned long> current;
+        EXPECT_NE(MPOL_INTERLEAVE_MODE, GetMemMode(current));
+    }
+    std::vector<unsigned long> after;
+    EXPECT_EQ(MPOL_INTERLEAVE_MODE, GetMemMode(after));
+    EXPECT_EQ(before, after);
+    syscall(SYS_set_mempolicy, MPOL_DEFAULT_MODE, nullptr, 0);
+}
+
+TEST_F(NumaTopologyUTest, DetectShouldParseOnlyOnce)
+{
+    auto &topology = NumaTopology::GetInstance();
+    topology.Detect();
+    WriteNode("node0", "0");
+    ASSERT_TRUE(topology.Load(BASE_PATH));
+    // 已解析过系统拓扑，再次Detect不会重新解析覆盖当前结果
+    EXPECT_EQ(1ul, topology.NodeNum());
+    topology.Detect();
+    EXPECT_EQ(1ul, topology.NodeNum());
+}
@@ -0,0 +1,124 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <string>
+#include "gtest/gtest.h"
+
+#include "analysis/csrc/infrastructure/utils/radix_sort.h"
+
+using namespace Analysis::Utils;
+
+namespace {
+struct Record {
+    uint64_t timestamp = 0;
+    uint32_t group = 0;
+    size_t seq = 0;
+    std::string payload;
+};
+
+std::vector<Record> MakeRecords(size_t num, uint64_t range, uint64_t base)
+{
+    std::mt19937_64 gen(num);
+    std::uniform_int_distribution<uint64_t> dist(0, range);
+    std::vector<Record> records(num);
+    for (size_t i = 0; i < num; ++i) {
+        records[i].timestamp = base + dist(gen);
+        records[i].group = static_cast<uint32_t>(dist(gen) % 7);  // 7: 分组数
+        records[i].seq = i;
+        records[i].payload = std::to_string(i);
+    }
+    return records;
+}
+
+bool SameOrder(const std::vector<Record> &lhs, const std::vector<Record> &rhs)
+{
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < lhs.size(); ++i) {
+        if (lhs[i].seq != rhs[i].seq || lhs[i].payload != rhs[i].payload) {
+            return false;
+        }
+    }
+    return true;
+}
+}
+
+class RadixSortUTest : public testing::Test {};
+
+TEST_F(RadixSortUTest, SortShouldBeStableAndMatchStdStableSort)
+{
+    // 覆盖小数据比较排序、单线程和多线程分块三种路径，时间戳高位相同以覆盖跳过趟的逻辑
+    for (size_t num : {0UL, 1UL, 200UL, 5000UL, 300000UL}) {
+        auto records = MakeRecords(num, 1000000, 1700000000000000000ULL);
+        auto expect = records;
+        std::stable_sort(expect.begin(), expect.end(),
+                         [](const Record &lhs, const Record &rhs) { return lhs.timestamp < rhs.timestamp; });
+        RadixSort::Sort(records, [](const Record &record) { return record.timestamp; }, 4);  // 4: 线程数
+        EXPECT_TRUE(SameOrder(expect, records)) << "num is " << num;
+    }
+}
+
+TEST_F(RadixSortUTest, SortByKeysShouldOrderByPrimaryThenSecondary)
+{
+    auto records = MakeRecords(200000, 1000, 0);
+    auto expect = records;
+    std::stable_sort(expect.begin(), expect.end(), [](const Record &lhs, const Record &rhs) {
+        return lhs.group < rhs.group || (lhs.group == rhs.group && lhs.timestamp < rhs.timestamp);
+    });
+    RadixSort::SortByKeys(
+        records, [](const Record &record) { return record.group; },
+        [](const Record &record) { return record.timestamp; });
+    EXPECT_TRUE(SameOrder(expect, records));
+}
+
+TEST_F(RadixSortUTest, SortShouldOnlySortGivenRange)
+{
+    std::vector<uint64_t> data = {5, 4, 3, 2, 1, 0};
+    RadixSort::Sort(data.begin(), data.begin() + 4, [](uint64_t value) { return value; });  // 4: 只排序前4个
+    std::vector<uint64_t> expect = {2, 3, 4, 5, 1, 0};
+    EXPECT_EQ(expect, data);
+}
+
+TEST_F(RadixSortUTest, ArgSortShouldReturnOrderWithoutMovingData)
+{
+    auto records = MakeRecords(100000, UINT64_MAX, 0);
+    auto origin = records;
+    std::vector<size_t> order;
+    ASSERT_TRUE(RadixSort::ArgSort(records, [](const Record &record) { return record.timestamp; }, order));
+    EXPECT_TRUE(SameOrder(origin, records));
+    ASSERT_EQ(records.size(), order.size());
+    for (size_t i = 1; i < order.size(); ++i) {
+        EXPECT_LE(records[order[i - 1]].timestamp, records[order[i]].timestamp);
+    }
+}
+
+TEST_F(RadixSortUTest, SignedAndDoubleKeysShouldKeepOrder)
+{
+    std::vector<double> doubles = {3.5, -1.0, 0.0, -std::numeric_limits<double>::infinity(), 1e300, -2.5, 1e-300,
+                                   std::numeric_limits<double>::infinity()};
+    auto expect = doubles;
+    std::sort(expect.begin(), expect.end());
+    RadixSort::Sort(doubles, [](double value) { return RadixKeyOfDouble(value); });
+    EXPECT_EQ(expect, doubles);
+
+    std::vector<int64_t> ints = {5, -3, INT64_MIN, 0, INT64_MAX, -1};
+    std::vector<int64_t> expectInts = {INT64_MIN, -3, -1, 0, 5, INT64_MAX};
+    RadixSort::Sort(ints, [](int64_t value) { return RadixKeyOfSigned(value); });
+    EXPECT_EQ(expectInts, ints);
+}
@@ -0,0 +1,104 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <thread>
+#include "gtest/gtest.h"
+
+#include "analysis/csrc/infrastructure/utils/run_control.h"
+
+using namespace Analysis::Utils;
+
+class RunControlUTest : public testing::Test {
+protected:
+    virtual void TearDown()
+    {
+        unsetenv("MSPROF_ANALYSIS_TIME_BUDGET_S");
+        auto &runControl = RunControl::GetInstance();
+        runControl.budgetSet_ = false;
+        runControl.timeBudget_ = 0;
+        runControl.Begin();
+    }
+};
+
+TEST_F(RunControlUTest, ShouldResetCancelAndProgressWhenBegin)
+{
+    auto &runControl = RunControl::GetInstance();
+    runControl.Begin();
+    runControl.SetStage("parse");
+    runControl.AddProcessDone();
+    runControl.AddRecords(100);
+    runControl.AddTableWritten();
+    runControl.AddAssemblersTotal(3);
+    runControl.AddAssemblerDone();
+    auto progress = runControl.GetProgress();
+    EXPECT_EQ("parse", progress.stage);
+    EXPECT_EQ(1ULL, progress.processesDone);
+    EXPECT_EQ(100ULL, progress.recordsParsed);
+    EXPECT_EQ(1ULL, progress.tablesWritten);
+    EXPECT_EQ(1ULL, progress.assemblersDone);
+    EXPECT_EQ(3ULL, progress.assemblersTotal);
+    EXPECT_FALSE(progress.cancelled);
+
+    runControl.Cancel();
+    EXPECT_TRUE(runControl.IsCancelled());
+    EXPECT_TRUE(runControl.GetProgress().cancelled);
+    // 外部调用Cancel不属于信号中断
+    EXPECT_FALSE(runControl.IsInterrupted());
+    runControl.Begin();
+    progress = runControl.GetProgress();
+    EXPECT_FALSE(progress.cancelled);
+    EXPECT_EQ("", progress.stage);
+    EXPECT_EQ(0ULL, progress.recordsParsed);
+    EXPECT_EQ(0ULL, progress.assemblersTotal);
+}
+
+TEST_F(RunControlUTest, ShouldCancelWhenTimeBudgetExhausted)
+{
+    auto &runControl = RunControl::GetInstance();
+    setenv("MSPROF_ANALYSIS_TIME_BUDGET_S", "5", 1);
+    EXPECT_EQ(5ULL, runControl.GetTimeBudget());
+    // 显式设置的预算优先于环境变量
+    runControl.SetTimeBudget(0);
+    EXPECT_EQ(0ULL, runControl.GetTimeBudget());
+    runControl.Begin();
+    EXPECT_FALSE(runControl.IsCancelled());
+
+    runControl.SetTimeBudget(1);
+    runControl.Begin();
+    EXPECT_FALSE(runControl.IsCancelled());
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));  // 1100: 超过1s预算
+    EXPECT_TRUE(runControl.IsCancelled());
+    EXPECT_FALSE(runControl.IsInterrupted());
+}
+
+TEST_F(RunControlUTest, ShouldCancelOnSignalAndRestoreHandlerAfterGuard)
+{
+    auto &runControl = RunControl::GetInstance();
+    runControl.Begin();
+    struct sigaction before {};
+    sigaction(SIGTERM, nullptr, &before);
+    {
+        CancelSignalGuard guard;
+        raise(SIGTERM);
+        EXPECT_TRUE(runControl.IsCancelled());
+        EXPECT_TRUE(runControl.GetProgress().interrupted);
+    }
+    struct sigaction after {};
+    sigaction(SIGTERM, nullptr, &after);
+    EXPECT_EQ(before.sa_handler, after.sa_handler);
+}
@@ -0,0 +1,139 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+#include <fstream>
+#include <set>
+#include <thread>
+#include "gtest/gtest.h"
+#include "nlohmann/json.hpp"
+
+#include "analysis/csrc/infrastructure/utils/file.h"
+#include "analysis/csrc/infrastructure/utils/self_trace.h"
+#include "analysis/csrc/infrastructure/utils/thread_pool.h"
+
+using namespace Analysis::Utils;
+
+namespace {
+const int DEPTH = 0;
+const std::string BASE_PATH = "./self_trace_utest";
+}
+
+class SelfTraceUTest : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        if (File::Check(BASE_PATH)) {
+            File::RemoveDir(BASE_PATH, DEPTH);
+        }
+        EXPECT_TRUE(File::CreateDir(BASE_PATH));
+        SelfTrace::GetInstance().Clear();
+    }
+    virtual void TearDown()
+    {
+        SelfTrace::GetInstance().Disable();
+        SelfTrace::GetInstance().Clear();
+        EXPECT_TRUE(File::RemoveDir(BASE_PATH, DEPTH));
+    }
+};
+
+TEST_F(SelfTraceUTest, ShouldNotRecordWhenDisabled)
+{
+    {
+        TraceSpan span(TRACE_CAT_PROCESSOR, "disabled");
+    }
+    auto trace = nlohmann::json::parse(SelfTrace::GetInstance().Dump());
+    // 只有进程名元数据
+    EXPECT_EQ(1ul, trace["traceEvents"].size());
+    EXPECT_TRUE(SelfTrace::GetInstance().Flush());
+    EXPECT_FALSE(File::Exist(SelfTrace::GetInstance().GetFilePath()));
+}
+
+TEST_F(SelfTraceUTest, ShouldRecordSpansOfAllThreadsAsChromeTrace)
+{
+    SelfTrace::GetInstance().Enable(BASE_PATH);
+    const uint32_t threadsNum = 4;
+    const uint32_t tasksNum = 100;
+    {
+        TraceSpan span(TRACE_CAT_PROCESSOR, "Outer \"quoted\"", true);
+        ThreadPool pool(threadsNum);
+        pool.Start();
+        for (uint32_t i = 0; i < tasksNum; ++i) {
+            pool.AddTask([i]() {
+                TraceSpan span(TRACE_CAT_DB, "INSERT ", "TABLE_" + std::to_string(i));
+            });
+        }
+        pool.WaitAllTasks();
+        pool.Stop();
+    }
+    ASSERT_TRUE(SelfTrace::GetInstance().Flush());
+    std::ifstream in(SelfTrace::GetInstance().GetFilePath());
+    auto trace = nlohmann::json::parse(in);
+    uint32_t dbNum = 0;
+    uint32_t taskNum = 0;
+    uint32_t memoryNum = 0;
+    std::set<int> tids;
+    bool hasOuter = false;
+    for (const auto &event : trace["traceEvents"]) {
+        if (event["ph"] == "C") {
+            ++memoryNum;
+            EXPECT_GT(event["args"]["peak_rss_kb"].get<uint64_t>(), 0ul);
+            continue;
+        }
+        if (event["ph"] != "X") {
+            continue;
+        }
+        if (event["cat"] == TRACE_CAT_DB) {
+            ++dbNum;
+            tids.insert(event["tid"].get<int>());
+        } else if (event["cat"] == TRACE_CAT_TASK) {
+            ++taskNum;
+        } else if (event["name"] == "Outer \"quoted\"") {
+            hasOuter = true;
+        }
+    }
+    EXPECT_EQ(tasksNum, dbNum);
+    EXPECT_EQ(tasksNum, taskNum);
+    EXPECT_EQ(1u, memoryNum);
+    EXPECT_TRUE(hasOuter);
+    EXPECT_LE(tids.size(), threadsNum);
+    EXPECT_EQ(0ul, trace["otherData"]["dropped"].get<uint64_t>());
+}
+
+TEST_F(SelfTraceUTest, ShouldWriteNewFileWithOnlyNewEventsAfterClear)
+{
+    SelfTrace::GetInstance().Enable(BASE_PATH);
+    {
+        TraceSpan span(TRACE_CAT_PROCESSOR, "first");
+    }
+    ASSERT_TRUE(SelfTrace::GetInstance().Flush());
+    auto firstPath = SelfTrace::GetInstance().GetFilePath();
+    SelfTrace::GetInstance().Clear();
+    {
+        TraceSpan span(TRACE_CAT_PROCESSOR, "second");
+    }
+    ASSERT_TRUE(SelfTrace::GetInstance().Flush());
+    auto secondPath = SelfTrace::GetInstance().GetFilePath();
+    EXPECT_NE(firstPath, secondPath);
+    EXPECT_TRUE(File::Exist(firstPath));
+    std::ifstream in(secondPath);
+    auto trace = nlohmann::json::parse(in);
+    std::set<std::string> names;
+    for (const auto &event : trace["traceEvents"]) {
+        if (event["ph"] == "X") {
+            names.insert(event["name"].get<std::string>());
+        }
+    }
+    EXPECT_EQ(std::set<std::string>{"second"}, names);
+}
@@ -0,0 +1,161 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+
+#include <fstream>
+#include "gtest/gtest.h"
+
+#include "analysis/csrc/infrastructure/utils/file.h"
+#include "analysis/csrc/infrastructure/utils/stage_manifest.h"
+
+using namespace Analysis::Utils;
+
+namespace {
+const int DEPTH = 0;
+const std::string BASE_PATH = "./stage_manifest_utest";
+const std::string DATA_PATH = "./stage_manifest_utest/data";
+const std::string OUTPUT_PATH = "./stage_manifest_utest/sqlite";
+const std::string STAGE = "device_parse";
+
+void WriteFile(const std::string &path, const std::string &content)
+{
+    std::ofstream out(path, std::ios::trunc | std::ios::binary);
+    out << content;
+}
+
+// 模拟一次阶段执行：输入未变化时跳过，否则生成产物并提交清单
+bool RunStage(const std::string &param, const std::string &output)
+{
+    StageManifest manifest(BASE_PATH, STAGE);
+    manifest.AddInputDir(DATA_PATH);
+    manifest.AddParam("stop_at", param);
+    if (manifest.IsUpToDate()) {
+        return false;
+    }
+    manifest.RemovePreviousOutputs();
+    manifest.Begin();
+    WriteFile(File::PathJoin({OUTPUT_PATH, output}), "db");
+    manifest.AddOutputsModifiedSinceBegin(OUTPUT_PATH, {".db"});
+    EXPECT_TRUE(manifest.Commit());
+    return true;
+}
+}
+
+class StageManifestUTest : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        if (File::Check(BASE_PATH)) {
+            File::RemoveDir(BASE_PATH, DEPTH);
+        }
+        EXPECT_TRUE(File::CreateDir(BASE_PATH));
+        EXPECT_TRUE(File::CreateDir(DATA_PATH));
+        EXPECT_TRUE(File::CreateDir(OUTPUT_PATH));
+        WriteFile(File::PathJoin({DATA_PATH, "ts_track.data.0.slice_0"}), "0123456789abcdef");
+        WriteFile(File::PathJoin({DATA_PATH, "stars_soc.data.0.slice_0"}), "stars");
+    }
+    virtual void TearDown()
+    {
+        EXPECT_TRUE(File::RemoveDir(BASE_PATH, DEPTH));
+    }
+};
+
+TEST_F(StageManifestUTest, ShouldSkipWhenInputsAndParamsUnchanged)
+{
+    EXPECT_TRUE(RunStage("", "ascend_task.db"));
+    EXPECT_TRUE(File::Exist(File::PathJoin({BASE_PATH, "." + STAGE + "_manifest"})));
+    EXPECT_FALSE(RunStage("", "ascend_task.db"));
+}
+
+TEST_F(StageManifestUTest, ShouldRerunWhenInputContentChanged)
+{
+    EXPECT_TRUE(RunStage("", "ascend_task.db"));
+    // 大小不变、内容变化
+    WriteFile(File::PathJoin({DATA_PATH, "stars_soc.data.0.slice_0"}), "STARS");
+    EXPECT_TRUE(RunStage("", "ascend_task.db"));
+    EXPECT_FALSE(RunStage("", "ascend_task.db"));
+}
+
+TEST_F(StageManifestUTest, ShouldReuseHashFromCheckWhenInputTouchedWithSameContent)
+{
+    auto path = File::PathJoin({DATA_PATH, "stars_soc.data.0.slice_0"});
+    EXPECT_TRUE(RunStage("", "ascend_task.db"));
+    // 首次提交不读取输入内容，修改时间变化后无法判定内容相同，需要重跑，重跑时检查阶段算出的hash写入清单
+    WriteFile(path, "stars");
+    EXPECT_TRUE(RunStage("", "ascend_task.db"));
+    WriteFile(path, "stars");
+    EXPECT_FALSE(RunStage("", "ascend_task.db"));
+}
+
+TEST_F(StageManifestUTest, HashStringShouldMatchHashFile)
+{
+    auto path = File::PathJoin({DATA_PATH, "hash"});
+    WriteFile(path, "abcdefgh12345");
+    uint64_t hash = 0;
+    EXPECT_TRUE(StageManifest::HashFile(path, hash));
+    EXPECT_EQ(hash, StageManifest::HashString("abcdefgh12345"));
+    EXPECT_NE(hash, StageManifest::HashString("abcdefgh12346"));
+}
+
+TEST_F(StageManifestUTest, ShouldRerunWhenInputAddedOrParamChanged)
+{
+    EXPECT_TRUE(RunStage("", "ascend_task.db"));
+    WriteFile(File::PathJoin({DATA_PATH, "ffts_profile.data.0.slice_0"}), "ffts");
+    EXPECT_TRUE(RunStage("", "ascend_task.db"));
+    EXPECT_TRUE(RunStage("parser", "ascend_task.db"));
+    EXPECT_FALSE(RunStage("parser", "ascend_task.db"));
+}
+
+TEST_F(StageManifestUTest, ShouldRerunAndRemoveStaleOutputsWhenOutputMissingOrInputChanged)
+{
+    EXPECT_TRUE(RunStage("", "old.db"));
+    EXPECT_TRUE(File::DeleteFile(File::PathJoin({OUTPUT_PATH, "old.db"})));
+    EXPECT_TRUE(RunStage("", "old.db"));
+
+    WriteFile(File::PathJoin({DATA_PATH, "ts_track.data.0.slice_0"}), "changed");
+    EXPECT_TRUE(RunStage("", "new.db"));
+    EXPECT_FALSE(File::Exist(File::PathJoin({OUTPUT_PATH, "old.db"})));
+    StageManifest manifest(BASE_PATH, STAGE);
+    manifest.AddInputDir(DATA_PATH);
+    manifest.AddParam("stop_at", "");
+    EXPECT_TRUE(manifest.IsUpToDate());
+    ASSERT_EQ(1UL, manifest.GetPreviousOutputs().size());
+    EXPECT_EQ(File::PathJoin({OUTPUT_PATH, "new.db"}), manifest.GetPreviousOutputs().front());
+}
+
+TEST_F(StageManifestUTest, ShouldNotBeUpToDateWhenManifestInvalid)
+{
+    StageManifest noManifest(BASE_PATH, STAGE);
+    EXPECT_FALSE(noManifest.IsUpToDate());
+    WriteFile(File::PathJoin({BASE_PATH, "." + STAGE + "_manifest"}), "version\t0\n");
+    StageManifest manifest(BASE_PATH, STAGE);
+    EXPECT_FALSE(manifest.IsUpToDate());
+}
+
+TEST_F(StageManifestUTest, HashFileShouldDependOnContent)
+{
+    auto path = File::PathJoin({DATA_PATH, "hash"});
+    uint64_t hash1 = 0;
+    uint64_t hash2 = 0;
+    uint64_t hash3 = 0;
+    WriteFile(path, "abcdefgh12345");
+    EXPECT_TRUE(StageManifest::HashFile(path, hash1));
+    EXPECT_TRUE(StageManifest::HashFile(path, hash2));
+    WriteFile(path, "abcdefgh12346");
+    EXPECT_TRUE(StageManifest::HashFile(path, hash3));
+    EXPECT_EQ(hash1, hash2);
+    EXPECT_NE(hash1, hash3);
+    EXPECT_FALSE(StageManifest::HashFile(File::PathJoin({DATA_PATH, "not_exist"}), hash1));
+}
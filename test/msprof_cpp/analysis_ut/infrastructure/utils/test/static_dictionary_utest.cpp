@@ -0,0 +1,172 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+#include <algorithm>
+#include <fstream>
+#include <random>
+#include "gtest/gtest.h"
+
+#include "analysis/csrc/infrastructure/utils/file.h"
+#include "analysis/csrc/infrastructure/utils/static_dictionary.h"
+
+using namespace Analysis::Utils;
+
+namespace {
+const int DEPTH = 0;
+const std::string BASE_PATH = "./static_dictionary_utest";
+const uint32_t RANDOM_SEED = 2026;
+
+std::unordered_map<uint64_t, std::string> MakeData(size_t num)
+{
+    std::mt19937_64 gen(RANDOM_SEED);
+    std::unordered_map<uint64_t, std::string> data;
+    while (data.size() < num) {
+        auto key = gen();
+        data[key] = "op_" + std::to_string(key % 1000);  // 1000: 构造重复的字符串
+    }
+    // 空字符串与0值key
+    data[0] = "";
+    return data;
+}
+
+void ExpectSameAsMap(const StaticDictionary &dictionary, const std::unordered_map<uint64_t, std::string> &data)
+{
+    EXPECT_EQ(data.size(), dictionary.Size());
+    for (const auto &item : data) {
+        std::string value;
+        ASSERT_TRUE(dictionary.Find(item.first, value));
+        EXPECT_EQ(item.second, value);
+    }
+}
+}
+
+class StaticDictionaryUTest : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        if (File::Check(BASE_PATH)) {
+            File::RemoveDir(BASE_PATH, DEPTH);
+        }
+        EXPECT_TRUE(File::CreateDir(BASE_PATH));
+    }
+    static void TearDownTestCase()
+    {
+        EXPECT_TRUE(File::RemoveDir(BASE_PATH, DEPTH));
+    }
+};
+
+TEST_F(StaticDictionaryUTest, ShouldFindAllKeysWhenBuildFromMap)
+{
+    for (size_t num : {1UL, 2UL, 7UL, 1000UL, 100000UL}) {
+        auto data = MakeData(num);
+        auto raw = data;
+        StaticDictionary dictionary;
+        ASSERT_TRUE(dictionary.Build(std::move(raw)));
+        EXPECT_TRUE(raw.empty());
+        ExpectSameAsMap(dictionary, data);
+    }
+}
+
+TEST_F(StaticDictionaryUTest, ShouldReturnFalseWhenKeyNotExist)
+{
+    auto data = MakeData(1000);
+    auto raw = data;
+    StaticDictionary dictionary;
+    ASSERT_TRUE(dictionary.Build(std::move(raw)));
+    std::mt19937_64 gen(RANDOM_SEED + 1);
+    for (int i = 0; i < 1000; ++i) {
+        auto key = gen();
+        std::string value;
+        EXPECT_EQ(data.count(key) > 0, dictionary.Find(key, value));
+        StringRef ref;
+        EXPECT_EQ(data.count(key) > 0, dictionary.Find(key, ref));
+    }
+    dictionary.Clear();
+    std::string value;
+    EXPECT_TRUE(dictionary.Empty());
+    EXPECT_FALSE(dictionary.Find(0, value));
+
+    StaticDictionary emptyDictionary;
+    EXPECT_TRUE(emptyDictionary.Build({}));
+    EXPECT_TRUE(emptyDictionary.Empty());
+    EXPECT_FALSE(emptyDictionary.Find(0, value));
+}
+
+TEST_F(StaticDictionaryUTest, FindShouldReturnViewIntoContiguousArena)
+{
+    auto data = MakeData(10000);
+    StaticDictionary dictionary;
+    ASSERT_TRUE(dictionary.Build(data));
+    const char *lowest = nullptr;
+    const char *highest = nullptr;
+    size_t total = 0;
+    for (const auto &item : data) {
+        StringRef value;
+        ASSERT_TRUE(dictionary.Find(item.first, value));
+        EXPECT_EQ(item.second, value.ToString());
+        // 多次查找指向同一块内存，不产生拷贝
+        StringRef again;
+        ASSERT_TRUE(dictionary.Find(item.first, again));
+        EXPECT_EQ(value.Data(), again.Data());
+        if (!value.Empty()) {
+            lowest = lowest == nullptr ? value.Data() : std::min(lowest, value.Data());
+            highest = std::max(highest, value.Data() + value.Size());
+        }
+        total += value.Size();
+    }
+    // 所有字符串首尾相接存放在同一块内存中
+    EXPECT_EQ(total, static_cast<size_t>(highest - lowest));
+}
+TEST_F(StaticDictionaryUTest, ShouldFindAllKeysWhenLoadSavedFile)
+{
+    auto data = MakeData(10000);
+    std::string path = File::PathJoin({BASE_PATH, "hash_dic.idx"});
+    {
+        StaticDictionary dictionary;
+        EXPECT_FALSE(dictionary.Save(path));
+        ASSERT_TRUE(dictionary.Build(data));
+        ASSERT_TRUE(dictionary.Save(path));
+    }
+    StaticDictionary loaded;
+    ASSERT_TRUE(loaded.Load(path));
+    ExpectSameAsMap(loaded, data);
+    const char *str = nullptr;
+    size_t len = 0;
+    auto it = data.begin();
+    ASSERT_TRUE(loaded.Find(it->first, str, len));
+    EXPECT_EQ(it->second, std::string(str, len));
+}
+
+TEST_F(StaticDictionaryUTest, LoadShouldReturnFalseWhenFileInvalid)
+{
+    StaticDictionary dictionary;
+    EXPECT_FALSE(dictionary.Load(File::PathJoin({BASE_PATH, "not_exist.idx"})));
+
+    auto data = MakeData(100);
+    ASSERT_TRUE(dictionary.Build(data));
+    std::string path = File::PathJoin({BASE_PATH, "truncated.idx"});
+    ASSERT_TRUE(dictionary.Save(path));
+    auto size = dictionary.GetMemorySize();
+    // 截断文件
+    std::ifstream in(path, std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    ASSERT_EQ(size, content.size());
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(content.data(), static_cast<std::streamsize>(content.size() - sizeof(uint64_t)));
+    out.close();
+    EXPECT_FALSE(dictionary.Load(path));
+    EXPECT_TRUE(dictionary.Empty());
+}
@@ -0,0 +1,117 @@
+/* -------------------------------------------------------------------------
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This file is part of the MindStudio project.
+ *
+ * MindStudio is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *    http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------*/
+#include <cstdio>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <gtest/gtest.h>
+#include "analysis/csrc/infrastructure/db/include/column_file.h"
+#include "analysis/csrc/infrastructure/utils/file.h"
+
+using namespace Analysis::Utils;
+using namespace Analysis::Infra;
+
+namespace {
+const std::string COLUMN_FILE_PATH = "./column_file_utest.col";
+const std::vector<std::string> COLUMNS = {"model_id", "index_id", "start_time", "task_type", "stream_id"};
+using ColumnData = std::vector<std::tuple<uint64_t, int32_t, double, std::string, uint16_t>>;
+}
+
+class ColumnFileUtest : public testing::Test {
+protected:
+    void TearDown() override
+    {
+        if (File::Exist(COLUMN_FILE_PATH)) {
+            File::DeleteFile(COLUMN_FILE_PATH);
+        }
+    }
+};
+
+TEST_F(ColumnFileUtest, ShouldReadAllSegmentsByColumnNameWhenAppendTwice)
+{
+    ColumnData first = {{4294967295, -1, 1.5, "AI_CORE", 1}, {2, 3, 2.25, "AI_CPU", 2}};
+    ColumnData second = {{7, 8, 3.125, "AI_CPU", 3}, {9, -10, 4.0, "HCCL", 4}, {11, 12, 5.5, "AI_CORE", 5}};
+    ColumnFileWriter writer(COLUMN_FILE_PATH);
+    ASSERT_TRUE(writer.Append(COLUMNS, first));
+    ASSERT_TRUE(writer.Append(COLUMNS, second));
+
+    ColumnFileReader reader;
+    ASSERT_TRUE(reader.Open(COLUMN_FILE_PATH));
+    EXPECT_EQ(first.size() + second.size(), reader.GetRowCount());
+    EXPECT_EQ(COLUMNS, reader.GetColumnNames());
+
+    ColumnData all;
+    ASSERT_TRUE(reader.Read(COLUMNS, all));
+    ColumnData expect = first;
+    expect.insert(expect.end(), second.begin(), second.end());
+    EXPECT_EQ(expect, all);
+
+    // 按任意列序读取，数值列之间转换，整数列可读为文本
+    std::vector<std::tuple<std::string, double, std::string>> part;
+    ASSERT_TRUE(reader.Read({"task_type", "stream_id", "index_id"}, part));
+    ASSERT_EQ(expect.size(), part.size());
+    EXPECT_EQ(std::make_tuple(std::string("HCCL"), 4.0, std::string("-10")), part[3]);
+}
+
+TEST_F(ColumnFileUtest, ShouldReturnFalseWhenColumnMissingOrTypeNotConvertible)
+{
+    ColumnData data = {{1, 2, 3.5, "AI_CORE", 4}};
+    ColumnFileWriter writer(COLUMN_FILE_PATH);
+    ASSERT_TRUE(writer.Append(COLUMNS, data));
+    EXPECT_FALSE(writer.Append({"model_id"}, data));
+
+    ColumnFileReader reader;
+    ASSERT_TRUE(reader.Open(COLUMN_FILE_PATH));
+    std::vector<std::tuple<uint64_t>> missing;
+    EXPECT_FALSE(reader.Read({"unknown"}, missing));
+    std::vector<std::tuple<std::string>> realToText;
+    EXPECT_FALSE(reader.Read({"start_time"}, realToText));
+    std::vector<std::tuple<uint32_t>> textToNumber;
+    EXPECT_FALSE(reader.Read({"task_type"}, textToNumber));
+}
+
+TEST_F(ColumnFileUtest, OpenShouldFailWhenSegmentIncompleteOrSchemaChanged)
+{
+    ColumnData data = {{1, 2, 3.5, "AI_CORE", 4}};
+    {
+        ColumnFileWriter writer(COLUMN_FILE_PATH);
+        ASSERT_TRUE(writer.Append(COLUMNS, data));
+        std::vector<std::tuple<uint64_t>> other = {std::make_tuple(1)};
+        ASSERT_TRUE(writer.Append({"model_id"}, other));
+    }
+    ColumnFileReader reader;
+    EXPECT_FALSE(reader.Open(COLUMN_FILE_PATH));
+
+    File::DeleteFile(COLUMN_FILE_PATH);
+    ColumnFileWriter writer(COLUMN_FILE_PATH);
+    ASSERT_TRUE(writer.Append(COLUMNS, data));
+    // 段长度回填前中断，段长度保持为0
+    FILE *file = fopen(COLUMN_FILE_PATH.c_str(), "r+b");
+    ASSERT_NE(nullptr, file);
+    const long segmentSizeOffset = 24;
+    uint64_t zero = 0;
+    fseek(file, segmentSizeOffset, SEEK_SET);
+    fwrite(&zero, sizeof(zero), 1, file);
+    fclose(file);
+    EXPECT_FALSE(reader.Open(COLUMN_FILE_PATH));
+}
+
+TEST_F(ColumnFileUtest, GetColumnFilePathShouldReplaceDbSuffixWithTableName)
+{
+    EXPECT_EQ("device_0/sqlite/ascend_task.AscendTask.col",
+              GetColumnFilePath("device_0/sqlite/ascend_task.db", "AscendTask"));
+    EXPECT_EQ("trace.get_next.col", GetColumnFilePath("trace", "get_next"));
+}
@@ -314,6 +314,70 @@ TEST_F(DBRunnerUtest, QueryDataShouldReturnFalseWhenCreateConnectionFailed)
     MOCKER_CPP(&Connection::IsDBOpened).reset();
 }
 
+TEST_F(DBRunnerUtest, QueryColumnsShouldKeepValueTypeAndSqliteTextFormat)
+{
+    std::string path = "./a.db";
+    auto dbRunner = std::make_shared<DBRunner>(path);
+    dbRunner->CreateTable("tb4", cols);
+    dbRunner->DeleteData("DELETE FROM tb4;");
+    DATA_FORMAT data = {
+        std::make_tuple(7, 4294967295, 9, 10, 1320.0, 56.5, "hcom_allGather__516_1")
+    };
+    dbRunner->InsertData("tb4", data);
+    std::string sql = "SELECT col1, col2, ROUND(col5, 3), col6, 'hcom_allGather__516_1', NULL FROM tb4;";
+    ColumnTable result;
+    EXPECT_TRUE(dbRunner->QueryColumns(sql, result));
+    ASSERT_EQ(1ul, result.RowCount());
+    ASSERT_EQ(6ul, result.ColumnCount());
+    EXPECT_EQ(1ul, result.GetColumnIndex("col2"));
+    EXPECT_EQ(ColumnTable::INVALID_INDEX, result.GetColumnIndex("not_exist"));
+    uint32_t ui32 = 0;
+    EXPECT_TRUE(result.GetUint32(1, 0, ui32));
+    EXPECT_EQ(UINT32_MAX, ui32);
+    EXPECT_FALSE(result.GetUint32(2, 0, ui32));
+    EXPECT_EQ(ColumnTable::VALUE_REAL, result.GetType(2, 0));
+    EXPECT_EQ("1320.0", result.ToString(2, 0));
+    EXPECT_EQ("56.5", result.ToString(3, 0));
+    EXPECT_EQ("hcom_allGather__516_1", result.ToString(4, 0));
+    EXPECT_FALSE(result.IsNumeric(4, 0));
+    EXPECT_EQ(ColumnTable::VALUE_NULL, result.GetType(5, 0));
+    EXPECT_EQ("", result.ToString(5, 0));
+}
+
+TEST_F(DBRunnerUtest, ColumnTableShouldKeepMixedCellTypesInOneColumn)
+{
+    ColumnTable table;
+    table.Reset({"value"});
+    table.AppendInteger(0, -3);  // -3: 负整数
+    table.AppendReal(0, 2.75);  // 2.75: 小数
+    table.AppendText(0, "12abc", 12.0, 12);  // 12: sqlite对文本前缀的数值转换
+    table.AppendNull(0);
+    ASSERT_EQ(4ul, table.RowCount());
+    EXPECT_EQ(ColumnTable::VALUE_INTEGER, table.GetType(0, 0));
+    EXPECT_DOUBLE_EQ(-3.0, table.GetDouble(0, 0));
+    uint64_t ui64 = 0;
+    EXPECT_FALSE(table.GetUint64(0, 0, ui64));
+    EXPECT_EQ(2, table.GetInt64(0, 1));
+    EXPECT_EQ("2.75", table.ToString(0, 1));
+    EXPECT_EQ(ColumnTable::VALUE_TEXT, table.GetType(0, 2));
+    EXPECT_DOUBLE_EQ(12.0, table.GetDouble(0, 2));
+    EXPECT_EQ(12, table.GetInt64(0, 2));
+    EXPECT_EQ("12abc", table.ToString(0, 2));
+    EXPECT_EQ(0, table.GetInt64(0, 3));
+    EXPECT_EQ("", table.ToString(0, 3));
+}
+
+TEST_F(DBRunnerUtest, QueryColumnsShouldReturnFalseWhenCreateConnectionFailed)
+{
+    std::string path = "./a.db";
+    auto dbRunner = std::make_shared<DBRunner>(path);
+    dbRunner->CreateTable("tb4", cols);
+    ColumnTable result;
+    MOCKER_CPP(&Connection::IsDBOpened).stubs().will(returnValue(false));
+    EXPECT_FALSE(dbRunner->QueryColumns("SELECT * FROM tb4;", result));
+    MOCKER_CPP(&Connection::IsDBOpened).reset();
+}
+
 TEST_F(DBRunnerUtest, UpdateData)
 {
     std::string path = "./a.db";
@@ -24,6 +24,9 @@ from msinterface.msprof_c_interface import _dump_device_data
 from msinterface.msprof_c_interface import _export_unified_db
 from msinterface.msprof_c_interface import _export_timeline
 from msinterface.msprof_c_interface import _export_summary
+from msinterface.msprof_c_interface import _export_batch
+from msinterface.msprof_c_interface import _run_with_progress
+from msinterface.msprof_c_interface import ANALYSIS_CANCELLED
 
 NAMESPACE = 'msinterface.msprof_c_interface'
 
@@ -47,4 +50,26 @@ class TestMsprofCInterface(unittest.TestCase):
 
     def test_export_summary(self):
         with mock.patch('importlib.import_module'):
-            _export_summary("")
\ No newline at end of file
+            _export_summary("")
+
+    def test_export_batch(self):
+        with mock.patch('importlib.import_module'):
+            _export_batch(["", ""], "db,timeline")
+
+    def test_run_with_progress_should_warn_when_export_cancelled(self):
+        parser = mock.Mock()
+        parser.export_timeline.return_value = ANALYSIS_CANCELLED
+        parser.get_export_progress.return_value = {"cancelled": True, "interrupted": False}
+        with mock.patch(NAMESPACE + '.logging.warning') as warning:
+            ret = _run_with_progress(parser, "Timeline export", parser.export_timeline, "", "")
+        self.assertEqual(ANALYSIS_CANCELLED, ret)
+        warning.assert_called_once()
+        parser.export_timeline.assert_called_once_with("", "")
+
+    def test_run_with_progress_should_raise_keyboard_interrupt_when_interrupted_by_signal(self):
+        parser = mock.Mock()
+        parser.export_timeline.return_value = ANALYSIS_CANCELLED
+        parser.get_export_progress.return_value = {"cancelled": True, "interrupted": True}
+        with mock.patch(NAMESPACE + '.logging.warning'):
+            with self.assertRaises(KeyboardInterrupt):
+                _run_with_progress(parser, "Timeline export", parser.export_timeline, "", "")